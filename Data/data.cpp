@@ -1,4 +1,7 @@
 #include "data.h"
+#include "datanotifier.h"
+#include "recordloader.h"
+#include "metrics/metrics.h"
 
 #include <QDebug>
 #include <QSqlError>
@@ -84,22 +87,22 @@ void Data::setAnswer(const QString &answer)
     _answer = answer;
 }
 
-QString Data::createTime() const
+qint64 Data::createTime() const
 {
     return _createTime;
 }
 
-void Data::setCreateTime(const QString &createTime)
+void Data::setCreateTime(qint64 createTime)
 {
     _createTime = createTime;
 }
 
-QString Data::passLifeTime() const
+qint64 Data::passLifeTime() const
 {
     return _passLifeTime;
 }
 
-void Data::setPassLifeTime(const QString &passLifeTime)
+void Data::setPassLifeTime(qint64 passLifeTime)
 {
     _passLifeTime = passLifeTime;
 }
@@ -149,6 +152,7 @@ bool Data::insert()
     query.bindValue( ":PassLifeTime", passLifeTime() );
     query.bindValue( ":Description", description() );
 
+    Metrics::add( Metrics::QueriesExecuted );
     if( ! query.exec() ){
         qDebug() << query.executedQuery() << "\n----\n"
                  << query.lastQuery();
@@ -156,6 +160,10 @@ bool Data::insert()
                     << "SqlError: " << query.lastError();
         return false;
     }
+    setId( query.lastInsertId().toLongLong() );
+    _storedGroup = group();
+    _storedPassLifeTime = passLifeTime();
+    emit DataNotifier::instance()->recordInserted( id(), group(), passLifeTime() );
     return true;
 }
 
@@ -187,6 +195,7 @@ bool Data::update()
     query.bindValue( ":PassLifeTime", passLifeTime() );
     query.bindValue( ":Description", description() );
 
+    Metrics::add( Metrics::QueriesExecuted );
     if( ! query.exec() ){
         qDebug() << sql;
         qDebug() << query.executedQuery();
@@ -194,6 +203,11 @@ bool Data::update()
                     << "SqlError: " << query.lastError();
         return false;
     }
+    QString oldGroup = _storedGroup;
+    qint64  oldPassLifeTime = _storedPassLifeTime;
+    _storedGroup = group();
+    _storedPassLifeTime = passLifeTime();
+    emit DataNotifier::instance()->recordUpdated( id(), oldGroup, group(), oldPassLifeTime, passLifeTime() );
     return true;
 }
 
@@ -206,45 +220,57 @@ bool Data::save()
     }
 }
 
-bool Data::load(const QString &id)
+bool Data::load(qint64 id)
 {
-    QSqlQuery query;
+    if( ! RecordLoader::load( id, this ) )
+        return false;
 
-    query.prepare( QString("SELECT * FROM %1 WHERE id = :id"
-                           ).arg(DataTable::tableName) );
+    _storedGroup = group();
+    _storedPassLifeTime = passLifeTime();
+    return true;
+}
 
-    query.bindValue( ":id", id );
+/*!
+ * \brief Метод удаляет запись из базы и уведомляет об этом DataNotifier
+ * \param id - идентификатор записи
+ * \return true - если запись удалена
+ */
+bool Data::remove(qint64 id)
+{
+    QSqlQuery query;
 
-    if( ! query.exec() ){
+    query.prepare( QString("SELECT %1, %2 FROM %3 WHERE id = :id"
+                           ).arg( DataTable::Fields::PassGroup,
+                                  DataTable::Fields::PassLifeTime,
+                                  DataTable::tableName ) );
+    query.bindValue( ":id", id );
+    Metrics::add( Metrics::QueriesExecuted );
+    if( ! query.exec() || ! query.first() ){
         qCritical() << "Cannot select Data from database\n"
                     << "SqlError: " << query.lastError();
         return false;
     }
-    query.first();
-
-    setId( query.value( DataTable::Fields::id ).toString() );
-    setAnswer( query.value( DataTable::Fields::Answer ).toString() );
-    setCreateTime( query.value( DataTable::Fields::CreateTime ).toString() );
-    setDescription( query.value( DataTable::Fields::Description ).toString() );
-    setGroup( query.value( DataTable::Fields::PassGroup ).toString() );
-    setLogin( query.value( DataTable::Fields::Login ).toString() );
-    setMail( query.value( DataTable::Fields::Mail ).toString() );
-    setPassLifeTime( query.value( DataTable::Fields::PassLifeTime ).toString() );
-    setPassword( query.value( DataTable::Fields::Password ).toString() );
-    setPhone( query.value( DataTable::Fields::Phone ).toString() );
-    setResource( query.value( DataTable::Fields::Resource ).toString() );
-    setUrl( query.value( DataTable::Fields::Url ).toString() );
-
+    QString group = query.value(0).toString();
+    qint64 passLifeTime = query.value(1).toLongLong();
 
+    query.prepare( QString("DELETE FROM %1 WHERE id = :id").arg(DataTable::tableName) );
+    query.bindValue( ":id", id );
+    Metrics::add( Metrics::QueriesExecuted );
+    if( ! query.exec() ){
+        qCritical() << "Cannot delete Data from database\n"
+                    << "SqlError: " << query.lastError();
+        return false;
+    }
+    emit DataNotifier::instance()->recordRemoved( id, group, passLifeTime );
     return true;
 }
 
-QString Data::id() const
+qint64 Data::id() const
 {
     return _id;
 }
 
-void Data::setId(const QString &id)
+void Data::setId(qint64 id)
 {
     _id = id;
 }
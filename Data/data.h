@@ -25,8 +25,8 @@ namespace DataTable {
 
 class Data
 {
-    bool    _editMode;
-    QString _id;
+    bool    _editMode = false;
+    qint64  _id = 0;
     QString _group;
     QString _resource;
     QString _url;
@@ -35,18 +35,21 @@ class Data
     QString _mail;
     QString _phone;
     QString _answer;
-    QString _createTime;
-    QString _passLifeTime;
+    qint64  _createTime = 0;     ///< мс от начала эпохи
+    qint64  _passLifeTime = 0;   ///< мс от начала эпохи
     QString _description;
+    QString _storedGroup;   ///< Группа записи в базе на момент загрузки/сохранения
+    qint64  _storedPassLifeTime = 0;   ///< Срок пароля в базе на момент загрузки/сохранения
 
     bool insert();
     bool update();
 public:
     bool save();
-    bool load(const QString &id);
+    bool load(qint64 id);
+    static bool remove(qint64 id);
 
-    QString id() const;
-    void setId(const QString &id);
+    qint64 id() const;
+    void setId(qint64 id);
     QString group() const;
     void setGroup(const QString &group);
     QString resource() const;
@@ -63,10 +66,10 @@ public:
     void setPhone(const QString &phone);
     QString answer() const;
     void setAnswer(const QString &answer);
-    QString createTime() const;
-    void setCreateTime(const QString &createTime);
-    QString passLifeTime() const;
-    void setPassLifeTime(const QString &passLifeTime);
+    qint64 createTime() const;
+    void setCreateTime(qint64 createTime);
+    qint64 passLifeTime() const;
+    void setPassLifeTime(qint64 passLifeTime);
     QString description() const;
     void setDescription(const QString &description);
     bool editMode() const;
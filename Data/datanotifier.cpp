@@ -0,0 +1,15 @@
+#include "datanotifier.h"
+
+DataNotifier::DataNotifier() :
+    QObject(0)
+{
+}
+
+/*!
+ * \brief Метод возвращает единственный экземпляр уведомителя
+ */
+DataNotifier *DataNotifier::instance()
+{
+    static DataNotifier notifier;
+    return &notifier;
+}
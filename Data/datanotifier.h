@@ -0,0 +1,30 @@
+#ifndef DATANOTIFIER_H
+#define DATANOTIFIER_H
+
+#include <QObject>
+#include <QString>
+
+/*!
+ * \brief Класс DataNotifier - уведомления об изменении отдельных записей Data
+ *
+ * Сигналы испускаются путём записи Data (save/remove) после успешного
+ * выполнения запроса, так что модели могут обновить одну строку
+ * вместо повторной выборки всей таблицы.
+ * Вместе с группой передаётся срок пароля PassLifeTime (до и после
+ * изменения), чтобы счётчики просроченных паролей менялись без запросов.
+ */
+class DataNotifier : public QObject
+{
+    Q_OBJECT
+private:
+    DataNotifier();
+public:
+    static DataNotifier *instance();
+signals:
+    void recordInserted(qint64 id, const QString &group, qint64 passLifeTime);
+    void recordUpdated(qint64 id, const QString &oldGroup, const QString &group,
+                       qint64 oldPassLifeTime, qint64 passLifeTime);
+    void recordRemoved(qint64 id, const QString &group, qint64 passLifeTime);
+};
+
+#endif // DATANOTIFIER_H
@@ -0,0 +1,173 @@
+#include "recordloader.h"
+#include "recordtable.h"
+#include "data.h"
+#include "metrics/metrics.h"
+#include "trace/trace.h"
+
+#include <QSqlQuery>
+#include <QSqlError>
+#include <QStringList>
+#include <QDebug>
+
+namespace {
+    /// Порядок колонок в запросе загрузчика
+    enum Column {
+        ColumnId = 0,
+        ColumnPassGroup,
+        ColumnResource,
+        ColumnUrl,
+        ColumnLogin,
+        ColumnPassword,
+        ColumnMail,
+        ColumnPhone,
+        ColumnAnswer,
+        ColumnDescription,
+        ColumnCreateTime,
+        ColumnPassLifeTime
+    };
+
+    QString selectSql()
+    {
+        QStringList fields;
+        fields << DataTable::Fields::id
+               << DataTable::Fields::PassGroup
+               << DataTable::Fields::Resource
+               << DataTable::Fields::Url
+               << DataTable::Fields::Login
+               << DataTable::Fields::Password
+               << DataTable::Fields::Mail
+               << DataTable::Fields::Phone
+               << DataTable::Fields::Answer
+               << DataTable::Fields::Description
+               << DataTable::Fields::CreateTime
+               << DataTable::Fields::PassLifeTime;
+        return QString("SELECT %1 FROM %2").arg( fields.join(", "), DataTable::tableName );
+    }
+}
+
+bool RecordLoader::exec(QSqlQuery &query, const QString &group)
+{
+    query.setForwardOnly( true );
+
+    QString sql = selectSql();
+    if( ! group.isNull() )
+        sql += QString(" WHERE %1 = :group").arg( DataTable::Fields::PassGroup );
+    sql += QString(" ORDER BY %1").arg( DataTable::Fields::id );
+
+    query.prepare( sql );
+    if( ! group.isNull() )
+        query.bindValue( ":group", group );
+
+    Metrics::add( Metrics::QueriesExecuted );
+    if( ! query.exec() ){
+        qCritical() << "Cannot load Data from database\n"
+                    << "SqlError: " << query.lastError();
+        return false;
+    }
+    return true;
+}
+
+void RecordLoader::read(const QSqlQuery &query, RecordTable *table)
+{
+    const QString texts[RecordTable::TextFieldCount] = {
+        query.value( ColumnResource ).toString(),
+        query.value( ColumnUrl ).toString(),
+        query.value( ColumnLogin ).toString(),
+        query.value( ColumnPassword ).toString(),
+        query.value( ColumnMail ).toString(),
+        query.value( ColumnPhone ).toString(),
+        query.value( ColumnAnswer ).toString(),
+        query.value( ColumnDescription ).toString()
+    };
+    table->append( query.value( ColumnId ).toLongLong(),
+                   query.value( ColumnPassGroup ).toString(),
+                   texts,
+                   query.value( ColumnCreateTime ).toLongLong(),
+                   query.value( ColumnPassLifeTime ).toLongLong() );
+}
+
+/*!
+ * \brief Метод загружает все записи (или записи группы) в таблицу
+ * \param table - таблица, куда добавляются записи
+ * \param group - группа; если не задана - загружаются все записи
+ * \return true - в случае успеха
+ */
+bool RecordLoader::load(RecordTable *table, const QString &group)
+{
+    QSqlQuery query;
+    if( ! exec( query, group ) )
+        return false;
+
+    while( query.next() ){
+        read( query, table );
+    }
+    return true;
+}
+
+/*!
+ * \brief Метод читает записи порциями и передаёт каждую порцию обработчику
+ * Память порции выделяется один раз и переиспользуется,
+ * так что объём памяти не зависит от размера хранилища
+ * \param handler - обработчик порции; false - прекратить чтение
+ * \param chunkSize - количество записей в порции
+ * \param group - группа; если не задана - читаются все записи
+ * \return true - если прочитаны все записи
+ */
+bool RecordLoader::forEach(const ChunkHandler &handler, int chunkSize, const QString &group)
+{
+    TRACE_SCOPE( "db.load_records" );
+    QSqlQuery query;
+    if( ! exec( query, group ) )
+        return false;
+
+    RecordTable chunk;
+    chunk.reserve( chunkSize );
+    while( query.next() ){
+        read( query, &chunk );
+        if( chunk.size() == chunkSize ){
+            if( ! handler( chunk ) )
+                return false;
+            chunk.clearRows();
+        }
+    }
+    if( ! chunk.isEmpty() )
+        return handler( chunk );
+    return true;
+}
+
+/*!
+ * \brief Метод загружает одну запись по id
+ * \param id - идентификатор записи
+ * \param data - куда загрузить запись
+ * \return true - если запись найдена
+ */
+bool RecordLoader::load(qint64 id, Data *data)
+{
+    QSqlQuery query;
+    query.setForwardOnly( true );
+    query.prepare( selectSql() + QString(" WHERE %1 = :id").arg( DataTable::Fields::id ) );
+    query.bindValue( ":id", id );
+
+    Metrics::add( Metrics::QueriesExecuted );
+    if( ! query.exec() ){
+        qCritical() << "Cannot select Data from database\n"
+                    << "SqlError: " << query.lastError();
+        return false;
+    }
+    if( ! query.next() )
+        return false;
+
+    data->setId( query.value( ColumnId ).toLongLong() );
+    data->setGroup( query.value( ColumnPassGroup ).toString() );
+    data->setResource( query.value( ColumnResource ).toString() );
+    data->setUrl( query.value( ColumnUrl ).toString() );
+    data->setLogin( query.value( ColumnLogin ).toString() );
+    data->setPassword( query.value( ColumnPassword ).toString() );
+    data->setMail( query.value( ColumnMail ).toString() );
+    data->setPhone( query.value( ColumnPhone ).toString() );
+    data->setAnswer( query.value( ColumnAnswer ).toString() );
+    data->setDescription( query.value( ColumnDescription ).toString() );
+    data->setCreateTime( query.value( ColumnCreateTime ).toLongLong() );
+    data->setPassLifeTime( query.value( ColumnPassLifeTime ).toLongLong() );
+    return true;
+}
@@ -0,0 +1,41 @@
+#ifndef RECORDLOADER_H
+#define RECORDLOADER_H
+
+#include <QString>
+
+#include <functional>
+
+class Data;
+class QSqlQuery;
+class RecordTable;
+
+/*!
+ * \brief Класс RecordLoader - пакетная загрузка записей таблицы Data
+ *
+ * Запрос перечисляет колонки явно, поэтому их номера известны заранее
+ * и строка читается по индексам без поиска колонки по имени.
+ * Выборка идёт в режиме setForwardOnly(true), записи складываются
+ * в RecordTable, которая при потоковой загрузке переиспользуется
+ * от порции к порции без новых выделений памяти.
+ */
+class RecordLoader
+{
+private:
+    RecordLoader();
+    ~RecordLoader();
+
+    static bool exec(QSqlQuery &query, const QString &group);
+    static void read(const QSqlQuery &query, RecordTable *table);
+public:
+    static const int DEFAULT_CHUNK_SIZE = 4096;
+
+    typedef std::function<bool(const RecordTable &chunk)> ChunkHandler;
+
+    static bool load(RecordTable *table, const QString &group = QString());
+    static bool forEach(const ChunkHandler &handler,
+                        int chunkSize = DEFAULT_CHUNK_SIZE,
+                        const QString &group = QString());
+    static bool load(qint64 id, Data *data);
+};
+
+#endif // RECORDLOADER_H
@@ -0,0 +1,197 @@
+#include "recordtable.h"
+#include "data.h"
+
+RecordTable::RecordTable()
+{
+}
+
+/*!
+ * \brief Метод заранее резервирует место под count записей
+ * Текстовые буферы резервируются под среднюю длину поля в 16 байт
+ */
+void RecordTable::reserve(int count)
+{
+    _ids.reserve( count );
+    _createTimes.reserve( count );
+    _passLifeTimes.reserve( count );
+    _groupIndexes.reserve( count );
+    for( TextColumn &column : _texts ){
+        column.ends.reserve( count );
+        column.bytes.reserve( count * 16 );
+    }
+}
+
+void RecordTable::clear()
+{
+    _ids.clear();
+    _createTimes.clear();
+    _passLifeTimes.clear();
+    _groupIndexes.clear();
+    _groupNames.clear();
+    _groupLookup.clear();
+    for( TextColumn &column : _texts ){
+        column.bytes.clear();
+        column.ends.clear();
+    }
+}
+
+/*!
+ * \brief Метод удаляет записи, сохраняя выделенную память и таблицу групп
+ * Позволяет переиспользовать таблицу как буфер при потоковой загрузке
+ */
+void RecordTable::clearRows()
+{
+    _ids.resize( 0 );
+    _createTimes.resize( 0 );
+    _passLifeTimes.resize( 0 );
+    _groupIndexes.resize( 0 );
+    for( TextColumn &column : _texts ){
+        column.bytes.resize( 0 );
+        column.ends.resize( 0 );
+    }
+}
+
+/*!
+ * \brief Метод добавляет запись
+ */
+void RecordTable::append(const Data &data)
+{
+    const QString texts[TextFieldCount] = {
+        data.resource(), data.url(), data.login(), data.password(),
+        data.mail(), data.phone(), data.answer(), data.description()
+    };
+    append( data.id(), data.group(), texts, data.createTime(), data.passLifeTime() );
+}
+
+/*!
+ * \brief Метод добавляет запись по полям
+ * \param texts - массив из TextFieldCount значений в порядке TextField
+ */
+void RecordTable::append(qint64 id, const QString &group, const QString *texts,
+                         qint64 createTime, qint64 passLifeTime)
+{
+    _ids.append( id );
+    _createTimes.append( createTime );
+    _passLifeTimes.append( passLifeTime );
+    _groupIndexes.append( internGroup(group) );
+
+    for( int field = 0; field < TextFieldCount; ++field ){
+        TextColumn &column = _texts[field];
+        column.bytes.append( texts[field].toUtf8() );
+        column.ends.append( quint32(column.bytes.size()) );
+    }
+}
+
+int RecordTable::size() const
+{
+    return _ids.size();
+}
+
+bool RecordTable::isEmpty() const
+{
+    return _ids.isEmpty();
+}
+
+qint64 RecordTable::id(int row) const
+{
+    return _ids.at( row );
+}
+
+qint64 RecordTable::createTime(int row) const
+{
+    return _createTimes.at( row );
+}
+
+qint64 RecordTable::passLifeTime(int row) const
+{
+    return _passLifeTimes.at( row );
+}
+
+quint32 RecordTable::groupIndex(int row) const
+{
+    return _groupIndexes.at( row );
+}
+
+const QString &RecordTable::group(int row) const
+{
+    return _groupNames.at( _groupIndexes.at(row) );
+}
+
+/*!
+ * \brief Метод декодирует текстовое поле в QString
+ */
+QString RecordTable::text(int row, TextField field) const
+{
+    const TextColumn &column = _texts[field];
+    quint32 begin = ( row == 0 ) ? 0 : column.ends.at( row - 1 );
+    return QString::fromUtf8( column.bytes.constData() + begin, int(column.ends.at(row) - begin) );
+}
+
+/*!
+ * \brief Метод возвращает текстовое поле в UTF-8 без копирования
+ * Результат ссылается на буфер таблицы и действителен до её изменения
+ */
+QByteArray RecordTable::textUtf8(int row, TextField field) const
+{
+    const TextColumn &column = _texts[field];
+    quint32 begin = ( row == 0 ) ? 0 : column.ends.at( row - 1 );
+    return QByteArray::fromRawData( column.bytes.constData() + begin, int(column.ends.at(row) - begin) );
+}
+
+/*!
+ * \brief Метод собирает запись в объект Data
+ */
+Data RecordTable::record(int row) const
+{
+    Data data;
+    data.setId( id(row) );
+    data.setGroup( group(row) );
+    data.setResource( text(row, Resource) );
+    data.setUrl( text(row, Url) );
+    data.setLogin( text(row, Login) );
+    data.setPassword( text(row, Password) );
+    data.setMail( text(row, Mail) );
+    data.setPhone( text(row, Phone) );
+    data.setAnswer( text(row, Answer) );
+    data.setDescription( text(row, Description) );
+    data.setCreateTime( createTime(row) );
+    data.setPassLifeTime( passLifeTime(row) );
+    return data;
+}
+
+/*!
+ * \brief Метод возвращает интернированные названия групп
+ * Индекс в векторе совпадает с groupIndex()
+ */
+const QVector<QString> &RecordTable::groups() const
+{
+    return _groupNames;
+}
+
+/*!
+ * \brief Метод оценивает объём памяти под данные таблицы в байтах
+ */
+qint64 RecordTable::memoryUsage() const
+{
+    qint64 bytes = qint64(_ids.capacity() + _createTimes.capacity() + _passLifeTimes.capacity()) * sizeof(qint64)
+                 + qint64(_groupIndexes.capacity()) * sizeof(quint32);
+    for( const QString &name : _groupNames ){
+        bytes += name.capacity() * sizeof(QChar);
+    }
+    for( const TextColumn &column : _texts ){
+        bytes += column.bytes.capacity() + qint64(column.ends.capacity()) * sizeof(quint32);
+    }
+    return bytes;
+}
+
+quint32 RecordTable::internGroup(const QString &group)
+{
+    QHash<QString, quint32>::const_iterator it = _groupLookup.constFind( group );
+    if( it != _groupLookup.constEnd() )
+        return it.value();
+
+    quint32 index = quint32( _groupNames.size() );
+    _groupNames.append( group );
+    _groupLookup.insert( group, index );
+    return index;
+}
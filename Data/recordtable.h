@@ -0,0 +1,80 @@
+#ifndef RECORDTABLE_H
+#define RECORDTABLE_H
+
+#include <QByteArray>
+#include <QHash>
+#include <QString>
+#include <QVector>
+
+class Data;
+
+/*!
+ * \brief Класс RecordTable - компактное поколоночное хранилище множества записей
+ *
+ * Вместо вектора Data с двенадцатью QString на запись:
+ * - id, CreateTime и PassLifeTime лежат в колонках qint64;
+ * - группа хранится индексом в таблице интернированных названий;
+ * - текстовые поля лежат в UTF-8 подряд в отдельном буфере на каждое поле,
+ *   конец каждого значения задаётся смещением.
+ * Для латиницы это вдвое меньше UTF-16 и без накладных расходов
+ * на заголовок строки, а сравнение дат - сравнение целых.
+ * Предназначен для пакетной загрузки, поиска и экспорта; записи
+ * только добавляются, изменение отдельных строк не поддерживается.
+ */
+class RecordTable
+{
+public:
+    enum TextField {
+        Resource = 0,
+        Url,
+        Login,
+        Password,
+        Mail,
+        Phone,
+        Answer,
+        Description,
+        TextFieldCount
+    };
+
+    RecordTable();
+
+    void reserve(int count);
+    void clear();
+    void clearRows();
+    void append(const Data &data);
+    void append(qint64 id, const QString &group, const QString *texts,
+                qint64 createTime, qint64 passLifeTime);
+
+    int size() const;
+    bool isEmpty() const;
+
+    qint64 id(int row) const;
+    qint64 createTime(int row) const;
+    qint64 passLifeTime(int row) const;
+    quint32 groupIndex(int row) const;
+    const QString &group(int row) const;
+    QString text(int row, TextField field) const;
+    QByteArray textUtf8(int row, TextField field) const;
+    Data record(int row) const;
+
+    const QVector<QString> &groups() const;
+    qint64 memoryUsage() const;
+
+private:
+    struct TextColumn {
+        QByteArray        bytes;
+        QVector<quint32>  ends;     ///< Конец значения строки i в bytes
+    };
+
+    QVector<qint64>         _ids;
+    QVector<qint64>         _createTimes;
+    QVector<qint64>         _passLifeTimes;
+    QVector<quint32>        _groupIndexes;
+    QVector<QString>        _groupNames;
+    QHash<QString, quint32> _groupLookup;
+    TextColumn              _texts[TextFieldCount];
+
+    quint32 internGroup(const QString &group);
+};
+
+#endif // RECORDTABLE_H
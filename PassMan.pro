@@ -4,55 +4,41 @@
 #
 #-------------------------------------------------
 
-QT       += core gui sql
+QT       += core gui sql concurrent
 
 greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
 
 TARGET = PasswordManager
 TEMPLATE = app
 
-CONFIG += c++11
-
-#openssl
-win32 {
-    INCLUDEPATH += c:/OpenSSL-Win32/include
-    LIBS += -Lc:/OpenSSL-Win32/bin -llibeay32
-}
-
-linux|macx {
-    LIBS += -lcrypto
-}
-
+include(core.pri)
 
 SOURCES += main.cpp\
         mainwindow.cpp \
-    cryptfiledevice.cpp \
-    db/querysmanager.cpp \
-    db/connectionmanager.cpp \
-    definespath.cpp \
-    passwordgenerator.cpp \
-    Data/data.cpp \
-    dbfileprocessing.cpp \
     recentdocuments.cpp \
     aboutdialog.cpp \
-    helpdialog.cpp
+    helpdialog.cpp \
+    diagnosticsdialog.cpp \
+    auditdialog.cpp \
+    models/recordtablemodel.cpp \
+    models/grouplistmodel.cpp \
+    models/auditmodel.cpp
 
 HEADERS  += mainwindow.h \
-    cryptfiledevice.h \
-    db/querysmanager.h \
-    db/connectionmanager.h \
-    definespath.h \
-    globalenum.h \
-    passwordgenerator.h \
-    Data/data.h \
-    dbfileprocessing.h \
     recentdocuments.h \
     aboutdialog.h \
-    helpdialog.h
+    helpdialog.h \
+    diagnosticsdialog.h \
+    auditdialog.h \
+    models/recordtablemodel.h \
+    models/grouplistmodel.h \
+    models/auditmodel.h
 
 FORMS    += mainwindow.ui \
     aboutdialog.ui \
-    helpdialog.ui
+    helpdialog.ui \
+    diagnosticsdialog.ui \
+    auditdialog.ui
 
 RESOURCES += \
     resources.qrc
@@ -0,0 +1,224 @@
+#include "audit/vaultaudit.h"
+#include "breach/breachindex.h"
+#include "strength/passwordstrength.h"
+#include "metrics/metrics.h"
+#include "trace/trace.h"
+
+#include <QDateTime>
+#include <QStringList>
+#include <QtConcurrent/QtConcurrentMap>
+#include <QtConcurrent/QtConcurrentRun>
+
+namespace {
+    const qint64 MSECS_PER_DAY = 24LL * 60 * 60 * 1000;
+}
+
+VaultAudit::VaultAudit(QObject *parent) :
+    QObject(parent)
+{
+    connect( &_prepare, SIGNAL(finished()), this, SLOT(prepared()) );
+    connect( &_chunks, SIGNAL(resultReadyAt(int)), this, SLOT(chunkReady(int)) );
+    connect( &_chunks, SIGNAL(finished()), this, SLOT(chunksFinished()) );
+}
+
+/*!
+ * \brief Деструктор дожидается рабочих потоков: они читают Options::breachIndex
+ */
+VaultAudit::~VaultAudit()
+{
+    cancel();
+    waitForFinished();
+}
+
+/*!
+ * \brief Метод запускает проверку в пуле потоков и сразу возвращается
+ * Таблица копируется (данные общие до изменения), так что её можно
+ * освободить сразу после вызова. Идущая проверка сначала отменяется.
+ */
+void VaultAudit::start(const RecordTable &records, const Options &options)
+{
+    cancel();
+    waitForFinished();
+
+    _cancelled = false;
+    _total     = records.size();
+    _done      = 0;
+    _timer.start();
+    _prepare.setFuture( QtConcurrent::run(&VaultAudit::prepare, records, options) );
+}
+
+void VaultAudit::cancel()
+{
+    _cancelled = true;
+    _chunks.cancel();
+}
+
+/*!
+ * \brief Метод дожидается рабочих потоков, например после cancel()
+ * После возврата Options::breachIndex больше не читается
+ */
+void VaultAudit::waitForFinished()
+{
+    _prepare.waitForFinished();
+    _chunks.waitForFinished();
+}
+
+bool VaultAudit::isRunning() const
+{
+    return _prepare.isRunning() || _chunks.isRunning();
+}
+
+/*!
+ * \brief Метод проверяет записи и ждёт результата
+ * \return Найденное в порядке строк таблицы
+ */
+QVector<VaultAudit::Finding> VaultAudit::run(const RecordTable &records, const Options &options)
+{
+    ScopedLatency latency( Metrics::Audit );
+
+    const QVector< QVector<Finding> > chunks =
+            QtConcurrent::blockingMapped< QVector< QVector<Finding> > >( split(prepare(records, options)), auditChunk );
+
+    QVector<Finding> findings;
+    for( const QVector<Finding> &chunk : chunks )
+        findings += chunk;
+    return findings;
+}
+
+/*!
+ * \brief Метод возвращает названия проблем через запятую
+ */
+QString VaultAudit::issueNames(int issues)
+{
+    QStringList names;
+    if( issues & Weak )
+        names << tr("weak");
+    if( issues & Reused )
+        names << tr("reused");
+    if( issues & Breached )
+        names << tr("breached");
+    if( issues & Expired )
+        names << tr("expired");
+    if( issues & Expiring )
+        names << tr("expiring");
+    if( issues & Old )
+        names << tr("old");
+    return names.join( ", " );
+}
+
+void VaultAudit::prepared()
+{
+    if( _cancelled )
+        return;
+
+    const QVector<Chunk> chunks = split( _prepare.result() );
+    emit progress( 0, _total );
+    _chunks.setFuture( QtConcurrent::mapped(chunks, auditChunk) );
+}
+
+void VaultAudit::chunkReady(int index)
+{
+    const QVector<Finding> findings = _chunks.resultAt( index );
+    _done = qMin( _done + CHUNK_SIZE, _total );
+
+    if( ! findings.isEmpty() )
+        emit found( findings );
+    emit progress( _done, _total );
+}
+
+void VaultAudit::chunksFinished()
+{
+    if( _chunks.isCanceled() )
+        return;
+
+    Metrics::record( Metrics::Audit, _timer.nsecsElapsed() );
+    emit finished( _total, _timer.elapsed() );
+}
+
+/*!
+ * \brief Метод считает, в скольких записях встречается каждый пароль
+ * Пустые пароли не считаются.
+ */
+VaultAudit::ContextPointer VaultAudit::prepare(const RecordTable &records, const Options &options)
+{
+    TRACE_SCOPE( "audit.prepare" );
+
+    QSharedPointer<Context> context( new Context );
+    context->records = records;
+    context->options = options;
+    if( context->options.now == 0 )
+        context->options.now = QDateTime::currentMSecsSinceEpoch();
+
+    context->uses.reserve( records.size() );
+    for( int row = 0; row < records.size(); ++row ){
+        const QByteArray password = records.textUtf8( row, RecordTable::Password );
+        if( ! password.isEmpty() )
+            ++context->uses[password];
+    }
+    return context;
+}
+
+QVector<VaultAudit::Chunk> VaultAudit::split(const ContextPointer &context)
+{
+    QVector<Chunk> chunks;
+    const int size = context->records.size();
+    for( int begin = 0; begin < size; begin += CHUNK_SIZE ){
+        Chunk chunk;
+        chunk.context = context;
+        chunk.begin   = begin;
+        chunk.end     = qMin( begin + CHUNK_SIZE, size );
+        chunks.append( chunk );
+    }
+    return chunks;
+}
+
+/*!
+ * \brief Метод проверяет строки порции [begin, end)
+ * Вызывается из пула потоков, читает только общий неизменяемый контекст
+ */
+QVector<VaultAudit::Finding> VaultAudit::auditChunk(const Chunk &chunk)
+{
+    TRACE_SCOPE( "audit.chunk" );
+
+    const RecordTable &records = chunk.context->records;
+    const Options     &options = chunk.context->options;
+    const qint64 expiringBefore = options.now + options.expiringDays * MSECS_PER_DAY;
+    const qint64 oldBefore      = options.now - options.maxAgeDays * MSECS_PER_DAY;
+
+    QVector<Finding> findings;
+    for( int row = chunk.begin; row < chunk.end; ++row ){
+        Finding finding;
+        finding.row = row;
+        finding.id  = records.id( row );
+
+        const QByteArray password = records.textUtf8( row, RecordTable::Password );
+        if( password.isEmpty() ){
+            finding.issues |= Weak;
+        } else {
+            finding.score = PasswordStrength::estimate( QString::fromUtf8(password) ).score;
+            if( finding.score < options.weakScore )
+                finding.issues |= Weak;
+
+            finding.reuseCount = chunk.context->uses.value( password, 1 );
+            if( finding.reuseCount > 1 )
+                finding.issues |= Reused;
+
+            if( options.breachIndex && options.breachIndex->containsPassword(password) )
+                finding.issues |= Breached;
+        }
+
+        const qint64 passLifeTime = records.passLifeTime( row );
+        if( passLifeTime > 0 && passLifeTime <= options.now )
+            finding.issues |= Expired;
+        else if( passLifeTime > 0 && passLifeTime <= expiringBefore )
+            finding.issues |= Expiring;
+
+        const qint64 createTime = records.createTime( row );
+        if( options.maxAgeDays > 0 && createTime > 0 && createTime < oldBefore )
+            finding.issues |= Old;
+
+        if( finding.issues )
+            findings.append( finding );
+    }
+    return findings;
+}
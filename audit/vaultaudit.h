@@ -0,0 +1,106 @@
+#ifndef VAULTAUDIT_H
+#define VAULTAUDIT_H
+
+#include "Data/recordtable.h"
+
+#include <QElapsedTimer>
+#include <QFutureWatcher>
+#include <QHash>
+#include <QObject>
+#include <QSharedPointer>
+#include <QVector>
+
+class BreachIndex;
+
+/*!
+ * \brief Класс VaultAudit - проверка паролей всего хранилища
+ *
+ * Для каждой записи RecordTable ищутся проблемы Issue: слабый пароль
+ * (PasswordStrength), один пароль в нескольких записях, истёкший или скоро
+ * истекающий срок PassLifeTime, старая запись по CreateTime и, если задан
+ * индекс, пароль из списка утёкших.
+ * Повторы считаются одним проходом по хэш-таблице паролей, затем записи
+ * делятся на порции по CHUNK_SIZE и проверяются через QtConcurrent на всех
+ * ядрах. start() не блокирует вызывающий поток: найденное приходит
+ * сигналом found() по мере готовности порций, в конце - finished().
+ * run() - то же синхронно, для passman-cli и замеров.
+ */
+class VaultAudit : public QObject
+{
+    Q_OBJECT
+public:
+    enum Issue {
+        Weak     = 1,
+        Reused   = 2,
+        Expired  = 4,
+        Expiring = 8,
+        Old      = 16,
+        Breached = 32
+    };
+
+    struct Options {
+        int    weakScore    = 2;    ///< Пароль с оценкой ниже - слабый
+        int    expiringDays = 14;   ///< Срок истекает в ближайшие дни
+        int    maxAgeDays   = 365;  ///< Запись старше - старая, 0 - не проверять
+        qint64 now          = 0;    ///< Момент проверки (мс), 0 - текущее время
+        const BreachIndex *breachIndex = nullptr;   ///< Должен жить до конца проверки
+    };
+
+    struct Finding {
+        int    row        = 0;      ///< Строка в RecordTable
+        qint64 id         = 0;
+        int    issues     = 0;      ///< Сочетание Issue
+        int    score      = 0;      ///< Оценка PasswordStrength 0..4
+        int    reuseCount = 1;      ///< Число записей с этим паролем
+    };
+
+    static const int CHUNK_SIZE = 2048;
+
+    explicit VaultAudit(QObject *parent = 0);
+    ~VaultAudit();
+
+    void start(const RecordTable &records, const Options &options);
+    void cancel();
+    void waitForFinished();
+    bool isRunning() const;
+
+    static QVector<Finding> run(const RecordTable &records, const Options &options);
+    static QString issueNames(int issues);
+
+signals:
+    void found(const QVector<VaultAudit::Finding> &findings);
+    void progress(int done, int total);
+    void finished(int records, qint64 msecs);
+
+private slots:
+    void prepared();
+    void chunkReady(int index);
+    void chunksFinished();
+
+private:
+    struct Context {
+        RecordTable             records;
+        Options                 options;
+        QHash<QByteArray, int>  uses;       ///< Пароль (UTF-8) - число записей
+    };
+    typedef QSharedPointer<const Context> ContextPointer;
+
+    struct Chunk {
+        ContextPointer context;
+        int            begin = 0;
+        int            end   = 0;
+    };
+
+    QFutureWatcher<ContextPointer>      _prepare;
+    QFutureWatcher< QVector<Finding> >  _chunks;
+    QElapsedTimer                       _timer;
+    int                                 _total     = 0;
+    int                                 _done      = 0;
+    bool                                _cancelled = false;
+
+    static ContextPointer prepare(const RecordTable &records, const Options &options);
+    static QVector<Chunk> split(const ContextPointer &context);
+    static QVector<Finding> auditChunk(const Chunk &chunk);
+};
+
+#endif // VAULTAUDIT_H
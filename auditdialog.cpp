@@ -0,0 +1,161 @@
+#include "auditdialog.h"
+#include "ui_auditdialog.h"
+#include "Data/recordloader.h"
+#include "breach/breachindex.h"
+
+#include <QMessageBox>
+#include <QRegExp>
+#include <QSettings>
+
+namespace {
+    const QString MAX_AGE_OPTION("Audit/MaxAgeDays");
+    const QString EXPIRING_OPTION("Audit/ExpiringDays");
+
+    /// Проблемы в порядке пунктов ComboBox_Filter после "All"
+    const VaultAudit::Issue ISSUES[] = {
+        VaultAudit::Weak,
+        VaultAudit::Reused,
+        VaultAudit::Breached,
+        VaultAudit::Expired,
+        VaultAudit::Expiring,
+        VaultAudit::Old
+    };
+    const int ISSUE_COUNT = sizeof(ISSUES) / sizeof(ISSUES[0]);
+}
+
+AuditDialog::AuditDialog(const BreachIndex *breachIndex, QWidget *parent) :
+    QDialog(parent),
+    ui(new Ui::AuditDialog),
+    _breachIndex(breachIndex)
+{
+    ui->setupUi(this);
+
+    QSettings cfg;
+    VaultAudit::Options defaults;
+    ui->SpinBox_MaxAge->setValue( cfg.value(MAX_AGE_OPTION, defaults.maxAgeDays).toInt() );
+    ui->SpinBox_Expiring->setValue( cfg.value(EXPIRING_OPTION, defaults.expiringDays).toInt() );
+
+    _proxy.setSourceModel( &_model );
+    _proxy.setFilterKeyColumn( AuditModel::ColumnIssues );
+    ui->TableView_Findings->setModel( &_proxy );
+
+    connect( &_audit, SIGNAL(found(QVector<VaultAudit::Finding>)), this, SLOT(addFindings(QVector<VaultAudit::Finding>)) );
+    connect( &_audit, SIGNAL(progress(int,int)), this, SLOT(showProgress(int,int)) );
+    connect( &_audit, SIGNAL(finished(int,qint64)), this, SLOT(auditFinished(int,qint64)) );
+
+    on_PushButton_Run_clicked();
+}
+
+AuditDialog::~AuditDialog()
+{
+    QSettings cfg;
+    cfg.setValue( MAX_AGE_OPTION, ui->SpinBox_MaxAge->value() );
+    cfg.setValue( EXPIRING_OPTION, ui->SpinBox_Expiring->value() );
+    delete ui;
+}
+
+/*!
+ * \brief Метод останавливает проверку и дожидается рабочих потоков
+ * Нужен перед закрытием или сменой индекса утёкших паролей
+ */
+void AuditDialog::stopAudit()
+{
+    if( ! _audit.isRunning() )
+        return;
+
+    _audit.cancel();
+    _audit.waitForFinished();
+    ui->Label_Summary->setText( tr("Check stopped") );
+}
+
+/*!
+ * \brief Обработчик запуска проверки
+ * Записи читаются из базы здесь, сама проверка идёт в пуле потоков
+ */
+void AuditDialog::on_PushButton_Run_clicked()
+{
+    RecordTable records;
+    if( ! RecordLoader::load(&records) ){
+        QMessageBox::warning( this, tr("Password audit"), tr("Cannot read records") );
+        return;
+    }
+
+    VaultAudit::Options options;
+    options.maxAgeDays   = ui->SpinBox_MaxAge->value();
+    options.expiringDays = ui->SpinBox_Expiring->value();
+    if( _breachIndex && _breachIndex->isOpen() )
+        options.breachIndex = _breachIndex;
+
+    for( int &count : _issueCounts )
+        count = 0;
+    _model.reset( records );
+    ui->ProgressBar_Audit->setRange( 0, qMax(records.size(), 1) );
+    ui->ProgressBar_Audit->setValue( 0 );
+    ui->Label_Summary->setText( tr("Checking %1 records...").arg(records.size()) );
+
+    _audit.start( records, options );
+}
+
+void AuditDialog::addFindings(const QVector<VaultAudit::Finding> &findings)
+{
+    for( const VaultAudit::Finding &finding : findings )
+        for( int i = 0; i < ISSUE_COUNT; ++i )
+            if( finding.issues & ISSUES[i] )
+                ++_issueCounts[i];
+
+    _model.append( findings );
+}
+
+void AuditDialog::showProgress(int done, int total)
+{
+    ui->ProgressBar_Audit->setMaximum( qMax(total, 1) );
+    ui->ProgressBar_Audit->setValue( done );
+}
+
+void AuditDialog::auditFinished(int records, qint64 msecs)
+{
+    showSummary();
+    ui->Label_Summary->setText( ui->Label_Summary->text()
+                                + tr(" (%1 records in %2 ms)").arg(records).arg(msecs) );
+}
+
+/*!
+ * \brief Метод показывает число записей с каждой проблемой
+ */
+void AuditDialog::showSummary()
+{
+    QStringList parts;
+    for( int i = 0; i < ISSUE_COUNT; ++i )
+        parts << QString("%1: %2").arg( VaultAudit::issueNames(ISSUES[i]) ).arg( _issueCounts[i] );
+
+    ui->Label_Summary->setText( parts.join("; ") );
+}
+
+/*!
+ * \brief Обработчик фильтра по проблеме, 0 - все найденные записи
+ */
+void AuditDialog::on_ComboBox_Filter_currentIndexChanged(int index)
+{
+    if( index <= 0 || index > ISSUE_COUNT )
+        _proxy.setFilterRegExp( QRegExp() );
+    else
+        _proxy.setFilterRegExp( QRegExp("\\b" + VaultAudit::issueNames(ISSUES[index - 1]) + "\\b") );
+}
+
+/*!
+ * \brief Обработчик кнопки показа записей из таблицы (с учётом фильтра) в главном окне
+ */
+void AuditDialog::on_PushButton_Show_clicked()
+{
+    QVector<qint64> ids;
+    ids.reserve( _proxy.rowCount() );
+    for( int row = 0; row < _proxy.rowCount(); ++row )
+        ids.append( _model.recordId(_proxy.mapToSource(_proxy.index(row, 0)).row()) );
+
+    emit showRecords( ids );
+}
+
+void AuditDialog::on_TableView_Findings_activated(const QModelIndex &index)
+{
+    emit showRecords( QVector<qint64>() << _model.recordId(_proxy.mapToSource(index).row()) );
+}
@@ -0,0 +1,52 @@
+#ifndef AUDITDIALOG_H
+#define AUDITDIALOG_H
+
+#include "audit/vaultaudit.h"
+#include "models/auditmodel.h"
+
+#include <QDialog>
+#include <QSortFilterProxyModel>
+
+namespace Ui {
+    class AuditDialog;
+}
+
+/*!
+ * \brief Класс AuditDialog - окно проверки паролей всего хранилища
+ * Проверка идёт в пуле потоков (VaultAudit), результаты появляются
+ * в таблице по мере готовности; окно можно закрыть в любой момент.
+ */
+class AuditDialog : public QDialog
+{
+    Q_OBJECT
+
+public:
+    explicit AuditDialog(const BreachIndex *breachIndex, QWidget *parent = 0);
+    ~AuditDialog();
+
+    void stopAudit();
+
+signals:
+    void showRecords(const QVector<qint64> &ids);
+
+private slots:
+    void addFindings(const QVector<VaultAudit::Finding> &findings);
+    void showProgress(int done, int total);
+    void auditFinished(int records, qint64 msecs);
+    void on_PushButton_Run_clicked();
+    void on_PushButton_Show_clicked();
+    void on_ComboBox_Filter_currentIndexChanged(int index);
+    void on_TableView_Findings_activated(const QModelIndex &index);
+
+private:
+    Ui::AuditDialog       *ui;
+    const BreachIndex     *_breachIndex;
+    VaultAudit             _audit;
+    AuditModel             _model;
+    QSortFilterProxyModel  _proxy;
+    int                    _issueCounts[6];
+
+    void showSummary();
+};
+
+#endif // AUDITDIALOG_H
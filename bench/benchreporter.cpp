@@ -0,0 +1,62 @@
+#include "benchreporter.h"
+
+#include <QJsonDocument>
+
+BenchReporter::BenchReporter(const QString &filter) :
+    _out(stdout),
+    _filter(filter)
+{
+}
+
+/*!
+ * \brief Метод проверяет, выбран ли замер фильтром --filter
+ */
+bool BenchReporter::isSelected(const QString &name) const
+{
+    return _filter.pattern().isEmpty() || _filter.match(name).hasMatch();
+}
+
+bool BenchReporter::isAnySelected(const QStringList &names) const
+{
+    for( const QString &name : names ){
+        if( isSelected(name) )
+            return true;
+    }
+    return false;
+}
+
+void BenchReporter::meta(const QJsonObject &info)
+{
+    QJsonObject line;
+    line.insert( "meta", info );
+    _out << QJsonDocument(line).toJson(QJsonDocument::Compact) << '\n';
+    _out.flush();
+}
+
+/*!
+ * \brief Метод выводит результат замера
+ * \param iterations - число операций
+ * \param nsecs - общее время в наносекундах
+ * \param bytes - объём обработанных данных, 0 - пропускная способность не выводится
+ */
+void BenchReporter::report(const QString &name, const QJsonObject &params,
+                           qint64 iterations, qint64 nsecs, qint64 bytes)
+{
+    if( ! isSelected(name) )
+        return;
+
+    const double seconds = nsecs / 1e9;
+
+    QJsonObject line;
+    line.insert( "name", name );
+    line.insert( "params", params );
+    line.insert( "iterations", iterations );
+    line.insert( "ns", nsecs );
+    line.insert( "ns_per_op", iterations > 0 ? double(nsecs) / iterations : 0.0 );
+    line.insert( "ops_per_s", seconds > 0 ? iterations / seconds : 0.0 );
+    if( bytes > 0 )
+        line.insert( "mb_per_s", seconds > 0 ? bytes / (1024.0 * 1024.0) / seconds : 0.0 );
+
+    _out << QJsonDocument(line).toJson(QJsonDocument::Compact) << '\n';
+    _out.flush();
+}
@@ -0,0 +1,33 @@
+#ifndef BENCHREPORTER_H
+#define BENCHREPORTER_H
+
+#include <QElapsedTimer>
+#include <QJsonObject>
+#include <QRegularExpression>
+#include <QStringList>
+#include <QTextStream>
+
+/*!
+ * \brief Класс BenchReporter - отбор и вывод результатов замеров
+ *
+ * Каждый результат - одна строка JSON (JSON Lines) в stdout:
+ * {"name", "params", "iterations", "ns", "ns_per_op", "ops_per_s", "mb_per_s"}.
+ * Первой строкой выводится {"meta": ...} с описанием окружения,
+ * чтобы прогоны можно было сравнивать между собой.
+ */
+class BenchReporter
+{
+private:
+    QTextStream        _out;
+    QRegularExpression _filter;
+public:
+    explicit BenchReporter(const QString &filter = QString());
+
+    bool isSelected(const QString &name) const;
+    bool isAnySelected(const QStringList &names) const;
+    void meta(const QJsonObject &info);
+    void report(const QString &name, const QJsonObject &params,
+                qint64 iterations, qint64 nsecs, qint64 bytes = 0);
+};
+
+#endif // BENCHREPORTER_H
@@ -0,0 +1,503 @@
+#include "benchsuites.h"
+#include "benchreporter.h"
+#include "dbfileprocessing.h"
+#include "db/connectionmanager.h"
+#include "db/querysmanager.h"
+#include "Data/data.h"
+#include "Data/recordtable.h"
+#include "Data/recordloader.h"
+#include "search/searchengine.h"
+#include "passwordgenerator.h"
+#include "passwordpolicy.h"
+#include "strength/passwordstrength.h"
+#include "audit/vaultaudit.h"
+
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QJsonObject>
+#include <QSqlDatabase>
+#include <QThread>
+#include <QDebug>
+
+#include <random>
+
+const QByteArray BenchSuites::PASSWORD("bench-password-hash");
+const QByteArray BenchSuites::SALT("bench-salt");
+
+namespace {
+    const qint64 CHUNK_SIZES[] = { 4 * 1024, 64 * 1024, 1024 * 1024 };
+    const CryptFileDevice::AesKeyLength KEY_LENGTHS[] = {
+        CryptFileDevice::kAesKeyLength128,
+        CryptFileDevice::kAesKeyLength192,
+        CryptFileDevice::kAesKeyLength256
+    };
+    const int SEEK_READS      = 10000;
+    const int SEEK_READ_SIZE  = 4096;
+    const int SEARCH_REPEATS  = 200;
+    const char *SEARCH_TERMS[] = { "site17", "example", "user-42", "descr", "gruop" };
+    const int PASSWORD_LENGTHS[] = { 12, 32, 128 };
+    const int PASSWORD_COUNT     = 100000;
+    const int POLICY_LENGTH      = 16;
+    const char *POLICY_RULES[] = { "U,l,d,s", "U4-4,l4-4,d4-4,s4-4", "U-2,l1-3,d8,s1-1" };
+    const int STRENGTH_REPEATS   = 10000;
+    const char *STRENGTH_SAMPLES[] = { "password1", "P@ssw0rd!", "qwertyuiop", "correcthorsebatterystaple",
+                                      "Tr0ub4dour&3", "19.04.1987", "zxcvbnm123456789" };
+}
+
+QByteArray BenchSuites::randomBytes(qint64 size, quint32 seed)
+{
+    std::mt19937 generator( seed );
+    QByteArray bytes( int(size), Qt::Uninitialized );
+    quint32 *words = reinterpret_cast<quint32*>( bytes.data() );
+    for( qint64 i = 0; i < size / qint64(sizeof(quint32)); ++i )
+        words[i] = generator();
+    return bytes;
+}
+
+/*!
+ * \brief Метод создаёт открытый файл заданного размера из случайных данных
+ */
+bool BenchSuites::writeFile(const QString &fileName, qint64 size, quint32 seed)
+{
+    QFile file( fileName );
+    if( ! file.open(QIODevice::WriteOnly | QIODevice::Truncate) )
+        return false;
+
+    const qint64 blockSize = 1024 * 1024;
+    const QByteArray block = randomBytes( blockSize, seed );
+    for( qint64 written = 0; written < size; written += blockSize ){
+        if( file.write(block.constData(), qMin(blockSize, size - written)) < 0 )
+            return false;
+    }
+    return true;
+}
+
+Data BenchSuites::record(int index, quint32 seed)
+{
+    std::mt19937 generator( seed + index );
+    const QString number = QString::number( index );
+
+    Data data;
+    data.setGroup( "Group " + QString::number(index % 20) );
+    data.setResource( "site" + number );
+    data.setUrl( "https://site" + number + ".example.com/login" );
+    data.setLogin( "user-" + number );
+    data.setPassword( QString::fromLatin1(randomBytes(12, generator()).toBase64()) );
+    data.setMail( "user-" + number + "@example.com" );
+    data.setPhone( QString::number(generator()) );
+    data.setAnswer( "answer " + number );
+    data.setCreateTime( 1500000000000LL + index );
+    data.setPassLifeTime( 1500000000000LL + index + 2592000000LL );
+    data.setDescription( "description of record " + number );
+    return data;
+}
+
+int BenchSuites::keyBits(CryptFileDevice::AesKeyLength keyLength)
+{
+    switch( keyLength ){
+    case CryptFileDevice::kAesKeyLength128: return 128;
+    case CryptFileDevice::kAesKeyLength192: return 192;
+    default:                                return 256;
+    }
+}
+
+/*!
+ * \brief Набор crypt: пропускная способность CryptFileDevice на запись и чтение
+ * по длинам ключа и размерам блока
+ */
+void BenchSuites::crypt(BenchReporter &reporter, const BenchOptions &options)
+{
+    if( ! reporter.isAnySelected(QStringList() << "crypt.write" << "crypt.read") )
+        return;
+
+    const QString fileName = options.dir + QDir::separator() + "bench-crypt";
+    const QByteArray data = randomBytes( CHUNK_SIZES[2], options.seed );
+
+    for( CryptFileDevice::AesKeyLength keyLength : KEY_LENGTHS ){
+        for( qint64 chunkSize : CHUNK_SIZES ){
+            QJsonObject params;
+            params.insert( "key_bits", keyBits(keyLength) );
+            params.insert( "chunk", chunkSize );
+            params.insert( "bytes", options.dataSize );
+
+            QFile::remove( fileName );
+            QElapsedTimer timer;
+            qint64 chunks = 0;
+            {
+                CryptFileDevice device( fileName, PASSWORD, SALT );
+                device.setKeyLength( keyLength );
+                if( ! device.open(QIODevice::WriteOnly) ){
+                    qCritical() << "crypt: cannot open" << fileName;
+                    return;
+                }
+                timer.start();
+                for( qint64 written = 0; written < options.dataSize; written += chunkSize, ++chunks )
+                    device.write( data.constData(), chunkSize );
+                device.close();
+            }
+            reporter.report( "crypt.write", params, chunks, timer.nsecsElapsed(), chunks * chunkSize );
+
+            chunks = 0;
+            {
+                CryptFileDevice device( fileName, PASSWORD, SALT );
+                device.setKeyLength( keyLength );
+                if( ! device.open(QIODevice::ReadOnly) ){
+                    qCritical() << "crypt: cannot open" << fileName;
+                    return;
+                }
+                QByteArray buffer( int(chunkSize), Qt::Uninitialized );
+                timer.start();
+                while( device.read(buffer.data(), chunkSize) > 0 )
+                    ++chunks;
+                device.close();
+            }
+            reporter.report( "crypt.read", params, chunks, timer.nsecsElapsed(), chunks * chunkSize );
+        }
+    }
+    QFile::remove( fileName );
+}
+
+/*!
+ * \brief Набор seek: произвольный доступ seek() + read() блоками по 4 КиБ
+ */
+void BenchSuites::seek(BenchReporter &reporter, const BenchOptions &options)
+{
+    if( ! reporter.isSelected("crypt.seek_read") )
+        return;
+
+    const QString fileName = options.dir + QDir::separator() + "bench-seek";
+    QFile::remove( fileName );
+    {
+        CryptFileDevice device( fileName, PASSWORD, SALT );
+        if( ! device.open(QIODevice::WriteOnly) )
+            return;
+        const QByteArray data = randomBytes( 1024 * 1024, options.seed );
+        for( qint64 written = 0; written < options.dataSize; written += data.size() )
+            device.write( data );
+    }
+
+    CryptFileDevice device( fileName, PASSWORD, SALT );
+    if( ! device.open(QIODevice::ReadOnly) )
+        return;
+
+    std::mt19937_64 generator( options.seed );
+    std::uniform_int_distribution<qint64> offsets( 0, options.dataSize - SEEK_READ_SIZE );
+    QByteArray buffer( SEEK_READ_SIZE, Qt::Uninitialized );
+
+    QElapsedTimer timer;
+    timer.start();
+    for( int i = 0; i < SEEK_READS; ++i ){
+        device.seek( offsets(generator) );
+        device.read( buffer.data(), SEEK_READ_SIZE );
+    }
+    qint64 elapsed = timer.nsecsElapsed();
+    device.close();
+
+    QJsonObject params;
+    params.insert( "read", SEEK_READ_SIZE );
+    params.insert( "file_bytes", options.dataSize );
+    reporter.report( "crypt.seek_read", params, SEEK_READS, elapsed, qint64(SEEK_READS) * SEEK_READ_SIZE );
+    QFile::remove( fileName );
+}
+
+/*!
+ * \brief Набор fileprocessing: сохранение и открытие хранилищ
+ * от 1 МиБ до BenchOptions::maxVaultSize (шаг x8)
+ */
+void BenchSuites::fileProcessing(BenchReporter &reporter, const BenchOptions &options)
+{
+    if( ! reporter.isAnySelected(QStringList() << "fileprocessing.save" << "fileprocessing.open") )
+        return;
+
+    const QString plainName     = options.dir + QDir::separator() + "bench-vault-plain";
+    const QString encryptedName = options.dir + QDir::separator() + "bench-vault";
+
+    QVector<qint64> sizes;
+    for( qint64 size = 1LL << 20; size < options.maxVaultSize; size *= 8 )
+        sizes << size;
+    sizes << options.maxVaultSize;
+
+    for( qint64 size : sizes ){
+        if( ! writeFile(plainName, size, options.seed) ){
+            qCritical() << "fileprocessing: cannot write" << plainName;
+            return;
+        }
+        QFile::remove( encryptedName );
+
+        QJsonObject params;
+        params.insert( "bytes", size );
+
+        DbFileProcessing file( plainName, encryptedName, PASSWORD, SALT );
+        QElapsedTimer timer;
+        timer.start();
+        bool saved = file.saveEncryptFile();
+        qint64 elapsed = timer.nsecsElapsed();
+        if( saved )
+            reporter.report( "fileprocessing.save", params, 1, elapsed, size );
+
+        timer.start();
+        bool opened = file.openEncryptFile();
+        elapsed = timer.nsecsElapsed();
+        if( opened )
+            reporter.report( "fileprocessing.open", params, 1, elapsed, size );
+    }
+    QFile::remove( plainName );
+    QFile::remove( encryptedName );
+}
+
+/*!
+ * \brief Набор data: вставка, изменение и загрузка записей через Data,
+ * пакетная вставка и полное чтение через RecordTable
+ */
+void BenchSuites::records(BenchReporter &reporter, const BenchOptions &options)
+{
+    if( ! reporter.isAnySelected(QStringList() << "data.insert" << "data.update" << "data.load"
+                                               << "data.bulk_insert" << "data.bulk_load") )
+        return;
+
+    const QString dbName = options.dir + QDir::separator() + "bench-records";
+    QFile::remove( dbName );
+
+    ConnectionManager db;
+    if( ! db.open(dbName) || ! QuerysManager::createTables() ){
+        qCritical() << "data: cannot create database" << dbName;
+        return;
+    }
+
+    QJsonObject params;
+    params.insert( "records", options.records );
+
+    QVector<Data> records;
+    records.reserve( options.records );
+    for( int i = 0; i < options.records; ++i )
+        records << record( i, options.seed );
+
+    QElapsedTimer timer;
+    timer.start();
+    db.transaction();
+    for( Data &data : records )
+        data.save();
+    db.commit();
+    reporter.report( "data.insert", params, options.records, timer.nsecsElapsed() );
+
+    timer.start();
+    db.transaction();
+    for( Data &data : records ){
+        data.setEditMode( true );
+        data.setPassword( data.password() + "!" );
+        data.save();
+    }
+    db.commit();
+    reporter.report( "data.update", params, options.records, timer.nsecsElapsed() );
+
+    timer.start();
+    for( const Data &data : records ){
+        Data loaded;
+        loaded.load( data.id() );
+    }
+    reporter.report( "data.load", params, options.records, timer.nsecsElapsed() );
+
+    RecordTable table;
+    for( const Data &data : records )
+        table.append( data );
+    timer.start();
+    db.transaction();
+    QuerysManager::insert( table );
+    db.commit();
+    reporter.report( "data.bulk_insert", params, table.size(), timer.nsecsElapsed() );
+
+    RecordTable loaded;
+    timer.start();
+    RecordLoader::load( &loaded );
+    reporter.report( "data.bulk_load", params, loaded.size(), timer.nsecsElapsed() );
+
+    db.close();
+    db.remove();
+}
+
+/*!
+ * \brief Набор search: задержка полнотекстового поиска SQLite
+ * и поиска по индексу SearchEngine
+ */
+void BenchSuites::search(BenchReporter &reporter, const BenchOptions &options)
+{
+    if( ! reporter.isAnySelected(QStringList() << "search.index_load" << "search.sql" << "search.engine") )
+        return;
+
+    const QString dbName = options.dir + QDir::separator() + "bench-search";
+    QFile::remove( dbName );
+
+    ConnectionManager db;
+    if( ! db.open(dbName) || ! QuerysManager::createTables() ){
+        qCritical() << "search: cannot create database" << dbName;
+        return;
+    }
+
+    RecordTable table;
+    for( int i = 0; i < options.records; ++i )
+        table.append( record(i, options.seed) );
+    db.transaction();
+    QuerysManager::insert( table );
+    db.commit();
+
+    SearchEngine engine;
+    QElapsedTimer timer;
+    timer.start();
+    engine.load();
+    QJsonObject loadParams;
+    loadParams.insert( "records", options.records );
+    reporter.report( "search.index_load", loadParams, 1, timer.nsecsElapsed() );
+
+    for( const char *term : SEARCH_TERMS ){
+        QJsonObject params;
+        params.insert( "records", options.records );
+        params.insert( "text", term );
+        params.insert( "fts", QuerysManager::hasFullTextSearch() );
+
+        if( reporter.isSelected("search.sql") ){
+            timer.start();
+            for( int i = 0; i < SEARCH_REPEATS; ++i )
+                QuerysManager::search( term );
+            reporter.report( "search.sql", params, SEARCH_REPEATS, timer.nsecsElapsed() );
+        }
+        if( reporter.isSelected("search.engine") ){
+            timer.start();
+            for( int i = 0; i < SEARCH_REPEATS; ++i )
+                engine.search( term );
+            reporter.report( "search.engine", params, SEARCH_REPEATS, timer.nsecsElapsed() );
+        }
+    }
+
+    db.close();
+    db.remove();
+}
+
+/*!
+ * \brief Набор generator: пакетная генерация паролей PasswordGenerator::getPasswords()
+ * из системного генератора и из воспроизводимого SecureRandom(seed)
+ */
+void BenchSuites::generator(BenchReporter &reporter, const BenchOptions &options)
+{
+    generatorPolicy( reporter, options );
+    if( ! reporter.isSelected("generator.passwords") )
+        return;
+
+    const int type = PasswordGenerator::Upper | PasswordGenerator::Lower | PasswordGenerator::Numbers
+                   | PasswordGenerator::Special | PasswordGenerator::Minus | PasswordGenerator::Underline;
+    SecureRandom seeded( QByteArray::number(options.seed) );
+
+    for( int length : PASSWORD_LENGTHS ){
+        for( int source = 0; source < 2; ++source ){
+            QElapsedTimer timer;
+            timer.start();
+            const QStringList passwords = PasswordGenerator::getPasswords( type, length, PASSWORD_COUNT,
+                                                                          source ? &seeded : nullptr );
+            const qint64 elapsed = timer.nsecsElapsed();
+
+            QJsonObject params;
+            params.insert( "length", length );
+            params.insert( "source", source ? QString("seeded") : QString("system") );
+            reporter.report( "generator.passwords", params, passwords.size(), elapsed,
+                             qint64(passwords.size()) * length );
+        }
+    }
+}
+
+/*!
+ * \brief Замер generator.policy: пакетная генерация по политике сайта
+ * Жёсткая политика (точные количества, без повторов) не должна быть
+ * медленнее мягкой - пароли строятся без перегенерации.
+ */
+void BenchSuites::generatorPolicy(BenchReporter &reporter, const BenchOptions &options)
+{
+    if( ! reporter.isSelected("generator.policy") )
+        return;
+
+    for( const char *rules : POLICY_RULES ){
+        for( int noRepeats = 0; noRepeats < 2; ++noRepeats ){
+            PasswordPolicy policy = PasswordPolicy::fromString( QString::fromLatin1(rules), POLICY_LENGTH );
+            policy.setNoRepeats( noRepeats );
+            SecureRandom seeded( QByteArray::number(options.seed) );
+
+            QElapsedTimer timer;
+            timer.start();
+            const QStringList passwords = policy.generate( PASSWORD_COUNT, &seeded );
+            const qint64 elapsed = timer.nsecsElapsed();
+
+            QJsonObject params;
+            params.insert( "policy", QString::fromLatin1(rules) );
+            params.insert( "length", POLICY_LENGTH );
+            params.insert( "noRepeats", bool(noRepeats) );
+            reporter.report( "generator.policy", params, passwords.size(), elapsed,
+                             qint64(passwords.size()) * POLICY_LENGTH );
+        }
+    }
+}
+
+/*!
+ * \brief Набор strength: задержка оценки стойкости PasswordStrength::estimate()
+ * на типичных паролях и пакетная оценка сгенерированных
+ */
+void BenchSuites::strength(BenchReporter &reporter, const BenchOptions &options)
+{
+    if( reporter.isSelected("strength.estimate") ){
+        for( const char *sample : STRENGTH_SAMPLES ){
+            const QString password = QString::fromLatin1( sample );
+            QElapsedTimer timer;
+            timer.start();
+            for( int i = 0; i < STRENGTH_REPEATS; ++i )
+                PasswordStrength::estimate( password );
+
+            QJsonObject params;
+            params.insert( "length", password.length() );
+            reporter.report( "strength.estimate", params, STRENGTH_REPEATS, timer.nsecsElapsed() );
+        }
+    }
+
+    if( reporter.isSelected("strength.batch") ){
+        SecureRandom random( QByteArray::number(options.seed) );
+        const QStringList passwords = PasswordGenerator::getPasswords( PasswordGenerator::Lower | PasswordGenerator::Numbers,
+                                                                       12, options.records, &random );
+        QElapsedTimer timer;
+        timer.start();
+        PasswordStrength::estimate( passwords );
+
+        QJsonObject params;
+        params.insert( "length", 12 );
+        reporter.report( "strength.batch", params, passwords.size(), timer.nsecsElapsed() );
+    }
+}
+
+/*!
+ * \brief Набор audit: проверка паролей всего хранилища VaultAudit::run()
+ * Каждая десятая запись получает пароль из небольшого набора - для повторов
+ */
+void BenchSuites::audit(BenchReporter &reporter, const BenchOptions &options)
+{
+    if( ! reporter.isSelected("audit.vault") )
+        return;
+
+    RecordTable records;
+    records.reserve( options.records );
+    for( int i = 0; i < options.records; ++i ){
+        Data data = record( i, options.seed );
+        if( i % 10 == 0 )
+            data.setPassword( "password" + QString::number(i % 100) );
+        records.append( data );
+    }
+
+    VaultAudit::Options auditOptions;
+    auditOptions.now = 1500000000000LL + options.records;
+
+    QElapsedTimer timer;
+    timer.start();
+    const QVector<VaultAudit::Finding> findings = VaultAudit::run( records, auditOptions );
+    const qint64 elapsed = timer.nsecsElapsed();
+
+    QJsonObject params;
+    params.insert( "records", records.size() );
+    params.insert( "findings", findings.size() );
+    params.insert( "threads", QThread::idealThreadCount() );
+    reporter.report( "audit.vault", params, records.size(), elapsed );
+}
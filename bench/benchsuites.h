@@ -0,0 +1,52 @@
+#ifndef BENCHSUITES_H
+#define BENCHSUITES_H
+
+#include "cryptfiledevice.h"
+
+#include <QString>
+#include <QVector>
+
+class BenchReporter;
+class Data;
+
+struct BenchOptions {
+    QString dir;                        ///< Каталог для временных файлов
+    qint64  dataSize = 64LL << 20;      ///< Объём данных для замеров шифрования
+    qint64  maxVaultSize = 128LL << 20; ///< Наибольший размер файла для DbFileProcessing
+    int     records = 10000;            ///< Число записей для замеров базы
+    quint32 seed = 42;
+};
+
+/*!
+ * \brief Статический класс BenchSuites - наборы замеров passman-bench
+ *
+ * Имена замеров имеют вид "набор.операция"; параметры (размер блока,
+ * длина ключа, размер файла) выводятся отдельно в "params".
+ * Данные генерируются детерминированно из BenchOptions::seed.
+ */
+class BenchSuites
+{
+private:
+    BenchSuites();
+    ~BenchSuites();
+
+    static QByteArray randomBytes(qint64 size, quint32 seed);
+    static bool writeFile(const QString &fileName, qint64 size, quint32 seed);
+    static Data record(int index, quint32 seed);
+    static int keyBits(CryptFileDevice::AesKeyLength keyLength);
+    static void generatorPolicy(BenchReporter &reporter, const BenchOptions &options);
+public:
+    static const QByteArray PASSWORD;
+    static const QByteArray SALT;
+
+    static void crypt(BenchReporter &reporter, const BenchOptions &options);
+    static void seek(BenchReporter &reporter, const BenchOptions &options);
+    static void fileProcessing(BenchReporter &reporter, const BenchOptions &options);
+    static void records(BenchReporter &reporter, const BenchOptions &options);
+    static void search(BenchReporter &reporter, const BenchOptions &options);
+    static void generator(BenchReporter &reporter, const BenchOptions &options);
+    static void strength(BenchReporter &reporter, const BenchOptions &options);
+    static void audit(BenchReporter &reporter, const BenchOptions &options);
+};
+
+#endif // BENCHSUITES_H
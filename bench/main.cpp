@@ -0,0 +1,115 @@
+#include "benchreporter.h"
+#include "benchsuites.h"
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QDateTime>
+#include <QDir>
+#include <QJsonObject>
+#include <QStandardPaths>
+#include <QSysInfo>
+#include <QTemporaryDir>
+#include <QTextStream>
+#include <QThread>
+
+/*!
+ * \brief Функция читает положительное число из опции
+ * \return false - если значение задано и неверно
+ */
+static bool readNumber(const QCommandLineParser &parser, const QCommandLineOption &option, qint64 *value)
+{
+    if( ! parser.isSet(option) )
+        return true;
+    bool ok = false;
+    *value = parser.value( option ).toLongLong( &ok );
+    return ok && *value > 0;
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(
+                "Benchmarks for CryptFileDevice, DbFileProcessing, Data, search, password generation, strength and audit.\n"
+                "Prints one JSON object per line for regression tracking." );
+    parser.addHelpOption();
+
+    QCommandLineOption filterOption( "filter",
+                                     "Run benchmarks whose name matches <regexp>,"
+                                     " e.g. \"crypt\\.|search\\.\".", "regexp" );
+    QCommandLineOption dirOption( "dir",
+                                  "Directory for temporary files (default: system temp).", "path" );
+    QCommandLineOption dataSizeOption( "data-mb",
+                                       "Data size for crypt benchmarks in MiB (default: 64).", "n" );
+    QCommandLineOption vaultSizeOption( "max-vault-mb",
+                                        "Largest vault for fileprocessing in MiB"
+                                        " (default: 128, up to 2048).", "n" );
+    QCommandLineOption recordsOption( "records",
+                                      "Number of records for data and search (default: 10000).", "n" );
+    QCommandLineOption seedOption( "seed",
+                                   "Seed for generated data (default: 42).", "n" );
+    parser.addOption( filterOption );
+    parser.addOption( dirOption );
+    parser.addOption( dataSizeOption );
+    parser.addOption( vaultSizeOption );
+    parser.addOption( recordsOption );
+    parser.addOption( seedOption );
+    parser.process( app );
+
+    BenchOptions options;
+    qint64 dataMb  = options.dataSize >> 20;
+    qint64 vaultMb = options.maxVaultSize >> 20;
+    qint64 records = options.records;
+    qint64 seed    = options.seed;
+    if( ! readNumber(parser, dataSizeOption, &dataMb)
+            || ! readNumber(parser, vaultSizeOption, &vaultMb) || vaultMb > 2048
+            || ! readNumber(parser, recordsOption, &records)
+            || ! readNumber(parser, seedOption, &seed) ){
+        QTextStream( stderr ) << parser.helpText();
+        return 2;
+    }
+    options.dataSize     = dataMb << 20;
+    options.maxVaultSize = vaultMb << 20;
+    options.records      = int( records );
+    options.seed         = quint32( seed );
+
+    QTemporaryDir tmpDir( (parser.isSet(dirOption) ? parser.value(dirOption)
+                                                   : QStandardPaths::writableLocation(QStandardPaths::TempLocation))
+                          + QDir::separator() + "passman-bench-XXXXXX" );
+    if( ! tmpDir.isValid() ){
+        QTextStream( stderr ) << "Cannot create temporary directory" << endl;
+        return 1;
+    }
+    options.dir = tmpDir.path();
+
+    BenchReporter reporter( parser.value(filterOption) );
+
+    QJsonObject meta;
+    meta.insert( "time", QDateTime::currentDateTimeUtc().toString(Qt::ISODate) );
+    meta.insert( "qt", QString(qVersion()) );
+    meta.insert( "cpu", QSysInfo::currentCpuArchitecture() );
+    meta.insert( "os", QSysInfo::prettyProductName() );
+    meta.insert( "threads", QThread::idealThreadCount() );
+#ifdef QT_NO_DEBUG
+    meta.insert( "build", QString("release") );
+#else
+    meta.insert( "build", QString("debug") );
+#endif
+    meta.insert( "data_bytes", options.dataSize );
+    meta.insert( "max_vault_bytes", options.maxVaultSize );
+    meta.insert( "records", options.records );
+    meta.insert( "seed", qint64(options.seed) );
+    reporter.meta( meta );
+
+    BenchSuites::crypt( reporter, options );
+    BenchSuites::seek( reporter, options );
+    BenchSuites::fileProcessing( reporter, options );
+    BenchSuites::records( reporter, options );
+    BenchSuites::search( reporter, options );
+    BenchSuites::generator( reporter, options );
+    BenchSuites::strength( reporter, options );
+    BenchSuites::audit( reporter, options );
+
+    return 0;
+}
@@ -0,0 +1,21 @@
+#-------------------------------------------------
+#
+# Benchmarks for the crypto and persistence hot paths
+#
+#-------------------------------------------------
+
+QT       -= gui
+
+TARGET = passman-bench
+TEMPLATE = app
+CONFIG += console
+CONFIG -= app_bundle
+
+include(../core.pri)
+
+SOURCES += main.cpp \
+    benchreporter.cpp \
+    benchsuites.cpp
+
+HEADERS  += benchreporter.h \
+    benchsuites.h
@@ -0,0 +1,371 @@
+#include "breach/breachindex.h"
+#include "Data/recordtable.h"
+#include "io/transferstats.h"
+#include "trace/trace.h"
+
+#include <QCryptographicHash>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QSettings>
+#include <QTemporaryDir>
+#include <QtEndian>
+#include <QDebug>
+
+#include <algorithm>
+#include <string.h>
+
+const char    BreachIndex::MAGIC[4]      = { 'P', 'M', 'B', 'I' };
+const char    BreachIndex::FILE_SUFFIX[] = ".pmbi";
+const QString BreachIndex::PATH_OPTION("BreachIndexPath");
+
+namespace {
+    const int    SHA1_SIZE       = 20;
+    const int    SHA1_HEX_SIZE   = 2 * SHA1_SIZE;
+    const int    KEY_SIZE        = sizeof(quint64);
+    const qint64 TABLE_SIZE      = qint64(BreachIndex::BUCKET_COUNT + 1) * KEY_SIZE;
+
+    /// Временные части при сборке - по старшему байту ключа
+    const int    PARTITION_COUNT = 256;
+    const int    PARTITION_BUFFER = 64 * 1024;
+    const qint64 READ_BLOCK_SIZE = 4 * 1024 * 1024;
+
+    int hexValue(char c)
+    {
+        if( c >= '0' && c <= '9' )
+            return c - '0';
+        if( c >= 'a' && c <= 'f' )
+            return c - 'a' + 10;
+        if( c >= 'A' && c <= 'F' )
+            return c - 'A' + 10;
+        return -1;
+    }
+
+    QString partitionPath(const QTemporaryDir &dir, int partition)
+    {
+        return dir.path() + "/" + QString::number( partition );
+    }
+
+    bool flushPartition(const QTemporaryDir &dir, int partition, QByteArray *buffer)
+    {
+        if( buffer->isEmpty() )
+            return true;
+        QFile file( partitionPath(dir, partition) );
+        if( ! file.open(QIODevice::WriteOnly | QIODevice::Append)
+                || file.write(*buffer) != buffer->size() ){
+            qCritical() << "Cannot write" << file.fileName() << file.errorString();
+            return false;
+        }
+        buffer->clear();
+        return true;
+    }
+}
+
+BreachIndex::BreachIndex()
+{
+}
+
+BreachIndex::~BreachIndex()
+{
+    close();
+}
+
+/*!
+ * \brief Метод открывает индекс и отображает его в память
+ * \return false - если файл не открывается или это не индекс
+ */
+bool BreachIndex::open(const QString &fileName)
+{
+    close();
+
+    _file.setFileName( fileName );
+    if( ! _file.open(QIODevice::ReadOnly) ){
+        qWarning() << "Cannot open breach index" << fileName << _file.errorString();
+        return false;
+    }
+
+    const qint64 size = _file.size();
+    const uchar *data = size >= HEADER_SIZE + TABLE_SIZE ? _file.map( 0, size ) : nullptr;
+    if( data == nullptr
+            || memcmp(data, MAGIC, sizeof(MAGIC)) != 0
+            || qFromLittleEndian<quint32>(data + 4) != VERSION
+            || qFromLittleEndian<quint32>(data + 8) != quint32(PREFIX_BITS) ){
+        qWarning() << "Not a breach index:" << fileName;
+        close();
+        return false;
+    }
+
+    const qint64 count = qint64( qFromLittleEndian<quint64>(data + 16) );
+    if( count < 0 || size != HEADER_SIZE + TABLE_SIZE + count * KEY_SIZE ){
+        qWarning() << "Breach index is truncated:" << fileName;
+        close();
+        return false;
+    }
+
+    // Таблица корзин проверяется один раз, чтобы contains() обходился без проверок
+    const uchar *table = data + HEADER_SIZE;
+    quint64 previous = 0;
+    for( int bucket = 0; bucket <= BUCKET_COUNT; ++bucket ){
+        const quint64 start = qFromLittleEndian<quint64>( table + bucket * KEY_SIZE );
+        if( start < previous || start > quint64(count) || (bucket == BUCKET_COUNT && start != quint64(count)) ){
+            qWarning() << "Breach index is corrupted:" << fileName;
+            close();
+            return false;
+        }
+        previous = start;
+    }
+
+    _table = table;
+    _keys  = table + TABLE_SIZE;
+    _count = count;
+    return true;
+}
+
+void BreachIndex::close()
+{
+    if( _file.isOpen() )
+        _file.close();
+    _table = nullptr;
+    _keys  = nullptr;
+    _count = 0;
+}
+
+bool BreachIndex::isOpen() const
+{
+    return _table != nullptr;
+}
+
+QString BreachIndex::fileName() const
+{
+    return _file.fileName();
+}
+
+qint64 BreachIndex::count() const
+{
+    return _count;
+}
+
+quint64 BreachIndex::key(qint64 index) const
+{
+    return qFromLittleEndian<quint64>( _keys + index * KEY_SIZE );
+}
+
+/*!
+ * \brief Метод проверяет, есть ли хэш в индексе
+ * \param sha1 - SHA-1, 20 байт
+ */
+bool BreachIndex::contains(const QByteArray &sha1) const
+{
+    if( ! isOpen() || sha1.size() != SHA1_SIZE )
+        return false;
+
+    const quint64 value  = qFromBigEndian<quint64>( reinterpret_cast<const uchar*>(sha1.constData()) );
+    const int     bucket = int( value >> (64 - PREFIX_BITS) );
+    qint64 low  = qint64( qFromLittleEndian<quint64>(_table + bucket * KEY_SIZE) );
+    qint64 high = qint64( qFromLittleEndian<quint64>(_table + (bucket + 1) * KEY_SIZE) );
+    const qint64 end = high;
+
+    while( low < high ){
+        const qint64 middle = low + (high - low) / 2;
+        if( key(middle) < value )
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low < end && key( low ) == value;
+}
+
+/*!
+ * \brief Метод проверяет пароль в кодировке UTF-8
+ */
+bool BreachIndex::containsPassword(const QByteArray &utf8) const
+{
+    return contains( QCryptographicHash::hash(utf8, QCryptographicHash::Sha1) );
+}
+
+bool BreachIndex::containsPassword(const QString &password) const
+{
+    return containsPassword( password.toUtf8() );
+}
+
+/*!
+ * \brief Метод возвращает id записей, пароли которых есть в индексе
+ * Пустые пароли пропускаются.
+ */
+QVector<qint64> BreachIndex::breached(const RecordTable &records) const
+{
+    TRACE_SCOPE( "breach.audit" );
+
+    QVector<qint64> ids;
+    for( int row = 0; row < records.size(); ++row ){
+        const QByteArray password = records.textUtf8( row, RecordTable::Password );
+        if( ! password.isEmpty() && containsPassword(password) )
+            ids.append( records.id(row) );
+    }
+    return ids;
+}
+
+/*!
+ * \brief Метод возвращает путь к индексу из настроек
+ * \return пустая строка, если индекс не выбран
+ */
+QString BreachIndex::configuredPath()
+{
+    QSettings cfg;
+    return cfg.value( PATH_OPTION ).toString();
+}
+
+/*!
+ * \brief Метод разбирает строку "SHA1HEX[:count]"
+ * \param key - первые 8 байт хэша
+ */
+bool BreachIndex::parseLine(const char *line, int length, quint64 *key)
+{
+    if( length < SHA1_HEX_SIZE )
+        return false;
+    if( length > SHA1_HEX_SIZE && line[SHA1_HEX_SIZE] != ':' && line[SHA1_HEX_SIZE] != '\r' )
+        return false;
+
+    quint64 value = 0;
+    for( int i = 0; i < SHA1_HEX_SIZE; ++i ){
+        const int digit = hexValue( line[i] );
+        if( digit < 0 )
+            return false;
+        if( i < 2 * KEY_SIZE )
+            value = (value << 4) | quint64( digit );
+    }
+    *key = value;
+    return true;
+}
+
+/*!
+ * \brief Метод строит индекс из списка хэшей
+ *
+ * Ключи раскладываются по PARTITION_COUNT временным файлам рядом с output
+ * по старшему байту, затем каждая часть сортируется в памяти и дописывается
+ * в индекс. Памяти нужно на одну часть (1/256 списка), а не на весь список.
+ * Индекс пишется через QSaveFile и появляется только целиком.
+ * \param stats - записи - уникальные хэши, пропущенные - неразобранные строки
+ */
+bool BreachIndex::build(const QString &input, const QString &output, TransferStats *stats)
+{
+    TRACE_SCOPE( "breach.build" );
+    stats->start();
+
+    QFile in( input );
+    if( ! in.open(QIODevice::ReadOnly) ){
+        qCritical() << "Cannot open" << input << in.errorString();
+        stats->finish();
+        return false;
+    }
+
+    QTemporaryDir dir( QFileInfo(output).absolutePath() + "/breach-index-XXXXXX" );
+    if( ! dir.isValid() ){
+        qCritical() << "Cannot create a temporary directory next to" << output;
+        stats->finish();
+        return false;
+    }
+
+    QVector<QByteArray> buffers( PARTITION_COUNT );
+    QByteArray block;
+    QByteArray rest;
+    while( ! in.atEnd() ){
+        block = rest + in.read( READ_BLOCK_SIZE );
+        stats->addBytes( block.size() - rest.size() );
+        const bool last = in.atEnd();
+
+        int begin = 0;
+        while( begin < block.size() ){
+            int end = block.indexOf( '\n', begin );
+            if( end < 0 ){
+                if( ! last )
+                    break;
+                end = block.size();
+            }
+
+            const int length = end - begin;
+            quint64 value;
+            if( parseLine(block.constData() + begin, length, &value) ){
+                const int partition = int( value >> 56 );
+                buffers[partition].append( reinterpret_cast<const char*>(&value), KEY_SIZE );
+                if( buffers.at(partition).size() >= PARTITION_BUFFER
+                        && ! flushPartition(dir, partition, &buffers[partition]) ){
+                    stats->finish();
+                    return false;
+                }
+            }else if( length > 0 && ! (length == 1 && block.at(begin) == '\r') ){
+                stats->addSkipped( 1 );
+            }
+            begin = end + 1;
+        }
+        rest = begin < block.size() ? block.mid( begin ) : QByteArray();
+    }
+    for( int partition = 0; partition < PARTITION_COUNT; ++partition ){
+        if( ! flushPartition(dir, partition, &buffers[partition]) ){
+            stats->finish();
+            return false;
+        }
+    }
+
+    QSaveFile file( output );
+    if( ! file.open(QIODevice::WriteOnly)
+            || file.write(QByteArray(HEADER_SIZE + TABLE_SIZE, '\0')) != HEADER_SIZE + TABLE_SIZE ){
+        qCritical() << "Cannot write" << output << file.errorString();
+        stats->finish();
+        return false;
+    }
+
+    QVector<quint64> bucketSizes( BUCKET_COUNT, 0 );
+    qint64 count = 0;
+    for( int partition = 0; partition < PARTITION_COUNT; ++partition ){
+        QFile part( partitionPath(dir, partition) );
+        if( ! part.exists() )
+            continue;
+        if( ! part.open(QIODevice::ReadOnly) ){
+            qCritical() << "Cannot read" << part.fileName() << part.errorString();
+            stats->finish();
+            return false;
+        }
+        QByteArray bytes = part.readAll();
+        part.close();
+        part.remove();
+
+        quint64 *keys = reinterpret_cast<quint64*>( bytes.data() );
+        std::sort( keys, keys + bytes.size() / KEY_SIZE );
+        quint64 *keysEnd = std::unique( keys, keys + bytes.size() / KEY_SIZE );
+        for( quint64 *k = keys; k != keysEnd; ++k ){
+            ++bucketSizes[int( *k >> (64 - PREFIX_BITS) )];
+            *k = qToLittleEndian( *k );
+        }
+
+        const qint64 size = qint64( keysEnd - keys ) * KEY_SIZE;
+        if( file.write(bytes.constData(), size) != size ){
+            qCritical() << "Cannot write" << output << file.errorString();
+            stats->finish();
+            return false;
+        }
+        count += keysEnd - keys;
+    }
+
+    QByteArray head( HEADER_SIZE + TABLE_SIZE, '\0' );
+    uchar *data = reinterpret_cast<uchar*>( head.data() );
+    memcpy( data, MAGIC, sizeof(MAGIC) );
+    qToLittleEndian<quint32>( VERSION, data + 4 );
+    qToLittleEndian<quint32>( PREFIX_BITS, data + 8 );
+    qToLittleEndian<quint64>( quint64(count), data + 16 );
+    quint64 start = 0;
+    for( int bucket = 0; bucket <= BUCKET_COUNT; ++bucket ){
+        qToLittleEndian<quint64>( start, data + HEADER_SIZE + bucket * KEY_SIZE );
+        if( bucket < BUCKET_COUNT )
+            start += bucketSizes.at( bucket );
+    }
+
+    if( ! file.seek(0) || file.write(head) != head.size() || ! file.commit() ){
+        qCritical() << "Cannot write" << output << file.errorString();
+        stats->finish();
+        return false;
+    }
+
+    stats->addRecords( count );
+    stats->finish();
+    return true;
+}
@@ -0,0 +1,69 @@
+#ifndef BREACHINDEX_H
+#define BREACHINDEX_H
+
+#include <QByteArray>
+#include <QFile>
+#include <QString>
+#include <QVector>
+
+class RecordTable;
+class TransferStats;
+
+/*!
+ * \brief Класс BreachIndex - локальный индекс утёкших паролей (SHA-1)
+ *
+ * Индекс строится из списка хэшей вида "SHA1HEX[:count]" по строке
+ * (формат загрузки Pwned Passwords) и хранит от каждого хэша первые 8 байт,
+ * отсортированные по возрастанию. Файл:
+ * - заголовок HEADER_SIZE байт: "PMBI", версия, PREFIX_BITS, число ключей;
+ * - таблица корзин: для каждого префикса из PREFIX_BITS бит - номер первого
+ *   ключа, всего BUCKET_COUNT + 1 чисел quint64;
+ * - ключи quint64.
+ * Числа записаны в little-endian. Файл отображается в память, проверка -
+ * двоичный поиск внутри одной корзины, поэтому на сотни миллионов хэшей
+ * нужно несколько обращений к диску. Ложное срабатывание из-за усечения
+ * хэша до 64 бит - порядка count / 2^64.
+ * contains() только читает отображение и безопасен из нескольких потоков.
+ */
+class BreachIndex
+{
+public:
+    static const int     PREFIX_BITS  = 16;
+    static const int     BUCKET_COUNT = 1 << PREFIX_BITS;
+    static const int     HEADER_SIZE  = 32;
+    static const quint32 VERSION      = 1;
+    static const char    MAGIC[4];
+    static const char    FILE_SUFFIX[];
+
+    static const QString PATH_OPTION;
+
+    BreachIndex();
+    ~BreachIndex();
+
+    bool open(const QString &fileName);
+    void close();
+    bool isOpen() const;
+    QString fileName() const;
+    qint64 count() const;
+
+    bool contains(const QByteArray &sha1) const;
+    bool containsPassword(const QByteArray &utf8) const;
+    bool containsPassword(const QString &password) const;
+    QVector<qint64> breached(const RecordTable &records) const;
+
+    static QString configuredPath();
+    static bool build(const QString &input, const QString &output, TransferStats *stats);
+
+private:
+    QFile        _file;
+    const uchar *_table = nullptr;
+    const uchar *_keys  = nullptr;
+    qint64       _count = 0;
+
+    Q_DISABLE_COPY(BreachIndex)
+
+    quint64 key(qint64 index) const;
+    static bool parseLine(const char *line, int length, quint64 *key);
+};
+
+#endif // BREACHINDEX_H
@@ -0,0 +1,196 @@
+#include "agentclient.h"
+#include "agentprotocol.h"
+#include "vaultcommands.h"
+
+#include <QDataStream>
+#include <QTextStream>
+
+bool AgentClient::connectTo(const QString &name)
+{
+    _socket.connectToServer( name );
+    return _socket.waitForConnected( TIMEOUT );
+}
+
+void AgentClient::setFields(const QStringList &fields)
+{
+    _fields = fields;
+}
+
+int AgentClient::ping()
+{
+    return request( AgentProtocol::Ping, QByteArray() );
+}
+
+int AgentClient::lock()
+{
+    return request( AgentProtocol::Lock, QByteArray() );
+}
+
+int AgentClient::stats()
+{
+    return request( AgentProtocol::Stats, QByteArray() );
+}
+
+int AgentClient::get(const QStringList &args)
+{
+    QVector<qint64> ids;
+    for( const QString &arg : args ){
+        bool ok = false;
+        qint64 id = arg.toLongLong( &ok );
+        if( ! ok || id <= 0 ){
+            QTextStream( stderr ) << "get: expected one or more record ids" << endl;
+            return ExitCode::USAGE;
+        }
+        ids.append( id );
+    }
+    if( ids.isEmpty() ){
+        QTextStream( stderr ) << "get: expected one or more record ids" << endl;
+        return ExitCode::USAGE;
+    }
+
+    QByteArray arguments;
+    QDataStream out( &arguments, QIODevice::WriteOnly );
+    out.setVersion( AgentProtocol::STREAM_VERSION );
+    out << quint32( ids.size() );
+    for( qint64 id : ids )
+        out << id;
+    return request( AgentProtocol::Get, arguments );
+}
+
+int AgentClient::search(const QString &text)
+{
+    if( text.isEmpty() ){
+        QTextStream( stderr ) << "search: expected search text" << endl;
+        return ExitCode::USAGE;
+    }
+
+    QByteArray arguments;
+    QDataStream out( &arguments, QIODevice::WriteOnly );
+    out.setVersion( AgentProtocol::STREAM_VERSION );
+    out << text.toUtf8();
+    return request( AgentProtocol::Search, arguments );
+}
+
+int AgentClient::list(const QString &group)
+{
+    QByteArray arguments;
+    QDataStream out( &arguments, QIODevice::WriteOnly );
+    out.setVersion( AgentProtocol::STREAM_VERSION );
+    out << group.toUtf8();
+    return request( AgentProtocol::List, arguments );
+}
+
+/*!
+ * \brief Метод отправляет запрос и выводит записи по мере прихода кадров ответа
+ * \return код завершения ExitCode
+ */
+int AgentClient::request(quint8 type, const QByteArray &arguments)
+{
+    QTextStream err( stderr );
+
+    QByteArray payload;
+    QDataStream header( &payload, QIODevice::WriteOnly );
+    header.setVersion( AgentProtocol::STREAM_VERSION );
+    header << type << fieldMask();
+    _socket.write( AgentProtocol::frame(payload + arguments) );
+
+    // Агент отдаёт поля в порядке fieldNames(), выводятся они в порядке --fields
+    const QStringList names = _fields.isEmpty() ? VaultCommands::fieldNames() : _fields;
+    QStringList received;
+    for( const QString &name : VaultCommands::fieldNames() ){
+        if( names.contains(name) )
+            received << name;
+    }
+    QVector<int> order;
+    for( const QString &name : names )
+        order << received.indexOf( name );
+
+    QTextStream out( stdout );
+    out.setCodec( "UTF-8" );
+    const bool records = type == AgentProtocol::Get || type == AgentProtocol::Search
+            || type == AgentProtocol::List;
+    bool headerWritten = false;
+    QVector<QString> values( received.size() );
+    QStringList line;
+
+    QByteArray buffer;
+    quint8 status = AgentProtocol::More;
+    while( status == AgentProtocol::More ){
+        QByteArray reply;
+        if( ! readFrame(buffer, &reply) ){
+            out.flush();
+            err << "Agent did not reply" << endl;
+            return ExitCode::FAILURE;
+        }
+
+        QDataStream in( reply );
+        in.setVersion( AgentProtocol::STREAM_VERSION );
+        quint32 count = 0;
+        status = AgentProtocol::Failure;
+        in >> status >> count;
+        if( status == AgentProtocol::BadRequest || status == AgentProtocol::Failure )
+            break;
+        if( type == AgentProtocol::Stats ){
+            QByteArray json;
+            in >> json;
+            out << json << '\n';
+            continue;
+        }
+        if( ! records )
+            continue;
+
+        if( ! headerWritten ){
+            out << "#" << names.join('\t') << '\n';
+            headerWritten = true;
+        }
+        for( quint32 i = 0; i < count && in.status() == QDataStream::Ok; ++i ){
+            for( int field = 0; field < received.size(); ++field ){
+                QByteArray value;
+                in >> value;
+                values[field] = VaultCommands::escape( QString::fromUtf8(value) );
+            }
+            line.clear();
+            for( int field : order )
+                line << values.at( field );
+            out << line.join('\t') << '\n';
+        }
+    }
+    out.flush();
+
+    if( status == AgentProtocol::BadRequest || status == AgentProtocol::Failure ){
+        err << "Agent failed to handle the request" << endl;
+        return ExitCode::FAILURE;
+    }
+    if( status == AgentProtocol::NotFound ){
+        err << "get: some records not found" << endl;
+        return ExitCode::FAILURE;
+    }
+    return ExitCode::SUCCESS;
+}
+
+/*!
+ * \brief Метод дожидается очередного кадра ответа
+ * \return false - если агент не ответил за TIMEOUT или прислал слишком большой кадр
+ */
+bool AgentClient::readFrame(QByteArray &buffer, QByteArray *reply)
+{
+    bool error = false;
+    while( ! AgentProtocol::takeFrame(buffer, reply, &error) ){
+        if( error || ! _socket.waitForReadyRead(TIMEOUT) )
+            return false;
+        buffer += _socket.readAll();
+    }
+    return true;
+}
+
+quint16 AgentClient::fieldMask() const
+{
+    const QStringList names = VaultCommands::fieldNames();
+    quint16 mask = 0;
+    for( const QString &field : _fields ){
+        int index = names.indexOf( field );
+        if( index >= 0 )
+            mask |= quint16( 1u << index );
+    }
+    return mask;
+}
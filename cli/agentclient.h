@@ -0,0 +1,37 @@
+#ifndef AGENTCLIENT_H
+#define AGENTCLIENT_H
+
+#include <QLocalSocket>
+#include <QStringList>
+#include <QVector>
+
+/*!
+ * \brief Класс AgentClient - запросы к запущенному агенту passman-cli
+ *
+ * Выводит записи в том же формате, что и VaultCommands, поэтому скрипту
+ * безразлично, обслужен запрос агентом или открытием файла.
+ */
+class AgentClient
+{
+private:
+    QLocalSocket _socket;
+    QStringList  _fields;   ///< Выводимые поля, пусто - все
+
+    static const int TIMEOUT = 5000;
+
+    int request(quint8 type, const QByteArray &arguments);
+    bool readFrame(QByteArray &buffer, QByteArray *reply);
+    quint16 fieldMask() const;
+public:
+    bool connectTo(const QString &name);
+    void setFields(const QStringList &fields);
+
+    int ping();
+    int lock();
+    int stats();
+    int get(const QStringList &args);
+    int search(const QString &text);
+    int list(const QString &group);
+};
+
+#endif // AGENTCLIENT_H
@@ -0,0 +1,53 @@
+#include "agentprotocol.h"
+
+#include <QtEndian>
+
+/*!
+ * \brief Функция возвращает имя сокета агента по умолчанию
+ * Имя включает пользователя, чтобы агенты разных пользователей не пересекались
+ */
+QString AgentProtocol::defaultSocketName()
+{
+    QString user = QString::fromLocal8Bit( qgetenv("USER") );
+    if( user.isEmpty() )
+        user = QString::fromLocal8Bit( qgetenv("USERNAME") );
+    return "passman-agent-" + user;
+}
+
+/*!
+ * \brief Функция упаковывает нагрузку в кадр
+ */
+QByteArray AgentProtocol::frame(const QByteArray &payload)
+{
+    QByteArray result;
+    result.resize( sizeof(quint32) );
+    qToBigEndian<quint32>( quint32(payload.size()), reinterpret_cast<uchar*>(result.data()) );
+    result += payload;
+    return result;
+}
+
+/*!
+ * \brief Функция извлекает из начала буфера очередной полный кадр
+ * \param buffer - накопленные данные, извлечённый кадр из него удаляется
+ * \param payload - нагрузка кадра
+ * \param error - true, если длина кадра превышает MAX_FRAME_SIZE
+ * \return true - если кадр получен целиком
+ */
+bool AgentProtocol::takeFrame(QByteArray &buffer, QByteArray *payload, bool *error)
+{
+    *error = false;
+    if( buffer.size() < int(sizeof(quint32)) )
+        return false;
+
+    quint32 size = qFromBigEndian<quint32>( reinterpret_cast<const uchar*>(buffer.constData()) );
+    if( size > MAX_FRAME_SIZE ){
+        *error = true;
+        return false;
+    }
+    if( quint32(buffer.size()) - sizeof(quint32) < size )
+        return false;
+
+    *payload = buffer.mid( sizeof(quint32), size );
+    buffer.remove( 0, sizeof(quint32) + size );
+    return true;
+}
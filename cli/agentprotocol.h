@@ -0,0 +1,49 @@
+#ifndef AGENTPROTOCOL_H
+#define AGENTPROTOCOL_H
+
+#include <QByteArray>
+#include <QString>
+#include <QDataStream>
+
+/*!
+ * \brief Протокол агента passman-cli
+ *
+ * Кадр - quint32 длина полезной нагрузки и сама нагрузка (QDataStream, big-endian).
+ * Запрос: quint8 Request, quint16 маска полей, аргументы:
+ * - Get:    quint32 число id, затем qint64 id;
+ * - Search: QByteArray текст в UTF-8;
+ * - List:   QByteArray группа в UTF-8, пусто - все записи;
+ * - Ping, Lock, Stats: без аргументов.
+ * Ответ - один или несколько кадров: quint8 Status, quint32 число записей
+ * в кадре, затем для каждой записи выбранные маской поля как QByteArray
+ * в UTF-8. Кадры со статусом More несут очередную порцию записей,
+ * последний кадр ответа - с любым другим статусом, итоговым для запроса.
+ * Бит i маски соответствует VaultCommands::fieldNames()[i], 0 - все поля.
+ */
+namespace AgentProtocol {
+    enum Request : quint8 {
+        Ping   = 1,
+        Get    = 2,
+        Search = 3,
+        List   = 4,
+        Lock   = 5,    ///< Закрыть хранилище и завершить агента
+        Stats  = 6     ///< Метрики агента: одна запись из одного поля JSON
+    };
+
+    enum Status : quint8 {
+        Ok         = 0,
+        NotFound   = 1,    ///< Часть запрошенных id не найдена
+        BadRequest = 2,
+        Failure    = 3,
+        More       = 4     ///< Порция записей, ответ продолжается
+    };
+
+    const quint32 MAX_FRAME_SIZE = 16 * 1024 * 1024;
+    const QDataStream::Version STREAM_VERSION = QDataStream::Qt_5_0;
+
+    QString defaultSocketName();
+    QByteArray frame(const QByteArray &payload);
+    bool takeFrame(QByteArray &buffer, QByteArray *payload, bool *error);
+}
+
+#endif // AGENTPROTOCOL_H
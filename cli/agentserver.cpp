@@ -0,0 +1,254 @@
+#include "agentserver.h"
+#include "agentprotocol.h"
+#include "vaultcommands.h"
+#include "Data/data.h"
+#include "Data/recordtable.h"
+#include "Data/recordloader.h"
+#include "db/querysmanager.h"
+#include "metrics/metrics.h"
+
+#include <QCoreApplication>
+#include <QDataStream>
+#include <QJsonDocument>
+#include <QLocalSocket>
+#include <QDebug>
+
+AgentServer::AgentServer(Vault &vault, QObject *parent) :
+    QObject(parent),
+    _vault(vault)
+{
+    _idleTimer.setSingleShot( true );
+    connect( &_server, SIGNAL(newConnection()), this, SLOT(acceptConnection()) );
+    connect( &_idleTimer, SIGNAL(timeout()), this, SLOT(idleTimeout()) );
+}
+
+/*!
+ * \brief Метод начинает приём запросов
+ * \param name - имя локального сокета
+ * \param idleMinutes - время простоя до закрытия хранилища
+ * \return false - если сокет занят работающим агентом или не создаётся
+ */
+bool AgentServer::listen(const QString &name, int idleMinutes)
+{
+    _server.setSocketOptions( QLocalServer::UserAccessOption );
+    if( ! _server.listen(name) ){
+        // Сокет мог остаться от аварийно завершённого агента
+        QLocalSocket probe;
+        probe.connectToServer( name );
+        if( probe.waitForConnected(1000) ){
+            qCritical() << "Agent is already running on" << name;
+            return false;
+        }
+        QLocalServer::removeServer( name );
+        if( ! _server.listen(name) ){
+            qCritical() << "Cannot listen on" << name << ":" << _server.errorString();
+            return false;
+        }
+    }
+
+    _idleTimer.setInterval( idleMinutes*60*1000 );
+    _idleTimer.start();
+    return true;
+}
+
+void AgentServer::acceptConnection()
+{
+    while( QLocalSocket *socket = _server.nextPendingConnection() ){
+        _buffers.insert( socket, QByteArray() );
+        connect( socket, SIGNAL(readyRead()), this, SLOT(readRequest()) );
+        connect( socket, SIGNAL(disconnected()), this, SLOT(dropConnection()) );
+    }
+}
+
+void AgentServer::readRequest()
+{
+    QLocalSocket *socket = qobject_cast<QLocalSocket*>( sender() );
+    if( ! socket )
+        return;
+
+    QByteArray &buffer = _buffers[socket];
+    buffer += socket->readAll();
+
+    QByteArray request;
+    bool error = false;
+    bool lock  = false;
+    while( AgentProtocol::takeFrame(buffer, &request, &error) ){
+        _idleTimer.start();
+        handle( socket, request, &lock );
+        if( lock ){
+            socket->flush();
+            shutdown();
+            return;
+        }
+    }
+    if( error ){
+        qWarning() << "Agent: oversized frame, dropping connection";
+        socket->abort();
+    }
+}
+
+void AgentServer::dropConnection()
+{
+    QLocalSocket *socket = qobject_cast<QLocalSocket*>( sender() );
+    if( ! socket )
+        return;
+    _buffers.remove( socket );
+    socket->deleteLater();
+}
+
+void AgentServer::idleTimeout()
+{
+    shutdown();
+}
+
+/*!
+ * \brief Метод закрывает хранилище, удаляя расшифрованную копию, и завершает агента
+ */
+void AgentServer::shutdown()
+{
+    _idleTimer.stop();
+    _server.close();
+    _vault.close();
+    QCoreApplication::quit();
+}
+
+/*!
+ * \brief Метод выполняет запрос и отправляет ответ
+ * Записи уходят порциями в кадрах More по мере чтения, поэтому размер
+ * хранилища не упирается в MAX_FRAME_SIZE. Последний кадр несёт итоговый статус.
+ * \param lock - устанавливается для запроса Lock
+ */
+void AgentServer::handle(QLocalSocket *socket, const QByteArray &request, bool *lock)
+{
+    QDataStream in( request );
+    in.setVersion( AgentProtocol::STREAM_VERSION );
+    quint8  type = 0;
+    quint16 mask = 0;
+    in >> type >> mask;
+
+    const QStringList fields = selectedFields( mask );
+    AgentProtocol::Status status = AgentProtocol::Ok;
+    quint32    count = 0;
+    QByteArray records;
+    QDataStream out( &records, QIODevice::WriteOnly );
+    out.setVersion( AgentProtocol::STREAM_VERSION );
+
+    // Порция уходит, когда набрана порция RecordLoader или кадр подходит к пределу
+    auto sendChunk = [&](){
+        if( count < quint32(RecordLoader::DEFAULT_CHUNK_SIZE)
+                && quint32(records.size()) < AgentProtocol::MAX_FRAME_SIZE / 2 )
+            return;
+        send( socket, AgentProtocol::More, count, records );
+        count = 0;
+        records.clear();
+        out.device()->seek( 0 );
+    };
+
+    switch( type ){
+    case AgentProtocol::Ping:
+        break;
+    case AgentProtocol::Lock:
+        *lock = true;
+        break;
+    case AgentProtocol::Stats:
+        out << QJsonDocument( Metrics::toJson() ).toJson( QJsonDocument::Compact );
+        count = 1;
+        break;
+    case AgentProtocol::Get: {
+        quint32 size = 0;
+        in >> size;
+        for( quint32 i = 0; i < size && in.status() == QDataStream::Ok; ++i ){
+            qint64 id = 0;
+            in >> id;
+            Data data;
+            if( data.load(id) ){
+                appendRecord( out, data, fields );
+                ++count;
+                sendChunk();
+            }else{
+                status = AgentProtocol::NotFound;
+            }
+        }
+        break;
+    }
+    case AgentProtocol::Search: {
+        QByteArray text;
+        in >> text;
+        for( qint64 id : QuerysManager::search(QString::fromUtf8(text)) ){
+            Data data;
+            if( data.load(id) ){
+                appendRecord( out, data, fields );
+                ++count;
+                sendChunk();
+            }
+        }
+        break;
+    }
+    case AgentProtocol::List: {
+        QByteArray group;
+        in >> group;
+        bool success = RecordLoader::forEach( [&](const RecordTable &chunk){
+                for( int row = 0; row < chunk.size(); ++row ){
+                    appendRecord( out, chunk.record(row), fields );
+                    ++count;
+                    sendChunk();
+                }
+                return socket->state() == QLocalSocket::ConnectedState;
+            }, RecordLoader::DEFAULT_CHUNK_SIZE, QString::fromUtf8(group) );
+        if( ! success )
+            status = AgentProtocol::Failure;
+        break;
+    }
+    default:
+        status = AgentProtocol::BadRequest;
+    }
+
+    if( in.status() != QDataStream::Ok )
+        status = AgentProtocol::BadRequest;
+    if( status == AgentProtocol::BadRequest || status == AgentProtocol::Failure ){
+        count = 0;
+        records.clear();
+    }
+    send( socket, status, count, records );
+}
+
+/*!
+ * \brief Метод отправляет кадр ответа
+ * Пока клиент не прочитал предыдущие кадры, в буфере сокета остаётся
+ * не больше одного кадра, и большой ответ не копится в памяти целиком.
+ */
+void AgentServer::send(QLocalSocket *socket, quint8 status, quint32 count, const QByteArray &records)
+{
+    QByteArray reply;
+    QDataStream header( &reply, QIODevice::WriteOnly );
+    header.setVersion( AgentProtocol::STREAM_VERSION );
+    header << status << count;
+    socket->write( AgentProtocol::frame(reply + records) );
+    while( socket->bytesToWrite() > AgentProtocol::MAX_FRAME_SIZE
+           && socket->waitForBytesWritten(WRITE_TIMEOUT) ){
+    }
+}
+
+/*!
+ * \brief Метод возвращает имена полей, выбранных маской
+ */
+QStringList AgentServer::selectedFields(quint16 mask)
+{
+    const QStringList names = VaultCommands::fieldNames();
+    if( mask == 0 )
+        return names;
+
+    QStringList fields;
+    for( int i = 0; i < names.size(); ++i ){
+        if( mask & (1u << i) )
+            fields << names.at(i);
+    }
+    return fields;
+}
+
+void AgentServer::appendRecord(QDataStream &out, const Data &data, const QStringList &fields)
+{
+    for( const QString &name : fields ){
+        out << VaultCommands::field( data, name ).toUtf8();
+    }
+}
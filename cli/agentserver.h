@@ -0,0 +1,50 @@
+#ifndef AGENTSERVER_H
+#define AGENTSERVER_H
+
+#include "vault.h"
+
+#include <QHash>
+#include <QLocalServer>
+#include <QStringList>
+#include <QTimer>
+
+class Data;
+class QDataStream;
+class QLocalSocket;
+
+/*!
+ * \brief Класс AgentServer - агент, держащий хранилище открытым
+ *
+ * Отвечает на запросы AgentProtocol через локальный сокет, доступный
+ * только текущему пользователю. Как и в окне приложения, после
+ * idleMinutes минут без запросов хранилище закрывается, расшифрованная
+ * копия удаляется и агент завершается.
+ */
+class AgentServer : public QObject
+{
+    Q_OBJECT
+private:
+    Vault                            &_vault;
+    QLocalServer                      _server;
+    QTimer                            _idleTimer;
+    QHash<QLocalSocket*, QByteArray>  _buffers;
+
+    static const int WRITE_TIMEOUT = 30000;
+
+    void handle(QLocalSocket *socket, const QByteArray &request, bool *lock);
+    static void send(QLocalSocket *socket, quint8 status, quint32 count, const QByteArray &records);
+    static QStringList selectedFields(quint16 mask);
+    static void appendRecord(QDataStream &out, const Data &data, const QStringList &fields);
+    void shutdown();
+public:
+    explicit AgentServer(Vault &vault, QObject *parent = 0);
+
+    bool listen(const QString &name, int idleMinutes);
+private slots:
+    void acceptConnection();
+    void readRequest();
+    void dropConnection();
+    void idleTimeout();
+};
+
+#endif // AGENTSERVER_H
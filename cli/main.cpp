@@ -0,0 +1,579 @@
+#include "vault.h"
+#include "vaultrekey.h"
+#include "vaultkey.h"
+#include "vaultcommands.h"
+#include "agentserver.h"
+#include "agentclient.h"
+#include "agentprotocol.h"
+#include "io/recordformat.h"
+#include "metrics/metrics.h"
+#include "passwordgenerator.h"
+#include "passwordpolicy.h"
+#include "wordlist.h"
+#include "strength/passwordstrength.h"
+#include "breach/breachindex.h"
+#include "io/transferstats.h"
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QFileInfo>
+#include <QTextStream>
+
+namespace Environment {
+    const char PASSWORD[]     = "PASSMAN_PASSWORD";
+    const char NEW_PASSWORD[] = "PASSMAN_NEW_PASSWORD";
+}
+
+/// Время простоя агента по умолчанию, как время сессии в окне приложения
+const int DEFAULT_AGENT_TIMEOUT = 5;
+
+/*!
+ * \brief Функция выполняет команду rekey
+ * Файл перешифровывается потоково, без расшифровки во временную базу.
+ * Не заданные длина ключа и число раундов берутся из заголовка файла.
+ */
+static int rekey(const QString &path,
+                 const QByteArray &passwordHash, const QByteArray &salt,
+                 const QByteArray &newPasswordHash, const QByteArray &newSalt,
+                 const QString &keyLength, const QString &rounds)
+{
+    QTextStream err( stderr );
+
+    CryptFileDevice::Header header;
+    if( ! CryptFileDevice::readHeader(path, &header) ){
+        err << "rekey: " << path << " is not an encrypted vault" << endl;
+        return ExitCode::FAILURE;
+    }
+
+    VaultRekey::Key key;
+    key.password  = newPasswordHash;
+    key.salt      = newSalt;
+    key.keyLength = header.keyLength;
+    key.numRounds = header.numRounds;
+
+    if( ! keyLength.isEmpty() ){
+        if( keyLength == "128" )
+            key.keyLength = CryptFileDevice::kAesKeyLength128;
+        else if( keyLength == "192" )
+            key.keyLength = CryptFileDevice::kAesKeyLength192;
+        else if( keyLength == "256" )
+            key.keyLength = CryptFileDevice::kAesKeyLength256;
+        else{
+            err << "Invalid --key-length value" << endl;
+            return ExitCode::USAGE;
+        }
+    }
+    if( ! rounds.isEmpty() ){
+        bool ok = false;
+        key.numRounds = rounds.toInt( &ok );
+        if( ! ok || key.numRounds < 1 ){
+            err << "Invalid --rounds value" << endl;
+            return ExitCode::USAGE;
+        }
+    }
+
+    if( ! VaultRekey::rekey(path, passwordHash, salt, key) ){
+        err << "rekey: failed" << endl;
+        return ExitCode::FAILURE;
+    }
+    return ExitCode::SUCCESS;
+}
+
+/*!
+ * \brief Функция выполняет команду generate
+ * Печатает count паролей по одному в строке; хранилище не нужно.
+ * Каждый набор из chars входит в пароль хотя бы раз; rules задаёт
+ * политику сайта целиком, см. PasswordPolicy::fromString().
+ * \param chars - наборы символов: U - заглавные, l - строчные, d - цифры,
+ * s - спецсимволы, '-' - минус, '_' - подчёркивание
+ */
+static int generate(const QString &count, const QString &length, const QString &chars,
+                    const QString &rules, const QString &forbid, bool noRepeats)
+{
+    QTextStream out( stdout );
+    QTextStream err( stderr );
+
+    bool ok = true;
+    const int passwordCount = count.isEmpty() ? 1 : count.toInt( &ok );
+    if( ! ok || passwordCount < 1 ){
+        err << "Invalid generate count" << endl;
+        return ExitCode::USAGE;
+    }
+    const int passwordLength = length.isEmpty() ? 16 : length.toInt( &ok );
+    if( ! ok || passwordLength < 1 ){
+        err << "Invalid --length value" << endl;
+        return ExitCode::USAGE;
+    }
+
+    PasswordPolicy policy;
+    if( ! rules.isEmpty() ){
+        policy = PasswordPolicy::fromString( rules, passwordLength, &ok );
+        if( ! ok ){
+            err << "Invalid --policy value" << endl;
+            return ExitCode::USAGE;
+        }
+    } else {
+        int type = 0;
+        for( const QChar &c : chars.isEmpty() ? QString("Ulds") : chars ){
+            const int setType = PasswordPolicy::charSetType( c );
+            if( setType == 0 ){
+                err << "Invalid --chars value" << endl;
+                return ExitCode::USAGE;
+            }
+            type |= setType;
+        }
+        policy = PasswordPolicy( type, passwordLength );
+    }
+    policy.setForbidden( forbid );
+    policy.setNoRepeats( noRepeats );
+
+    QString error;
+    if( ! policy.isValid(&error) ){
+        err << error << endl;
+        return ExitCode::USAGE;
+    }
+
+    // Порциями, чтобы большой count не держать в памяти целиком
+    const int BATCH = 4096;
+    for( int done = 0; done < passwordCount; done += BATCH ){
+        const QStringList passwords = policy.generate( qMin(BATCH, passwordCount - done) );
+        for( const QString &password : passwords )
+            out << password << '\n';
+    }
+    out.flush();
+
+    return SecureRandom::threadInstance().isValid() ? ExitCode::SUCCESS : ExitCode::FAILURE;
+}
+
+/*!
+ * \brief Функция выполняет команду passphrase
+ * Печатает count парольных фраз по одной в строке; хранилище не нужно.
+ * \param wordlist - код языка встроенного списка (en, ru) или путь к файлу
+ * \param capitalize - none, first или random
+ */
+static int passphrase(const QString &count, const QString &words, const QString &separator,
+                      const QString &capitalize, const QString &wordlist)
+{
+    QTextStream out( stdout );
+    QTextStream err( stderr );
+
+    bool ok = true;
+    const int passphraseCount = count.isEmpty() ? 1 : count.toInt( &ok );
+    if( ! ok || passphraseCount < 1 ){
+        err << "Invalid passphrase count" << endl;
+        return ExitCode::USAGE;
+    }
+    const int wordCount = words.isEmpty() ? 6 : words.toInt( &ok );
+    if( ! ok || wordCount < 1 ){
+        err << "Invalid --words value" << endl;
+        return ExitCode::USAGE;
+    }
+
+    PasswordGenerator::Capitalization capitalization = PasswordGenerator::Lowercase;
+    if( capitalize == "first" )
+        capitalization = PasswordGenerator::Capitalized;
+    else if( capitalize == "random" )
+        capitalization = PasswordGenerator::RandomCase;
+    else if( ! capitalize.isEmpty() && capitalize != "none" ){
+        err << "Invalid --capitalize value" << endl;
+        return ExitCode::USAGE;
+    }
+
+    const Wordlist *list = Wordlist::language( wordlist.isEmpty() ? QString("en") : wordlist );
+    if( list == nullptr ){
+        err << "Cannot load wordlist " << wordlist << endl;
+        return ExitCode::FAILURE;
+    }
+
+    for( int i = 0; i < passphraseCount; ++i )
+        out << PasswordGenerator::getPassphrase( *list, wordCount, separator, capitalization ) << '\n';
+    out.flush();
+
+    err << QString::number( PasswordGenerator::passphraseEntropy(*list, wordCount, capitalization), 'f', 1 )
+        << " bits per passphrase (" << list->count() << " words)" << endl;
+
+    return SecureRandom::threadInstance().isValid() ? ExitCode::SUCCESS : ExitCode::FAILURE;
+}
+
+/*!
+ * \brief Функция выполняет команду strength
+ * Читает пароли из stdin по одному в строке и печатает для каждого
+ * оценку 0..4, log10 числа попыток и подсказку через табуляцию.
+ */
+static int strength()
+{
+    QTextStream in( stdin );
+    QTextStream out( stdout );
+
+    QStringList passwords;
+    while( ! in.atEnd() )
+        passwords << in.readLine();
+
+    const QVector<PasswordStrength::Estimate> estimates = PasswordStrength::estimate( passwords );
+    for( const PasswordStrength::Estimate &estimate : estimates )
+        out << estimate.score << '\t' << QString::number( estimate.guessesLog10, 'f', 2 )
+            << '\t' << PasswordStrength::feedback( estimate ) << '\n';
+    out.flush();
+
+    return ExitCode::SUCCESS;
+}
+
+/*!
+ * \brief Функция выполняет команду breach-index
+ * Строит индекс утёкших паролей из списка "SHA1HEX[:count]"
+ */
+static int buildBreachIndex(const QStringList &args)
+{
+    QTextStream err( stderr );
+    if( args.size() != 2 ){
+        err << "breach-index: expected <list> <index>" << endl;
+        return ExitCode::USAGE;
+    }
+
+    TransferStats stats;
+    if( ! BreachIndex::build(args.at(0), args.at(1), &stats) ){
+        err << "breach-index: failed" << endl;
+        return ExitCode::FAILURE;
+    }
+    err << "breach-index: " << stats.summary() << endl;
+    return ExitCode::SUCCESS;
+}
+
+/*!
+ * \brief Класс MetricsDump записывает метрики при выходе из main()
+ * Объявляется до Vault, поэтому закрытие хранилища тоже попадает в замеры
+ */
+class MetricsDump
+{
+private:
+    QString _fileName;
+public:
+    explicit MetricsDump(const QString &fileName) : _fileName(fileName) {}
+    ~MetricsDump()
+    {
+        if( ! _fileName.isEmpty() && ! Metrics::dump(_fileName) )
+            QTextStream( stderr ) << "Cannot write metrics to " << _fileName << endl;
+    }
+};
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    // Общие с графическим интерфейсом настройки (число циклов хэширования)
+    QCoreApplication::setApplicationName( "PasswordManager" );
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(
+                "Headless access to PasswordManager files.\n\n"
+                "Commands:\n"
+                "  create                    create an empty vault\n"
+                "  list                      print records (of --group)\n"
+                "  get <id>...               print records by id\n"
+                "  search <text>             print records matching text\n"
+                "  set [id] --set F=V...     add a record or change record <id>\n"
+                "  delete <id>...            delete records\n"
+                "  import <file>             import .csv, .jsonl, .enc or KeePass .xml\n"
+                "  export <file>             export to .csv, .jsonl or .enc\n"
+                "  rekey                     re-encrypt the vault with a new password,\n"
+                "                            --key-length and --rounds\n"
+                "  agent                     keep the vault open and serve --agent requests\n"
+                "  ping, lock                check or stop a running agent\n"
+                "  metrics                   print counters and latencies of a running agent\n"
+                "  generate [count]          print random passwords, --length, --chars or\n"
+                "                            --policy, --forbid and --no-repeats\n"
+                "  passphrase [count]        print random passphrases, --words, --separator,\n"
+                "                            --capitalize and --wordlist\n"
+                "  strength                  rate passwords read from stdin, one per line\n"
+                "  breach-index <list> <idx> build a breached passwords index from SHA-1 lines\n"
+                "  breached                  print records whose passwords are in --breach-index\n"
+                "  audit                     print records with weak, reused, breached, expired\n"
+                "                            or old passwords, --max-age and --expiring\n\n"
+                "With --agent, get, search and list are answered by a running agent\n"
+                "without --file or a password.\n\n"
+                "Records are printed as tab-separated lines, fields: "
+                + VaultCommands::fieldNames().join(", ") + "." );
+    parser.addHelpOption();
+    parser.addPositionalArgument( "command", "Command to run." );
+    parser.addPositionalArgument( "args", "Command arguments.", "[args...]" );
+
+    QCommandLineOption fileOption( QStringList() << "f" << "file",
+                                   "Vault file.", "path" );
+    QCommandLineOption passwordOption( QStringList() << "p" << "password-file",
+                                       "Read the password from <path> ('-' for stdin)"
+                                       " instead of PASSMAN_PASSWORD.", "path" );
+    QCommandLineOption newPasswordOption( "new-password-file",
+                                          "Read the new password for rekey from <path>"
+                                          " instead of PASSMAN_NEW_PASSWORD.", "path" );
+    QCommandLineOption hashCyclesOption( "hash-cycles",
+                                         "Password hash cycles (default: GUI setting).", "n" );
+    QCommandLineOption groupOption( QStringList() << "g" << "group",
+                                    "Limit list to a group.", "name" );
+    QCommandLineOption fieldsOption( "fields",
+                                     "Comma-separated fields to print.", "list" );
+    QCommandLineOption setOption( QStringList() << "s" << "set",
+                                  "Field assignment for set, repeatable.", "Field=Value" );
+    QCommandLineOption encryptOption( "encrypt",
+                                      "Encrypt export with the vault password"
+                                      " (implied by the .enc suffix)." );
+    QCommandLineOption keyLengthOption( "key-length",
+                                        "AES key length for rekey: 128, 192 or 256"
+                                        " (default: keep).", "bits" );
+    QCommandLineOption roundsOption( "rounds",
+                                     "Key derivation rounds for rekey (default: keep).", "n" );
+    QCommandLineOption metricsOption( "metrics",
+                                      "Write counters and latency percentiles of this run"
+                                      " to <path> as JSON.", "path" );
+    QCommandLineOption lengthOption( "length",
+                                     "Password length for generate (default: 16).", "n" );
+    QCommandLineOption charsOption( "chars",
+                                    "Character sets for generate: U upper, l lower, d digits,"
+                                    " s special, - minus, _ underline (default: Ulds).", "sets" );
+    QCommandLineOption policyOption( "policy",
+                                     "Site policy for generate instead of --chars: sets with"
+                                     " optional count ranges, e.g. U1-2,l,d2,s-3.", "rules" );
+    QCommandLineOption forbidOption( "forbid",
+                                     "Characters generate must not use.", "chars" );
+    QCommandLineOption noRepeatsOption( "no-repeats",
+                                        "Use every character at most once in a generated password." );
+    QCommandLineOption wordsOption( "words",
+                                    "Word count for passphrase (default: 6).", "n" );
+    QCommandLineOption separatorOption( "separator",
+                                        "Word separator for passphrase (default: -).", "text", "-" );
+    QCommandLineOption capitalizeOption( "capitalize",
+                                         "Passphrase word case: none, first or random"
+                                         " (default: none).", "mode" );
+    QCommandLineOption wordlistOption( "wordlist",
+                                       "Passphrase wordlist: en, ru or a file with a word"
+                                       " per line (default: en).", "name" );
+    QCommandLineOption breachIndexOption( "breach-index",
+                                          "Breached passwords index for breached and audit"
+                                          " (default: GUI setting).", "path" );
+    QCommandLineOption maxAgeOption( "max-age",
+                                     "Days after which audit reports a record as old, 0 - never"
+                                     " (default: 365).", "days" );
+    QCommandLineOption expiringOption( "expiring",
+                                       "Days before PassLifeTime audit reports a password as"
+                                       " expiring (default: 14).", "days" );
+    QCommandLineOption agentOption( QStringList() << "a" << "agent",
+                                    "Send get, search and list to a running agent." );
+    QCommandLineOption socketOption( "socket",
+                                     "Agent socket name (default: "
+                                     + AgentProtocol::defaultSocketName() + ").", "name" );
+    QCommandLineOption timeoutOption( "timeout",
+                                      "Agent idle minutes before it locks the vault and exits"
+                                      " (default: " + QString::number(DEFAULT_AGENT_TIMEOUT) + ").",
+                                      "minutes" );
+    parser.addOption( fileOption );
+    parser.addOption( passwordOption );
+    parser.addOption( newPasswordOption );
+    parser.addOption( hashCyclesOption );
+    parser.addOption( groupOption );
+    parser.addOption( fieldsOption );
+    parser.addOption( setOption );
+    parser.addOption( encryptOption );
+    parser.addOption( keyLengthOption );
+    parser.addOption( roundsOption );
+    parser.addOption( metricsOption );
+    parser.addOption( lengthOption );
+    parser.addOption( charsOption );
+    parser.addOption( policyOption );
+    parser.addOption( forbidOption );
+    parser.addOption( noRepeatsOption );
+    parser.addOption( wordsOption );
+    parser.addOption( separatorOption );
+    parser.addOption( capitalizeOption );
+    parser.addOption( wordlistOption );
+    parser.addOption( breachIndexOption );
+    parser.addOption( maxAgeOption );
+    parser.addOption( expiringOption );
+    parser.addOption( agentOption );
+    parser.addOption( socketOption );
+    parser.addOption( timeoutOption );
+    parser.process( app );
+    MetricsDump metricsDump( parser.value(metricsOption) );
+
+    QTextStream err( stderr );
+    QStringList args = parser.positionalArguments();
+    if( args.isEmpty() ){
+        err << parser.helpText();
+        return ExitCode::USAGE;
+    }
+    const QString command = args.takeFirst();
+
+    QStringList fields;
+    if( parser.isSet(fieldsOption) ){
+        fields = parser.value( fieldsOption ).split( ',', QString::SkipEmptyParts );
+        for( const QString &field : fields ){
+            if( ! VaultCommands::fieldNames().contains(field) ){
+                err << "Unknown field " << field << endl;
+                return ExitCode::USAGE;
+            }
+        }
+    }
+
+    if( command == "generate" )
+        return generate( args.value(0), parser.value(lengthOption), parser.value(charsOption),
+                         parser.value(policyOption), parser.value(forbidOption),
+                         parser.isSet(noRepeatsOption) );
+    if( command == "passphrase" )
+        return passphrase( args.value(0), parser.value(wordsOption), parser.value(separatorOption),
+                           parser.value(capitalizeOption), parser.value(wordlistOption) );
+    if( command == "strength" )
+        return strength();
+    if( command == "breach-index" )
+        return buildBreachIndex( args );
+
+    const QString socketName = parser.isSet( socketOption ) ? parser.value( socketOption )
+                                                            : AgentProtocol::defaultSocketName();
+    const bool toAgent = command == "ping" || command == "lock" || command == "metrics"
+            || ( parser.isSet(agentOption)
+                 && (command == "get" || command == "search" || command == "list") );
+    if( toAgent ){
+        AgentClient client;
+        if( ! client.connectTo(socketName) ){
+            err << "No agent on " << socketName << endl;
+            return ExitCode::FAILURE;
+        }
+        client.setFields( fields );
+        if( command == "ping" )
+            return client.ping();
+        if( command == "lock" )
+            return client.lock();
+        if( command == "metrics" )
+            return client.stats();
+        if( command == "get" )
+            return client.get( args );
+        if( command == "search" )
+            return client.search( args.join(' ') );
+        return client.list( parser.value(groupOption) );
+    }
+
+    if( ! parser.isSet(fileOption) ){
+        err << parser.helpText();
+        return ExitCode::USAGE;
+    }
+
+    int agentTimeout = DEFAULT_AGENT_TIMEOUT;
+    if( parser.isSet(timeoutOption) ){
+        bool ok = false;
+        agentTimeout = parser.value( timeoutOption ).toInt( &ok );
+        if( ! ok || agentTimeout < 1 ){
+            err << "Invalid --timeout value" << endl;
+            return ExitCode::USAGE;
+        }
+    }
+
+    int hashCycles = VaultKey::hashCycles();
+    if( parser.isSet(hashCyclesOption) ){
+        bool ok = false;
+        hashCycles = parser.value( hashCyclesOption ).toInt( &ok );
+        if( ! ok || hashCycles < 1 ){
+            err << "Invalid --hash-cycles value" << endl;
+            return ExitCode::USAGE;
+        }
+    }
+
+    QString password;
+    if( ! VaultKey::readPassword(parser.value(passwordOption), Environment::PASSWORD, &password) ){
+        err << "Password is not set: use --password-file or " << Environment::PASSWORD << endl;
+        return ExitCode::USAGE;
+    }
+    const QByteArray passwordHash = VaultKey::passwordHash( password, hashCycles );
+    const QByteArray salt         = VaultKey::salt( password );
+
+    Vault vault;
+    const QString path = parser.value( fileOption );
+    if( command == "create" ){
+        if( QFileInfo::exists(path) ){
+            err << "create: " << path << " already exists" << endl;
+            return ExitCode::FAILURE;
+        }
+        return vault.create(path, passwordHash, salt) ? ExitCode::SUCCESS : ExitCode::FAILURE;
+    }
+
+    if( command == "rekey" ){
+        QString newPassword;
+        if( ! VaultKey::readPassword(parser.value(newPasswordOption), Environment::NEW_PASSWORD, &newPassword)
+                || newPassword.isEmpty() ){
+            err << "New password is not set: use --new-password-file or "
+                << Environment::NEW_PASSWORD << endl;
+            return ExitCode::USAGE;
+        }
+        return rekey( path, passwordHash, salt,
+                      VaultKey::passwordHash(newPassword, hashCycles), VaultKey::salt(newPassword),
+                      parser.value(keyLengthOption), parser.value(roundsOption) );
+    }
+
+    if( ! vault.open(path, passwordHash, salt) ){
+        err << "Cannot open " << path << endl;
+        return ExitCode::FAILURE;
+    }
+
+    if( command == "agent" ){
+        AgentServer agent( vault );
+        if( ! agent.listen(socketName, agentTimeout) )
+            return ExitCode::FAILURE;
+        return app.exec() == 0 ? ExitCode::SUCCESS : ExitCode::FAILURE;
+    }
+
+    VaultCommands commands( vault );
+    commands.setFields( fields );
+
+    // Импорт сам распознаёт зашифрованный файл; экспорт шифруется,
+    // если задан --encrypt или имя файла оканчивается на .enc
+    QString fileArg = args.value( 0 );
+    const bool encrypt = parser.isSet( encryptOption )
+            || fileArg.endsWith( RecordFormat::ENCRYPTED_SUFFIX, Qt::CaseInsensitive );
+    if( encrypt && ! fileArg.isEmpty() && ! fileArg.endsWith(RecordFormat::ENCRYPTED_SUFFIX, Qt::CaseInsensitive) )
+        fileArg += RecordFormat::ENCRYPTED_SUFFIX;
+
+    if( command == "breached" ){
+        const QString indexPath = parser.isSet( breachIndexOption ) ? parser.value( breachIndexOption )
+                                                                    : BreachIndex::configuredPath();
+        BreachIndex index;
+        if( indexPath.isEmpty() || ! index.open(indexPath) ){
+            err << "breached: no breach index, use --breach-index" << endl;
+            return ExitCode::USAGE;
+        }
+        return commands.breached( index );
+    }
+    if( command == "audit" ){
+        VaultAudit::Options options;
+        bool maxAgeOk   = true;
+        bool expiringOk = true;
+        if( parser.isSet(maxAgeOption) )
+            options.maxAgeDays = parser.value( maxAgeOption ).toInt( &maxAgeOk );
+        if( parser.isSet(expiringOption) )
+            options.expiringDays = parser.value( expiringOption ).toInt( &expiringOk );
+        if( ! maxAgeOk || ! expiringOk || options.maxAgeDays < 0 || options.expiringDays < 0 ){
+            err << "audit: invalid --max-age or --expiring value" << endl;
+            return ExitCode::USAGE;
+        }
+
+        // Индекс утёкших паролей необязателен
+        BreachIndex index;
+        const QString indexPath = parser.isSet( breachIndexOption ) ? parser.value( breachIndexOption )
+                                                                    : BreachIndex::configuredPath();
+        if( ! indexPath.isEmpty() && index.open(indexPath) )
+            options.breachIndex = &index;
+        return commands.audit( options );
+    }
+    if( command == "list" )
+        return commands.list( parser.value(groupOption) );
+    if( command == "get" )
+        return commands.get( args );
+    if( command == "search" )
+        return commands.search( args.join(' ') );
+    if( command == "set" )
+        return commands.set( args, parser.values(setOption) );
+    if( command == "delete" )
+        return commands.remove( args );
+    if( command == "import" )
+        return commands.import( fileArg, passwordHash, salt );
+    if( command == "export" )
+        return commands.exportTo( fileArg,
+                                  encrypt ? passwordHash : QByteArray(),
+                                  encrypt ? salt         : QByteArray() );
+    err << "Unknown command " << command << endl;
+    return ExitCode::USAGE;
+}
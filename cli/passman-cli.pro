@@ -0,0 +1,26 @@
+#-------------------------------------------------
+#
+# Headless command-line front end
+#
+#-------------------------------------------------
+
+QT       += network
+QT       -= gui
+
+TARGET = passman-cli
+TEMPLATE = app
+CONFIG += console
+CONFIG -= app_bundle
+
+include(../core.pri)
+
+SOURCES += main.cpp \
+    vaultcommands.cpp \
+    agentprotocol.cpp \
+    agentserver.cpp \
+    agentclient.cpp
+
+HEADERS  += vaultcommands.h \
+    agentprotocol.h \
+    agentserver.h \
+    agentclient.h
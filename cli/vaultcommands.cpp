@@ -0,0 +1,372 @@
+#include "vaultcommands.h"
+#include "breach/breachindex.h"
+#include "Data/data.h"
+#include "Data/recordtable.h"
+#include "Data/recordloader.h"
+#include "db/querysmanager.h"
+#include "io/recordformat.h"
+#include "io/recordexporter.h"
+#include "io/recordimporter.h"
+#include "io/keepassimporter.h"
+#include "io/transferstats.h"
+
+#include <QDateTime>
+#include <QElapsedTimer>
+#include <QFileInfo>
+
+VaultCommands::VaultCommands(Vault &vault) :
+    _vault(vault),
+    _out(stdout),
+    _err(stderr)
+{
+    _out.setCodec( "UTF-8" );
+    _err.setCodec( "UTF-8" );
+}
+
+/*!
+ * \brief Метод задаёт поля для вывода
+ * \param fields - имена полей (fieldNames()), пустой список - все поля
+ */
+void VaultCommands::setFields(const QStringList &fields)
+{
+    _fields = fields;
+}
+
+/*!
+ * \brief Метод возвращает имена полей записи в порядке вывода
+ */
+QStringList VaultCommands::fieldNames()
+{
+    return QStringList() << DataTable::Fields::id
+                         << RecordFormat::fieldNames();
+}
+
+/*!
+ * \brief Команда list - вывод всех записей или записей группы
+ * Записи читаются порциями, поэтому объём памяти не зависит от размера хранилища
+ */
+int VaultCommands::list(const QString &group)
+{
+    printHeader();
+    bool success = RecordLoader::forEach( [this](const RecordTable &chunk){
+            for( int row = 0; row < chunk.size(); ++row ){
+                print( chunk.record(row) );
+            }
+            return true;
+        }, RecordLoader::DEFAULT_CHUNK_SIZE, group );
+    _out.flush();
+    return success ? ExitCode::SUCCESS : ExitCode::FAILURE;
+}
+
+/*!
+ * \brief Команда get - вывод записей по идентификаторам
+ */
+int VaultCommands::get(const QStringList &args)
+{
+    QVector<qint64> ids;
+    if( ! toIds(args, &ids) ){
+        _err << "get: expected one or more record ids" << endl;
+        return ExitCode::USAGE;
+    }
+
+    int exitCode = ExitCode::SUCCESS;
+    printHeader();
+    for( qint64 id : ids ){
+        Data data;
+        if( data.load(id) ){
+            print( data );
+        }else{
+            _err << "get: record " << id << " not found" << endl;
+            exitCode = ExitCode::FAILURE;
+        }
+    }
+    _out.flush();
+    return exitCode;
+}
+
+/*!
+ * \brief Команда search - вывод записей, найденных полнотекстовым поиском
+ */
+int VaultCommands::search(const QString &text)
+{
+    if( text.isEmpty() ){
+        _err << "search: expected search text" << endl;
+        return ExitCode::USAGE;
+    }
+
+    printHeader();
+    for( qint64 id : QuerysManager::search(text) ){
+        Data data;
+        if( data.load(id) )
+            print( data );
+    }
+    _out.flush();
+    return ExitCode::SUCCESS;
+}
+
+/*!
+ * \brief Команда breached - вывод записей, пароли которых есть в индексе утёкших паролей
+ */
+int VaultCommands::breached(const BreachIndex &index)
+{
+    RecordTable records;
+    if( ! RecordLoader::load(&records) ){
+        _err << "breached: cannot read records" << endl;
+        return ExitCode::FAILURE;
+    }
+
+    printHeader();
+    for( qint64 id : index.breached(records) ){
+        Data data;
+        if( data.load(id) )
+            print( data );
+    }
+    _out.flush();
+    return ExitCode::SUCCESS;
+}
+
+/*!
+ * \brief Команда audit - проверка паролей всего хранилища
+ * Для каждой записи с проблемами выводятся id, название, логин, проблемы,
+ * оценка стойкости и число записей с тем же паролем; итог - в stderr
+ */
+int VaultCommands::audit(const VaultAudit::Options &options)
+{
+    RecordTable records;
+    if( ! RecordLoader::load(&records) ){
+        _err << "audit: cannot read records" << endl;
+        return ExitCode::FAILURE;
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+    const QVector<VaultAudit::Finding> findings = VaultAudit::run( records, options );
+
+    _out << "#Id\tResource\tLogin\tIssues\tScore\tReused\n";
+    for( const VaultAudit::Finding &finding : findings ){
+        _out << finding.id << '\t'
+             << escape( records.text(finding.row, RecordTable::Resource) ) << '\t'
+             << escape( records.text(finding.row, RecordTable::Login) ) << '\t'
+             << VaultAudit::issueNames( finding.issues ) << '\t'
+             << finding.score << '\t'
+             << finding.reuseCount << '\n';
+    }
+    _out.flush();
+
+    _err << findings.size() << " of " << records.size() << " records with issues, "
+         << timer.elapsed() << " ms" << endl;
+    return ExitCode::SUCCESS;
+}
+
+/*!
+ * \brief Команда set - создание записи или изменение существующей
+ * \param args - пусто для новой записи или id изменяемой записи
+ * \param assignments - присваивания вида Поле=Значение
+ * В stdout выводится id сохранённой записи
+ */
+int VaultCommands::set(const QStringList &args, const QStringList &assignments)
+{
+    QVector<qint64> ids;
+    if( args.size() > 1 || (! args.isEmpty() && ! toIds(args, &ids)) || assignments.isEmpty() ){
+        _err << "set: expected [id] and at least one --set Field=Value" << endl;
+        return ExitCode::USAGE;
+    }
+
+    Data data;
+    if( ids.isEmpty() ){
+        const QDateTime now = QDateTime::currentDateTime();
+        data.setCreateTime( now.toMSecsSinceEpoch() );
+        data.setPassLifeTime( now.addMonths(1).toMSecsSinceEpoch() );
+    }else{
+        if( ! data.load(ids.first()) ){
+            _err << "set: record " << ids.first() << " not found" << endl;
+            return ExitCode::FAILURE;
+        }
+        data.setEditMode( true );
+    }
+
+    if( ! apply(data, assignments) )
+        return ExitCode::USAGE;
+    if( ! data.save() || ! _vault.save() ){
+        _err << "set: cannot save record" << endl;
+        return ExitCode::FAILURE;
+    }
+
+    _out << data.id() << endl;
+    return ExitCode::SUCCESS;
+}
+
+/*!
+ * \brief Команда delete - удаление записей по идентификаторам
+ */
+int VaultCommands::remove(const QStringList &args)
+{
+    QVector<qint64> ids;
+    if( ! toIds(args, &ids) ){
+        _err << "delete: expected one or more record ids" << endl;
+        return ExitCode::USAGE;
+    }
+
+    int exitCode = ExitCode::SUCCESS;
+    for( qint64 id : ids ){
+        if( ! Data::remove(id) ){
+            _err << "delete: cannot delete record " << id << endl;
+            exitCode = ExitCode::FAILURE;
+        }
+    }
+    if( ! _vault.save() )
+        return ExitCode::FAILURE;
+    return exitCode;
+}
+
+/*!
+ * \brief Команда import - загрузка записей из CSV, JSON Lines или XML KeePass 2.x
+ * \param password, salt - ключ зашифрованного файла (*.enc)
+ */
+int VaultCommands::import(const QString &fileName, const QByteArray &password, const QByteArray &salt)
+{
+    if( fileName.isEmpty() ){
+        _err << "import: expected file name" << endl;
+        return ExitCode::USAGE;
+    }
+
+    TransferStats stats;
+    bool success;
+    if( KeePassImporter::isKdbxFile(fileName) ){
+        _err << "import: KeePass database files are not supported, export them to XML" << endl;
+        return ExitCode::FAILURE;
+    }else if( QFileInfo(fileName).suffix().compare("xml", Qt::CaseInsensitive) == 0 ){
+        success = KeePassImporter::readFile( fileName, &stats );
+    }else{
+        success = RecordImporter::readFile( fileName, &stats, password, salt );
+    }
+
+    if( ! success || ! _vault.save() ){
+        _err << "import: failed" << endl;
+        return ExitCode::FAILURE;
+    }
+    _err << stats.summary() << endl;
+    return ExitCode::SUCCESS;
+}
+
+/*!
+ * \brief Команда export - выгрузка всех записей в файл
+ * Формат определяется по расширению; для *.enc файл шифруется ключом password, salt
+ */
+int VaultCommands::exportTo(const QString &fileName, const QByteArray &password, const QByteArray &salt)
+{
+    if( fileName.isEmpty() ){
+        _err << "export: expected file name" << endl;
+        return ExitCode::USAGE;
+    }
+
+    TransferStats stats;
+    if( ! RecordExporter::writeFile(fileName, RecordFormat::fromFileName(fileName), &stats, password, salt) ){
+        _err << "export: failed" << endl;
+        return ExitCode::FAILURE;
+    }
+    _err << stats.summary() << endl;
+    return ExitCode::SUCCESS;
+}
+
+void VaultCommands::printHeader()
+{
+    const QStringList names = _fields.isEmpty() ? fieldNames() : _fields;
+    _out << "#" << names.join('\t') << '\n';
+}
+
+void VaultCommands::print(const Data &data)
+{
+    const QStringList names = _fields.isEmpty() ? fieldNames() : _fields;
+    QStringList values;
+    for( const QString &name : names ){
+        values << escape( field(data, name) );
+    }
+    _out << values.join('\t') << '\n';
+}
+
+bool VaultCommands::apply(Data &data, const QStringList &assignments)
+{
+    for( const QString &assignment : assignments ){
+        int separator = assignment.indexOf('=');
+        if( separator <= 0 ){
+            _err << "set: expected Field=Value, got " << assignment << endl;
+            return false;
+        }
+        const QString name = assignment.left( separator );
+        if( ! setField(data, name, assignment.mid(separator + 1)) ){
+            _err << "set: unknown or read-only field " << name << endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+QString VaultCommands::field(const Data &data, const QString &name)
+{
+    if( name == DataTable::Fields::id )           return QString::number( data.id() );
+    if( name == DataTable::Fields::PassGroup )    return data.group();
+    if( name == DataTable::Fields::Resource )     return data.resource();
+    if( name == DataTable::Fields::Url )          return data.url();
+    if( name == DataTable::Fields::Login )        return data.login();
+    if( name == DataTable::Fields::Password )     return data.password();
+    if( name == DataTable::Fields::Mail )         return data.mail();
+    if( name == DataTable::Fields::Phone )        return data.phone();
+    if( name == DataTable::Fields::Answer )       return data.answer();
+    if( name == DataTable::Fields::CreateTime )   return QString::number( data.createTime() );
+    if( name == DataTable::Fields::PassLifeTime ) return QString::number( data.passLifeTime() );
+    if( name == DataTable::Fields::Description )  return data.description();
+    return QString();
+}
+
+bool VaultCommands::setField(Data &data, const QString &name, const QString &value)
+{
+    if( name == DataTable::Fields::PassGroup )    { data.setGroup( value );       return true; }
+    if( name == DataTable::Fields::Resource )     { data.setResource( value );    return true; }
+    if( name == DataTable::Fields::Url )          { data.setUrl( value );         return true; }
+    if( name == DataTable::Fields::Login )        { data.setLogin( value );       return true; }
+    if( name == DataTable::Fields::Password )     { data.setPassword( value );    return true; }
+    if( name == DataTable::Fields::Mail )         { data.setMail( value );        return true; }
+    if( name == DataTable::Fields::Phone )        { data.setPhone( value );       return true; }
+    if( name == DataTable::Fields::Answer )       { data.setAnswer( value );      return true; }
+    if( name == DataTable::Fields::Description )  { data.setDescription( value ); return true; }
+
+    bool ok = false;
+    qint64 time = value.toLongLong( &ok );
+    if( ! ok )
+        return false;
+    if( name == DataTable::Fields::CreateTime )   { data.setCreateTime( time );   return true; }
+    if( name == DataTable::Fields::PassLifeTime ) { data.setPassLifeTime( time ); return true; }
+    return false;
+}
+
+QString VaultCommands::escape(const QString &value)
+{
+    QString result;
+    result.reserve( value.size() );
+    for( const QChar ch : value ){
+        switch( ch.unicode() ){
+        case '\\': result += QLatin1String("\\\\"); break;
+        case '\t': result += QLatin1String("\\t");  break;
+        case '\n': result += QLatin1String("\\n");  break;
+        case '\r': result += QLatin1String("\\r");  break;
+        default:   result += ch;
+        }
+    }
+    return result;
+}
+
+bool VaultCommands::toIds(const QStringList &args, QVector<qint64> *ids)
+{
+    if( args.isEmpty() )
+        return false;
+
+    for( const QString &arg : args ){
+        bool ok = false;
+        qint64 id = arg.toLongLong( &ok );
+        if( ! ok || id <= 0 )
+            return false;
+        ids->append( id );
+    }
+    return true;
+}
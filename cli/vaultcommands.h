@@ -0,0 +1,62 @@
+#ifndef VAULTCOMMANDS_H
+#define VAULTCOMMANDS_H
+
+#include "vault.h"
+#include "audit/vaultaudit.h"
+
+#include <QStringList>
+#include <QTextStream>
+#include <QVector>
+
+class BreachIndex;
+class Data;
+
+namespace ExitCode {
+    enum ExitCode {
+        SUCCESS = 0,
+        FAILURE = 1,    ///< Команда не выполнена
+        USAGE   = 2     ///< Неверные аргументы
+    };
+}
+
+/*!
+ * \brief Класс VaultCommands - команды passman-cli над открытым хранилищем
+ *
+ * Записи выводятся в stdout построчно, поля разделены табуляцией;
+ * табуляции и переводы строк внутри значений экранируются (\t, \n, \\).
+ * Сообщения об ошибках идут в stderr.
+ */
+class VaultCommands
+{
+private:
+    Vault       &_vault;
+    QTextStream  _out;
+    QTextStream  _err;
+    QStringList  _fields;   ///< Выводимые поля, пусто - все
+
+    void printHeader();
+    void print(const Data &data);
+    bool apply(Data &data, const QStringList &assignments);
+    static bool setField(Data &data, const QString &name, const QString &value);
+    static bool toIds(const QStringList &args, QVector<qint64> *ids);
+public:
+    explicit VaultCommands(Vault &vault);
+
+    void setFields(const QStringList &fields);
+
+    int list(const QString &group);
+    int get(const QStringList &args);
+    int search(const QString &text);
+    int set(const QStringList &args, const QStringList &assignments);
+    int remove(const QStringList &args);
+    int import(const QString &fileName, const QByteArray &password, const QByteArray &salt);
+    int exportTo(const QString &fileName, const QByteArray &password, const QByteArray &salt);
+    int breached(const BreachIndex &index);
+    int audit(const VaultAudit::Options &options);
+
+    static QStringList fieldNames();
+    static QString field(const Data &data, const QString &name);
+    static QString escape(const QString &value);
+};
+
+#endif // VAULTCOMMANDS_H
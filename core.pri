@@ -0,0 +1,103 @@
+#-------------------------------------------------
+#
+# Core of PassMan without widgets:
+# encrypted file, database, records, search, import/export.
+# Shared by the GUI (PassMan.pro), the CLI (cli/passman-cli.pro),
+# bench/ and tools/
+#
+#-------------------------------------------------
+
+QT       += core sql concurrent
+
+CONFIG += c++11
+
+INCLUDEPATH += $$PWD
+
+#openssl
+win32 {
+    INCLUDEPATH += c:/OpenSSL-Win32/include
+    LIBS += -Lc:/OpenSSL-Win32/bin -llibeay32
+}
+
+linux|macx {
+    LIBS += -lcrypto
+}
+
+# Hot-path timings (TRACE_SCOPE), see trace/trace.h:
+#   qmake CONFIG+=tracing
+tracing {
+    DEFINES += PASSMAN_TRACING
+    SOURCES += $$PWD/trace/tracer.cpp
+    HEADERS += $$PWD/trace/tracer.h
+}
+
+SOURCES += \
+    $$PWD/cryptfiledevice.cpp \
+    $$PWD/db/querysmanager.cpp \
+    $$PWD/db/connectionmanager.cpp \
+    $$PWD/definespath.cpp \
+    $$PWD/passwordgenerator.cpp \
+    $$PWD/passwordpolicy.cpp \
+    $$PWD/securerandom.cpp \
+    $$PWD/wordlist.cpp \
+    $$PWD/strength/strengthdictionary.cpp \
+    $$PWD/strength/passwordstrength.cpp \
+    $$PWD/breach/breachindex.cpp \
+    $$PWD/audit/vaultaudit.cpp \
+    $$PWD/Data/data.cpp \
+    $$PWD/Data/datanotifier.cpp \
+    $$PWD/Data/recordtable.cpp \
+    $$PWD/Data/recordloader.cpp \
+    $$PWD/dbfileprocessing.cpp \
+    $$PWD/vaultkey.cpp \
+    $$PWD/vault.cpp \
+    $$PWD/vaultrekey.cpp \
+    $$PWD/search/searchengine.cpp \
+    $$PWD/search/fuzzymatcher.cpp \
+    $$PWD/search/searchdispatcher.cpp \
+    $$PWD/io/recordformat.cpp \
+    $$PWD/io/transferstats.cpp \
+    $$PWD/io/recordexporter.cpp \
+    $$PWD/io/recordimporter.cpp \
+    $$PWD/io/keepassimporter.cpp \
+    $$PWD/metrics/histogram.cpp \
+    $$PWD/metrics/metrics.cpp
+
+HEADERS += \
+    $$PWD/cryptfiledevice.h \
+    $$PWD/db/querysmanager.h \
+    $$PWD/db/connectionmanager.h \
+    $$PWD/definespath.h \
+    $$PWD/globalenum.h \
+    $$PWD/passwordgenerator.h \
+    $$PWD/passwordpolicy.h \
+    $$PWD/securerandom.h \
+    $$PWD/wordlist.h \
+    $$PWD/strength/strengthdictionary.h \
+    $$PWD/strength/strengthdictionary_data.h \
+    $$PWD/strength/passwordstrength.h \
+    $$PWD/breach/breachindex.h \
+    $$PWD/audit/vaultaudit.h \
+    $$PWD/Data/data.h \
+    $$PWD/Data/datanotifier.h \
+    $$PWD/Data/recordtable.h \
+    $$PWD/Data/recordloader.h \
+    $$PWD/dbfileprocessing.h \
+    $$PWD/vaultkey.h \
+    $$PWD/vault.h \
+    $$PWD/vaultrekey.h \
+    $$PWD/search/searchengine.h \
+    $$PWD/search/fuzzymatcher.h \
+    $$PWD/search/searchdispatcher.h \
+    $$PWD/io/recordformat.h \
+    $$PWD/io/transferstats.h \
+    $$PWD/io/recordexporter.h \
+    $$PWD/io/recordimporter.h \
+    $$PWD/io/keepassimporter.h \
+    $$PWD/trace/trace.h \
+    $$PWD/metrics/histogram.h \
+    $$PWD/metrics/metrics.h
+
+# Built-in passphrase wordlists, see wordlist.h
+RESOURCES += \
+    $$PWD/wordlists/wordlists.qrc
@@ -1,4 +1,6 @@
 #include "cryptfiledevice.h"
+#include "metrics/metrics.h"
+#include "trace/trace.h"
 
 #include <openssl/evp.h>
 
@@ -78,6 +80,16 @@ void CryptFileDevice::setNumRounds(int numRounds)
     m_numRounds = numRounds;
 }
 
+CryptFileDevice::AesKeyLength CryptFileDevice::keyLength() const
+{
+    return m_aesKeyLength;
+}
+
+int CryptFileDevice::numRounds() const
+{
+    return m_numRounds;
+}
+
 bool CryptFileDevice::open(OpenMode mode)
 {
     if (m_device == nullptr)
@@ -142,23 +154,62 @@ bool CryptFileDevice::open(OpenMode mode)
 }
 
 void CryptFileDevice::insertHeader()
+{
+    m_device->write(makeHeader(m_password, m_salt, m_aesKeyLength, m_numRounds));
+}
+
+QByteArray CryptFileDevice::makeHeader(const QByteArray &password,
+                                       const QByteArray &salt,
+                                       AesKeyLength keyLength,
+                                       int numRounds)
 {
     QByteArray header;
     header.append(0xcd); // cryptdevice byte
-    header.append(0x01); // version
-    header.append((char *)&m_aesKeyLength, 4); // aes key length
-    header.append((char *)&m_numRounds, 4); // iteration count to use
-    QByteArray passwordHash = QCryptographicHash::hash(m_password, QCryptographicHash::Sha3_256);
+    header.append(char(kHeaderVersion)); // version
+    header.append((char *)&keyLength, 4); // aes key length
+    header.append((char *)&numRounds, 4); // iteration count to use
+    QByteArray passwordHash = QCryptographicHash::hash(password, QCryptographicHash::Sha3_256);
     header.append(passwordHash);
-    QByteArray saltHash = QCryptographicHash::hash(m_salt, QCryptographicHash::Sha3_256);
+    QByteArray saltHash = QCryptographicHash::hash(salt.mid(0, kSaltMaxLength), QCryptographicHash::Sha3_256);
     header.append(saltHash);
     QByteArray padding(kHeaderLength - header.length(), 0xcd);
     header.append(padding);
-    m_device->write(header);
+    return header;
+}
+
+qint64 CryptFileDevice::headerLength()
+{
+    return kHeaderLength;
+}
+
+/*
+ * Reads the cipher parameters of an encrypted file without the password,
+ * so that the file can be opened (and saved back) with the parameters
+ * it was written with.
+ */
+bool CryptFileDevice::readHeader(const QString &fileName, Header *header)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly))
+        return false;
+
+    QByteArray data = file.read(kHeaderLength);
+    if (data.length() != kHeaderLength || data.at(0) != (char)0xcd)
+        return false;
+
+    int aesKeyLength = *(int *)data.mid(2, 4).data();
+    if (aesKeyLength < kAesKeyLength128 || aesKeyLength > kAesKeyLength256)
+        return false;
+
+    header->version = data.at(1);
+    header->keyLength = static_cast<AesKeyLength>(aesKeyLength);
+    header->numRounds = *(int *)data.mid(6, 4).data();
+    return header->numRounds > 0;
 }
 
 bool CryptFileDevice::tryParseHeader()
 {
+    TRACE_SCOPE("crypt.header");
     QByteArray header = m_device->read(kHeaderLength);
     if (header.length() != kHeaderLength)
         return false;
@@ -298,6 +349,7 @@ qint64 CryptFileDevice::readData(char *data, qint64 len)
         return 0;
 
     memcpy(data, ba.data(), ba.length());
+    Metrics::add(Metrics::BytesDecrypted, ba.length());
 
     return ba.length();
 }
@@ -309,6 +361,7 @@ qint64 CryptFileDevice::writeData(const char *data, qint64 len)
 
     QScopedPointer<char> cipherText(encrypt(data, len));
     m_device->write(cipherText.data(), len);
+    Metrics::add(Metrics::BytesEncrypted, len);
 
     return len;
 }
@@ -350,12 +403,29 @@ void CryptFileDevice::initCtr(CtrState *state, const unsigned char *iv)
 
 bool CryptFileDevice::initCipher()
 {
+    unsigned char iv[EVP_MAX_IV_LENGTH];
+    if (!deriveKey(m_password, m_salt, m_aesKeyLength, m_numRounds, &m_aesKey, iv))
+        return false;
+
+    initCtr(&m_ctrState, iv);
+
+    return true;
+}
+
+bool CryptFileDevice::deriveKey(const QByteArray &password,
+                                const QByteArray &salt,
+                                AesKeyLength keyLength,
+                                int numRounds,
+                                AES_KEY *aesKey,
+                                unsigned char *iv)
+{
+    TRACE_SCOPE("crypt.kdf");
     const EVP_CIPHER *cipher = EVP_enc_null();
-    if (m_aesKeyLength == kAesKeyLength128)
+    if (keyLength == kAesKeyLength128)
         cipher = EVP_aes_128_cbc();
-    else if (m_aesKeyLength == kAesKeyLength192)
+    else if (keyLength == kAesKeyLength192)
         cipher = EVP_aes_192_cbc();
-    else if (m_aesKeyLength == kAesKeyLength256)
+    else if (keyLength == kAesKeyLength256)
         cipher = EVP_aes_256_cbc();
     else
         Q_ASSERT_X(false, Q_FUNC_INFO, "Unknown value of AesKeyLength");
@@ -365,18 +435,17 @@ bool CryptFileDevice::initCipher()
 
     EVP_CIPHER_CTX_init(&ctx);
     EVP_EncryptInit_ex(&ctx, cipher, nullptr, nullptr, nullptr);
-    int keyLength = EVP_CIPHER_CTX_key_length(&ctx);
-    int ivLength = EVP_CIPHER_CTX_iv_length(&ctx);
+    int cipherKeyLength = EVP_CIPHER_CTX_key_length(&ctx);
 
-    unsigned char key[keyLength];
-    unsigned char iv[ivLength];
+    unsigned char key[EVP_MAX_KEY_LENGTH];
+    QByteArray saltBytes = salt.mid(0, kSaltMaxLength);
 
     int ok = EVP_BytesToKey(cipher,
                             EVP_sha256(),
-                            m_salt.isEmpty() ? nullptr : reinterpret_cast<unsigned char *>(m_salt.data()),
-                            reinterpret_cast<unsigned char *>(m_password.data()),
-                            m_password.length(),
-                            m_numRounds,
+                            saltBytes.isEmpty() ? nullptr : reinterpret_cast<const unsigned char *>(saltBytes.constData()),
+                            reinterpret_cast<const unsigned char *>(password.constData()),
+                            password.length(),
+                            numRounds,
                             key,
                             iv);
 
@@ -385,13 +454,8 @@ bool CryptFileDevice::initCipher()
     if (ok == 0)
         return false;
 
-    int res = AES_set_encrypt_key(key, keyLength * 8, &m_aesKey);
-    if (res != 0)
-        return false;
-
-    initCtr(&m_ctrState, iv);
-
-    return true;
+    int res = AES_set_encrypt_key(key, cipherKeyLength * 8, aesKey);
+    return res == 0;
 }
 
 char * CryptFileDevice::encrypt(const char *plainText, qint64 len)
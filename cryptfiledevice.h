@@ -26,6 +26,15 @@ public:
         kAesKeyLength256
     };
 
+    static const int kHeaderVersion = 1;
+
+    struct Header
+    {
+        int version = 0;
+        AesKeyLength keyLength = kAesKeyLength256;
+        int numRounds = 5;
+    };
+
     explicit CryptFileDevice(QObject *parent = 0);
     explicit CryptFileDevice(QFileDevice *device, QObject *parent = 0);
     explicit CryptFileDevice(QFileDevice *device,
@@ -50,6 +59,8 @@ public:
     void setSalt(const QByteArray &salt);
     void setKeyLength(AesKeyLength keyLength);
     void setNumRounds(int numRounds);
+    AesKeyLength keyLength() const;
+    int numRounds() const;
 
     bool isEncrypted() const;
     qint64 size() const;
@@ -63,6 +74,19 @@ public:
     bool exists() const;
     bool rename(const QString &newName);
 
+    static qint64 headerLength();
+    static bool readHeader(const QString &fileName, Header *header);
+    static QByteArray makeHeader(const QByteArray &password,
+                                 const QByteArray &salt,
+                                 AesKeyLength keyLength,
+                                 int numRounds);
+    static bool deriveKey(const QByteArray &password,
+                          const QByteArray &salt,
+                          AesKeyLength keyLength,
+                          int numRounds,
+                          AES_KEY *aesKey,
+                          unsigned char *iv);
+
 protected:
     qint64 readData(char *data, qint64 len);
     qint64 writeData(const char *data, qint64 len);
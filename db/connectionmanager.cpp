@@ -1,8 +1,11 @@
 #include "db/connectionmanager.h"
 #include <QDebug>
 #include <QDir>
+#ifdef QT_WIDGETS_LIB
 #include <QMessageBox>
+#endif
 #include <definespath.h>
+#include "trace/trace.h"
 #include <QDateTime>
 
 /*!
@@ -19,8 +22,11 @@ ConnectionManager::ConnectionManager()
     // Проверяем доступность драйвера
     if( ! QSqlDatabase::isDriverAvailable(dbDriv) ){
         qCritical() << "Cannot avalible QSQLITE driver";
+#ifdef QT_WIDGETS_LIB
+        // Консольная сборка без виджетов обходится сообщением в лог
         QMessageBox::critical(0, QObject::tr("Critical"),
                     QObject::tr("Cannot avalible database driver"));
+#endif
         return;
     }
 
@@ -49,6 +55,7 @@ ConnectionManager::~ConnectionManager()
  */
 bool ConnectionManager::open(const QString &filePath)
 {
+    TRACE_SCOPE( "db.open" );
     QString dbFileName;
     QString dbPath;
     if( filePath.isEmpty() || filePath.isNull() ){
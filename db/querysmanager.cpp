@@ -1,9 +1,32 @@
 #include "db/querysmanager.h"
+#include "Data/recordtable.h"
+#include "metrics/metrics.h"
+#include "trace/trace.h"
 
 #include <QSqlQuery>
 #include <QSqlError>
+#include <QStringList>
 #include <QDebug>
 
+namespace DataSearchTable {
+    const QString tableName("DataSearch");
+
+    /// Минимальная длина запроса, с которой работает trigram-токенизатор
+    const int MIN_MATCH_LENGTH = 3;
+    const int MAX_RESULTS      = 1000;
+}
+
+namespace GroupCatalogTable {
+    const QString tableName("GroupCatalog");
+
+    namespace Fields{
+        const QString PassGroup("PassGroup");
+        const QString RecordCount("RecordCount");
+    }
+}
+
+bool QuerysManager::_fullTextSearch = false;
+
 QuerysManager::QuerysManager()
 {
 
@@ -42,9 +65,213 @@ bool QuerysManager::createTable_Data()
     return true;
 }
 
+/*!
+ * \brief Метод проверяет, собран ли SQLite с модулем FTS5 и trigram-токенизатором
+ * \return true - если полнотекстовый индекс может быть создан
+ */
+bool QuerysManager::isFullTextSearchAvailable()
+{
+    QSqlQuery query;
+    if( ! query.exec("CREATE VIRTUAL TABLE temp.DataSearchProbe USING fts5(x, tokenize='trigram');") ){
+        return false;
+    }
+    query.exec("DROP TABLE temp.DataSearchProbe;");
+    return true;
+}
+
+/*!
+ * \brief Метод создаёт полнотекстовый индекс FTS5 над таблицей Data
+ * и триггеры, поддерживающие его в актуальном состоянии.
+ * Если SQLite собран без FTS5 - триггеры удаляются, чтобы запись в Data
+ * не ломалась, а поиск откатывается на LIKE.
+ * \return true - если индекс готов к использованию
+ */
+bool QuerysManager::createTable_DataSearch()
+{
+    const QStringList triggers = QStringList() << "Data_SearchInsert"
+                                               << "Data_SearchDelete"
+                                               << "Data_SearchUpdate";
+    QSqlQuery query;
+
+    if( ! isFullTextSearchAvailable() ){
+        qWarning() << "SQLite has no FTS5 trigram tokenizer, search falls back to LIKE";
+        for( const QString &trigger : triggers ){
+            query.exec( QString("DROP TRIGGER IF EXISTS %1;").arg(trigger) );
+        }
+        return false;
+    }
+
+    // Индекс устарел, если его нет или его триггеры удалялись при открытии без FTS5
+    bool needRebuild = true;
+    query.prepare( "SELECT COUNT(*) FROM sqlite_master WHERE type = 'trigger' AND name = :name" );
+    query.bindValue( ":name", triggers.first() );
+    Metrics::add( Metrics::QueriesExecuted );
+    if( query.exec() && query.first() ){
+        needRebuild = ( query.value(0).toInt() == 0 );
+    }
+
+    const QString indexedFields("Resource, Url, Login, Mail, Description");
+    const QString newValues("new.Resource, new.Url, new.Login, new.Mail, new.Description");
+    const QString oldValues("old.Resource, old.Url, old.Login, old.Mail, old.Description");
+
+    QStringList sqlList;
+    sqlList << QString("CREATE VIRTUAL TABLE IF NOT EXISTS %1 USING fts5("
+                       "%2, content='%3', content_rowid='id', tokenize='trigram');"
+                       ).arg( DataSearchTable::tableName, indexedFields, DataTable::tableName );
+    sqlList << QString("CREATE TRIGGER IF NOT EXISTS %1 AFTER INSERT ON %2 BEGIN "
+                       "INSERT INTO %3(rowid, %4) VALUES (new.id, %5); "
+                       "END;"
+                       ).arg( triggers.at(0), DataTable::tableName, DataSearchTable::tableName,
+                              indexedFields, newValues );
+    sqlList << QString("CREATE TRIGGER IF NOT EXISTS %1 AFTER DELETE ON %2 BEGIN "
+                       "INSERT INTO %3(%3, rowid, %4) VALUES ('delete', old.id, %5); "
+                       "END;"
+                       ).arg( triggers.at(1), DataTable::tableName, DataSearchTable::tableName,
+                              indexedFields, oldValues );
+    sqlList << QString("CREATE TRIGGER IF NOT EXISTS %1 AFTER UPDATE ON %2 BEGIN "
+                       "INSERT INTO %3(%3, rowid, %4) VALUES ('delete', old.id, %5); "
+                       "INSERT INTO %3(rowid, %4) VALUES (new.id, %6); "
+                       "END;"
+                       ).arg( triggers.at(2), DataTable::tableName, DataSearchTable::tableName,
+                              indexedFields, oldValues, newValues );
+    if( needRebuild ){
+        sqlList << QString("INSERT INTO %1(%1) VALUES ('rebuild');").arg( DataSearchTable::tableName );
+    }
+
+    for( const QString &sql : sqlList ){
+        if( ! query.exec(sql) ){
+            qCritical() << QString("Table %1 is not created!").arg( DataSearchTable::tableName )
+                        << "\nSqlError: "
+                        << query.lastError();
+            return false;
+        }
+    }
+    return true;
+}
+
+/*!
+ * \brief Метод создаёт индекс (PassGroup, id), по которому главная таблица
+ * считает записи группы и читает их постранично без полного просмотра Data
+ * \return true - если индекс создан
+ */
+bool QuerysManager::createIndex_DataGroup()
+{
+    QSqlQuery query;
+    if( ! query.exec( QString("CREATE INDEX IF NOT EXISTS Data_PassGroup_id ON %1(%2, %3);"
+                              ).arg( DataTable::tableName,
+                                     DataTable::Fields::PassGroup,
+                                     DataTable::Fields::id ) ) ){
+        qCritical() << "Index Data_PassGroup_id is not created!"
+                    << "\nSqlError: "
+                    << query.lastError();
+        return false;
+    }
+    return true;
+}
+
+/*!
+ * \brief Метод создаёт каталог групп GroupCatalog с количеством записей в каждой
+ * Каталог ведётся триггерами в той же транзакции, что и запись в Data,
+ * и заполняется агрегатом по Data только один раз - при создании триггеров.
+ * Для подсчёта просроченных паролей создаётся индекс по PassLifeTime.
+ * \return true - если каталог готов к использованию
+ */
+bool QuerysManager::createTable_GroupCatalog()
+{
+    const QStringList triggers = QStringList() << "Data_CatalogInsert"
+                                               << "Data_CatalogDelete"
+                                               << "Data_CatalogUpdate";
+    QSqlQuery query;
+
+    bool needSeed = true;
+    query.prepare( "SELECT COUNT(*) FROM sqlite_master WHERE type = 'trigger' AND name = :name" );
+    query.bindValue( ":name", triggers.first() );
+    Metrics::add( Metrics::QueriesExecuted );
+    if( query.exec() && query.first() ){
+        needSeed = ( query.value(0).toInt() == 0 );
+    }
+
+    // Записи без группы (NULL) учитываются в группе '' - в первичном ключе
+    // не-INTEGER NULL не уникален и каждая такая запись дала бы свою строку
+    const QString increment = QString("INSERT OR IGNORE INTO %1(%2, %3) VALUES (COALESCE(new.%2, ''), 0); "
+                                      "UPDATE %1 SET %3 = %3 + 1 WHERE %2 = COALESCE(new.%2, ''); "
+                                      ).arg( GroupCatalogTable::tableName,
+                                             GroupCatalogTable::Fields::PassGroup,
+                                             GroupCatalogTable::Fields::RecordCount );
+    const QString decrement = QString("UPDATE %1 SET %3 = %3 - 1 WHERE %2 = COALESCE(old.%2, ''); "
+                                      "DELETE FROM %1 WHERE %2 = COALESCE(old.%2, '') AND %3 <= 0; "
+                                      ).arg( GroupCatalogTable::tableName,
+                                             GroupCatalogTable::Fields::PassGroup,
+                                             GroupCatalogTable::Fields::RecordCount );
+
+    // Каталог первой версии допускал NULL в PassGroup - пересоздаётся
+    query.prepare( QString("PRAGMA table_info(%1)").arg( GroupCatalogTable::tableName ) );
+    Metrics::add( Metrics::QueriesExecuted );
+    bool nullableGroup = false;
+    if( query.exec() ){
+        while( query.next() ){
+            if( query.value("name").toString() == GroupCatalogTable::Fields::PassGroup )
+                nullableGroup = ( query.value("notnull").toInt() == 0 );
+        }
+    }
+
+    QStringList sqlList;
+    if( nullableGroup ){
+        for( const QString &trigger : triggers )
+            sqlList << QString("DROP TRIGGER IF EXISTS %1;").arg( trigger );
+        sqlList << QString("DROP TABLE %1;").arg( GroupCatalogTable::tableName );
+        needSeed = true;
+    }
+    sqlList << QString("CREATE TABLE IF NOT EXISTS %1( "
+                       "%2 VARCHAR(32) NOT NULL PRIMARY KEY, "
+                       "%3 INTEGER NOT NULL DEFAULT 0 "
+                       ");").arg( GroupCatalogTable::tableName,
+                                  GroupCatalogTable::Fields::PassGroup,
+                                  GroupCatalogTable::Fields::RecordCount );
+    sqlList << QString("CREATE INDEX IF NOT EXISTS Data_PassLifeTime ON %1(%2);"
+                       ).arg( DataTable::tableName, DataTable::Fields::PassLifeTime );
+    sqlList << QString("CREATE TRIGGER IF NOT EXISTS %1 AFTER INSERT ON %2 BEGIN %3END;"
+                       ).arg( triggers.at(0), DataTable::tableName, increment );
+    sqlList << QString("CREATE TRIGGER IF NOT EXISTS %1 AFTER DELETE ON %2 BEGIN %3END;"
+                       ).arg( triggers.at(1), DataTable::tableName, decrement );
+    sqlList << QString("CREATE TRIGGER IF NOT EXISTS %1 AFTER UPDATE OF %2 ON %3 "
+                       "WHEN old.%2 IS NOT new.%2 BEGIN %4%5END;"
+                       ).arg( triggers.at(2), DataTable::Fields::PassGroup, DataTable::tableName,
+                              decrement, increment );
+    if( needSeed ){
+        sqlList << QString("DELETE FROM %1;").arg( GroupCatalogTable::tableName );
+        sqlList << QString("INSERT INTO %1(%2, %3) SELECT COALESCE(%4, ''), COUNT(*) FROM %5 "
+                           "GROUP BY COALESCE(%4, '');"
+                           ).arg( GroupCatalogTable::tableName,
+                                  GroupCatalogTable::Fields::PassGroup,
+                                  GroupCatalogTable::Fields::RecordCount,
+                                  DataTable::Fields::PassGroup,
+                                  DataTable::tableName );
+    }
+
+    for( const QString &sql : sqlList ){
+        if( ! query.exec(sql) ){
+            qCritical() << QString("Table %1 is not created!").arg( GroupCatalogTable::tableName )
+                        << "\nSqlError: "
+                        << query.lastError();
+            return false;
+        }
+    }
+    return true;
+}
+
 bool QuerysManager::createTables()
 {
-    return createTable_Data();
+    TRACE_SCOPE( "db.schema" );
+    if( ! createTable_Data() )
+        return false;
+
+    createIndex_DataGroup();
+    if( ! createTable_GroupCatalog() )
+        return false;
+
+    _fullTextSearch = createTable_DataSearch();
+    return true;
 }
 
 bool QuerysManager::insert(Data &)
@@ -52,3 +279,188 @@ bool QuerysManager::insert(Data &)
     return false;
 }
 
+/*!
+ * \brief Метод вставляет записи одним подготовленным запросом
+ * id записей не используются - база выдаёт новые.
+ * Транзакцией управляет вызывающий код.
+ * \param records - вставляемые записи
+ * \return true - если вставлены все записи
+ */
+bool QuerysManager::insert(const RecordTable &records)
+{
+    QSqlQuery query;
+    query.prepare( QString("INSERT INTO %1("
+                           "PassGroup, Resource, Url, Login,"
+                           "Password, Mail, Phone,"
+                           "Answer, Description, CreateTime, PassLifeTime"
+                           ") VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);").arg(DataTable::tableName) );
+
+    for( int row = 0; row < records.size(); ++row ){
+        query.bindValue( 0, records.group(row) );
+        for( int field = 0; field < RecordTable::TextFieldCount; ++field ){
+            query.bindValue( 1 + field, records.text(row, RecordTable::TextField(field)) );
+        }
+        query.bindValue( 9, records.createTime(row) );
+        query.bindValue( 10, records.passLifeTime(row) );
+
+        Metrics::add( Metrics::QueriesExecuted );
+        if( ! query.exec() ){
+            qCritical() << "Cannot insert Data to database\n"
+                        << "SqlError: " << query.lastError();
+            return false;
+        }
+    }
+    return true;
+}
+
+/*!
+ * \brief Метод читает каталог групп
+ * \return группы по алфавиту с количеством записей
+ */
+QVector< QPair<QString, qint64> > QuerysManager::groups()
+{
+    QVector< QPair<QString, qint64> > result;
+
+    QSqlQuery query;
+    query.setForwardOnly( true );
+    if( ! query.exec( QString("SELECT COALESCE(%1, ''), %2 FROM %3 ORDER BY 1"
+                              ).arg( GroupCatalogTable::Fields::PassGroup,
+                                     GroupCatalogTable::Fields::RecordCount,
+                                     GroupCatalogTable::tableName ) ) ){
+        qCritical() << "Cannot select group catalog\n"
+                    << "SqlError: " << query.lastError();
+        return result;
+    }
+    while( query.next() ){
+        result.append( qMakePair( query.value(0).toString(), query.value(1).toLongLong() ) );
+    }
+    return result;
+}
+
+/*!
+ * \brief Метод считает пароли, срок которых истёк в промежутке (after, now]
+ * Просматривает индекс PassLifeTime только в этом диапазоне: по умолчанию
+ * все истёкшие (при открытии), затем - истёкшие с прошлой проверки
+ * \param now - текущее время, мс от начала эпохи
+ * \param after - время прошлой проверки
+ * \return количество паролей по группам, записи без группы - в группе ""
+ */
+QHash<QString, qint64> QuerysManager::expiredCounts(qint64 now, qint64 after)
+{
+    QHash<QString, qint64> result;
+
+    QSqlQuery query;
+    query.setForwardOnly( true );
+    query.prepare( QString("SELECT %1, COUNT(*) FROM %2 WHERE %3 > :after AND %3 <= :now GROUP BY %1"
+                           ).arg( DataTable::Fields::PassGroup,
+                                  DataTable::tableName,
+                                  DataTable::Fields::PassLifeTime ) );
+    query.bindValue( ":after", after );
+    query.bindValue( ":now", now );
+    Metrics::add( Metrics::QueriesExecuted );
+    if( ! query.exec() ){
+        qCritical() << "Cannot count expired passwords\n"
+                    << "SqlError: " << query.lastError();
+        return result;
+    }
+    while( query.next() ){
+        result[ query.value(0).toString() ] += query.value(1).toLongLong();
+    }
+    return result;
+}
+
+/*!
+ * \brief Метод возвращает ближайший срок пароля позже after
+ * Одно чтение индекса PassLifeTime
+ * \return -1, если таких сроков нет
+ */
+qint64 QuerysManager::nextExpiry(qint64 after)
+{
+    QSqlQuery query;
+    query.prepare( QString("SELECT MIN(%1) FROM %2 WHERE %1 > :after"
+                           ).arg( DataTable::Fields::PassLifeTime, DataTable::tableName ) );
+    query.bindValue( ":after", after );
+    Metrics::add( Metrics::QueriesExecuted );
+    if( ! query.exec() || ! query.first() ){
+        qCritical() << "Cannot select next password expiry\n"
+                    << "SqlError: " << query.lastError();
+        return -1;
+    }
+    return query.value(0).isNull() ? -1 : query.value(0).toLongLong();
+}
+
+/*!
+ * \brief Метод позволяет узнать, доступен ли полнотекстовый индекс
+ * \return true - если поиск идёт через FTS5
+ */
+bool QuerysManager::hasFullTextSearch()
+{
+    return _fullTextSearch;
+}
+
+/*!
+ * \brief Метод выполняет поиск записей по полям Resource, Url, Login, Mail и Description
+ * во всех группах. Запросы от трёх символов идут через индекс FTS5 с ранжированием,
+ * более короткие (или при отсутствии FTS5) - через LIKE.
+ * \param text - искомая подстрока
+ * \return идентификаторы найденных записей в порядке ранжирования
+ */
+QVector<qint64> QuerysManager::search(const QString &text)
+{
+    TRACE_SCOPE( "search.sql" );
+    ScopedLatency latency( Metrics::Search );
+    Metrics::add( Metrics::Searches );
+    QSqlQuery query;
+    query.setForwardOnly( true );
+    const QString column = DataTable::tableName + "." + DataTable::Fields::id;
+
+    if( _fullTextSearch && text.length() >= DataSearchTable::MIN_MATCH_LENGTH ){
+        QString sql("SELECT %1 FROM %2 JOIN %3 ON %3.id = %2.rowid "
+                    "WHERE %2 MATCH :pattern ORDER BY %2.rank LIMIT %4");
+        sql = sql.arg( column,
+                       DataSearchTable::tableName,
+                       DataTable::tableName,
+                       QString::number(DataSearchTable::MAX_RESULTS) );
+        query.prepare( sql );
+
+        // Фраза в кавычках - trigram-токенизатор ищет её как подстроку
+        QString pattern = text;
+        pattern.replace( "\"", "\"\"" );
+        query.bindValue( ":pattern", "\"" + pattern + "\"" );
+    }else{
+        QString sql("SELECT %1 FROM %2 WHERE "
+                    "%3 LIKE ? ESCAPE '\\' OR %4 LIKE ? ESCAPE '\\' OR %5 LIKE ? ESCAPE '\\' "
+                    "OR %6 LIKE ? ESCAPE '\\' OR %7 LIKE ? ESCAPE '\\' "
+                    "LIMIT %8");
+        sql = sql.arg( column,
+                       DataTable::tableName,
+                       DataTable::Fields::Resource,
+                       DataTable::Fields::Url,
+                       DataTable::Fields::Login,
+                       DataTable::Fields::Mail,
+                       DataTable::Fields::Description,
+                       QString::number(DataSearchTable::MAX_RESULTS) );
+        query.prepare( sql );
+
+        // '%' и '_' в запросе ищутся как обычные символы
+        QString pattern = text;
+        pattern.replace( "\\", "\\\\" );
+        pattern.replace( "%", "\\%" );
+        pattern.replace( "_", "\\_" );
+        for( int i = 0; i < 5; ++i ){
+            query.addBindValue( "%" + pattern + "%" );
+        }
+    }
+
+    QVector<qint64> ids;
+    Metrics::add( Metrics::QueriesExecuted );
+    if( ! query.exec() ){
+        qCritical() << "Cannot search Data in database\n"
+                    << "SqlError: " << query.lastError();
+        return ids;
+    }
+    while( query.next() ){
+        ids.append( query.value(0).toLongLong() );
+    }
+    return ids;
+}
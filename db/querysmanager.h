@@ -3,16 +3,39 @@
 
 #include <Data/data.h>
 
+#include <QHash>
+#include <QPair>
+#include <QVector>
+
+#include <limits>
+
+class RecordTable;
+
 class QuerysManager
 {
 private:
+    static bool _fullTextSearch;
+
     QuerysManager();
     ~QuerysManager();
     static bool createTable_Data();
+    static bool createTable_DataSearch();
+    static bool isFullTextSearchAvailable();
+    static bool createIndex_DataGroup();
+    static bool createTable_GroupCatalog();
 public:
     static bool createTables();
     static bool insert( Data &data );
+    static bool insert( const RecordTable &records );
     static bool update( Data &data );
+
+    static QVector< QPair<QString, qint64> > groups();
+    static QHash<QString, qint64> expiredCounts( qint64 now,
+                                                 qint64 after = std::numeric_limits<qint64>::min() );
+    static qint64 nextExpiry( qint64 after );
+
+    static bool hasFullTextSearch();
+    static QVector<qint64> search( const QString &text );
 };
 
 #endif // QUERYSMANAGER_H
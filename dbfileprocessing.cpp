@@ -1,9 +1,11 @@
 #include "cryptfiledevice.h"
 #include "dbfileprocessing.h"
+#include "metrics/metrics.h"
+#include "trace/trace.h"
 
 #include <QFile>
 #include <QDebug>
-#include <QApplication>
+#include <QCoreApplication>
 
 
 DbFileProcessing::DbFileProcessing(const QString    &achtungDbPath,
@@ -22,12 +24,21 @@ DbFileProcessing::DbFileProcessing(const QString    &achtungDbPath,
 
 bool DbFileProcessing::openEncryptFile()
 {
+    TRACE_SCOPE( "vault.decrypt" );
+    ScopedLatency latency( Metrics::Open );
+    // Параметры шифра берутся из заголовка файла и запоминаются,
+    // чтобы saveEncryptFile() записал файл с теми же параметрами
+    CryptFileDevice::Header header;
+    if( ! _password.isEmpty() && CryptFileDevice::readHeader(_encryptDbPath, &header) ){
+        _keyLength = header.keyLength;
+        _numRounds = header.numRounds;
+    }
+
     CryptFileDevice encDB( _encryptDbPath, _password, _salt );
     QFile achtungDB( _achtungDbPath );
 
-//    encDB.setKeyLength( CryptFileDevice::kAesKeyLength128 );
-//    encDB.setKeyLength( CryptFileDevice::kAesKeyLength192 );
-    encDB.setKeyLength( CryptFileDevice::kAesKeyLength256 );
+    encDB.setKeyLength( _keyLength );
+    encDB.setNumRounds( _numRounds );
 
     if ( ! encDB.open(QIODevice::ReadOnly) ){
         qCritical() << "[DbFileProcessing::readEncryptFile()] "
@@ -54,7 +65,7 @@ bool DbFileProcessing::openEncryptFile()
     while ( ! encDB.atEnd() ) {
         QByteArray buffer = encDB.read( _bufferSize );
         achtungDB.write( buffer );
-        qApp->processEvents(); // Обработка событий
+        QCoreApplication::processEvents(); // Обработка событий
     }
 
     qDebug() << "1.encDB.bytesAvailable(): " << encDB.bytesAvailable();
@@ -68,8 +79,13 @@ bool DbFileProcessing::openEncryptFile()
 
 bool DbFileProcessing::saveEncryptFile()
 {
+    TRACE_SCOPE( "vault.encrypt" );
+    ScopedLatency latency( Metrics::Save );
+    Metrics::add( Metrics::Saves );
     QFile achtungDbFile( _achtungDbPath );
     CryptFileDevice encryptDbfile( _encryptDbPath, _password, _salt );
+    encryptDbfile.setKeyLength( _keyLength );
+    encryptDbfile.setNumRounds( _numRounds );
 
     if ( ! achtungDbFile.open(QIODevice::ReadOnly) ){
         qCritical() << "[DbFileProcessing::saveEncryptFile()] "
@@ -92,3 +108,23 @@ bool DbFileProcessing::saveEncryptFile()
 
     return true;
 }
+
+CryptFileDevice::AesKeyLength DbFileProcessing::keyLength() const
+{
+    return _keyLength;
+}
+
+void DbFileProcessing::setKeyLength(CryptFileDevice::AesKeyLength keyLength)
+{
+    _keyLength = keyLength;
+}
+
+int DbFileProcessing::numRounds() const
+{
+    return _numRounds;
+}
+
+void DbFileProcessing::setNumRounds(int numRounds)
+{
+    _numRounds = numRounds;
+}
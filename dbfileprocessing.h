@@ -3,6 +3,8 @@
 
 #include <QString>
 
+#include "cryptfiledevice.h"
+
 class DbFileProcessing
 {
 private:
@@ -11,6 +13,8 @@ private:
     QByteArray _password;
     QByteArray _salt;
     size_t     _bufferSize = 51200;
+    CryptFileDevice::AesKeyLength _keyLength = CryptFileDevice::kAesKeyLength256;
+    int        _numRounds = 5;
 public:
     explicit DbFileProcessing(const QString    &achtungDbPath,
                               const QString    &encryptDbPath,
@@ -19,6 +23,11 @@ public:
                               const size_t     bufferSize = 51200);
     bool openEncryptFile();
     bool saveEncryptFile();
+
+    CryptFileDevice::AesKeyLength keyLength() const;
+    void setKeyLength(CryptFileDevice::AesKeyLength keyLength);
+    int numRounds() const;
+    void setNumRounds(int numRounds);
 };
 
 #endif // DBFILEPROCESSING_H
@@ -0,0 +1,49 @@
+#include "diagnosticsdialog.h"
+#include "ui_diagnosticsdialog.h"
+#include "metrics/metrics.h"
+
+#include <QFileDialog>
+#include <QFontDatabase>
+#include <QMessageBox>
+#include <QStandardPaths>
+
+DiagnosticsDialog::DiagnosticsDialog(QWidget *parent) :
+    QDialog(parent),
+    ui(new Ui::DiagnosticsDialog)
+{
+    ui->setupUi(this);
+    ui->PlainTextEdit_Metrics->setFont( QFontDatabase::systemFont(QFontDatabase::FixedFont) );
+
+    connect( &_refreshTimer, SIGNAL(timeout()), this, SLOT(refresh()) );
+    _refreshTimer.start( REFRESH_INTERVAL );
+    refresh();
+}
+
+DiagnosticsDialog::~DiagnosticsDialog()
+{
+    delete ui;
+}
+
+void DiagnosticsDialog::refresh()
+{
+    ui->PlainTextEdit_Metrics->setPlainText( Metrics::toText() );
+}
+
+void DiagnosticsDialog::on_PushButton_Reset_clicked()
+{
+    Metrics::reset();
+    refresh();
+}
+
+void DiagnosticsDialog::on_PushButton_Save_clicked()
+{
+    QString fileName = QFileDialog::getSaveFileName(this,
+                                                    tr("Save metrics"),
+                                                    QStandardPaths::writableLocation( QStandardPaths::HomeLocation ),
+                                                    tr("JSON (*.json)") );
+    if( fileName.isEmpty() )
+        return;
+
+    if( ! Metrics::dump(fileName) )
+        QMessageBox::warning( this, tr("Warning"), tr("Cannot write file ") + fileName );
+}
@@ -0,0 +1,35 @@
+#ifndef DIAGNOSTICSDIALOG_H
+#define DIAGNOSTICSDIALOG_H
+
+#include <QDialog>
+#include <QTimer>
+
+namespace Ui {
+    class DiagnosticsDialog;
+}
+
+/*!
+ * \brief Класс DiagnosticsDialog - окно счётчиков и задержек Metrics
+ * Значения обновляются раз в секунду, пока окно открыто
+ */
+class DiagnosticsDialog : public QDialog
+{
+    Q_OBJECT
+
+public:
+    explicit DiagnosticsDialog(QWidget *parent = 0);
+    ~DiagnosticsDialog();
+
+private slots:
+    void refresh();
+    void on_PushButton_Reset_clicked();
+    void on_PushButton_Save_clicked();
+
+private:
+    Ui::DiagnosticsDialog *ui;
+    QTimer _refreshTimer;
+
+    static const int REFRESH_INTERVAL = 1000;
+};
+
+#endif // DIAGNOSTICSDIALOG_H
@@ -0,0 +1,281 @@
+#include "io/keepassimporter.h"
+#include "io/transferstats.h"
+#include "db/querysmanager.h"
+
+#include <QDateTime>
+#include <QFile>
+#include <QFuture>
+#include <QSqlDatabase>
+#include <QXmlStreamReader>
+#include <QtConcurrent/QtConcurrentMap>
+#include <QtEndian>
+#include <QDebug>
+
+namespace {
+    /// Сигнатура бинарного файла KeePass (KDBX)
+    const quint32 KDBX_SIGNATURE = 0x9AA2D903;
+
+    /// Секунды от 0001-01-01 до начала эпохи Unix (даты KDBX 4 в base64)
+    const qint64 KDBX_EPOCH_OFFSET = Q_INT64_C(62135596800);
+
+    /// Срок "никогда не истекает" - верхняя граница QDateTimeEdit
+    const qint64 NEVER_EXPIRES = QDateTime( QDate(9999, 12, 31), QTime(23, 59, 59), Qt::UTC ).toMSecsSinceEpoch();
+
+    /// Путь вложенной группы разделяется так
+    const QString GROUP_SEPARATOR("/");
+}
+
+/*!
+ * \brief Метод загружает записи из XML-экспорта KeePass 2.x
+ * \param device - устройство, открытое на чтение
+ * \param stats - счётчики загрузки
+ * \return true - если файл разобран и все записи вставлены
+ */
+bool KeePassImporter::read(QIODevice *device, TransferStats *stats)
+{
+    stats->start();
+
+    QXmlStreamReader xml( device );
+    QString recycleBin;
+    QStringList groupNames;
+    QVector<bool> skipGroups;
+
+    Batch batch;
+    Batch decoding;
+    QFuture<void> decoded;
+    bool success = true;
+    batch.reserve( BATCH_SIZE );
+
+    while( success && ! xml.atEnd() ){
+        xml.readNext();
+
+        if( xml.isEndElement() && xml.name() == QLatin1String("Group") ){
+            groupNames.removeLast();
+            skipGroups.removeLast();
+            continue;
+        }
+        if( ! xml.isStartElement() )
+            continue;
+
+        if( xml.name() == QLatin1String("RecycleBinUUID") ){
+            recycleBin = xml.readElementText();
+        }else if( xml.name() == QLatin1String("Group") ){
+            groupNames.append( QString() );
+            skipGroups.append( ! skipGroups.isEmpty() && skipGroups.last() );
+        }else if( xml.name() == QLatin1String("UUID") && ! groupNames.isEmpty() ){
+            if( xml.readElementText() == recycleBin && ! recycleBin.isEmpty() )
+                skipGroups.last() = true;
+        }else if( xml.name() == QLatin1String("Name") && ! groupNames.isEmpty() ){
+            groupNames.last() = xml.readElementText();
+        }else if( xml.name() == QLatin1String("Entry") ){
+            if( groupNames.isEmpty() || skipGroups.last() ){
+                xml.skipCurrentElement();
+                continue;
+            }
+
+            Entry entry;
+            // Корневая группа в путь не входит, если есть вложенные
+            entry.groupPath = ( groupNames.size() > 1 ) ? QStringList(groupNames.mid(1)).join(GROUP_SEPARATOR)
+                                                        : groupNames.first();
+            readEntry( xml, &entry );
+            batch.append( entry );
+
+            if( batch.size() == BATCH_SIZE ){
+                decoded.waitForFinished();
+                if( ! decoding.isEmpty() )
+                    success = insert( decoding, stats );
+                decoding.swap( batch );
+                batch.clear();
+                decoded = QtConcurrent::map( decoding, &KeePassImporter::decode );
+            }
+        }
+    }
+
+    decoded.waitForFinished();
+    if( success && ! decoding.isEmpty() )
+        success = insert( decoding, stats );
+
+    if( xml.hasError() ){
+        qCritical() << "KeePass import: XML error at line" << xml.lineNumber() << xml.errorString();
+        success = false;
+    }
+    if( success && ! batch.isEmpty() ){
+        QtConcurrent::blockingMap( batch, &KeePassImporter::decode );
+        success = insert( batch, stats );
+    }
+
+    stats->addBytes( device->pos() );
+    stats->finish();
+    return success;
+}
+
+/*!
+ * \brief Метод загружает записи из файла XML-экспорта KeePass
+ */
+bool KeePassImporter::readFile(const QString &fileName, TransferStats *stats)
+{
+    if( isKdbxFile(fileName) ){
+        qCritical() << "KeePass import: binary KDBX is not supported, export the database to XML";
+        return false;
+    }
+
+    QFile file( fileName );
+    if( ! file.open(QIODevice::ReadOnly) ){
+        qCritical() << "Cannot open" << fileName << "for import";
+        return false;
+    }
+    return read( &file, stats );
+}
+
+/*!
+ * \brief Метод проверяет, является ли файл бинарной базой KeePass
+ */
+bool KeePassImporter::isKdbxFile(const QString &fileName)
+{
+    QFile file( fileName );
+    if( ! file.open(QIODevice::ReadOnly) )
+        return false;
+
+    QByteArray signature = file.read( 4 );
+    return signature.size() == 4
+            && qFromLittleEndian<quint32>( reinterpret_cast<const uchar *>(signature.constData()) ) == KDBX_SIGNATURE;
+}
+
+void KeePassImporter::readEntry(QXmlStreamReader &xml, Entry *entry)
+{
+    while( xml.readNextStartElement() ){
+        if( xml.name() == QLatin1String("String") )
+            readString( xml, entry );
+        else if( xml.name() == QLatin1String("Times") )
+            readTimes( xml, entry );
+        else
+            xml.skipCurrentElement();   // History, AutoType, Binary и прочее
+    }
+}
+
+void KeePassImporter::readString(QXmlStreamReader &xml, Entry *entry)
+{
+    QString key;
+    QString value;
+    while( xml.readNextStartElement() ){
+        if( xml.name() == QLatin1String("Key") )
+            key = xml.readElementText();
+        else if( xml.name() == QLatin1String("Value") )
+            value = xml.readElementText();
+        else
+            xml.skipCurrentElement();
+    }
+    entry->keys.append( key );
+    entry->values.append( value );
+}
+
+void KeePassImporter::readTimes(QXmlStreamReader &xml, Entry *entry)
+{
+    while( xml.readNextStartElement() ){
+        if( xml.name() == QLatin1String("CreationTime") )
+            entry->creationTime = xml.readElementText();
+        else if( xml.name() == QLatin1String("ExpiryTime") )
+            entry->expiryTime = xml.readElementText();
+        else if( xml.name() == QLatin1String("Expires") )
+            entry->expires = ( xml.readElementText().compare("True", Qt::CaseInsensitive) == 0 );
+        else
+            xml.skipCurrentElement();
+    }
+}
+
+/*!
+ * \brief Метод декодирует сырую запись, выполняется в пуле потоков
+ */
+void KeePassImporter::decode(Entry &entry)
+{
+    QStringList extra;
+    for( int i = 0; i < entry.keys.size(); ++i ){
+        const QString &key   = entry.keys.at(i);
+        const QString &value = entry.values.at(i);
+
+        int field = -1;
+        if( key == QLatin1String("Title") )
+            field = RecordTable::Resource;
+        else if( key == QLatin1String("URL") )
+            field = RecordTable::Url;
+        else if( key == QLatin1String("UserName") )
+            field = RecordTable::Login;
+        else if( key == QLatin1String("Password") )
+            field = RecordTable::Password;
+        else if( key == QLatin1String("Notes") )
+            field = RecordTable::Description;
+        else if( key.compare("Email", Qt::CaseInsensitive) == 0 || key.compare("E-mail", Qt::CaseInsensitive) == 0 )
+            field = RecordTable::Mail;
+        else if( key.compare("Phone", Qt::CaseInsensitive) == 0 )
+            field = RecordTable::Phone;
+
+        if( field >= 0 )
+            entry.texts[field] = value;
+        else if( ! value.isEmpty() )
+            extra.append( key + ": " + value );
+    }
+    if( ! extra.isEmpty() ){
+        QString &description = entry.texts[RecordTable::Description];
+        if( ! description.isEmpty() )
+            description += "\n";
+        description += extra.join("\n");
+    }
+
+    entry.createTime = parseTime( entry.creationTime );
+    if( entry.createTime == 0 )
+        entry.createTime = QDateTime::currentMSecsSinceEpoch();
+    entry.passLifeTime = entry.expires ? parseTime( entry.expiryTime ) : NEVER_EXPIRES;
+
+    // Сырые строки больше не нужны
+    entry.keys.clear();
+    entry.values.clear();
+}
+
+/*!
+ * \brief Метод разбирает дату KeePass
+ * Экспорт KDBX 3 пишет ISO 8601, KDBX 4 - base64 от 64-битного
+ * числа секунд с 0001-01-01
+ * \return мс от начала эпохи, 0 - если дата не разобрана
+ */
+qint64 KeePassImporter::parseTime(const QString &text)
+{
+    if( text.isEmpty() )
+        return 0;
+
+    QDateTime time = QDateTime::fromString( text, Qt::ISODate );
+    if( time.isValid() )
+        return time.toMSecsSinceEpoch();
+
+    QByteArray bytes = QByteArray::fromBase64( text.toLatin1() );
+    if( bytes.size() != 8 )
+        return 0;
+
+    qint64 seconds = qFromLittleEndian<qint64>( reinterpret_cast<const uchar *>(bytes.constData()) );
+    return (seconds - KDBX_EPOCH_OFFSET) * 1000;
+}
+
+/*!
+ * \brief Метод вставляет декодированную порцию одной транзакцией
+ */
+bool KeePassImporter::insert(const Batch &batch, TransferStats *stats)
+{
+    RecordTable records;
+    records.reserve( batch.size() );
+    for( const Entry &entry : batch ){
+        records.append( 0, entry.groupPath, entry.texts, entry.createTime, entry.passLifeTime );
+    }
+
+    QSqlDatabase db = QSqlDatabase::database();
+    db.transaction();
+    if( ! QuerysManager::insert(records) ){
+        db.rollback();
+        return false;
+    }
+    if( ! db.commit() ){
+        qCritical() << "Cannot commit imported records";
+        return false;
+    }
+
+    stats->addRecords( records.size() );
+    return true;
+}
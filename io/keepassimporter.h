@@ -0,0 +1,68 @@
+#ifndef KEEPASSIMPORTER_H
+#define KEEPASSIMPORTER_H
+
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+#include "Data/recordtable.h"
+
+class QIODevice;
+class QXmlStreamReader;
+class TransferStats;
+
+/*!
+ * \brief Класс KeePassImporter - импорт экспорта KeePass 2.x в формате XML
+ *
+ * Файл читается потоково QXmlStreamReader без построения DOM.
+ * Записи копятся порциями по BATCH_SIZE в сыром виде; пока разбирается
+ * следующая порция, предыдущая декодируется параллельно (QtConcurrent):
+ * разбор дат, сопоставление полей, сборка описания. Затем порция
+ * вставляется в базу одной транзакцией.
+ *
+ * Сопоставление полей:
+ * путь группы -> PassGroup, Title -> Resource, URL -> Url,
+ * UserName -> Login, Password -> Password, Notes -> Description,
+ * Email/Phone -> Mail/Phone, прочие строки дописываются в Description,
+ * CreationTime -> CreateTime, ExpiryTime (если Expires) -> PassLifeTime.
+ * История записей и корзина пропускаются.
+ * Бинарный KDBX не поддерживается: его нужно экспортировать в XML из KeePass.
+ */
+class KeePassImporter
+{
+public:
+    static const int BATCH_SIZE = 2048;
+
+    static bool read(QIODevice *device, TransferStats *stats);
+    static bool readFile(const QString &fileName, TransferStats *stats);
+    static bool isKdbxFile(const QString &fileName);
+
+private:
+    struct Entry {
+        // Сырые значения из XML
+        QString     groupPath;
+        QStringList keys;
+        QStringList values;
+        QString     creationTime;
+        QString     expiryTime;
+        bool        expires = false;
+
+        // Результат декодирования
+        QString     texts[RecordTable::TextFieldCount];
+        qint64      createTime = 0;
+        qint64      passLifeTime = 0;
+    };
+    typedef QVector<Entry> Batch;
+
+    KeePassImporter();
+    ~KeePassImporter();
+
+    static void readEntry(QXmlStreamReader &xml, Entry *entry);
+    static void readString(QXmlStreamReader &xml, Entry *entry);
+    static void readTimes(QXmlStreamReader &xml, Entry *entry);
+    static void decode(Entry &entry);
+    static qint64 parseTime(const QString &text);
+    static bool insert(const Batch &batch, TransferStats *stats);
+};
+
+#endif // KEEPASSIMPORTER_H
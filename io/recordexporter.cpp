@@ -0,0 +1,186 @@
+#include "io/recordexporter.h"
+#include "io/transferstats.h"
+#include "Data/recordloader.h"
+#include "Data/recordtable.h"
+#include "cryptfiledevice.h"
+
+#include <QFile>
+#include <QDebug>
+
+namespace {
+    const char HEX_DIGITS[] = "0123456789abcdef";
+
+    QByteArray groupUtf8(const RecordTable &chunk, int row, QVector<QByteArray> &cache)
+    {
+        quint32 index = chunk.groupIndex( row );
+        while( quint32(cache.size()) <= index ){
+            cache.append( chunk.groups().at(cache.size()).toUtf8() );
+        }
+        return cache.at( index );
+    }
+}
+
+/*!
+ * \brief Метод выгружает все записи в открытое устройство
+ * \param device - устройство, открытое на запись
+ * \param format - формат выгрузки
+ * \param stats - счётчики выгрузки
+ * \return true - в случае успеха
+ */
+bool RecordExporter::write(QIODevice *device, RecordFormat::Format format, TransferStats *stats)
+{
+    stats->start();
+
+    // Ключи JSON вида ,"Name": собираются один раз на выгрузку
+    QVector<QByteArray> keys;
+    for( const QString &name : RecordFormat::fieldNames() ){
+        keys.append( ",\"" + name.toUtf8() + "\":" );
+    }
+
+    QByteArray out;
+    if( format == RecordFormat::Csv ){
+        QList<QByteArray> header;
+        for( const QString &name : RecordFormat::fieldNames() ){
+            header.append( name.toUtf8() );
+        }
+        out = header.join(',') + "\r\n";
+    }
+
+    QVector<QByteArray> groups;
+    bool success = RecordLoader::forEach( [&](const RecordTable &chunk){
+        for( int row = 0; row < chunk.size(); ++row ){
+            if( format == RecordFormat::Csv ){
+                appendCsvField( out, groupUtf8(chunk, row, groups) );
+                out.append( ',' );
+                appendCsv( out, chunk, row );
+            }else{
+                out.append( '{' ).append( keys.at(RecordFormat::PassGroup).constData() + 1 );
+                appendJsonString( out, groupUtf8(chunk, row, groups) );
+                appendJson( out, chunk, row, keys );
+            }
+        }
+
+        if( device->write(out) != out.size() ){
+            qCritical() << "Cannot write export:" << device->errorString();
+            return false;
+        }
+        stats->addRecords( chunk.size() );
+        stats->addBytes( out.size() );
+        out.resize( 0 );
+        return true;
+    } );
+
+    if( success && ! out.isEmpty() ){
+        success = ( device->write(out) == out.size() );
+        stats->addBytes( out.size() );
+    }
+
+    stats->finish();
+    return success;
+}
+
+/*!
+ * \brief Метод выгружает все записи в файл
+ * Если задан пароль, файл пишется через CryptFileDevice
+ * \param fileName - путь к файлу, существующий файл перезаписывается
+ * \param password - хэш пароля шифрования, пустой - без шифрования
+ * \param salt - соль шифрования
+ * \return true - в случае успеха
+ */
+bool RecordExporter::writeFile(const QString &fileName, RecordFormat::Format format, TransferStats *stats,
+                               const QByteArray &password, const QByteArray &salt)
+{
+    QFile file( fileName );
+    if( file.exists() && ! file.remove() ){
+        qCritical() << "Cannot overwrite" << fileName;
+        return false;
+    }
+
+    CryptFileDevice device( &file, password, salt );
+    if( ! device.open(QIODevice::WriteOnly) ){
+        qCritical() << "Cannot open" << fileName << "for export";
+        return false;
+    }
+
+    bool success = write( &device, format, stats );
+    device.close();
+    return success;
+}
+
+void RecordExporter::appendCsvField(QByteArray &out, const QByteArray &value)
+{
+    bool needQuotes = false;
+    for( char c : value ){
+        if( c == ',' || c == '"' || c == '\r' || c == '\n' ){
+            needQuotes = true;
+            break;
+        }
+    }
+    if( ! needQuotes ){
+        out.append( value );
+        return;
+    }
+
+    out.append( '"' );
+    for( char c : value ){
+        if( c == '"' )
+            out.append( '"' );
+        out.append( c );
+    }
+    out.append( '"' );
+}
+
+void RecordExporter::appendJsonString(QByteArray &out, const QByteArray &value)
+{
+    out.append( '"' );
+    for( char c : value ){
+        switch( c ){
+        case '"':  out.append( "\\\"" ); break;
+        case '\\': out.append( "\\\\" ); break;
+        case '\n': out.append( "\\n" );  break;
+        case '\r': out.append( "\\r" );  break;
+        case '\t': out.append( "\\t" );  break;
+        default:
+            if( uchar(c) < 0x20 ){
+                out.append( "\\u00" );
+                out.append( HEX_DIGITS[uchar(c) >> 4] );
+                out.append( HEX_DIGITS[uchar(c) & 0x0F] );
+            }else{
+                out.append( c );
+            }
+        }
+    }
+    out.append( '"' );
+}
+
+/*!
+ * \brief Метод дописывает поля строки после PassGroup в формате CSV
+ */
+void RecordExporter::appendCsv(QByteArray &out, const RecordTable &chunk, int row)
+{
+    for( int field = 0; field < RecordTable::TextFieldCount; ++field ){
+        appendCsvField( out, chunk.textUtf8(row, RecordTable::TextField(field)) );
+        out.append( ',' );
+    }
+    out.append( QByteArray::number(chunk.createTime(row)) );
+    out.append( ',' );
+    out.append( QByteArray::number(chunk.passLifeTime(row)) );
+    out.append( "\r\n" );
+}
+
+/*!
+ * \brief Метод дописывает поля строки после PassGroup и закрывает JSON-объект
+ */
+void RecordExporter::appendJson(QByteArray &out, const RecordTable &chunk, int row,
+                                const QVector<QByteArray> &keys)
+{
+    for( int field = 0; field < RecordTable::TextFieldCount; ++field ){
+        out.append( keys.at(RecordFormat::Resource + field) );
+        appendJsonString( out, chunk.textUtf8(row, RecordTable::TextField(field)) );
+    }
+    out.append( keys.at(RecordFormat::CreateTime) );
+    out.append( QByteArray::number(chunk.createTime(row)) );
+    out.append( keys.at(RecordFormat::PassLifeTime) );
+    out.append( QByteArray::number(chunk.passLifeTime(row)) );
+    out.append( "}\n" );
+}
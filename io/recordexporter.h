@@ -0,0 +1,40 @@
+#ifndef RECORDEXPORTER_H
+#define RECORDEXPORTER_H
+
+#include "io/recordformat.h"
+
+#include <QByteArray>
+#include <QVector>
+
+class QIODevice;
+class RecordTable;
+class TransferStats;
+
+/*!
+ * \brief Класс RecordExporter - потоковая выгрузка записей в CSV или JSON Lines
+ *
+ * Записи читаются RecordLoader порциями и пишутся в устройство по мере
+ * чтения, поэтому память не зависит от размера хранилища. Текстовые поля
+ * берутся из RecordTable сразу в UTF-8, без промежуточных QString.
+ * Устройством может быть CryptFileDevice - тогда открытый текст
+ * не попадает на диск.
+ */
+class RecordExporter
+{
+private:
+    RecordExporter();
+    ~RecordExporter();
+
+    static void appendCsvField(QByteArray &out, const QByteArray &value);
+    static void appendJsonString(QByteArray &out, const QByteArray &value);
+    static void appendCsv(QByteArray &out, const RecordTable &chunk, int row);
+    static void appendJson(QByteArray &out, const RecordTable &chunk, int row,
+                           const QVector<QByteArray> &keys);
+public:
+    static bool write(QIODevice *device, RecordFormat::Format format, TransferStats *stats);
+    static bool writeFile(const QString &fileName, RecordFormat::Format format, TransferStats *stats,
+                          const QByteArray &password = QByteArray(),
+                          const QByteArray &salt = QByteArray());
+};
+
+#endif // RECORDEXPORTER_H
@@ -0,0 +1,50 @@
+#include "io/recordformat.h"
+#include "Data/data.h"
+
+/*!
+ * \brief Функция определяет формат по имени файла
+ * Суффикс зашифрованного файла (.enc) не учитывается
+ * \return JsonLines для .jsonl, .ndjson и .json, иначе Csv
+ */
+RecordFormat::Format RecordFormat::fromFileName(const QString &fileName)
+{
+    QString name = fileName.toLower();
+    if( name.endsWith(ENCRYPTED_SUFFIX) )
+        name.chop( ENCRYPTED_SUFFIX.length() );
+
+    if( name.endsWith(".jsonl") || name.endsWith(".ndjson") || name.endsWith(".json") )
+        return JsonLines;
+    return Csv;
+}
+
+/*!
+ * \brief Функция возвращает названия полей в порядке Field
+ */
+QStringList RecordFormat::fieldNames()
+{
+    return QStringList() << DataTable::Fields::PassGroup
+                         << DataTable::Fields::Resource
+                         << DataTable::Fields::Url
+                         << DataTable::Fields::Login
+                         << DataTable::Fields::Password
+                         << DataTable::Fields::Mail
+                         << DataTable::Fields::Phone
+                         << DataTable::Fields::Answer
+                         << DataTable::Fields::Description
+                         << DataTable::Fields::CreateTime
+                         << DataTable::Fields::PassLifeTime;
+}
+
+/*!
+ * \brief Функция ищет поле по названию без учёта регистра
+ * \return значение Field, -1 - если поле неизвестно
+ */
+int RecordFormat::fieldIndex(const QString &name)
+{
+    const QStringList names = fieldNames();
+    for( int i = 0; i < names.size(); ++i ){
+        if( names.at(i).compare(name.trimmed(), Qt::CaseInsensitive) == 0 )
+            return i;
+    }
+    return -1;
+}
@@ -0,0 +1,43 @@
+#ifndef RECORDFORMAT_H
+#define RECORDFORMAT_H
+
+#include <QString>
+#include <QStringList>
+
+/*!
+ * \brief Форматы файлов импорта/экспорта записей
+ *
+ * Поля файла совпадают с колонками таблицы Data, кроме id:
+ * при импорте записи получают новые идентификаторы.
+ */
+namespace RecordFormat {
+    enum Format {
+        Csv,        ///< RFC 4180, первая строка - названия полей
+        JsonLines   ///< Один JSON-объект на строку
+    };
+
+    /// Порядок полей в файле. Resource..Description идут в порядке
+    /// RecordTable::TextField со сдвигом на единицу.
+    enum Field {
+        PassGroup = 0,
+        Resource,
+        Url,
+        Login,
+        Password,
+        Mail,
+        Phone,
+        Answer,
+        Description,
+        CreateTime,
+        PassLifeTime,
+        FieldCount
+    };
+
+    const QString ENCRYPTED_SUFFIX(".enc");
+
+    Format fromFileName(const QString &fileName);
+    QStringList fieldNames();
+    int fieldIndex(const QString &name);
+}
+
+#endif // RECORDFORMAT_H
@@ -0,0 +1,255 @@
+#include "io/recordimporter.h"
+#include "io/transferstats.h"
+#include "Data/recordtable.h"
+#include "db/querysmanager.h"
+#include "cryptfiledevice.h"
+
+#include <QDateTime>
+#include <QFile>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonParseError>
+#include <QSqlDatabase>
+#include <QDebug>
+
+/*!
+ * \brief Метод загружает записи из открытого устройства
+ * \param device - устройство, открытое на чтение
+ * \param format - формат данных
+ * \param stats - счётчики загрузки
+ * \return true - если все порции записаны в базу
+ */
+bool RecordImporter::read(QIODevice *device, RecordFormat::Format format, TransferStats *stats)
+{
+    stats->start();
+    bool success = ( format == RecordFormat::Csv ) ? readCsv( device, stats )
+                                                   : readJsonLines( device, stats );
+    stats->finish();
+    return success;
+}
+
+/*!
+ * \brief Метод загружает записи из файла
+ * Формат определяется по имени файла, зашифрованный файл
+ * (заголовок CryptFileDevice) читается с указанным паролем
+ * \param fileName - путь к файлу
+ * \param password - хэш пароля, которым зашифрован файл
+ * \param salt - соль шифрования
+ * \return true - в случае успеха
+ */
+bool RecordImporter::readFile(const QString &fileName, TransferStats *stats,
+                              const QByteArray &password, const QByteArray &salt)
+{
+    QFile file( fileName );
+    // Параметры шифра берутся из заголовка, как при открытии хранилища
+    CryptFileDevice::Header header;
+    const bool encrypted = CryptFileDevice::readHeader( fileName, &header );
+    CryptFileDevice device( &file, encrypted ? password : QByteArray(), salt );
+    if( encrypted ){
+        device.setKeyLength( header.keyLength );
+        device.setNumRounds( header.numRounds );
+    }
+    if( ! device.open(QIODevice::ReadOnly) ){
+        qCritical() << "Cannot open" << fileName << "for import";
+        return false;
+    }
+
+    bool success = read( &device, RecordFormat::fromFileName(fileName), stats );
+    device.close();
+    return success;
+}
+
+/*!
+ * \brief Метод проверяет, начинается ли файл с заголовка CryptFileDevice
+ * Проверяется весь заголовок, а не только первый байт: CSV или JSON
+ * с таким байтом в начале шифрованным не считается.
+ */
+bool RecordImporter::isEncryptedFile(const QString &fileName)
+{
+    CryptFileDevice::Header header;
+    return CryptFileDevice::readHeader( fileName, &header );
+}
+
+bool RecordImporter::readCsv(QIODevice *device, TransferStats *stats)
+{
+    QList<QByteArray> fields;
+    if( ! readCsvRecord(device, &fields, stats) ){
+        qCritical() << "CSV import: header is missing";
+        return false;
+    }
+
+    // Номер поля RecordFormat для каждой колонки файла
+    if( ! fields.isEmpty() && fields.first().startsWith("\xEF\xBB\xBF") )
+        fields.first().remove( 0, 3 );
+    QVector<int> columns;
+    QVector<bool> present( RecordFormat::FieldCount, false );
+    for( const QByteArray &name : fields ){
+        int field = RecordFormat::fieldIndex( QString::fromUtf8(name) );
+        columns.append( field );
+        if( field >= 0 )
+            present[field] = true;
+    }
+
+    RecordTable batch;
+    batch.reserve( BATCH_SIZE );
+    QString values[RecordFormat::FieldCount];
+
+    while( readCsvRecord(device, &fields, stats) ){
+        if( fields.size() == 1 && fields.first().isEmpty() )
+            continue;
+
+        for( QString &value : values ){
+            value.clear();
+        }
+        for( int i = 0; i < fields.size() && i < columns.size(); ++i ){
+            if( columns.at(i) >= 0 )
+                values[columns.at(i)] = QString::fromUtf8( fields.at(i) );
+        }
+        append( &batch, values, present );
+
+        if( batch.size() == BATCH_SIZE && ! flush(&batch, stats) )
+            return false;
+    }
+    return flush( &batch, stats );
+}
+
+bool RecordImporter::readJsonLines(QIODevice *device, TransferStats *stats)
+{
+    const QStringList names = RecordFormat::fieldNames();
+    RecordTable batch;
+    batch.reserve( BATCH_SIZE );
+    QString values[RecordFormat::FieldCount];
+    QVector<bool> present( RecordFormat::FieldCount, false );
+
+    while( ! device->atEnd() ){
+        QByteArray line = device->readLine();
+        stats->addBytes( line.size() );
+        line = line.trimmed();
+        if( line.isEmpty() )
+            continue;
+
+        QJsonParseError error;
+        QJsonDocument document = QJsonDocument::fromJson( line, &error );
+        if( ! document.isObject() ){
+            qWarning() << "JSON import: skipped line:" << error.errorString();
+            stats->addSkipped( 1 );
+            continue;
+        }
+
+        QJsonObject object = document.object();
+        for( int field = 0; field < RecordFormat::FieldCount; ++field ){
+            QJsonObject::const_iterator it = object.constFind( names.at(field) );
+            present[field] = ( it != object.constEnd() && ! it.value().isNull() );
+            if( ! present.at(field) )
+                values[field].clear();
+            else if( it.value().isDouble() )
+                values[field] = QString::number( qint64(it.value().toDouble()) );
+            else
+                values[field] = it.value().toString();
+        }
+        append( &batch, values, present );
+
+        if( batch.size() == BATCH_SIZE && ! flush(&batch, stats) )
+            return false;
+    }
+    return flush( &batch, stats );
+}
+
+/*!
+ * \brief Метод читает одну запись CSV (RFC 4180)
+ * Поле в кавычках может содержать запятые, удвоенные кавычки и переводы строк
+ * \param fields - прочитанные поля в UTF-8
+ * \return false - если достигнут конец файла
+ */
+bool RecordImporter::readCsvRecord(QIODevice *device, QList<QByteArray> *fields, TransferStats *stats)
+{
+    fields->clear();
+    QByteArray field;
+    bool inQuotes   = false;
+    bool fieldStart = true;
+    bool readAny    = false;
+
+    while( ! device->atEnd() ){
+        QByteArray line = device->readLine();
+        stats->addBytes( line.size() );
+        readAny = true;
+
+        for( int i = 0; i < line.size(); ++i ){
+            char c = line.at(i);
+            if( inQuotes ){
+                if( c == '"' ){
+                    if( i + 1 < line.size() && line.at(i + 1) == '"' ){
+                        field.append( '"' );
+                        ++i;
+                    }else{
+                        inQuotes = false;
+                    }
+                }else{
+                    field.append( c );
+                }
+            }else if( c == '"' && fieldStart ){
+                inQuotes   = true;
+                fieldStart = false;
+            }else if( c == ',' ){
+                fields->append( field );
+                field.clear();
+                fieldStart = true;
+            }else if( c == '\r' || c == '\n' ){
+                break;
+            }else{
+                field.append( c );
+                fieldStart = false;
+            }
+        }
+
+        if( ! inQuotes )
+            break;
+    }
+
+    if( ! readAny )
+        return false;
+
+    fields->append( field );
+    return true;
+}
+
+/*!
+ * \brief Метод добавляет запись в порцию, подставляя значения по умолчанию
+ * Время создания - текущее, срок действия пароля - месяц от создания
+ */
+void RecordImporter::append(RecordTable *batch, QString *values, const QVector<bool> &present)
+{
+    qint64 createTime = ( present.at(RecordFormat::CreateTime) && ! values[RecordFormat::CreateTime].isEmpty() )
+            ? values[RecordFormat::CreateTime].toLongLong()
+            : QDateTime::currentMSecsSinceEpoch();
+    qint64 passLifeTime = ( present.at(RecordFormat::PassLifeTime) && ! values[RecordFormat::PassLifeTime].isEmpty() )
+            ? values[RecordFormat::PassLifeTime].toLongLong()
+            : QDateTime::fromMSecsSinceEpoch(createTime).addMonths(1).toMSecsSinceEpoch();
+
+    batch->append( 0, values[RecordFormat::PassGroup], values + RecordFormat::Resource,
+                   createTime, passLifeTime );
+}
+
+/*!
+ * \brief Метод записывает порцию в базу одной транзакцией
+ */
+bool RecordImporter::flush(RecordTable *batch, TransferStats *stats)
+{
+    if( batch->isEmpty() )
+        return true;
+
+    QSqlDatabase db = QSqlDatabase::database();
+    db.transaction();
+    if( ! QuerysManager::insert(*batch) ){
+        db.rollback();
+        return false;
+    }
+    if( ! db.commit() ){
+        qCritical() << "Cannot commit imported records";
+        return false;
+    }
+
+    stats->addRecords( batch->size() );
+    batch->clearRows();
+    return true;
+}
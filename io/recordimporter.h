@@ -0,0 +1,45 @@
+#ifndef RECORDIMPORTER_H
+#define RECORDIMPORTER_H
+
+#include "io/recordformat.h"
+
+#include <QByteArray>
+#include <QList>
+#include <QVector>
+
+class QIODevice;
+class RecordTable;
+class TransferStats;
+
+/*!
+ * \brief Класс RecordImporter - потоковая загрузка записей из CSV или JSON Lines
+ *
+ * Файл читается построчно, записи копятся в RecordTable по BATCH_SIZE
+ * и вставляются через QuerysManager одной транзакцией на порцию.
+ * Буфер порции переиспользуется, так что память не зависит от размера файла.
+ * Поля сопоставляются по названию (заголовок CSV или ключи JSON),
+ * неизвестные поля пропускаются, недостающие получают значения
+ * как у новой записи в форме редактирования.
+ */
+class RecordImporter
+{
+private:
+    RecordImporter();
+    ~RecordImporter();
+
+    static bool readCsv(QIODevice *device, TransferStats *stats);
+    static bool readJsonLines(QIODevice *device, TransferStats *stats);
+    static bool readCsvRecord(QIODevice *device, QList<QByteArray> *fields, TransferStats *stats);
+    static void append(RecordTable *batch, QString *values, const QVector<bool> &present);
+    static bool flush(RecordTable *batch, TransferStats *stats);
+public:
+    static const int BATCH_SIZE = 1000;
+
+    static bool read(QIODevice *device, RecordFormat::Format format, TransferStats *stats);
+    static bool readFile(const QString &fileName, TransferStats *stats,
+                         const QByteArray &password = QByteArray(),
+                         const QByteArray &salt = QByteArray());
+    static bool isEncryptedFile(const QString &fileName);
+};
+
+#endif // RECORDIMPORTER_H
@@ -0,0 +1,81 @@
+#include "io/transferstats.h"
+
+#include <QObject>
+
+void TransferStats::start()
+{
+    _records = 0;
+    _skipped = 0;
+    _bytes   = 0;
+    _elapsed = 0;
+    _timer.start();
+}
+
+void TransferStats::finish()
+{
+    _elapsed = _timer.isValid() ? _timer.elapsed() : 0;
+}
+
+void TransferStats::addRecords(qint64 count)
+{
+    _records += count;
+}
+
+void TransferStats::addSkipped(qint64 count)
+{
+    _skipped += count;
+}
+
+void TransferStats::addBytes(qint64 count)
+{
+    _bytes += count;
+}
+
+qint64 TransferStats::records() const
+{
+    return _records;
+}
+
+qint64 TransferStats::skipped() const
+{
+    return _skipped;
+}
+
+qint64 TransferStats::bytes() const
+{
+    return _bytes;
+}
+
+/*!
+ * \brief Метод возвращает длительность в мс
+ */
+qint64 TransferStats::elapsed() const
+{
+    return _elapsed;
+}
+
+double TransferStats::recordsPerSecond() const
+{
+    return _elapsed > 0 ? _records * 1000.0 / _elapsed : 0.0;
+}
+
+double TransferStats::bytesPerSecond() const
+{
+    return _elapsed > 0 ? _bytes * 1000.0 / _elapsed : 0.0;
+}
+
+/*!
+ * \brief Метод возвращает сводку для строки состояния
+ */
+QString TransferStats::summary() const
+{
+    QString text = QObject::tr("%1 records, %2 KiB in %3 ms (%4 records/s, %5 MiB/s)")
+                   .arg( _records )
+                   .arg( _bytes / 1024 )
+                   .arg( _elapsed )
+                   .arg( qRound64(recordsPerSecond()) )
+                   .arg( bytesPerSecond() / (1024.0 * 1024.0), 0, 'f', 2 );
+    if( _skipped > 0 )
+        text += QObject::tr(", %1 skipped").arg( _skipped );
+    return text;
+}
@@ -0,0 +1,35 @@
+#ifndef TRANSFERSTATS_H
+#define TRANSFERSTATS_H
+
+#include <QElapsedTimer>
+#include <QString>
+
+/*!
+ * \brief Класс TransferStats - счётчики и пропускная способность импорта/экспорта
+ */
+class TransferStats
+{
+private:
+    qint64        _records = 0;
+    qint64        _skipped = 0;
+    qint64        _bytes   = 0;
+    qint64        _elapsed = 0;
+    QElapsedTimer _timer;
+public:
+    void start();
+    void finish();
+
+    void addRecords(qint64 count);
+    void addSkipped(qint64 count);
+    void addBytes(qint64 count);
+
+    qint64 records() const;
+    qint64 skipped() const;
+    qint64 bytes() const;
+    qint64 elapsed() const;
+    double recordsPerSecond() const;
+    double bytesPerSecond() const;
+    QString summary() const;
+};
+
+#endif // TRANSFERSTATS_H
@@ -5,7 +5,6 @@ int main(int argc, char *argv[])
 {
     QApplication app(argc, argv);
 
-    qsrand( QTime::currentTime().msec() );
     MainWindow w;
     w.show();
 
@@ -2,6 +2,9 @@
 #include <QDebug>
 #include "cryptfiledevice.h"
 #include "passwordgenerator.h"
+#include "wordlist.h"
+#include "strength/passwordstrength.h"
+#include "vaultkey.h"
 
 
 #include <db/querysmanager.h>
@@ -12,6 +15,7 @@
 #include <QString>
 #include <QCryptographicHash>
 #include <QDir>
+#include <QFileInfo>
 #include <QStandardPaths>
 #include <QSettings>
 #include <QMessageBox>
@@ -22,6 +26,17 @@
 
 #include "aboutdialog.h"
 #include "helpdialog.h"
+#include "diagnosticsdialog.h"
+#include "auditdialog.h"
+#include "io/recordexporter.h"
+#include "io/recordimporter.h"
+#include "io/keepassimporter.h"
+#include "io/transferstats.h"
+#include "metrics/metrics.h"
+#include "trace/trace.h"
+#include "Data/recordloader.h"
+#include "Data/recordtable.h"
+#include <QtConcurrent/QtConcurrentRun>
 
 /*
     my.dbx -> read & decrypt -> write as SQLiteDB (achtung)
@@ -40,7 +55,6 @@ const QString warningStyle("border: 1px solid #CC0033");
 namespace Options {
     const QString LAST_FILE_PATH("LastFilePath");
     const QString BUFFER_SIZE("ReadWriteBufferSize");
-    const QString PASSWORD_HASH_CYCLES("PasswordHashCycles");
     const QString AES_ENCRYPT_ROUNDS("AesEncryptRounds");
 
     const QString LANGUAGE("Language");
@@ -55,12 +69,15 @@ namespace Options {
         const QString MINUS(    CharGroups::GROUP_PREFIX+"MinusLettersState");
         const QString NUMBERS(  CharGroups::GROUP_PREFIX+"NumbersLettersState");
         const QString UNDERLINE(CharGroups::GROUP_PREFIX+"UnderlineLettersState");
+        const QString PASSPHRASE(           CharGroups::GROUP_PREFIX+"PassphraseState");
+        const QString PASSPHRASE_WORDS(     CharGroups::GROUP_PREFIX+"PassphraseWords");
+        const QString PASSPHRASE_SEPARATOR( CharGroups::GROUP_PREFIX+"PassphraseSeparator");
+        const QString PASSPHRASE_CASE(      CharGroups::GROUP_PREFIX+"PassphraseCase");
     }
 }
 
 namespace DefaultValues {
     const int BUFFER_SIZE(51200);
-    const int PASSWORD_HASH_CYCLES(3);
     const int AES_ENCRYPT_ROUNDS(10000);
 
     const QStringList RECENT_DOCUMENTS_LIST;
@@ -72,6 +89,10 @@ namespace DefaultValues {
         const bool MINUS    (true);
         const bool NUMBERS  (true);
         const bool UNDERLINE(true);
+        const bool PASSPHRASE(false);
+        const int  PASSPHRASE_WORDS(6);
+        const QString PASSPHRASE_SEPARATOR("-");
+        const int  PASSPHRASE_CASE(PasswordGenerator::Lowercase);
     }
 }
 
@@ -90,11 +111,17 @@ bool MainWindow::setPage(PageIndex::PageIndex index)
 
         _sessionTimer.start( _sessionTime*60*1000 );
 //        QTimer::singleShot(time*60*1000, this, SLOT(sessionTimeout()) );
+        if( ! _breachedRecords.isEmpty() ){
+            showRecords( _breachedRecords );
+            _breachedRecords.clear();
+        }
     }else if(    index == PageIndex::FIRST
                || index == PageIndex::OPEN_FILE
                || index == PageIndex::NEW_FILE
                || index == PageIndex::LOCK){
 
+        // Хранилище заблокировано или закрыто - окна проверки не должны его показывать
+        closeAuditDialogs();
         ui.MainMenuBar->setVisible( false );
         ui.MainToolBar->setVisible( false );
         ui.StatusBar->setVisible(   false );
@@ -122,8 +149,8 @@ bool MainWindow::connectToDatabase(const QString &filePath)
 
 void MainWindow::setDataToInfoPanel(const Data &data)
 {
-    QDateTime create = QDateTime::fromMSecsSinceEpoch( data.createTime().toLongLong() );
-    QDateTime life   = QDateTime::fromMSecsSinceEpoch( data.passLifeTime().toLongLong() );
+    QDateTime create = QDateTime::fromMSecsSinceEpoch( data.createTime() );
+    QDateTime life   = QDateTime::fromMSecsSinceEpoch( data.passLifeTime() );
 
     QString cssExpired;
     if( life <= QDateTime::currentDateTime() ){
@@ -250,7 +277,8 @@ bool MainWindow::goPage_LOCK()
  * \param parent
  */
 MainWindow::MainWindow(QWidget *parent) :
-    QMainWindow(parent)
+    QMainWindow(parent),
+    _searchDispatcher(&_searchEngine)
 {
     QSettings cfg;
     QLocale::Language language = static_cast<QLocale::Language>( cfg.value( Options::LANGUAGE, QLocale::Russian ).toInt());
@@ -297,9 +325,18 @@ MainWindow::MainWindow(QWidget *parent) :
     ui.StatusBar->addWidget( &_statusBar_countRecords );
 
     connect( &_sessionTimer, SIGNAL(timeout()), this, SLOT(sessionTimeout()) );
+    connect( &_searchDispatcher, SIGNAL(resultsReady(QVector<qint64>)), this, SLOT(showRecords(QVector<qint64>)) );
+    connect( &_modelGroupsList, SIGNAL(recordCountChanged(qint64)), this, SLOT(showRecordCount()) );
+    connect( &_breachAudit, SIGNAL(finished()), this, SLOT(showBreachedRecords()) );
+
+    if( ! BreachIndex::configuredPath().isEmpty() )
+        _breachIndex.open( BreachIndex::configuredPath() );
 }
 
 void MainWindow::closeEvent(QCloseEvent *){
+    // Проверки читают отображение _breachIndex из рабочих потоков
+    stopBreachIndexReaders();
+
     QSettings cfg;
     cfg.setValue(Options::RECENT_DOCUMENTS_LIST, _recentDocuments.getRecentDocuments() );
     _db.close();
@@ -314,6 +351,35 @@ void MainWindow::closeEvent(QCloseEvent *){
  * \brief Деструктор Lego
  */
 MainWindow::~MainWindow(){
+    // Окна проверки удаляются в ~QWidget, уже после _breachIndex
+    stopBreachIndexReaders();
+}
+
+/*!
+ * \brief Метод останавливает все проверки, читающие _breachIndex
+ * После возврата индекс можно закрыть или открыть другой
+ */
+void MainWindow::stopBreachIndexReaders()
+{
+    _breachAudit.waitForFinished();
+    for( const QPointer<AuditDialog> &dialog : _auditDialogs )
+        if( dialog )
+            dialog->stopAudit();
+    _auditDialogs.removeAll( QPointer<AuditDialog>() );
+}
+
+/*!
+ * \brief Метод закрывает окна проверки хранилища
+ * Окна показывают найденные записи и перечитывают хранилище,
+ * поэтому закрываются при блокировке и закрытии хранилища.
+ */
+void MainWindow::closeAuditDialogs()
+{
+    stopBreachIndexReaders();
+    for( const QPointer<AuditDialog> &dialog : _auditDialogs )
+        if( dialog )
+            dialog->close();
+    _auditDialogs.clear();
 }
 
 /*!
@@ -391,27 +457,26 @@ void MainWindow::setAdaptiveLastColumn()
  */
 void MainWindow::updateMainTable()
 {
-    QString group = ui.TreeView_Main_Category->currentIndex().data(Qt::DisplayRole).toString();
-
-    QStringList fields;
-    fields.append(DataTable::Fields::id);
-    fields.append(DataTable::Fields::Resource);
-    fields.append(DataTable::Fields::Url);
-    fields.append(DataTable::Fields::Login);
-    fields.append(DataTable::Fields::Password);
-
-    QString sql("SELECT %1 FROM %3 WHERE %4='%5'");
-    sql = sql.arg( fields.join(", "),
-                   DataTable::tableName,
-                   DataTable::Fields::PassGroup,
-                   group );
-    _modelMainTable.setQuery( sql );
+    TRACE_SCOPE( "ui.main_table" );
+    QString group = _modelGroupsList.group( ui.TreeView_Main_Category->currentIndex().row() );
+
+    _modelMainTable.setGroup( group );
     setAdaptiveLastColumn();
 
-    _modelMainTable.setHeaderData(1, Qt::Horizontal, tr("Title"), Qt::DisplayRole);
-    _modelMainTable.setHeaderData(2, Qt::Horizontal, tr("URL"), Qt::DisplayRole);
-    _modelMainTable.setHeaderData(3, Qt::Horizontal, tr("Login"), Qt::DisplayRole);
-    _modelMainTable.setHeaderData(4, Qt::Horizontal, tr("Password"), Qt::DisplayRole);
+    _modelMainTable.setHeaderData(RecordTableModel::ColumnResource, Qt::Horizontal, tr("Title"), Qt::DisplayRole);
+    _modelMainTable.setHeaderData(RecordTableModel::ColumnUrl, Qt::Horizontal, tr("URL"), Qt::DisplayRole);
+    _modelMainTable.setHeaderData(RecordTableModel::ColumnLogin, Qt::Horizontal, tr("Login"), Qt::DisplayRole);
+    _modelMainTable.setHeaderData(RecordTableModel::ColumnPassword, Qt::Horizontal, tr("Password"), Qt::DisplayRole);
+}
+
+/*!
+ * \brief Метод показывает в главной таблице записи с указанными идентификаторами
+ * в порядке их следования (результат поиска SearchEngine)
+ * \param ids - идентификаторы записей
+ */
+void MainWindow::showRecords(const QVector<qint64> &ids)
+{
+    _modelMainTable.setIds( ids );
 }
 
 /*!
@@ -420,11 +485,11 @@ void MainWindow::updateMainTable()
  */
 void MainWindow::updateSectionsList()
 {
-    QString sql("SELECT `%1` FROM %2 GROUP BY %1");
-    sql = sql.arg( DataTable::Fields::PassGroup, DataTable::tableName );
-    _modelGroupsList.setQuery( sql );
+    _modelGroupsList.load();
 
-    _modelGroupsList.setHeaderData(0, Qt::Horizontal, tr("Groups"), Qt::DisplayRole);
+    _modelGroupsList.setHeaderData(GroupListModel::ColumnName, Qt::Horizontal, tr("Groups"), Qt::DisplayRole);
+    _modelGroupsList.setHeaderData(GroupListModel::ColumnRecords, Qt::Horizontal, tr("Records"), Qt::DisplayRole);
+    _modelGroupsList.setHeaderData(GroupListModel::ColumnExpired, Qt::Horizontal, tr("Expired"), Qt::DisplayRole);
 }
 
 void MainWindow::clearFieldsOpenFilePage()
@@ -433,18 +498,14 @@ void MainWindow::clearFieldsOpenFilePage()
     ui.LineEdit_Open_Password->clear();
 }
 
-QString MainWindow::countRecords()
+/*!
+ * \brief Метод выводит в строку состояния количество записей
+ * Количество берётся из каталога групп и поддерживается
+ * по уведомлениям DataNotifier
+ */
+void MainWindow::showRecordCount()
 {
-    QSqlQuery query;
-    QString sqlCount("SELECT COUNT(*) AS rCount FROM %1");
-    sqlCount = sqlCount.arg(DataTable::tableName);
-    if( ! query.exec(sqlCount) ){
-        qCritical() << "Cannot counted records.";
-    }
-    query.first();
-    QString recCount = query.value("rCount").toString();
-
-    return recCount;
+    _statusBar_countRecords.setText( tr("Record count: ") + QString::number(_modelGroupsList.recordCount()) );
 }
 
 void MainWindow::sessionTimeout()
@@ -454,13 +515,14 @@ void MainWindow::sessionTimeout()
 
 void MainWindow::on_PButton_Open_OpenFile_clicked()
 {
+    TRACE_SCOPE( "ui.unlock" );
     QSettings cfg;
 
     int        bufferSize    = cfg.value( Options::BUFFER_SIZE, DefaultValues::BUFFER_SIZE).toInt();
     QString    achtungDbPath = getTmpDbPath();
     QString    encDbPath     = ui.LineEdit_Open_FilePath->text();
-    QByteArray password      = getPasswordHash( ui.LineEdit_Open_Password->text() );
-    QByteArray salt          = getSaltForPassword( ui.LineEdit_Open_Password->text() );
+    QByteArray password;
+    QByteArray salt;
                _sessionTime  = ui.SpinBox_Open_sessionTimeOut->value();
 
     if( _dbFileProcessing ){
@@ -468,16 +530,24 @@ void MainWindow::on_PButton_Open_OpenFile_clicked()
         delete _dbFileProcessing;
         _dbFileProcessing = nullptr;
     }
-    _dbFileProcessing = new DbFileProcessing(achtungDbPath, encDbPath, password, salt, bufferSize);
-    if( ! _dbFileProcessing->openEncryptFile() ){
-        ui.Label_Open_Error->setText( tr("Cannot open encrypted file") );
-        delete _dbFileProcessing;
-        _dbFileProcessing = nullptr;
-        return;
+    {
+        // Разблокировка - вывод ключа и расшифровка, без загрузки таблиц
+        ScopedLatency latency( Metrics::Unlock );
+        password = getPasswordHash( ui.LineEdit_Open_Password->text() );
+        salt     = getSaltForPassword( ui.LineEdit_Open_Password->text() );
+        _dbFileProcessing = new DbFileProcessing(achtungDbPath, encDbPath, password, salt, bufferSize);
+        if( ! _dbFileProcessing->openEncryptFile() ){
+            ui.Label_Open_Error->setText( tr("Cannot open encrypted file") );
+            delete _dbFileProcessing;
+            _dbFileProcessing = nullptr;
+            return;
+        }
     }
 
     _passwordHash = password;
+    _passwordSalt = salt;
     connectToDatabase(achtungDbPath);
+    _searchEngine.load();
     setPage( PageIndex::MAIN );
     _modelGroupsList.clear();
     updateMainTable();
@@ -490,8 +560,6 @@ void MainWindow::on_PButton_Open_OpenFile_clicked()
     _recentDocuments.addLastDocument( encDbPath );
 
 
-    QString recCount = countRecords();
-    _statusBar_countRecords.setText( tr("Record count: ") + recCount );
 }
 
 /*!
@@ -519,6 +587,12 @@ void MainWindow::loadCharGroupsUserSettings()
     ui.CheckBox_Edit_Pas_ChType_Minus    ->setChecked( cfg.value(Options::CharGroups::MINUS,     DefaultValues::CharGroups::MINUS    ).toBool() );
     ui.CheckBox_Edit_Pas_ChType_Numbers  ->setChecked( cfg.value(Options::CharGroups::NUMBERS,   DefaultValues::CharGroups::NUMBERS  ).toBool() );
     ui.CheckBox_Edit_Pas_ChType_Underline->setChecked( cfg.value(Options::CharGroups::UNDERLINE, DefaultValues::CharGroups::UNDERLINE).toBool() );
+
+    ui.CheckBox_Edit_Pas_Passphrase      ->setChecked( cfg.value(Options::CharGroups::PASSPHRASE, DefaultValues::CharGroups::PASSPHRASE).toBool() );
+    ui.SpinBox_Edit_PassphraseWords      ->setValue( cfg.value(Options::CharGroups::PASSPHRASE_WORDS, DefaultValues::CharGroups::PASSPHRASE_WORDS).toInt() );
+    ui.LineEdit_Edit_PassphraseSeparator ->setText( cfg.value(Options::CharGroups::PASSPHRASE_SEPARATOR, DefaultValues::CharGroups::PASSPHRASE_SEPARATOR).toString() );
+    ui.ComboBox_Edit_PassphraseCase      ->setCurrentIndex( cfg.value(Options::CharGroups::PASSPHRASE_CASE, DefaultValues::CharGroups::PASSPHRASE_CASE).toInt() );
+    on_CheckBox_Edit_Pas_Passphrase_toggled( ui.CheckBox_Edit_Pas_Passphrase->isChecked() );
 }
 
 void MainWindow::on_actionNewRecord_triggered()
@@ -539,6 +613,11 @@ void MainWindow::on_actionNewRecord_triggered()
  */
 void MainWindow::on_PushButton_Edit_GeneratePassword_clicked()
 {
+    if( ui.CheckBox_Edit_Pas_Passphrase->isChecked() ){
+        generatePassphrase();
+        return;
+    }
+
     int type = 0;
     int length = 0;
 
@@ -561,20 +640,79 @@ void MainWindow::on_PushButton_Edit_GeneratePassword_clicked()
 
     QString password = PasswordGenerator::getPassword(type, length);
 
-    ui.ProgressBar_Edit_PasswordQuality->setValue( PasswordGenerator::entropy(password) );
+    showPasswordStrength( password );
     ui.LineEdit_Edit_Password->setText( password );
     ui.LineEdit_Edit_ConfirmPassword->setText( password );
 }
 
+/*!
+ * \brief Метод генерирует парольную фразу из списка слов текущего языка
+ * Список открывается при первой генерации, см. Wordlist::language()
+ */
+void MainWindow::generatePassphrase()
+{
+    const QString language = _currentLanguage == QLocale::Russian ? "ru" : "en";
+    const Wordlist *words = Wordlist::language( language );
+    if( words == nullptr ){
+        QMessageBox::warning( this, tr("Passphrase"), tr("Wordlist \"%1\" is not available").arg(language) );
+        return;
+    }
+
+    const QString password = PasswordGenerator::getPassphrase(
+                *words,
+                ui.SpinBox_Edit_PassphraseWords->value(),
+                ui.LineEdit_Edit_PassphraseSeparator->text(),
+                PasswordGenerator::Capitalization(ui.ComboBox_Edit_PassphraseCase->currentIndex()) );
+
+    showPasswordStrength( password );
+    ui.LineEdit_Edit_Password->setText( password );
+    ui.LineEdit_Edit_ConfirmPassword->setText( password );
+}
+
+/*!
+ * \brief Обработчик переключения режима парольной фразы
+ * Группы символов и длина нужны только обычному паролю
+ */
+void MainWindow::on_CheckBox_Edit_Pas_Passphrase_toggled(bool checked)
+{
+    ui.GroupBox_Edit_Password_Symbols_Group->setEnabled( ! checked );
+    ui.SpinBox_Edit_PasswordLenght->setEnabled( ! checked );
+    ui.SpinBox_Edit_PassphraseWords->setEnabled( checked );
+    ui.LineEdit_Edit_PassphraseSeparator->setEnabled( checked );
+    ui.ComboBox_Edit_PassphraseCase->setEnabled( checked );
+}
+
 /*!
  * \brief Метод обрабатывает ввод пароля в поле ввода
- * Вычисляет и устанавливает в виджет прогресс-бара значение
- * энтропии посредством класса PasswordGenerator
+ * Оценивает стойкость пароля посредством класса PasswordStrength
  * \param password - пароль, текст в LineEdit
  */
 void MainWindow::on_LineEdit_Edit_Password_textEdited(const QString &password)
 {
-    ui.ProgressBar_Edit_PasswordQuality->setValue( PasswordGenerator::entropy(password) );
+    showPasswordStrength( password );
+}
+
+/*!
+ * \brief Метод показывает стойкость пароля в прогресс-баре
+ * Значение - число попыток подбора в битах (100 бит - полная шкала),
+ * в подсказке - совет по самому слабому месту пароля
+ */
+void MainWindow::showPasswordStrength(const QString &password)
+{
+    if( ! password.isEmpty() && _breachIndex.containsPassword(password) ){
+        ui.ProgressBar_Edit_PasswordQuality->setValue( 0 );
+        ui.ProgressBar_Edit_PasswordQuality->setStyleSheet( warningStyle );
+        ui.ProgressBar_Edit_PasswordQuality->setToolTip( tr("This password appears in the breach list") );
+        return;
+    }
+
+    const PasswordStrength::Estimate estimate = PasswordStrength::estimate( password );
+    const QString feedback = PasswordStrength::feedback( estimate );
+
+    ui.ProgressBar_Edit_PasswordQuality->setValue( qMin(100, qRound(estimate.bits())) );
+    ui.ProgressBar_Edit_PasswordQuality->setStyleSheet( QString() );
+    ui.ProgressBar_Edit_PasswordQuality->setToolTip( feedback.isEmpty() ? tr("Difficulties")
+                                                                        : tr("Difficulties") + "\n" + feedback );
 }
 
 /*!
@@ -601,8 +739,8 @@ void MainWindow::getDataFromUi()
     _data.setLogin( ui.LineEdit_Edit_Login->text() );
     _data.setPassword( ui.LineEdit_Edit_Password->text() );
     _data.setAnswer( ui.LineEdit_Edit_Answer->text() );
-    _data.setCreateTime( QString::number( QDateTime::currentMSecsSinceEpoch() ) );
-    _data.setPassLifeTime( QString::number( ui.DateTimeEdit_Edit_Pas_PassOutdate->dateTime().toMSecsSinceEpoch() ) );
+    _data.setCreateTime( QDateTime::currentMSecsSinceEpoch() );
+    _data.setPassLifeTime( ui.DateTimeEdit_Edit_Pas_PassOutdate->dateTime().toMSecsSinceEpoch() );
     _data.setPhone( ui.LineEdit_Edit_Phone->text() );
     _data.setDescription( ui.PlainTextEdit_Edit_Comment->toPlainText() );
 }
@@ -692,6 +830,11 @@ void MainWindow::saveCharGroupsUserSettings()
     cfg.setValue(Options::CharGroups::MINUS     , ui.CheckBox_Edit_Pas_ChType_Minus->isChecked() );
     cfg.setValue(Options::CharGroups::NUMBERS   , ui.CheckBox_Edit_Pas_ChType_Numbers->isChecked() );
     cfg.setValue(Options::CharGroups::UNDERLINE , ui.CheckBox_Edit_Pas_ChType_Underline->isChecked() );
+
+    cfg.setValue(Options::CharGroups::PASSPHRASE           , ui.CheckBox_Edit_Pas_Passphrase->isChecked() );
+    cfg.setValue(Options::CharGroups::PASSPHRASE_WORDS     , ui.SpinBox_Edit_PassphraseWords->value() );
+    cfg.setValue(Options::CharGroups::PASSPHRASE_SEPARATOR , ui.LineEdit_Edit_PassphraseSeparator->text() );
+    cfg.setValue(Options::CharGroups::PASSPHRASE_CASE      , ui.ComboBox_Edit_PassphraseCase->currentIndex() );
 }
 
 bool MainWindow::isClearEditPageFields()
@@ -744,17 +887,14 @@ void MainWindow::on_PushButton_Edit_Save_clicked()
     }
 
     getDataFromUi();
-    _data.save();
+    if( _data.save() ){
+        _searchEngine.update( _data );
+    }
 
     saveCharGroupsUserSettings();
     clearEditPageFields();
-    updateMainTable();
-    updateSectionsList();
     setPage( PageIndex::MAIN );
     _existsChanges = true;
-
-    QString recCount = countRecords();
-    _statusBar_countRecords.setText( tr("Record count: ") + recCount );
 }
 
 /*!
@@ -770,22 +910,34 @@ void MainWindow::on_PushButton_Edit_Cancel_clicked()
 
 void MainWindow::on_actionCreateDatabase_triggered()
 {
+    closeAuditDialogs();
+    // Результат идущей проверки относится к закрываемому хранилищу
+    ++_databaseSession;
+    _breachedRecords.clear();
     _db.close();
     if( _existsChanges && hasSaveChanges() ){
         _dbFileProcessing->saveEncryptFile();
     }
     _db.remove();
+    _searchDispatcher.cancel();
+    _searchEngine.clear();
     _existsChanges = false;
     setPage( PageIndex::NEW_FILE );
 }
 
 void MainWindow::on_actionOpenDatabase_triggered()
 {
+    closeAuditDialogs();
+    // Результат идущей проверки относится к закрываемому хранилищу
+    ++_databaseSession;
+    _breachedRecords.clear();
     _db.close();
     if( _existsChanges && hasSaveChanges() ){
         _dbFileProcessing->saveEncryptFile();
     }
     _db.remove();
+    _searchDispatcher.cancel();
+    _searchEngine.clear();
     _existsChanges = false;
     goPage( PageIndex::OPEN_FILE );
 }
@@ -795,42 +947,23 @@ void MainWindow::on_actionDeleteRecord_triggered()
     QModelIndex index = ui.TableView_Main_Records->selectionModel()->currentIndex();
     if( ! index.isValid() )
         return;
-    QString id = _modelMainTable.record(index.row()).value(DataTable::Fields::id).toString();
+    qint64 id = _modelMainTable.recordId( index.row() );
     qDebug() << id;
 
-    QSqlQuery query;
-    query.prepare( QString("DELETE FROM %1 WHERE id = :id").arg(DataTable::tableName) );
-    query.bindValue( ":id", id );
-    if( ! query.exec() ){
-        qWarning() << query.lastError().text();
+    if( Data::remove(id) ){
+        _searchEngine.remove( id );
     }
     _existsChanges = true;
-    updateMainTable();
-
-    QString recCount = countRecords();
-    _statusBar_countRecords.setText( tr("Record count: ") + recCount );
 }
 
 QByteArray MainWindow::getPasswordHash(const QString &password)
 {
-    QSettings cfg;
-    QByteArray passwordHash = password.toUtf8();
-    bool hashCyclessCastToIntSuccess = false;
-    int hashCycles = cfg.value( Options::PASSWORD_HASH_CYCLES, DefaultValues::PASSWORD_HASH_CYCLES ).toInt(&hashCyclessCastToIntSuccess);
-    if( (! hashCyclessCastToIntSuccess) || (hashCycles < 1) ){
-        hashCycles = DefaultValues::PASSWORD_HASH_CYCLES;
-    }
-    for(int i = 0; i < hashCycles; ++i){
-        passwordHash   = QCryptographicHash::hash( passwordHash, QCryptographicHash::Md5 );
-    }
-
-    return passwordHash;
+    return VaultKey::passwordHash( password );
 }
 
 QByteArray MainWindow::getSaltForPassword(const QString &password)
 {
-    QByteArray salt          = password.toUtf8().toHex();
-    return salt;
+    return VaultKey::salt( password );
 }
 
 void MainWindow::createEmptyFile(const QString &path)
@@ -860,7 +993,9 @@ void MainWindow::on_PButton_New_CreateDatabase_clicked()
 
     createEmptyFile(encDbPath);
     connectToDatabase( achtungDbPath );
+    _searchEngine.load();
     _passwordHash = password;
+    _passwordSalt = salt;
 
     _modelGroupsList.clear();
     updateMainTable();
@@ -877,6 +1012,7 @@ void MainWindow::on_PButton_New_CreateDatabase_clicked()
 
 void MainWindow::on_actionSaveDatabase_triggered()
 {
+    TRACE_SCOPE( "ui.save" );
     _dbFileProcessing->saveEncryptFile();
     _existsChanges = false;
 }
@@ -980,7 +1116,12 @@ void MainWindow::on_actionLock_triggered()
 
 void MainWindow::on_PButton_Lock_Unclock_clicked()
 {
-    QByteArray password = getPasswordHash( ui.LineEdit_Lock_Password->text() );
+    TRACE_SCOPE( "ui.relock" );
+    QByteArray password;
+    {
+        ScopedLatency latency( Metrics::Unlock );
+        password = getPasswordHash( ui.LineEdit_Lock_Password->text() );
+    }
     if( password == _passwordHash ){
         setPage( PageIndex::MAIN );
         ui.Label_Lock_Error->setText("");
@@ -1033,8 +1174,7 @@ void MainWindow::on_LineEdit_Edit_Password_editingFinished()
 
 void MainWindow::on_TableView_Main_Records_activated(const QModelIndex &index)
 {
-    QSqlRecord record = _modelMainTable.record( index.row() );
-    _data.load( record.value( DataTable::Fields::id ).toString() );
+    _data.load( _modelMainTable.recordId(index.row()) );
 
     setDataToInfoPanel( _data );
 }
@@ -1044,7 +1184,7 @@ void MainWindow::on_actionCopyNameInClipboard_triggered()
     QModelIndex index = ui.TableView_Main_Records->selectionModel()->currentIndex();
     if( ! index.isValid() )
         return;
-    QString login = _modelMainTable.record(index.row()).value(DataTable::Fields::Login).toString();
+    QString login = _modelMainTable.value(index.row(), RecordTableModel::ColumnLogin).toString();
 
     QClipboard *pcb = QApplication::clipboard();
     pcb->setText(login);
@@ -1055,7 +1195,7 @@ void MainWindow::on_actionCopyPasswordInClipboard_triggered()
     QModelIndex index = ui.TableView_Main_Records->selectionModel()->currentIndex();
     if( ! index.isValid() )
         return;
-    QString password = _modelMainTable.record(index.row()).value(DataTable::Fields::Password).toString();
+    QString password = _modelMainTable.value(index.row(), RecordTableModel::ColumnPassword).toString();
 
     QClipboard *pcb = QApplication::clipboard();
     pcb->setText(password);
@@ -1077,7 +1217,7 @@ void MainWindow::on_actionCopyUrl_triggered()
     QModelIndex index = ui.TableView_Main_Records->selectionModel()->currentIndex();
     if( ! index.isValid() )
         return;
-    QString url = _modelMainTable.record(index.row()).value(DataTable::Fields::Url).toString();
+    QString url = _modelMainTable.value(index.row(), RecordTableModel::ColumnUrl).toString();
 
 //    QClipboard *pcb = QApplication::clipboard();
 //    pcb->setText(url);
@@ -1085,24 +1225,29 @@ void MainWindow::on_actionCopyUrl_triggered()
     QDesktopServices::openUrl( QUrl(url) );
 }
 
+/*!
+ * \brief Метод обрабатывает ввод в строку поиска
+ * Ищет по всем группам в индексе SearchEngine без обращения к SQLite:
+ * запрос откладывается и выполняется в рабочем потоке SearchDispatcher,
+ * результат приходит в showRecords(). Если индекс не загружен -
+ * ищет через QuerysManager::search.
+ * При пустой строке возвращает таблицу текущей группы
+ * \param searchText - искомая строка
+ */
 void MainWindow::on_LineEdit_Main_Search_textEdited(const QString &searchText)
 {
-    QString group = ui.TreeView_Main_Category->currentIndex().data(Qt::DisplayRole).toString();
+    if( searchText.isEmpty() ){
+        _searchDispatcher.cancel();
+        updateMainTable();
+        return;
+    }
 
-    QStringList fields;
-    fields.append(DataTable::Fields::id);
-    fields.append(DataTable::Fields::Resource);
-    fields.append(DataTable::Fields::Url);
-    fields.append(DataTable::Fields::Login);
-    fields.append(DataTable::Fields::Password);
+    if( _searchEngine.isLoaded() ){
+        _searchDispatcher.search( searchText );
+        return;
+    }
 
-    QString sql("SELECT %1 FROM %2 WHERE %3='%4' AND %5 LIKE '\%" + searchText + "\%'");
-    sql = sql.arg( fields.join(", "),
-                   DataTable::tableName,
-                   DataTable::Fields::PassGroup,
-                   group,
-                   DataTable::Fields::Resource);
-    _modelMainTable.setQuery( sql );
+    _modelMainTable.setIds( QuerysManager::search(searchText) );
 }
 
 void MainWindow::on_actionAbout_triggered()
@@ -1112,6 +1257,113 @@ void MainWindow::on_actionAbout_triggered()
     dialog->exec();
 }
 
+/*!
+ * \brief Обработчик выбора индекса утёкших паролей
+ * Индекс строится командой passman-cli breach-index из списка SHA-1
+ */
+void MainWindow::on_actionBreachIndex_triggered()
+{
+    QString fileName = QFileDialog::getOpenFileName(this,
+                                                    tr("Breach list"),
+                                                    QFileInfo( _breachIndex.fileName() ).absolutePath(),
+                                                    tr("Breach index (*%1);;All files (*)").arg(BreachIndex::FILE_SUFFIX) );
+    if( fileName.isEmpty() )
+        return;
+
+    // open() сначала закрывает текущий индекс, поэтому файл проверяется отдельно
+    BreachIndex candidate;
+    if( ! candidate.open(fileName) ){
+        QMessageBox::warning( this, tr("Breach list"),
+                              tr("This file is not a breach index.\n"
+                                 "Build one from a SHA-1 list with: passman-cli breach-index <list> <index>") );
+        return;
+    }
+    candidate.close();
+
+    // Проверки в рабочих потоках читают отображение текущего индекса
+    stopBreachIndexReaders();
+    if( ! _breachIndex.open(fileName) ){
+        QMessageBox::warning( this, tr("Breach list"), tr("Cannot open %1").arg(fileName) );
+        if( ! BreachIndex::configuredPath().isEmpty() )
+            _breachIndex.open( BreachIndex::configuredPath() );
+        return;
+    }
+
+    QSettings cfg;
+    cfg.setValue( BreachIndex::PATH_OPTION, fileName );
+    ui.StatusBar->showMessage( tr("Breach list: %1 hashes").arg(_breachIndex.count()), 10000 );
+}
+
+/*!
+ * \brief Обработчик проверки всех паролей по индексу утёкших паролей
+ * Записи читаются здесь, проверка идёт в рабочем потоке,
+ * результат показывает showBreachedRecords()
+ */
+void MainWindow::on_actionBreachAudit_triggered()
+{
+    if( ! _breachIndex.isOpen() ){
+        on_actionBreachIndex_triggered();
+        if( ! _breachIndex.isOpen() )
+            return;
+    }
+    if( _breachAudit.isRunning() )
+        return;
+
+    RecordTable records;
+    if( ! RecordLoader::load(&records) ){
+        QMessageBox::warning( this, tr("Breach check"), tr("Cannot read records") );
+        return;
+    }
+
+    ui.actionBreachAudit->setEnabled( false );
+    ui.StatusBar->showMessage( tr("Checking passwords...") );
+    _breachAuditSession = _databaseSession;
+    _breachAudit.setFuture( QtConcurrent::run(&_breachIndex, &BreachIndex::breached, records) );
+}
+
+/*!
+ * \brief Метод показывает в таблице записи с утёкшими паролями
+ * Если открыта другая страница, записи покажутся при возврате на главную;
+ * результат по уже закрытому хранилищу отбрасывается.
+ */
+void MainWindow::showBreachedRecords()
+{
+    ui.actionBreachAudit->setEnabled( true );
+
+    const QVector<qint64> ids = _breachAudit.result();
+    if( _breachAuditSession != _databaseSession )
+        return;
+
+    ui.StatusBar->showMessage( tr("Passwords found in the breach list: %1").arg(ids.size()), 10000 );
+    if( ids.isEmpty() )
+        return;
+    if( ui.StackedWidget->currentIndex() == PageIndex::MAIN )
+        showRecords( ids );
+    else
+        _breachedRecords = ids;
+}
+
+/*!
+ * \brief Обработчик проверки паролей всего хранилища
+ * Индекс утёкших паролей учитывается, если он открыт
+ */
+void MainWindow::on_actionPasswordAudit_triggered()
+{
+    auto dialog = new AuditDialog( &_breachIndex, this );
+    dialog->setAttribute( Qt::WA_DeleteOnClose );
+    _auditDialogs.removeAll( QPointer<AuditDialog>() );
+    _auditDialogs.append( dialog );
+    connect( dialog, SIGNAL(showRecords(QVector<qint64>)), this, SLOT(showRecords(QVector<qint64>)) );
+    dialog->show();
+}
+
+void MainWindow::on_actionDiagnostics_triggered()
+{
+    auto dialog = new DiagnosticsDialog(this);
+    dialog->setAttribute( Qt::WA_DeleteOnClose );
+    dialog->show();
+}
+
 void MainWindow::on_actionHelp_triggered()
 {
     QString file = QDir::currentPath() + QDir::separator();
@@ -1146,8 +1398,7 @@ void MainWindow::on_actionRussian_triggered(bool checked)
         QSettings cfg;
         cfg.setValue( Options::LANGUAGE, QLocale::Russian );
 
-        QString recCount = countRecords();
-        _statusBar_countRecords.setText( tr("Record count: ") + recCount );
+        showRecordCount();
 
         _currentLanguage = QLocale::Russian;
     }
@@ -1169,8 +1420,7 @@ void MainWindow::on_actionEnglish_triggered(bool checked)
         QSettings cfg;
         cfg.setValue( Options::LANGUAGE, QLocale::English );
 
-        QString recCount = countRecords();
-        _statusBar_countRecords.setText( tr("Record count: ") + recCount );
+        showRecordCount();
 
         _currentLanguage = QLocale::English;
     }
@@ -1191,3 +1441,94 @@ void MainWindow::on_actionEnglish_triggered()
 {
 
 }
+
+/*!
+ * \brief Обработчик действия импорта записей из CSV, JSON Lines или XML KeePass
+ * Зашифрованный файл читается с паролем текущего файла.
+ * После загрузки перечитываются каталог групп, таблица и индекс поиска
+ */
+void MainWindow::on_actionImportRecords_triggered()
+{
+    QString fileName = QFileDialog::getOpenFileName(this,
+                                                    tr("Import records"),
+                                                    QStandardPaths::writableLocation( QStandardPaths::HomeLocation ),
+                                                    tr("Records (*.csv *.jsonl *.ndjson *.json *.enc);;"
+                                                       "KeePass 2.x XML (*.xml);;All files (*)") );
+    if( fileName.isEmpty() )
+        return;
+
+    if( KeePassImporter::isKdbxFile(fileName) ){
+        QMessageBox::warning( this, tr("Import records"),
+                              tr("KeePass database files are not supported.\n"
+                                 "Export the database from KeePass to XML and import that file.") );
+        return;
+    }
+
+    TransferStats stats;
+    bool success = false;
+    if( fileName.endsWith(".xml", Qt::CaseInsensitive) )
+        success = KeePassImporter::readFile( fileName, &stats );
+    else
+        success = RecordImporter::readFile( fileName, &stats, _passwordHash, _passwordSalt );
+    if( stats.records() > 0 ){
+        _existsChanges = true;
+        _searchEngine.load();
+        updateSectionsList();
+        updateMainTable();
+    }
+
+    if( success ){
+        ui.StatusBar->showMessage( tr("Imported: ") + stats.summary(), 10000 );
+    }else{
+        QMessageBox::warning( this, tr("Import records"),
+                              tr("Import is interrupted by an error.\n") + stats.summary() );
+    }
+}
+
+void MainWindow::on_actionExportRecords_triggered()
+{
+    exportRecords( false );
+}
+
+void MainWindow::on_actionExportRecordsEncrypted_triggered()
+{
+    exportRecords( true );
+}
+
+/*!
+ * \brief Метод выгружает все записи в файл
+ * \param encrypted - шифровать файл паролем текущего файла;
+ * запись идёт сразу через CryptFileDevice, открытый текст на диск не попадает
+ */
+void MainWindow::exportRecords(bool encrypted)
+{
+    QString csvFilter  = tr("CSV (*.csv)");
+    QString jsonFilter = tr("JSON Lines (*.jsonl)");
+    QString selectedFilter;
+    QString fileName = QFileDialog::getSaveFileName(this,
+                                                    tr("Export records"),
+                                                    QStandardPaths::writableLocation( QStandardPaths::HomeLocation ),
+                                                    csvFilter + ";;" + jsonFilter,
+                                                    &selectedFilter );
+    if( fileName.isEmpty() )
+        return;
+
+    RecordFormat::Format format = ( selectedFilter == jsonFilter ) ? RecordFormat::JsonLines
+                                                                   : RecordFormat::Csv;
+    // Импорт определяет формат по расширению, поэтому оно обязательно
+    if( RecordFormat::fromFileName(fileName) != format || QFileInfo(fileName).suffix().isEmpty() )
+        fileName += ( format == RecordFormat::JsonLines ) ? ".jsonl" : ".csv";
+    if( encrypted && ! fileName.endsWith(RecordFormat::ENCRYPTED_SUFFIX) )
+        fileName += RecordFormat::ENCRYPTED_SUFFIX;
+
+    TransferStats stats;
+    bool success = RecordExporter::writeFile( fileName, format, &stats,
+                                              encrypted ? _passwordHash : QByteArray(),
+                                              encrypted ? _passwordSalt : QByteArray() );
+
+    if( success ){
+        ui.StatusBar->showMessage( tr("Exported: ") + stats.summary(), 10000 );
+    }else{
+        QMessageBox::warning( this, tr("Export records"), tr("Cannot export records") );
+    }
+}
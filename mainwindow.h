@@ -11,6 +11,15 @@
 #include <QTimer>
 #include <QTranslator>
 #include "recentdocuments.h"
+#include "search/searchengine.h"
+#include "search/searchdispatcher.h"
+#include "models/recordtablemodel.h"
+#include "models/grouplistmodel.h"
+#include "breach/breachindex.h"
+#include <QFutureWatcher>
+#include <QPointer>
+
+class AuditDialog;
 
 namespace PageIndex{
     enum PageIndex{
@@ -34,14 +43,23 @@ private:
     bool              _existsChanges = false;
     ConnectionManager _db;
     Data              _data;
-    QSqlQueryModel    _modelMainTable;
-    QSqlQueryModel    _modelGroupsList;
+    RecordTableModel  _modelMainTable;
+    GroupListModel    _modelGroupsList;
+    SearchEngine      _searchEngine;
+    SearchDispatcher  _searchDispatcher;
     QSystemTrayIcon   _trayIcon;
     QByteArray        _passwordHash;
+    QByteArray        _passwordSalt;
     RecentDocuments   _recentDocuments;
     QLabel            _statusBar_countRecords;
     QTimer            _sessionTimer;
     QLocale::Language _currentLanguage;
+    BreachIndex       _breachIndex;
+    QFutureWatcher< QVector<qint64> > _breachAudit;
+    QList< QPointer<AuditDialog> >    _auditDialogs;  ///< Читают _breachIndex из рабочих потоков
+    QVector<qint64>   _breachedRecords;         ///< Найдены не на главной странице, покажутся на ней
+    quint32           _databaseSession = 0;     ///< Растёт при смене хранилища
+    quint32           _breachAuditSession = 0;  ///< _databaseSession на начало проверки
 
     int               _sessionTime = 5;
 
@@ -60,6 +78,8 @@ private:
     bool goPage_MAIN();
     bool goPage_EDIT();
     bool goPage_LOCK();
+    void stopBreachIndexReaders();
+    void closeAuditDialogs();
 public:
     explicit MainWindow(QWidget *parent = 0);
     ~MainWindow();
@@ -81,9 +101,14 @@ public:
     void clearFieldsOpenFilePage();
     bool isClearEditPageFields();
     void setDataToUi();
-    QString countRecords();
+    void exportRecords(bool encrypted);
+    void showPasswordStrength(const QString &password);
+    void generatePassphrase();
 private slots:
+    void showRecordCount();
     void sessionTimeout();
+    void showRecords(const QVector<qint64> &ids);
+    void showBreachedRecords();
     void on_PButton_First_NewFile_clicked();
     void on_PButton_Open_Cancel_clicked();
     void on_PButton_New_Cancel_clicked();
@@ -92,6 +117,7 @@ private slots:
     void on_actionExit_triggered();
     void on_actionNewRecord_triggered();
     void on_PushButton_Edit_GeneratePassword_clicked();
+    void on_CheckBox_Edit_Pas_Passphrase_toggled(bool checked);
     void on_LineEdit_Edit_Password_textEdited(const QString &arg1);
     void on_ToolButton_Edit_Toogle_Password_toggled(bool checked);
     void on_PushButton_Edit_Save_clicked();
@@ -130,6 +156,8 @@ private slots:
 
     void on_actionHelp_triggered();
 
+    void on_actionDiagnostics_triggered();
+
     void on_actionRussian_triggered(bool checked);
 
     void on_actionEnglish_triggered(bool checked);
@@ -138,6 +166,18 @@ private slots:
 
     void on_actionEnglish_triggered();
 
+    void on_actionImportRecords_triggered();
+
+    void on_actionExportRecords_triggered();
+
+    void on_actionExportRecordsEncrypted_triggered();
+
+    void on_actionBreachIndex_triggered();
+
+    void on_actionBreachAudit_triggered();
+
+    void on_actionPasswordAudit_triggered();
+
 protected:
     void closeEvent(QCloseEvent *);
 };
@@ -0,0 +1,95 @@
+#include "metrics/histogram.h"
+
+#include <QtAlgorithms>
+
+Histogram::Histogram() :
+    _sum(0),
+    _max(0)
+{
+    for( int i = 0; i < BUCKET_COUNT; ++i )
+        _counts[i].store( 0 );
+}
+
+/*!
+ * \brief Метод возвращает номер корзины для значения
+ * Значения меньше SUB_BUCKETS хранятся точно; для больших корзина
+ * определяется старшим битом и следующими SUB_BUCKET_BITS битами
+ */
+int Histogram::bucketIndex(quint64 value)
+{
+    if( value < quint64(SUB_BUCKETS) )
+        return int( value );
+
+    const int msb   = 63 - int( qCountLeadingZeroBits(value) );
+    const int shift = msb - SUB_BUCKET_BITS;
+    return SUB_BUCKETS + shift * SUB_BUCKETS + int( (value >> shift) - SUB_BUCKETS );
+}
+
+/*!
+ * \brief Метод возвращает наибольшее значение, попадающее в корзину
+ */
+quint64 Histogram::bucketUpperBound(int index)
+{
+    if( index < SUB_BUCKETS )
+        return quint64( index );
+
+    const int shift = (index - SUB_BUCKETS) / SUB_BUCKETS;
+    const quint64 sub = quint64( (index - SUB_BUCKETS) % SUB_BUCKETS + SUB_BUCKETS );
+    return ((sub + 1) << shift) - 1;
+}
+
+void Histogram::record(quint64 value)
+{
+    _counts[bucketIndex(value)].fetchAndAddRelaxed( 1 );
+    _sum.fetchAndAddRelaxed( value );
+
+    quint64 max = _max.loadAcquire();
+    while( value > max && ! _max.testAndSetOrdered(max, value, max) ){
+    }
+}
+
+Histogram::Snapshot Histogram::snapshot() const
+{
+    Snapshot result;
+    result.counts.resize( BUCKET_COUNT );
+    for( int i = 0; i < BUCKET_COUNT; ++i ){
+        result.counts[i] = _counts[i].loadAcquire();
+        result.total    += result.counts[i];
+    }
+    result.sum = _sum.loadAcquire();
+    result.max = _max.loadAcquire();
+    return result;
+}
+
+void Histogram::reset()
+{
+    for( int i = 0; i < BUCKET_COUNT; ++i )
+        _counts[i].store( 0 );
+    _sum.store( 0 );
+    _max.store( 0 );
+}
+
+/*!
+ * \brief Метод возвращает перцентиль
+ * \param p - доля от 0 до 1, например 0.99
+ * \return верхняя граница корзины, не больше наибольшего значения
+ */
+quint64 Histogram::Snapshot::percentile(double p) const
+{
+    if( total == 0 )
+        return 0;
+
+    const quint64 rank = qMax<quint64>( 1, quint64(p * total + 0.5) );
+    quint64 seen = 0;
+    for( int i = 0; i < counts.size(); ++i ){
+        seen += counts.at(i);
+        if( seen >= rank )
+            return qMin( bucketUpperBound(i), max );
+    }
+    return max;
+}
+
+double Histogram::Snapshot::mean() const
+{
+    return total > 0 ? double(sum) / total : 0.0;
+}
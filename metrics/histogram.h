@@ -0,0 +1,49 @@
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+#include <QAtomicInteger>
+#include <QVector>
+
+/*!
+ * \brief Класс Histogram - гистограмма задержек в стиле HDR
+ *
+ * Значения (наносекунды) раскладываются по корзинам логарифмически-линейно:
+ * каждая степень двойки делится на SUB_BUCKETS равных корзин, поэтому
+ * относительная погрешность перцентилей не превышает 1/SUB_BUCKETS
+ * при любом диапазоне значений. Запись - одно атомарное приращение
+ * без блокировок, её можно вызывать из любого потока.
+ */
+class Histogram
+{
+public:
+    static const int SUB_BUCKET_BITS = 4;
+    static const int SUB_BUCKETS     = 1 << SUB_BUCKET_BITS;
+    static const int BUCKET_COUNT    = SUB_BUCKETS + (64 - SUB_BUCKET_BITS) * SUB_BUCKETS;
+
+    /// Согласованный снимок для расчёта перцентилей
+    struct Snapshot {
+        QVector<quint64> counts;
+        quint64 total = 0;
+        quint64 sum   = 0;
+        quint64 max   = 0;
+
+        quint64 percentile(double p) const;
+        double  mean() const;
+    };
+
+    Histogram();
+
+    void record(quint64 value);
+    Snapshot snapshot() const;
+    void reset();
+
+    static int bucketIndex(quint64 value);
+    static quint64 bucketUpperBound(int index);
+
+private:
+    QAtomicInteger<quint64> _counts[BUCKET_COUNT];
+    QAtomicInteger<quint64> _sum;
+    QAtomicInteger<quint64> _max;
+};
+
+#endif // HISTOGRAM_H
@@ -0,0 +1,135 @@
+#include "metrics/metrics.h"
+
+#include <QFile>
+#include <QJsonDocument>
+#include <QTextStream>
+
+QAtomicInteger<qint64> Metrics::_counters[Metrics::CounterCount];
+Histogram              Metrics::_latencies[Metrics::LatencyCount];
+
+namespace {
+    const double PERCENTILES[] = { 0.5, 0.9, 0.99, 0.999 };
+    const char  *PERCENTILE_NAMES[] = { "p50", "p90", "p99", "p999" };
+    const int    PERCENTILE_COUNT = 4;
+}
+
+void Metrics::add(Counter counter, qint64 value)
+{
+    _counters[counter].fetchAndAddRelaxed( value );
+}
+
+void Metrics::record(Latency latency, qint64 nsecs)
+{
+    _latencies[latency].record( quint64(qMax<qint64>(0, nsecs)) );
+}
+
+qint64 Metrics::counter(Counter counter)
+{
+    return _counters[counter].loadAcquire();
+}
+
+Histogram::Snapshot Metrics::latency(Latency latency)
+{
+    return _latencies[latency].snapshot();
+}
+
+QString Metrics::name(Counter counter)
+{
+    switch( counter ){
+    case BytesEncrypted:  return "bytes_encrypted";
+    case BytesDecrypted:  return "bytes_decrypted";
+    case QueriesExecuted: return "queries_executed";
+    case Saves:           return "saves";
+    case PageCacheHits:   return "page_cache_hits";
+    case PageCacheMisses: return "page_cache_misses";
+    case Searches:        return "searches";
+    default:              return QString();
+    }
+}
+
+QString Metrics::name(Latency latency)
+{
+    switch( latency ){
+    case Unlock: return "unlock";
+    case Open:   return "open";
+    case Save:   return "save";
+    case Search: return "search";
+    case Audit:  return "audit";
+    default:     return QString();
+    }
+}
+
+/*!
+ * \brief Метод возвращает значения в JSON
+ * {"counters": {...}, "latency_us": {"open": {"count", "mean", "max", "p50", ...}, ...}}
+ */
+QJsonObject Metrics::toJson()
+{
+    QJsonObject counters;
+    for( int i = 0; i < CounterCount; ++i )
+        counters.insert( name(Counter(i)), counter(Counter(i)) );
+
+    QJsonObject latencies;
+    for( int i = 0; i < LatencyCount; ++i ){
+        const Histogram::Snapshot snapshot = latency( Latency(i) );
+        QJsonObject values;
+        values.insert( "count", qint64(snapshot.total) );
+        values.insert( "mean", snapshot.mean() / 1000.0 );
+        values.insert( "max", snapshot.max / 1000.0 );
+        for( int p = 0; p < PERCENTILE_COUNT; ++p )
+            values.insert( PERCENTILE_NAMES[p], snapshot.percentile(PERCENTILES[p]) / 1000.0 );
+        latencies.insert( name(Latency(i)), values );
+    }
+
+    QJsonObject result;
+    result.insert( "counters", counters );
+    result.insert( "latency_us", latencies );
+    return result;
+}
+
+/*!
+ * \brief Метод возвращает значения таблицей для чтения человеком
+ */
+QString Metrics::toText()
+{
+    QString text;
+    QTextStream out( &text );
+
+    for( int i = 0; i < CounterCount; ++i )
+        out << qSetFieldWidth(20) << left << name(Counter(i))
+            << qSetFieldWidth(0) << counter(Counter(i)) << '\n';
+
+    out << '\n' << qSetFieldWidth(10) << left << "ms" << right
+        << "count" << "mean" << "p50" << "p90" << "p99" << "p99.9" << "max"
+        << qSetFieldWidth(0) << '\n';
+    for( int i = 0; i < LatencyCount; ++i ){
+        const Histogram::Snapshot snapshot = latency( Latency(i) );
+        out << qSetFieldWidth(10) << left << name(Latency(i)) << right
+            << qint64(snapshot.total) << fixed << qSetRealNumberPrecision(2)
+            << snapshot.mean() / 1e6;
+        for( int p = 0; p < PERCENTILE_COUNT; ++p )
+            out << snapshot.percentile(PERCENTILES[p]) / 1e6;
+        out << snapshot.max / 1e6 << qSetFieldWidth(0) << '\n';
+    }
+    out.flush();
+    return text;
+}
+
+/*!
+ * \brief Метод записывает значения в файл JSON
+ */
+bool Metrics::dump(const QString &fileName)
+{
+    QFile file( fileName );
+    if( ! file.open(QIODevice::WriteOnly | QIODevice::Truncate) )
+        return false;
+    return file.write( QJsonDocument(toJson()).toJson() ) > 0;
+}
+
+void Metrics::reset()
+{
+    for( int i = 0; i < CounterCount; ++i )
+        _counters[i].store( 0 );
+    for( int i = 0; i < LatencyCount; ++i )
+        _latencies[i].reset();
+}
@@ -0,0 +1,83 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include "metrics/histogram.h"
+
+#include <QAtomicInteger>
+#include <QElapsedTimer>
+#include <QJsonObject>
+#include <QString>
+
+/*!
+ * \brief Статический класс Metrics - постоянно включённые счётчики и гистограммы задержек
+ *
+ * Счётчики и гистограммы фиксированы перечислениями, поэтому обновление -
+ * атомарная операция над элементом массива без поиска по имени.
+ * Текущие значения выводятся текстом (окно диагностики), в JSON
+ * (файл, passman-cli metrics) и сбрасываются reset().
+ */
+class Metrics
+{
+public:
+    enum Counter {
+        BytesEncrypted = 0,
+        BytesDecrypted,
+        QueriesExecuted,
+        Saves,
+        PageCacheHits,
+        PageCacheMisses,
+        Searches,
+        CounterCount
+    };
+
+    enum Latency {
+        Unlock = 0,     ///< Ввод пароля - готовность хранилища
+        Open,           ///< Расшифровка файла во временную базу
+        Save,           ///< Шифрование базы в файл
+        Search,
+        Audit,          ///< Проверка паролей всего хранилища
+        LatencyCount
+    };
+
+    static void add(Counter counter, qint64 value = 1);
+    static void record(Latency latency, qint64 nsecs);
+
+    static qint64 counter(Counter counter);
+    static Histogram::Snapshot latency(Latency latency);
+    static QString name(Counter counter);
+    static QString name(Latency latency);
+
+    static QJsonObject toJson();
+    static QString toText();
+    static bool dump(const QString &fileName);
+    static void reset();
+
+private:
+    Metrics();
+    ~Metrics();
+
+    static QAtomicInteger<qint64> _counters[CounterCount];
+    static Histogram              _latencies[LatencyCount];
+};
+
+/*!
+ * \brief Класс ScopedLatency - запись времени до конца области видимости в гистограмму
+ */
+class ScopedLatency
+{
+private:
+    Metrics::Latency _latency;
+    QElapsedTimer    _timer;
+public:
+    explicit ScopedLatency(Metrics::Latency latency) :
+        _latency(latency)
+    {
+        _timer.start();
+    }
+    ~ScopedLatency()
+    {
+        Metrics::record( _latency, _timer.nsecsElapsed() );
+    }
+};
+
+#endif // METRICS_H
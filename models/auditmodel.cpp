@@ -0,0 +1,91 @@
+#include "models/auditmodel.h"
+
+#include <QDateTime>
+
+AuditModel::AuditModel(QObject *parent) :
+    QAbstractTableModel(parent)
+{
+}
+
+/*!
+ * \brief Метод очищает модель перед новой проверкой
+ * \param records - проверяемые записи
+ */
+void AuditModel::reset(const RecordTable &records)
+{
+    beginResetModel();
+    _records = records;
+    _findings.clear();
+    endResetModel();
+}
+
+qint64 AuditModel::recordId(int row) const
+{
+    return _findings.at( row ).id;
+}
+
+int AuditModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : _findings.size();
+}
+
+int AuditModel::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : ColumnCount;
+}
+
+QVariant AuditModel::data(const QModelIndex &index, int role) const
+{
+    if( ! index.isValid() || role != Qt::DisplayRole )
+        return QVariant();
+
+    const VaultAudit::Finding &finding = _findings.at( index.row() );
+    switch( index.column() ){
+    case ColumnResource:
+        return _records.text( finding.row, RecordTable::Resource );
+    case ColumnLogin:
+        return _records.text( finding.row, RecordTable::Login );
+    case ColumnIssues:
+        return VaultAudit::issueNames( finding.issues );
+    case ColumnScore:
+        return finding.score;
+    case ColumnReused:
+        return finding.reuseCount;
+    case ColumnPassLifeTime:
+        return QDateTime::fromMSecsSinceEpoch( _records.passLifeTime(finding.row) );
+    case ColumnCreateTime:
+        return QDateTime::fromMSecsSinceEpoch( _records.createTime(finding.row) );
+    default:
+        return QVariant();
+    }
+}
+
+QVariant AuditModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if( orientation != Qt::Horizontal || role != Qt::DisplayRole )
+        return QAbstractTableModel::headerData( section, orientation, role );
+
+    switch( section ){
+    case ColumnResource:     return tr("Title");
+    case ColumnLogin:        return tr("Login");
+    case ColumnIssues:       return tr("Issues");
+    case ColumnScore:        return tr("Strength");
+    case ColumnReused:       return tr("Records with password");
+    case ColumnPassLifeTime: return tr("Expires");
+    case ColumnCreateTime:   return tr("Created");
+    default:                 return QVariant();
+    }
+}
+
+/*!
+ * \brief Слот добавляет порцию результатов в конец
+ */
+void AuditModel::append(const QVector<VaultAudit::Finding> &findings)
+{
+    if( findings.isEmpty() )
+        return;
+
+    beginInsertRows( QModelIndex(), _findings.size(), _findings.size() + findings.size() - 1 );
+    _findings += findings;
+    endInsertRows();
+}
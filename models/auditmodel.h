@@ -0,0 +1,48 @@
+#ifndef AUDITMODEL_H
+#define AUDITMODEL_H
+
+#include "audit/vaultaudit.h"
+#include "Data/recordtable.h"
+
+#include <QAbstractTableModel>
+#include <QVector>
+
+/*!
+ * \brief Класс AuditModel - модель результатов VaultAudit
+ * Строки добавляются порциями по мере прихода VaultAudit::found(),
+ * названия и логины берутся из той же RecordTable, что проверялась.
+ */
+class AuditModel : public QAbstractTableModel
+{
+    Q_OBJECT
+public:
+    enum Column {
+        ColumnResource = 0,
+        ColumnLogin,
+        ColumnIssues,
+        ColumnScore,
+        ColumnReused,
+        ColumnPassLifeTime,
+        ColumnCreateTime,
+        ColumnCount
+    };
+
+    explicit AuditModel(QObject *parent = 0);
+
+    void reset(const RecordTable &records);
+    qint64 recordId(int row) const;
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const;
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const;
+
+public slots:
+    void append(const QVector<VaultAudit::Finding> &findings);
+
+private:
+    RecordTable                  _records;
+    QVector<VaultAudit::Finding> _findings;
+};
+
+#endif // AUDITMODEL_H
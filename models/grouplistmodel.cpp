@@ -0,0 +1,271 @@
+#include "models/grouplistmodel.h"
+#include "Data/datanotifier.h"
+#include "db/querysmanager.h"
+#include "trace/trace.h"
+
+#include <QDateTime>
+#include <QSqlDatabase>
+
+#include <algorithm>
+
+GroupListModel::GroupListModel(QObject *parent) :
+    QAbstractTableModel(parent)
+{
+    DataNotifier *notifier = DataNotifier::instance();
+    connect( notifier, SIGNAL(recordInserted(qint64,QString,qint64)), this, SLOT(recordInserted(qint64,QString,qint64)) );
+    connect( notifier, SIGNAL(recordUpdated(qint64,QString,QString,qint64,qint64)),
+             this, SLOT(recordUpdated(qint64,QString,QString,qint64,qint64)) );
+    connect( notifier, SIGNAL(recordRemoved(qint64,QString,qint64)), this, SLOT(recordRemoved(qint64,QString,qint64)) );
+
+    _expiryTimer.setSingleShot( true );
+    connect( &_expiryTimer, SIGNAL(timeout()), this, SLOT(expiryReached()) );
+}
+
+/*!
+ * \brief Метод читает каталог групп и число просроченных паролей
+ */
+void GroupListModel::load()
+{
+    TRACE_SCOPE( "model.groups" );
+    beginResetModel();
+    _groups.clear();
+    _expiryTimer.stop();
+    _nextExpiry = -1;
+    _expiredUntil = std::numeric_limits<qint64>::min();
+
+    qint64 total = 0;
+    if( QSqlDatabase::database( QSqlDatabase::defaultConnection, false ).isOpen() ){
+        const qint64 now = QDateTime::currentMSecsSinceEpoch();
+        QHash<QString, qint64> expired = QuerysManager::expiredCounts( now );
+        for( const auto &item : QuerysManager::groups() ){
+            Group group;
+            group.name    = item.first;
+            group.records = item.second;
+            group.expired = expired.value( item.first );
+            _groups.append( group );
+            total += group.records;
+        }
+        _expiredUntil = now;
+        scheduleExpiry( QuerysManager::nextExpiry(now) );
+    }
+
+    endResetModel();
+    setRecordCount( total );
+}
+
+/*!
+ * \brief Метод очищает модель
+ */
+void GroupListModel::clear()
+{
+    beginResetModel();
+    _groups.clear();
+    endResetModel();
+    _expiryTimer.stop();
+    _nextExpiry = -1;
+    _expiredUntil = std::numeric_limits<qint64>::min();
+    setRecordCount( 0 );
+}
+
+/*!
+ * \brief Метод возвращает название группы в строке
+ */
+QString GroupListModel::group(int row) const
+{
+    return ( row >= 0 && row < _groups.size() ) ? _groups.at(row).name : QString();
+}
+
+/*!
+ * \brief Метод возвращает общее количество записей во всех группах
+ */
+qint64 GroupListModel::recordCount() const
+{
+    return _recordCount;
+}
+
+int GroupListModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : _groups.size();
+}
+
+int GroupListModel::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : ColumnCount;
+}
+
+QVariant GroupListModel::data(const QModelIndex &index, int role) const
+{
+    if( ! index.isValid() || index.row() >= _groups.size() )
+        return QVariant();
+
+    const Group &group = _groups.at( index.row() );
+    if( role == Qt::DisplayRole || role == Qt::EditRole ){
+        switch( index.column() ){
+        case ColumnName:
+            return group.name;
+        case ColumnRecords:
+            return group.records;
+        case ColumnExpired:
+            return group.expired;
+        default:
+            return QVariant();
+        }
+    }
+    if( role == Qt::TextAlignmentRole && index.column() != ColumnName )
+        return int(Qt::AlignRight | Qt::AlignVCenter);
+
+    return QVariant();
+}
+
+QVariant GroupListModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if( orientation == Qt::Horizontal && role == Qt::DisplayRole && _headers.contains(section) )
+        return _headers.value( section );
+
+    return QAbstractTableModel::headerData( section, orientation, role );
+}
+
+bool GroupListModel::setHeaderData(int section, Qt::Orientation orientation, const QVariant &value, int role)
+{
+    if( orientation != Qt::Horizontal || section < 0 || section >= ColumnCount
+        || (role != Qt::DisplayRole && role != Qt::EditRole) )
+        return false;
+
+    _headers.insert( section, value );
+    emit headerDataChanged( orientation, section, section );
+    return true;
+}
+
+void GroupListModel::recordInserted(qint64, const QString &group, qint64 passLifeTime)
+{
+    addRecord( group );
+    countExpiry( group, passLifeTime, +1 );
+    setRecordCount( _recordCount + 1 );
+}
+
+void GroupListModel::recordUpdated(qint64, const QString &oldGroup, const QString &group,
+                                   qint64 oldPassLifeTime, qint64 passLifeTime)
+{
+    countExpiry( oldGroup, oldPassLifeTime, -1 );
+    if( oldGroup != group ){
+        removeRecord( oldGroup );
+        addRecord( group );
+    }
+    countExpiry( group, passLifeTime, +1 );
+}
+
+void GroupListModel::recordRemoved(qint64, const QString &group, qint64 passLifeTime)
+{
+    countExpiry( group, passLifeTime, -1 );
+    removeRecord( group );
+    setRecordCount( _recordCount - 1 );
+}
+
+/*!
+ * \brief Слот учитывает сроки, истёкшие с прошлой проверки
+ * Запрос идёт только по диапазону индекса PassLifeTime между проверками
+ */
+void GroupListModel::expiryReached()
+{
+    _nextExpiry = -1;
+    if( ! QSqlDatabase::database( QSqlDatabase::defaultConnection, false ).isOpen() )
+        return;
+
+    const qint64 now = QDateTime::currentMSecsSinceEpoch();
+    const QHash<QString, qint64> expired = QuerysManager::expiredCounts( now, _expiredUntil );
+    for( auto it = expired.constBegin(); it != expired.constEnd(); ++it )
+        addExpired( it.key(), it.value() );
+
+    _expiredUntil = now;
+    scheduleExpiry( QuerysManager::nextExpiry(now) );
+}
+
+int GroupListModel::lowerBound(const QString &name) const
+{
+    auto it = std::lower_bound( _groups.constBegin(), _groups.constEnd(), name,
+                                [](const Group &group, const QString &value){ return group.name < value; } );
+    return int( it - _groups.constBegin() );
+}
+
+void GroupListModel::addRecord(const QString &name)
+{
+    int row = lowerBound( name );
+    if( row < _groups.size() && _groups.at(row).name == name ){
+        ++_groups[row].records;
+        emit dataChanged( index(row, ColumnRecords), index(row, ColumnRecords) );
+        return;
+    }
+
+    Group group;
+    group.name    = name;
+    group.records = 1;
+    group.expired = 0;
+
+    beginInsertRows( QModelIndex(), row, row );
+    _groups.insert( row, group );
+    endInsertRows();
+}
+
+void GroupListModel::removeRecord(const QString &name)
+{
+    int row = lowerBound( name );
+    if( row >= _groups.size() || _groups.at(row).name != name )
+        return;
+
+    if( _groups.at(row).records > 1 ){
+        --_groups[row].records;
+        emit dataChanged( index(row, ColumnRecords), index(row, ColumnRecords) );
+        return;
+    }
+
+    beginRemoveRows( QModelIndex(), row, row );
+    _groups.remove( row );
+    endRemoveRows();
+}
+
+/*!
+ * \brief Метод меняет счётчик просроченных паролей группы
+ */
+void GroupListModel::addExpired(const QString &name, qint64 delta)
+{
+    int row = lowerBound( name );
+    if( row >= _groups.size() || _groups.at(row).name != name )
+        return;
+
+    _groups[row].expired = qMax( Q_INT64_C(0), _groups.at(row).expired + delta );
+    emit dataChanged( index(row, ColumnExpired), index(row, ColumnExpired) );
+}
+
+/*!
+ * \brief Метод учитывает срок пароля записи из уведомления
+ * Уже истёкший срок сразу меняет счётчик, будущий - переводит таймер
+ * \param delta - +1 для появившейся записи, -1 для исчезнувшей
+ */
+void GroupListModel::countExpiry(const QString &name, qint64 passLifeTime, qint64 delta)
+{
+    if( passLifeTime <= _expiredUntil )
+        addExpired( name, delta );
+    else if( delta > 0 )
+        scheduleExpiry( passLifeTime );
+}
+
+/*!
+ * \brief Метод заводит таймер на срок, если он ближе уже заведённого
+ * Интервал ограничен MAX_TIMER_INTERVAL, после которого срок ищется заново
+ * \param passLifeTime - срок, -1 - сроков впереди нет
+ */
+void GroupListModel::scheduleExpiry(qint64 passLifeTime)
+{
+    if( passLifeTime < 0 || (_nextExpiry >= 0 && _nextExpiry <= passLifeTime) )
+        return;
+
+    _nextExpiry = passLifeTime;
+    const qint64 interval = passLifeTime - QDateTime::currentMSecsSinceEpoch();
+    _expiryTimer.start( int(qBound(Q_INT64_C(0), interval, qint64(MAX_TIMER_INTERVAL))) );
+}
+
+void GroupListModel::setRecordCount(qint64 count)
+{
+    _recordCount = count;
+    emit recordCountChanged( count );
+}
@@ -0,0 +1,86 @@
+#ifndef GROUPLISTMODEL_H
+#define GROUPLISTMODEL_H
+
+#include <QAbstractTableModel>
+#include <QMap>
+#include <QTimer>
+#include <QVector>
+
+#include <limits>
+
+/*!
+ * \brief Класс GroupListModel - модель списка групп с количеством записей
+ *
+ * Читает каталог GroupCatalog, который ведут триггеры SQLite, поэтому
+ * загрузка не требует агрегатов по Data. Далее изменения приходят от
+ * DataNotifier и применяются к одной строке: счётчик группы меняется
+ * на месте, группа добавляется или удаляется, когда в ней появляется
+ * первая или исчезает последняя запись.
+ * Просроченные пароли считаются одним запросом при загрузке; дальше счётчик
+ * меняется по срокам PassLifeTime из уведомлений, а истечение сроков
+ * отслеживает один таймер до ближайшего срока (nextExpiry).
+ * Колонка ColumnName совместима с QComboBox (modelColumn по умолчанию 0).
+ */
+class GroupListModel : public QAbstractTableModel
+{
+    Q_OBJECT
+public:
+    enum Column {
+        ColumnName = 0,
+        ColumnRecords,
+        ColumnExpired,
+        ColumnCount
+    };
+
+    explicit GroupListModel(QObject *parent = 0);
+
+    void load();
+    void clear();
+
+    QString group(int row) const;
+    qint64  recordCount() const;
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const;
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const;
+    bool setHeaderData(int section, Qt::Orientation orientation, const QVariant &value, int role = Qt::EditRole);
+
+public slots:
+    void recordInserted(qint64 id, const QString &group, qint64 passLifeTime);
+    void recordUpdated(qint64 id, const QString &oldGroup, const QString &group,
+                       qint64 oldPassLifeTime, qint64 passLifeTime);
+    void recordRemoved(qint64 id, const QString &group, qint64 passLifeTime);
+
+private slots:
+    void expiryReached();
+
+signals:
+    void recordCountChanged(qint64 count);
+
+private:
+    struct Group {
+        QString name;
+        qint64  records;
+        qint64  expired;
+    };
+
+    QVector<Group>      _groups;    ///< Отсортированы по имени
+    qint64              _recordCount = 0;
+    QMap<int, QVariant> _headers;
+    qint64              _expiredUntil = std::numeric_limits<qint64>::min();  ///< Учтены сроки <= этого
+    qint64              _nextExpiry   = -1;     ///< Срок, до которого заведён таймер
+    QTimer              _expiryTimer;
+
+    static const int MAX_TIMER_INTERVAL = 24 * 60 * 60 * 1000;
+
+    int lowerBound(const QString &name) const;
+    void addRecord(const QString &name);
+    void removeRecord(const QString &name);
+    void addExpired(const QString &name, qint64 delta);
+    void scheduleExpiry(qint64 passLifeTime);
+    void countExpiry(const QString &name, qint64 passLifeTime, qint64 delta);
+    void setRecordCount(qint64 count);
+};
+
+#endif // GROUPLISTMODEL_H
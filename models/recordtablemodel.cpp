@@ -0,0 +1,484 @@
+#include "models/recordtablemodel.h"
+#include "Data/data.h"
+#include "Data/datanotifier.h"
+#include "metrics/metrics.h"
+#include "trace/trace.h"
+
+#include <QSqlDatabase>
+#include <QSqlQuery>
+#include <QSqlError>
+#include <QStringList>
+#include <QHash>
+#include <QDebug>
+
+RecordTableModel::RecordTableModel(QObject *parent) :
+    QAbstractTableModel(parent)
+{
+    _cache.setMaxCost( CACHE_PAGES );
+
+    DataNotifier *notifier = DataNotifier::instance();
+    connect( notifier, SIGNAL(recordInserted(qint64,QString,qint64)), this, SLOT(recordInserted(qint64,QString)) );
+    connect( notifier, SIGNAL(recordUpdated(qint64,QString,QString,qint64,qint64)), this, SLOT(recordUpdated(qint64,QString,QString)) );
+    connect( notifier, SIGNAL(recordRemoved(qint64,QString,qint64)), this, SLOT(recordRemoved(qint64,QString)) );
+}
+
+/*!
+ * \brief Метод переключает модель на записи группы
+ * Читается только количество записей, сами строки подгружаются при отображении
+ * \param group - название группы
+ */
+void RecordTableModel::setGroup(const QString &group)
+{
+    TRACE_SCOPE( "model.set_group" );
+    beginResetModel();
+    _listMode = false;
+    _group    = group;
+    _ids.clear();
+    _count    = 0;
+
+    if( QSqlDatabase::database( QSqlDatabase::defaultConnection, false ).isOpen() ){
+        QSqlQuery query;
+        query.prepare( QString("SELECT COUNT(*) FROM %1 WHERE %2 = :group"
+                               ).arg( DataTable::tableName, DataTable::Fields::PassGroup ) );
+        query.bindValue( ":group", group );
+        Metrics::add( Metrics::QueriesExecuted );
+        if( query.exec() && query.first() ){
+            _count = query.value(0).toInt();
+        }else{
+            qCritical() << "Cannot count records of group\n"
+                        << "SqlError: " << query.lastError();
+        }
+    }
+
+    reset();
+    endResetModel();
+}
+
+/*!
+ * \brief Метод переключает модель на список записей в заданном порядке
+ * \param ids - идентификаторы записей
+ */
+void RecordTableModel::setIds(const QVector<qint64> &ids)
+{
+    beginResetModel();
+    _listMode = true;
+    _group.clear();
+    _ids      = ids;
+    _count    = ids.size();
+    reset();
+    endResetModel();
+}
+
+/*!
+ * \brief Метод очищает модель
+ */
+void RecordTableModel::clear()
+{
+    setIds( QVector<qint64>() );
+    _listMode = false;
+}
+
+/*!
+ * \brief Метод возвращает группу, записи которой показывает модель
+ * \return название группы, пустая строка - в режиме списка
+ */
+QString RecordTableModel::group() const
+{
+    return _group;
+}
+
+/*!
+ * \brief Метод возвращает идентификатор записи в строке
+ * \param row - номер строки
+ * \return id записи, -1 - если строка недоступна
+ */
+qint64 RecordTableModel::recordId(int row) const
+{
+    if( _listMode )
+        return ( row >= 0 && row < _ids.size() ) ? _ids.at(row) : -1;
+
+    const Row *item = this->row( row );
+    return item ? item->id : -1;
+}
+
+/*!
+ * \brief Метод возвращает значение ячейки
+ * \param row - номер строки
+ * \param column - колонка из перечисления Column
+ */
+QVariant RecordTableModel::value(int row, int column) const
+{
+    const Row *item = this->row( row );
+    if( item == nullptr )
+        return QVariant();
+
+    switch( column ){
+    case ColumnId:
+        return item->id;
+    case ColumnResource:
+        return item->resource;
+    case ColumnUrl:
+        return item->url;
+    case ColumnLogin:
+        return item->login;
+    case ColumnPassword:
+        return item->password;
+    default:
+        return QVariant();
+    }
+}
+
+int RecordTableModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : _count;
+}
+
+int RecordTableModel::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : ColumnCount;
+}
+
+QVariant RecordTableModel::data(const QModelIndex &index, int role) const
+{
+    if( ! index.isValid() || (role != Qt::DisplayRole && role != Qt::EditRole) )
+        return QVariant();
+
+    return value( index.row(), index.column() );
+}
+
+QVariant RecordTableModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if( orientation == Qt::Horizontal && role == Qt::DisplayRole && _headers.contains(section) )
+        return _headers.value( section );
+
+    return QAbstractTableModel::headerData( section, orientation, role );
+}
+
+bool RecordTableModel::setHeaderData(int section, Qt::Orientation orientation, const QVariant &value, int role)
+{
+    if( orientation != Qt::Horizontal || section < 0 || section >= ColumnCount
+        || (role != Qt::DisplayRole && role != Qt::EditRole) )
+        return false;
+
+    _headers.insert( section, value );
+    emit headerDataChanged( orientation, section, section );
+    return true;
+}
+
+/*!
+ * \brief Слот добавляет новую запись в конец группы
+ * id выдаётся по возрастанию (AUTOINCREMENT), поэтому новая запись
+ * всегда последняя и смещать страницы не нужно
+ */
+void RecordTableModel::recordInserted(qint64 id, const QString &group)
+{
+    if( _listMode || group != _group )
+        return;
+
+    int row = _count;
+    beginInsertRows( QModelIndex(), row, row );
+    ++_count;
+    if( row % PAGE_SIZE == 0 ){
+        _pageStart.append( row == 0 ? 0 : id );
+    }else{
+        _cache.remove( row / PAGE_SIZE );
+    }
+    endInsertRows();
+}
+
+/*!
+ * \brief Слот обновляет строку изменённой записи
+ * Если запись ушла из текущей группы - строка удаляется
+ */
+void RecordTableModel::recordUpdated(qint64 id, const QString &oldGroup, const QString &group)
+{
+    int row = -1;
+    if( _listMode ){
+        row = _ids.indexOf( id );
+    }else if( oldGroup != group ){
+        if( oldGroup == _group ){
+            recordRemoved( id, oldGroup );
+        }else if( group == _group ){
+            // Место записи в группе неизвестно без выборки - перечитываем группу
+            setGroup( _group );
+        }
+        return;
+    }else if( group == _group ){
+        row = cachedRow( id );
+    }
+    if( row < 0 )
+        return;
+
+    Page *rows = _cache.object( row / PAGE_SIZE );
+    if( rows ){
+        Row item;
+        if( fetchRow( id, &item ) )
+            (*rows)[row % PAGE_SIZE] = item;
+        else
+            _cache.remove( row / PAGE_SIZE );
+    }
+    emit dataChanged( index(row, 0), index(row, ColumnCount - 1) );
+}
+
+/*!
+ * \brief Слот удаляет строку записи
+ * Страницы после удалённой строки сдвигаются и сбрасываются из кэша
+ */
+void RecordTableModel::recordRemoved(qint64 id, const QString &group)
+{
+    int row = -1;
+    if( _listMode ){
+        row = _ids.indexOf( id );
+    }else if( group == _group ){
+        row = cachedRow( id );
+        if( row < 0 ){
+            setGroup( _group );
+            return;
+        }
+    }
+    if( row < 0 )
+        return;
+
+    beginRemoveRows( QModelIndex(), row, row );
+    if( _listMode )
+        _ids.remove( row );
+    --_count;
+    dropPagesFrom( row / PAGE_SIZE );
+    endRemoveRows();
+}
+
+const RecordTableModel::Row *RecordTableModel::row(int row) const
+{
+    if( row < 0 || row >= _count )
+        return nullptr;
+
+    int page = row / PAGE_SIZE;
+    Page *rows = _cache.object( page );
+    if( rows == nullptr ){
+        Metrics::add( Metrics::PageCacheMisses );
+        rows = fetchPage( page );
+    }else{
+        Metrics::add( Metrics::PageCacheHits );
+    }
+    if( rows == nullptr )
+        return nullptr;
+
+    int offset = row % PAGE_SIZE;
+    return ( offset < rows->size() ) ? &rows->at(offset) : nullptr;
+}
+
+RecordTableModel::Page *RecordTableModel::fetchPage(int page) const
+{
+    TRACE_SCOPE( "model.fetch_page" );
+    Page *rows = new Page;
+    rows->reserve( PAGE_SIZE );
+
+    bool ok = _listMode ? fetchListPage( page, rows ) : fetchGroupPage( page, rows );
+    if( ! ok ){
+        delete rows;
+        return nullptr;
+    }
+
+    _cache.insert( page, rows );
+    return rows;
+}
+
+/*!
+ * \brief Метод читает страницу группы по ключу: id >= начала страницы
+ * Лишняя строка в выборке даёт начало следующей страницы,
+ * так что последовательная прокрутка обходится без OFFSET
+ */
+bool RecordTableModel::fetchGroupPage(int page, Page *rows) const
+{
+    qint64 start = pageStart( page );
+    if( start < 0 )
+        return false;
+
+    QSqlQuery query;
+    query.setForwardOnly( true );
+    query.prepare( QString("SELECT %1 FROM %2 WHERE %3 = :group AND %4 >= :start ORDER BY %4 LIMIT %5"
+                           ).arg( selectFields(),
+                                  DataTable::tableName,
+                                  DataTable::Fields::PassGroup,
+                                  DataTable::Fields::id,
+                                  QString::number(PAGE_SIZE + 1) ) );
+    query.bindValue( ":group", _group );
+    query.bindValue( ":start", start );
+    Metrics::add( Metrics::QueriesExecuted );
+    if( ! query.exec() ){
+        qCritical() << "Cannot fetch records page\n"
+                    << "SqlError: " << query.lastError();
+        return false;
+    }
+
+    while( query.next() ){
+        if( rows->size() == PAGE_SIZE ){
+            if( page + 1 < _pageStart.size() )
+                _pageStart[page + 1] = query.value(0).toLongLong();
+            break;
+        }
+        Row item;
+        item.id       = query.value(0).toLongLong();
+        item.resource = query.value(1).toString();
+        item.url      = query.value(2).toString();
+        item.login    = query.value(3).toString();
+        item.password = query.value(4).toString();
+        rows->append( item );
+    }
+    return true;
+}
+
+/*!
+ * \brief Метод читает страницу списка по первичному ключу, сохраняя порядок списка
+ */
+bool RecordTableModel::fetchListPage(int page, Page *rows) const
+{
+    int first = page * PAGE_SIZE;
+    int last  = qMin( first + PAGE_SIZE, _ids.size() );
+
+    QStringList idList;
+    for( int i = first; i < last; ++i ){
+        idList.append( QString::number( _ids.at(i) ) );
+    }
+
+    QSqlQuery query;
+    query.setForwardOnly( true );
+    if( ! query.exec( QString("SELECT %1 FROM %2 WHERE %3 IN (%4)"
+                              ).arg( selectFields(),
+                                     DataTable::tableName,
+                                     DataTable::Fields::id,
+                                     idList.join(",") ) ) ){
+        qCritical() << "Cannot fetch records page\n"
+                    << "SqlError: " << query.lastError();
+        return false;
+    }
+
+    QHash<qint64, Row> found;
+    while( query.next() ){
+        Row item;
+        item.id       = query.value(0).toLongLong();
+        item.resource = query.value(1).toString();
+        item.url      = query.value(2).toString();
+        item.login    = query.value(3).toString();
+        item.password = query.value(4).toString();
+        found.insert( item.id, item );
+    }
+
+    for( int i = first; i < last; ++i ){
+        Row item = found.value( _ids.at(i) );
+        item.id = _ids.at(i);
+        rows->append( item );
+    }
+    return true;
+}
+
+/*!
+ * \brief Метод возвращает первый id страницы группы
+ * Если он неизвестен, отсчитывается OFFSET от ближайшей известной страницы
+ * по индексу (PassGroup, id), не читая сами строки
+ * \return id, -1 - в случае ошибки
+ */
+qint64 RecordTableModel::pageStart(int page) const
+{
+    if( page < 0 || page >= _pageStart.size() )
+        return -1;
+    if( _pageStart.at(page) >= 0 )
+        return _pageStart.at(page);
+
+    int known = page;
+    while( known > 0 && _pageStart.at(known) < 0 ){
+        --known;
+    }
+
+    QSqlQuery query;
+    query.prepare( QString("SELECT %1 FROM %2 WHERE %3 = :group AND %1 >= :start ORDER BY %1 LIMIT 1 OFFSET :offset"
+                           ).arg( DataTable::Fields::id,
+                                  DataTable::tableName,
+                                  DataTable::Fields::PassGroup ) );
+    query.bindValue( ":group", _group );
+    query.bindValue( ":start", _pageStart.at(known) );
+    query.bindValue( ":offset", (page - known) * PAGE_SIZE );
+    Metrics::add( Metrics::QueriesExecuted );
+    if( ! query.exec() || ! query.first() ){
+        qCritical() << "Cannot locate records page\n"
+                    << "SqlError: " << query.lastError();
+        return -1;
+    }
+
+    _pageStart[page] = query.value(0).toLongLong();
+    return _pageStart.at(page);
+}
+
+bool RecordTableModel::fetchRow(qint64 id, Row *item) const
+{
+    QSqlQuery query;
+    query.prepare( QString("SELECT %1 FROM %2 WHERE %3 = :id"
+                           ).arg( selectFields(), DataTable::tableName, DataTable::Fields::id ) );
+    query.bindValue( ":id", id );
+    Metrics::add( Metrics::QueriesExecuted );
+    if( ! query.exec() || ! query.first() ){
+        qCritical() << "Cannot fetch record\n"
+                    << "SqlError: " << query.lastError();
+        return false;
+    }
+
+    item->id       = query.value(0).toLongLong();
+    item->resource = query.value(1).toString();
+    item->url      = query.value(2).toString();
+    item->login    = query.value(3).toString();
+    item->password = query.value(4).toString();
+    return true;
+}
+
+/*!
+ * \brief Метод ищет строку записи среди закэшированных страниц
+ * \return номер строки, -1 - если страница записи не в кэше
+ */
+int RecordTableModel::cachedRow(qint64 id) const
+{
+    for( int page : _cache.keys() ){
+        const Page *rows = _cache.object( page );
+        for( int i = 0; i < rows->size(); ++i ){
+            if( rows->at(i).id == id )
+                return page * PAGE_SIZE + i;
+        }
+    }
+    return -1;
+}
+
+/*!
+ * \brief Метод сбрасывает страницы начиная с page после изменения числа строк
+ * Начало страницы page остаётся верным: ключ id >= начала не зависит от сдвига
+ */
+void RecordTableModel::dropPagesFrom(int page)
+{
+    for( int cached : _cache.keys() ){
+        if( cached >= page )
+            _cache.remove( cached );
+    }
+
+    int pages = (_count + PAGE_SIZE - 1) / PAGE_SIZE;
+    _pageStart.resize( pages );
+    for( int i = page + 1; i < pages; ++i ){
+        _pageStart[i] = -1;
+    }
+}
+
+void RecordTableModel::reset()
+{
+    _cache.clear();
+    _pageStart.fill( -1, (_count + PAGE_SIZE - 1) / PAGE_SIZE );
+    if( ! _pageStart.isEmpty() )
+        _pageStart[0] = 0;
+}
+
+QString RecordTableModel::selectFields()
+{
+    QStringList fields;
+    fields.append(DataTable::Fields::id);
+    fields.append(DataTable::Fields::Resource);
+    fields.append(DataTable::Fields::Url);
+    fields.append(DataTable::Fields::Login);
+    fields.append(DataTable::Fields::Password);
+    return fields.join(", ");
+}
@@ -0,0 +1,91 @@
+#ifndef RECORDTABLEMODEL_H
+#define RECORDTABLEMODEL_H
+
+#include <QAbstractTableModel>
+#include <QCache>
+#include <QMap>
+#include <QVector>
+
+/*!
+ * \brief Класс RecordTableModel - модель главной таблицы записей с ленивой подгрузкой
+ *
+ * Работает в одном из двух режимов:
+ * - группа: записи группы PassGroup по возрастанию id, страницы читаются
+ *   по ключу (id >= начало страницы), количество строк - точный COUNT(*)
+ *   по индексу (PassGroup, id);
+ * - список: заранее известные id (результат поиска) в заданном порядке.
+ * Строки хранятся страницами по PAGE_SIZE в LRU-кэше на CACHE_PAGES страниц,
+ * поэтому объём памяти не зависит от размера хранилища.
+ * Изменения отдельных записей приходят от DataNotifier и применяются
+ * к затронутой строке без сброса модели.
+ */
+class RecordTableModel : public QAbstractTableModel
+{
+    Q_OBJECT
+public:
+    enum Column {
+        ColumnId = 0,
+        ColumnResource,
+        ColumnUrl,
+        ColumnLogin,
+        ColumnPassword,
+        ColumnCount
+    };
+
+    static const int PAGE_SIZE   = 256;
+    static const int CACHE_PAGES = 64;
+
+    explicit RecordTableModel(QObject *parent = 0);
+
+    void setGroup(const QString &group);
+    void setIds(const QVector<qint64> &ids);
+    void clear();
+
+    QString group() const;
+    qint64  recordId(int row) const;
+    QVariant value(int row, int column) const;
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const;
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const;
+    bool setHeaderData(int section, Qt::Orientation orientation, const QVariant &value, int role = Qt::EditRole);
+
+public slots:
+    void recordInserted(qint64 id, const QString &group);
+    void recordUpdated(qint64 id, const QString &oldGroup, const QString &group);
+    void recordRemoved(qint64 id, const QString &group);
+
+private:
+    struct Row {
+        qint64  id;
+        QString resource;
+        QString url;
+        QString login;
+        QString password;
+    };
+    typedef QVector<Row> Page;
+
+    bool                      _listMode = false;
+    QString                   _group;
+    QVector<qint64>           _ids;
+    int                       _count = 0;
+    QMap<int, QVariant>       _headers;
+
+    mutable QCache<int, Page> _cache;
+    mutable QVector<qint64>   _pageStart;   ///< Первый id страницы, -1 - неизвестен
+
+    const Row *row(int row) const;
+    Page *fetchPage(int page) const;
+    bool fetchGroupPage(int page, Page *rows) const;
+    bool fetchListPage(int page, Page *rows) const;
+    qint64 pageStart(int page) const;
+    bool fetchRow(qint64 id, Row *item) const;
+    int cachedRow(qint64 id) const;
+    void dropPagesFrom(int page);
+    void reset();
+
+    static QString selectFields();
+};
+
+#endif // RECORDTABLEMODEL_H
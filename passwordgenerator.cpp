@@ -1,7 +1,69 @@
 #include "passwordgenerator.h"
+#include "passwordpolicy.h"
+#include "wordlist.h"
 
 #include <cmath>
 #include <QDebug>
+#include <QSet>
+#include <QVector>
+
+namespace {
+    constexpr char UPPER_ALPHABET[]     = "QWERTYUIOPASDFGHJKLZXCVBNM";
+    constexpr char LOWER_ALPHABET[]     = "qwertyuiopasdfghjklzxcvbnm";
+    constexpr char SPECIAL_ALPHABET[]   = "!@#$%^&*()_+./='<>~|";
+    constexpr char MINUS_ALPHABET[]     = "-";
+    constexpr char NUMBERS_ALPHABET[]   = "1234567890";
+    constexpr char UNDERLINE_ALPHABET[] = "_";
+
+    /// Признак "входит в алфавит спецсимволов" ('_' - и подчёркивание, и спецсимвол)
+    constexpr quint8 SPECIAL_FLAG = 0x80;
+    constexpr quint8 TYPE_MASK    = 0x7f;
+
+    constexpr bool contains(const char *alphabet, int c)
+    {
+        return *alphabet != '\0'
+            && ( static_cast<unsigned char>(*alphabet) == c || contains(alphabet + 1, c) );
+    }
+
+    /// Тип символа в порядке проверок getSymbolType() и признак спецсимвола
+    constexpr quint8 classify(int c)
+    {
+        return quint8( ( contains(LOWER_ALPHABET, c)     ? PasswordGenerator::Lower
+                       : contains(UPPER_ALPHABET, c)     ? PasswordGenerator::Upper
+                       : contains(UNDERLINE_ALPHABET, c) ? PasswordGenerator::Underline
+                       : contains(MINUS_ALPHABET, c)     ? PasswordGenerator::Minus
+                       : contains(NUMBERS_ALPHABET, c)   ? PasswordGenerator::Numbers
+                       : contains(SPECIAL_ALPHABET, c)   ? PasswordGenerator::Special
+                       : 0 )
+                     | ( contains(SPECIAL_ALPHABET, c) ? SPECIAL_FLAG : 0 ) );
+    }
+
+#define CLASS_ROW(base) \
+    classify(base + 0),  classify(base + 1),  classify(base + 2),  classify(base + 3),  \
+    classify(base + 4),  classify(base + 5),  classify(base + 6),  classify(base + 7),  \
+    classify(base + 8),  classify(base + 9),  classify(base + 10), classify(base + 11), \
+    classify(base + 12), classify(base + 13), classify(base + 14), classify(base + 15)
+
+    /// Классы символов Latin-1, вычисляются при компиляции.
+    /// Символы за пределами таблицы не входят ни в один алфавит
+    constexpr quint8 CHAR_CLASS[256] = {
+        CLASS_ROW(0),   CLASS_ROW(16),  CLASS_ROW(32),  CLASS_ROW(48),
+        CLASS_ROW(64),  CLASS_ROW(80),  CLASS_ROW(96),  CLASS_ROW(112),
+        CLASS_ROW(128), CLASS_ROW(144), CLASS_ROW(160), CLASS_ROW(176),
+        CLASS_ROW(192), CLASS_ROW(208), CLASS_ROW(224), CLASS_ROW(240)
+    };
+
+#undef CLASS_ROW
+
+    inline quint8 charClass(QChar c)
+    {
+        const ushort code = c.unicode();
+        return code < 256 ? CHAR_CLASS[code] : 0;
+    }
+
+    /// Все сочетания CharType - 6 бит начиная с Upper
+    const int TYPE_COMBINATIONS = 64;
+}
 
 /*!
  * \brief Метод для получения алфавита символов в верхнем регистре
@@ -9,7 +71,7 @@
  */
 QString PasswordGenerator::getUpperAlphabet()
 {
-    return QString("QWERTYUIOPASDFGHJKLZXCVBNM");
+    return QString( UPPER_ALPHABET );
 }
 
 /*!
@@ -18,7 +80,7 @@ QString PasswordGenerator::getUpperAlphabet()
  */
 QString PasswordGenerator::getLowerAlphabet()
 {
-    return QString("qwertyuiopasdfghjklzxcvbnm");
+    return QString( LOWER_ALPHABET );
 }
 
 /*!
@@ -27,7 +89,7 @@ QString PasswordGenerator::getLowerAlphabet()
  */
 QString PasswordGenerator::getSpecialAlphabet()
 {
-    return QString("!@#$%^&*()_+./='<>~|");
+    return QString( SPECIAL_ALPHABET );
 }
 
 /*!
@@ -36,7 +98,7 @@ QString PasswordGenerator::getSpecialAlphabet()
  */
 QString PasswordGenerator::getMinusAlphabet()
 {
-    return "-";
+    return QString( MINUS_ALPHABET );
 }
 
 /*!
@@ -45,7 +107,7 @@ QString PasswordGenerator::getMinusAlphabet()
  */
 QString PasswordGenerator::getNumbersAlphabet()
 {
-    return QString("1234567890");
+    return QString( NUMBERS_ALPHABET );
 }
 
 /*!
@@ -54,7 +116,7 @@ QString PasswordGenerator::getNumbersAlphabet()
  */
 QString PasswordGenerator::getUnderlineAlphabet()
 {
-    return "_";
+    return QString( UNDERLINE_ALPHABET );
 }
 
 /*!
@@ -64,14 +126,25 @@ QString PasswordGenerator::getUnderlineAlphabet()
  */
 int PasswordGenerator::countUniqueSymbols(const QString &password)
 {
-    QString uniqueSymbols;
+    // Latin-1 отмечается в битовой маске, остальные символы - в множестве
+    quint64      latin1[4] = { 0, 0, 0, 0 };
+    QSet<ushort> other;
+    int          count = 0;
+
     for( QChar c : password ){
-        if( uniqueSymbols.contains( c ) == false ){
-            uniqueSymbols.append( c );
+        const ushort code = c.unicode();
+        if( code < 256 ){
+            const quint64 bit = quint64(1) << (code & 63);
+            if( ! (latin1[code >> 6] & bit) ){
+                latin1[code >> 6] |= bit;
+                ++count;
+            }
+        }else{
+            other.insert( code );
         }
     }
 
-    return uniqueSymbols.length();
+    return count + other.size();
 }
 
 /*!
@@ -83,7 +156,7 @@ int PasswordGenerator::countSpecialSymbols(const QString &password)
 {
     int count = 0;
     for(QChar c : password){
-        if( getSpecialAlphabet().contains( c ) ){
+        if( charClass( c ) & SPECIAL_FLAG ){
             count++;
         }
     }
@@ -132,6 +205,22 @@ int PasswordGenerator::countDifferentCase(const QString &password)
  * \return QString - алфавит символов в соответвии с типом
  */
 QString PasswordGenerator::getTypeAlphabet(int type)
+{
+    // Алфавиты всех сочетаний собираются один раз
+    static const QVector<QString> alphabets = [](){
+        QVector<QString> result( TYPE_COMBINATIONS );
+        for( int i = 0; i < TYPE_COMBINATIONS; ++i )
+            result[i] = buildTypeAlphabet( i * CharType::Upper );
+        return result;
+    }();
+
+    return alphabets.at( (type / CharType::Upper) & (TYPE_COMBINATIONS - 1) );
+}
+
+/*!
+ * \brief Метод для сборки алфавита по типу, см. getTypeAlphabet()
+ */
+QString PasswordGenerator::buildTypeAlphabet(int type)
 {
     QString alphabet;
 
@@ -158,20 +247,9 @@ QString PasswordGenerator::getTypeAlphabet(int type)
  */
 int PasswordGenerator::getSymbolType(const QChar &c)
 {
-    if( getLowerAlphabet().contains( c ) )
-        return CharType::Lower;
-    if( getUpperAlphabet().contains( c ) )
-        return CharType::Upper;
-    if( getUnderlineAlphabet().contains( c ) )
-        return CharType::Underline;
-    if( getMinusAlphabet().contains( c ) )
-        return CharType::Minus;
-    if( getNumbersAlphabet().contains( c ) )
-        return CharType::Numbers;
-    if( getSpecialAlphabet().contains( c ) )
-        return CharType::Special;
-
-    return -1;
+    const int type = charClass( c ) & TYPE_MASK;
+
+    return type ? type : -1;
 }
 
 /*!
@@ -226,10 +304,11 @@ double PasswordGenerator::entropy(const QString &password)
     int N = countUniqueSymbols(password);
     int L = password.length();
 
-    double entropy = log2( pow(N,L) );
-    qDebug() << entropy;
+    if( N == 0 )
+        return 0;
 
-    return entropy;
+    // L * log2(N), а не log2(N^L): степень переполняет double уже на длинных паролях
+    return L * log2( N );
 }
 
 /*!
@@ -240,23 +319,104 @@ double PasswordGenerator::entropy(const QString &password)
  */
 QString PasswordGenerator::getPassword(int type, int length)
 {
-    QString alphabet = getTypeAlphabet( type );
-    QString password;
+    return getPassword( type, length, SecureRandom::threadInstance() );
+}
 
-    for(int i = 0; i < length; ++i){
-        password += alphabet.at( qrand() % alphabet.length() );
-    }
+/*!
+ * \brief Метод для генерации пароля из заданного источника случайности
+ * \param random - генератор, например воспроизводимый SecureRandom(seed)
+ */
+QString PasswordGenerator::getPassword(int type, int length, SecureRandom &random)
+{
+    const QString alphabet = getTypeAlphabet( type );
+    if( alphabet.isEmpty() || length <= 0 )
+        return QString();
 
-    return password;
-}
+    const PasswordPolicy policy( type, length );
+    if( policy.isValid() )
+        return policy.generate( random );
 
+    return generate( alphabet, length, random );
+}
 
+/*!
+ * \brief Метод для генерации набора паролей одного типа и длины
+ * Алфавит вычисляется один раз на весь набор.
+ * \param count - количество паролей
+ * \param random - генератор, nullptr - генератор текущего потока
+ * \return QStringList - сгенерированные пароли
+ */
+QStringList PasswordGenerator::getPasswords(int type, int length, int count, SecureRandom *random)
+{
+    QStringList passwords;
+    const QString alphabet = getTypeAlphabet( type );
+    if( alphabet.isEmpty() || length <= 0 || count <= 0 )
+        return passwords;
 
+    const PasswordPolicy policy( type, length );
+    if( policy.isValid() )
+        return policy.generate( count, random );
 
+    SecureRandom &source = random ? *random : SecureRandom::threadInstance();
+    passwords.reserve( count );
+    for( int i = 0; i < count; ++i )
+        passwords << generate( alphabet, length, source );
 
+    return passwords;
+}
 
+QString PasswordGenerator::generate(const QString &alphabet, int length, SecureRandom &random)
+{
+    const quint32 size = alphabet.length();
+    const QChar  *chars = alphabet.constData();
 
+    QString password( length, Qt::Uninitialized );
+    QChar *out = password.data();
+    for( int i = 0; i < length; ++i )
+        out[i] = chars[ random.uniform(size) ];
 
+    return password;
+}
 
+/*!
+ * \brief Метод для генерации парольной фразы (diceware)
+ * \param words - список слов, см. Wordlist::language()
+ * \param count - количество слов
+ * \param separator - разделитель слов
+ * \return QString - парольная фраза, пустая строка - если список пуст
+ */
+QString PasswordGenerator::getPassphrase(const Wordlist &words, int count, const QString &separator,
+                                         Capitalization capitalization)
+{
+    return getPassphrase( words, count, separator, capitalization, SecureRandom::threadInstance() );
+}
 
+QString PasswordGenerator::getPassphrase(const Wordlist &words, int count, const QString &separator,
+                                         Capitalization capitalization, SecureRandom &random)
+{
+    if( words.count() == 0 || count <= 0 )
+        return QString();
+
+    QString passphrase;
+    for( int i = 0; i < count; ++i ){
+        QString word = words.word( int(random.uniform(words.count())) );
+        if( capitalization == Capitalized
+                || (capitalization == RandomCase && (random.nextByte() & 1)) )
+            word[0] = word.at(0).toUpper();
+
+        if( i > 0 )
+            passphrase += separator;
+        passphrase += word;
+    }
+    return passphrase;
+}
 
+/*!
+ * \brief Метод возвращает энтропию парольной фразы в битах
+ * Считается по размеру списка, а не по символам фразы.
+ */
+double PasswordGenerator::passphraseEntropy(const Wordlist &words, int count, Capitalization capitalization)
+{
+    const double bitsPerWord = words.bitsPerWord() + (capitalization == RandomCase ? 1 : 0);
+    return bitsPerWord * qMax(count, 0);
+}
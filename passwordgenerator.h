@@ -3,11 +3,23 @@
 
 //class QString;
 #include <QString>
+#include <QStringList>
 #include <random>
 
+#include "securerandom.h"
+
+class Wordlist;
+
 /*!
  * \brief Статический класс PasswordGenerator предназначен для операций с паролем
  * таких как вычисление сложности, энтропии и генерации пароля
+ *
+ * Символы выбираются через SecureRandom (RAND_bytes с буферизацией)
+ * с отбраковкой, поэтому все символы алфавита равновероятны.
+ * Каждая выбранная группа символов входит в пароль хотя бы раз
+ * (см. PasswordPolicy), если длина это позволяет.
+ * Классы символов берутся из таблицы, построенной при компиляции,
+ * поэтому оценки пароля линейны по длине.
  */
 class PasswordGenerator
 {
@@ -23,9 +35,22 @@ public:
         Numbers   = 32,  /// < Тип для символов-цифр
         Underline = 64   /// < Тип для символов подчёркивания
     };
+    enum Capitalization{
+        Lowercase = 0,   /// < Слова как в списке
+        Capitalized,     /// < Первая буква каждого слова заглавная
+        RandomCase       /// < Каждое слово с вероятностью 1/2 с заглавной
+    };
     static QString getPassword( int type, int length );
+    static QString getPassword( int type, int length, SecureRandom &random );
+    static QStringList getPasswords( int type, int length, int count, SecureRandom *random = nullptr );
+    static QString getPassphrase( const Wordlist &words, int count, const QString &separator,
+                                  Capitalization capitalization = Lowercase );
+    static QString getPassphrase( const Wordlist &words, int count, const QString &separator,
+                                  Capitalization capitalization, SecureRandom &random );
+    static double  passphraseEntropy( const Wordlist &words, int count, Capitalization capitalization );
     static double  quality(const QString &password);
     static double  entropy(const QString &password);
+    static QString getTypeAlphabet( int type );
 private:
     static QString getUpperAlphabet();
     static QString getLowerAlphabet();
@@ -39,7 +64,8 @@ private:
     static int countSameSymbols(const QString &password);
     static int countDifferentCase(const QString &password);
 
-    static QString getTypeAlphabet( int type );
+    static QString buildTypeAlphabet( int type );
+    static QString generate( const QString &alphabet, int length, SecureRandom &random );
     static int getSymbolType( const QChar &c );
     static bool isDifferentCase( const QChar &c1, const QChar &c2);
 };
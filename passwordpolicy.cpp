@@ -0,0 +1,369 @@
+#include "passwordpolicy.h"
+
+#include <QCoreApplication>
+
+namespace {
+    /// Порядок, в котором классы забирают общие символы, см. PasswordGenerator::getSymbolType()
+    const PasswordGenerator::CharType CLASS_ORDER[] = {
+        PasswordGenerator::Lower,
+        PasswordGenerator::Upper,
+        PasswordGenerator::Underline,
+        PasswordGenerator::Minus,
+        PasswordGenerator::Numbers,
+        PasswordGenerator::Special
+    };
+
+    const char SET_LETTERS[] = "lU_-ds";    ///< Буквы наборов в порядке CLASS_ORDER
+
+    int classPosition(int type)
+    {
+        for( int i = 0; i < int(sizeof(CLASS_ORDER) / sizeof(CLASS_ORDER[0])); ++i )
+            if( CLASS_ORDER[i] == type )
+                return i;
+        return -1;
+    }
+}
+
+PasswordPolicy::PasswordPolicy()
+{
+}
+
+/*!
+ * \brief Конструктор политики по флажкам групп символов
+ * Каждый выбранный класс обязателен хотя бы один раз.
+ * \param type - сочетание PasswordGenerator::CharType
+ */
+PasswordPolicy::PasswordPolicy(int type, int length)
+    : _length( length )
+{
+    for( PasswordGenerator::CharType charType : CLASS_ORDER )
+        if( type & charType )
+            setClass( charType, 1 );
+}
+
+void PasswordPolicy::setLength(int length)
+{
+    _length = length;
+}
+
+int PasswordPolicy::length() const
+{
+    return _length;
+}
+
+/*!
+ * \brief Метод задаёт требования к классу символов
+ * \param minimum - наименьшее количество символов класса
+ * \param maximum - наибольшее количество, UNLIMITED - без ограничения
+ */
+void PasswordPolicy::setClass(PasswordGenerator::CharType type, int minimum, int maximum)
+{
+    Rule rule;
+    rule.type    = type;
+    rule.minimum = qMax( minimum, 0 );
+    rule.maximum = maximum;
+
+    const int index = ruleIndex( type );
+    if( index >= 0 ){
+        _rules[index] = rule;
+    } else {
+        int position = 0;
+        while( position < _rules.size() && classPosition(_rules.at(position).type) < classPosition(type) )
+            ++position;
+        _rules.insert( position, rule );
+    }
+    resolveAlphabets();
+}
+
+void PasswordPolicy::removeClass(PasswordGenerator::CharType type)
+{
+    const int index = ruleIndex( type );
+    if( index >= 0 ){
+        _rules.remove( index );
+        resolveAlphabets();
+    }
+}
+
+/*!
+ * \brief Метод возвращает сочетание PasswordGenerator::CharType всех классов политики
+ */
+int PasswordPolicy::type() const
+{
+    int type = 0;
+    for( const Rule &rule : _rules )
+        type |= rule.type;
+    return type;
+}
+
+void PasswordPolicy::setForbidden(const QString &chars)
+{
+    _forbidden = chars;
+    resolveAlphabets();
+}
+
+QString PasswordPolicy::forbidden() const
+{
+    return _forbidden;
+}
+
+void PasswordPolicy::setNoRepeats(bool noRepeats)
+{
+    _noRepeats = noRepeats;
+}
+
+bool PasswordPolicy::noRepeats() const
+{
+    return _noRepeats;
+}
+
+/*!
+ * \brief Метод проверяет, что политике соответствует хотя бы один пароль
+ * \param error - описание противоречия в требованиях
+ */
+bool PasswordPolicy::isValid(QString *error) const
+{
+    QString message;
+    int minimum  = 0;
+    int capacity = 0;
+
+    if( _length <= 0 )
+        message = QCoreApplication::translate("PasswordPolicy", "Password length must be positive");
+    else if( _rules.isEmpty() )
+        message = QCoreApplication::translate("PasswordPolicy", "No character groups selected");
+
+    for( const Rule &rule : _rules ){
+        if( ! message.isEmpty() )
+            break;
+        const int ruleCapacity = rule.capacity( _length, _noRepeats );
+        if( rule.minimum > ruleCapacity )
+            message = QCoreApplication::translate("PasswordPolicy", "Character group \"%1\" cannot have %2 characters")
+                    .arg( QChar(SET_LETTERS[classPosition(rule.type)]) ).arg( rule.minimum );
+        minimum  += rule.minimum;
+        capacity += ruleCapacity;
+    }
+
+    if( message.isEmpty() && minimum > _length )
+        message = QCoreApplication::translate("PasswordPolicy", "Required characters (%1) exceed the length %2").arg( minimum ).arg( _length );
+    if( message.isEmpty() && capacity < _length )
+        message = QCoreApplication::translate("PasswordPolicy", "Allowed characters fill at most %1 of %2 positions").arg( capacity ).arg( _length );
+
+    if( error )
+        *error = message;
+    return message.isEmpty();
+}
+
+/*!
+ * \brief Метод проверяет пароль на соответствие политике
+ */
+bool PasswordPolicy::accepts(const QString &password) const
+{
+    if( password.length() != _length )
+        return false;
+
+    QVector<int> counts( _rules.size(), 0 );
+    for( int i = 0; i < password.length(); ++i ){
+        const QChar c = password.at( i );
+        if( _noRepeats && password.indexOf(c, i + 1) >= 0 )
+            return false;
+
+        int index = 0;
+        while( index < _rules.size() && ! _rules.at(index).alphabet.contains(c) )
+            ++index;
+        if( index == _rules.size() )
+            return false;
+        ++counts[index];
+    }
+
+    for( int i = 0; i < _rules.size(); ++i ){
+        const Rule &rule = _rules.at( i );
+        if( counts.at(i) < rule.minimum
+                || (rule.maximum != UNLIMITED && counts.at(i) > rule.maximum) )
+            return false;
+    }
+    return true;
+}
+
+QString PasswordPolicy::generate() const
+{
+    return generate( SecureRandom::threadInstance() );
+}
+
+/*!
+ * \brief Метод генерирует пароль по политике без повторных попыток
+ * \return QString - пароль, пустая строка - если политика противоречива
+ */
+QString PasswordPolicy::generate(SecureRandom &random) const
+{
+    if( ! isValid() )
+        return QString();
+
+    // Количества по классам: минимумы, затем остаток с весом по числу
+    // ещё доступных символов - как выбор из объединения алфавитов
+    const int classes = _rules.size();
+    QVector<int> counts( classes );
+    QVector<int> capacities( classes );
+    int remaining = _length;
+    for( int k = 0; k < classes; ++k ){
+        counts[k]     = _rules.at(k).minimum;
+        capacities[k] = _rules.at(k).capacity( _length, _noRepeats );
+        remaining    -= counts.at(k);
+    }
+
+    QVector<quint32> weights( classes );
+    for( ; remaining > 0; --remaining ){
+        quint32 total = 0;
+        for( int k = 0; k < classes; ++k ){
+            const int size = _rules.at(k).alphabet.size();
+            weights[k] = counts.at(k) >= capacities.at(k) ? 0
+                       : quint32( _noRepeats ? size - counts.at(k) : size );
+            total += weights.at(k);
+        }
+
+        quint32 pick = random.uniform( total );
+        int k = 0;
+        while( pick >= weights.at(k) )
+            pick -= weights.at(k++);
+        ++counts[k];
+    }
+
+    QString password( _length, Qt::Uninitialized );
+    QChar *out = password.data();
+    int position = 0;
+    for( int k = 0; k < classes; ++k ){
+        const QString &alphabet = _rules.at(k).alphabet;
+        const quint32 size = alphabet.size();
+        if( _noRepeats ){
+            // Частичное перемешивание копии алфавита - первые counts[k] символов
+            QString pool = alphabet;
+            QChar *chars = pool.data();
+            for( int i = 0; i < counts.at(k); ++i ){
+                qSwap( chars[i], chars[i + random.uniform(size - i)] );
+                out[position++] = chars[i];
+            }
+        } else {
+            const QChar *chars = alphabet.constData();
+            for( int i = 0; i < counts.at(k); ++i )
+                out[position++] = chars[ random.uniform(size) ];
+        }
+    }
+
+    for( int i = _length - 1; i > 0; --i )
+        qSwap( out[i], out[random.uniform(quint32(i) + 1)] );
+
+    return password;
+}
+
+/*!
+ * \brief Метод генерирует набор паролей по политике, например для смены всех паролей
+ * \param random - генератор, nullptr - генератор текущего потока
+ */
+QStringList PasswordPolicy::generate(int count, SecureRandom *random) const
+{
+    QStringList passwords;
+    if( count <= 0 || ! isValid() )
+        return passwords;
+
+    SecureRandom &source = random ? *random : SecureRandom::threadInstance();
+    passwords.reserve( count );
+    for( int i = 0; i < count; ++i )
+        passwords << generate( source );
+
+    return passwords;
+}
+
+/*!
+ * \brief Метод возвращает класс по букве набора символов
+ * U - заглавные, l - строчные, d - цифры, s - спецсимволы, '-' - минус, '_' - подчёркивание
+ * \return 0 - если буква не обозначает набор
+ */
+int PasswordPolicy::charSetType(QChar set)
+{
+    switch( set.toLatin1() ){
+    case 'U': return PasswordGenerator::Upper;
+    case 'l': return PasswordGenerator::Lower;
+    case 'd': return PasswordGenerator::Numbers;
+    case 's': return PasswordGenerator::Special;
+    case '-': return PasswordGenerator::Minus;
+    case '_': return PasswordGenerator::Underline;
+    default:  return 0;
+    }
+}
+
+/*!
+ * \brief Метод разбирает политику сайта из строки
+ * Правила через запятую: буква набора (см. charSetType()) и необязательный
+ * диапазон количества, например "U1-2,l,d2,s-3": "d2" и "d2-" - не меньше двух,
+ * "s-3" - не больше трёх, без диапазона - не меньше одного.
+ * \param ok - false, если строка не разобрана
+ */
+PasswordPolicy PasswordPolicy::fromString(const QString &rules, int length, bool *ok)
+{
+    PasswordPolicy policy;
+    policy.setLength( length );
+    bool parsed = ! rules.trimmed().isEmpty();
+
+    for( const QString &item : rules.split(',', QString::SkipEmptyParts) ){
+        const QString rule = item.trimmed();
+        const int type = rule.isEmpty() ? 0 : charSetType( rule.at(0) );
+        if( type == 0 ){
+            parsed = false;
+            break;
+        }
+
+        int minimum = 1;
+        int maximum = UNLIMITED;
+        const QString range = rule.mid( 1 );
+        if( ! range.isEmpty() ){
+            const int dash = range.indexOf( '-' );
+            bool minOk = true;
+            bool maxOk = true;
+            if( dash != 0 )
+                minimum = range.left( dash < 0 ? range.size() : dash ).toInt( &minOk );
+            else
+                minimum = 0;
+            if( dash >= 0 && dash + 1 < range.size() )
+                maximum = range.mid( dash + 1 ).toInt( &maxOk );
+            if( ! minOk || ! maxOk || minimum < 0 || (maximum != UNLIMITED && maximum < minimum) ){
+                parsed = false;
+                break;
+            }
+        }
+        policy.setClass( PasswordGenerator::CharType(type), minimum, maximum );
+    }
+
+    if( ok )
+        *ok = parsed;
+    return policy;
+}
+
+int PasswordPolicy::Rule::capacity(int length, bool noRepeats) const
+{
+    int result = maximum == UNLIMITED ? length : qMin( maximum, length );
+    if( noRepeats )
+        result = qMin( result, alphabet.size() );
+    return alphabet.isEmpty() ? 0 : result;
+}
+
+/*!
+ * \brief Метод пересобирает алфавиты классов
+ * Общие символы достаются первому классу, запрещённые удаляются
+ */
+void PasswordPolicy::resolveAlphabets()
+{
+    QString taken = _forbidden;
+    for( Rule &rule : _rules ){
+        rule.alphabet.clear();
+        for( const QChar &c : PasswordGenerator::getTypeAlphabet(rule.type) )
+            if( ! taken.contains(c) )
+                rule.alphabet += c;
+        taken += rule.alphabet;
+    }
+}
+
+int PasswordPolicy::ruleIndex(int type) const
+{
+    for( int i = 0; i < _rules.size(); ++i )
+        if( _rules.at(i).type == type )
+            return i;
+    return -1;
+}
@@ -0,0 +1,71 @@
+#ifndef PASSWORDPOLICY_H
+#define PASSWORDPOLICY_H
+
+#include "passwordgenerator.h"
+
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+/*!
+ * \brief Класс PasswordPolicy - требования к паролю и генерация по ним
+ *
+ * Для каждого класса символов (PasswordGenerator::CharType) задаётся
+ * наименьшее и наибольшее количество; дополнительно - запрещённые символы
+ * и запрет повторов. Пароль строится без перегенерации: сначала количества
+ * по классам (минимумы, остаток раздаётся с весом по числу доступных
+ * символов класса), затем символы каждого класса и перемешивание
+ * Фишера-Йетса через SecureRandom. Поэтому время генерации не зависит
+ * от того, насколько жёсткие требования.
+ * Символ, входящий в несколько алфавитов ('_' - и подчёркивание,
+ * и спецсимвол), относится к первому выбранному классу в порядке
+ * Lower, Upper, Underline, Minus, Numbers, Special.
+ */
+class PasswordPolicy
+{
+public:
+    static const int UNLIMITED = -1;
+
+    PasswordPolicy();
+    PasswordPolicy(int type, int length);
+
+    void setLength(int length);
+    int  length() const;
+    void setClass(PasswordGenerator::CharType type, int minimum, int maximum = UNLIMITED);
+    void removeClass(PasswordGenerator::CharType type);
+    int  type() const;
+    void setForbidden(const QString &chars);
+    QString forbidden() const;
+    void setNoRepeats(bool noRepeats);
+    bool noRepeats() const;
+
+    bool isValid(QString *error = nullptr) const;
+    bool accepts(const QString &password) const;
+
+    QString     generate() const;
+    QString     generate(SecureRandom &random) const;
+    QStringList generate(int count, SecureRandom *random = nullptr) const;
+
+    static int charSetType(QChar set);
+    static PasswordPolicy fromString(const QString &rules, int length, bool *ok = nullptr);
+
+private:
+    struct Rule {
+        int     type     = 0;
+        int     minimum  = 0;
+        int     maximum  = UNLIMITED;
+        QString alphabet;               ///< Без запрещённых и занятых другими классами символов
+
+        int capacity(int length, bool noRepeats) const;
+    };
+
+    QVector<Rule> _rules;               ///< В порядке CLASS_ORDER
+    int           _length    = 0;
+    QString       _forbidden;
+    bool          _noRepeats = false;
+
+    void resolveAlphabets();
+    int  ruleIndex(int type) const;
+};
+
+#endif // PASSWORDPOLICY_H
@@ -0,0 +1,294 @@
+#include "search/fuzzymatcher.h"
+
+#include <QPair>
+#include <QtAlgorithms>
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+    const QChar FIELD_SEPARATOR(0x1F);
+
+    /// Ярусы оценки: точное вхождение > подпоследовательность > опечатки
+    const int EXACT_TIER       = 3000;
+    const int SUBSEQUENCE_TIER = 2000;
+    const int TYPO_TIER        = 1000;
+
+    const int CANCEL_CHECK_INTERVAL = 1024;
+
+    /*!
+     * \brief Шаблон для бит-параллельного алгоритма Майерса
+     * Вычисляет минимальное расстояние редактирования шаблона
+     * до любой подстроки текста за один проход по тексту
+     */
+    class BitPattern
+    {
+        quint64 _latin1[256];
+        QVector<QPair<ushort, quint64> > _other;
+        quint64 _high;
+        int     _length;
+
+        quint64 peq(ushort c) const
+        {
+            if( c < 256 )
+                return _latin1[c];
+            for( const QPair<ushort, quint64> &item : _other ){
+                if( item.first == c )
+                    return item.second;
+            }
+            return 0;
+        }
+    public:
+        explicit BitPattern(const QString &pattern)
+        {
+            _length = qMin( pattern.length(), 64 );
+            _high   = quint64(1) << (_length - 1);
+            std::memset( _latin1, 0, sizeof(_latin1) );
+
+            const ushort *chars = pattern.utf16();
+            for( int i = 0; i < _length; ++i ){
+                quint64 bit = quint64(1) << i;
+                if( chars[i] < 256 ){
+                    _latin1[chars[i]] |= bit;
+                    continue;
+                }
+                bool found = false;
+                for( QPair<ushort, quint64> &item : _other ){
+                    if( item.first == chars[i] ){
+                        item.second |= bit;
+                        found = true;
+                    }
+                }
+                if( ! found )
+                    _other.append( qMakePair(chars[i], bit) );
+            }
+        }
+
+        int distance(const QString &text) const
+        {
+            quint64 pv = ~quint64(0);
+            quint64 mv = 0;
+            int score = _length;
+            int best  = _length;
+
+            const ushort *chars = text.utf16();
+            for( int i = 0, n = text.length(); i < n && best > 0; ++i ){
+                quint64 eq = peq( chars[i] );
+                quint64 xv = eq | mv;
+                quint64 xh = (((eq & pv) + pv) ^ pv) | eq;
+                quint64 ph = mv | ~(xh | pv);
+                quint64 mh = pv & xh;
+                if( ph & _high )
+                    ++score;
+                else if( mh & _high )
+                    --score;
+                ph <<= 1;
+                mh <<= 1;
+                pv = mh | ~(xv | ph);
+                mv = ph & xv;
+                if( score < best )
+                    best = score;
+            }
+            return best;
+        }
+    };
+
+    struct Scored {
+        int     score;
+        qint64  createTime;
+        qint64  id;
+
+        bool operator<(const Scored &other) const
+        {
+            if( score != other.score )
+                return score > other.score;
+            if( createTime != other.createTime )
+                return createTime > other.createTime;
+            return id < other.id;
+        }
+    };
+}
+
+/*!
+ * \brief Метод очищает список кандидатов
+ */
+void FuzzyMatcher::clear()
+{
+    _candidates.clear();
+    _positions.clear();
+}
+
+/*!
+ * \brief Метод добавляет или заменяет кандидата
+ * \param id - идентификатор записи
+ * \param resource - поле Resource
+ * \param url - поле Url
+ * \param login - поле Login
+ * \param createTime - время создания в мс, используется для ранжирования
+ */
+void FuzzyMatcher::update(qint64 id, const QString &resource, const QString &url,
+                          const QString &login, qint64 createTime)
+{
+    Candidate candidate;
+    candidate.id         = id;
+    candidate.createTime = createTime;
+    candidate.text       = (resource + FIELD_SEPARATOR + url + FIELD_SEPARATOR + login).toCaseFolded();
+    candidate.mask       = charMask( candidate.text );
+
+    QHash<qint64, int>::const_iterator it = _positions.constFind( id );
+    if( it != _positions.constEnd() ){
+        _candidates[it.value()] = candidate;
+    }else{
+        _positions.insert( id, _candidates.size() );
+        _candidates.append( candidate );
+    }
+}
+
+/*!
+ * \brief Метод удаляет кандидата
+ * \param id - идентификатор записи
+ */
+void FuzzyMatcher::remove(qint64 id)
+{
+    QHash<qint64, int>::iterator it = _positions.find( id );
+    if( it == _positions.end() )
+        return;
+
+    int position = it.value();
+    _positions.erase( it );
+
+    int last = _candidates.size() - 1;
+    if( position != last ){
+        _candidates[position] = _candidates.at(last);
+        _positions[ _candidates.at(position).id ] = position;
+    }
+    _candidates.removeLast();
+}
+
+/*!
+ * \brief Метод выполняет нечёткий поиск
+ * Кандидаты, в которых не хватает больше символов шаблона, чем допустимо опечаток,
+ * отсекаются по маске без просмотра текста.
+ * \param pattern - строка запроса
+ * \param limit - максимальное количество результатов
+ * \param isCancelled - проверка отмены; отменённый поиск возвращает пустой результат
+ * \return идентификаторы записей по убыванию оценки, затем по новизне
+ */
+QVector<qint64> FuzzyMatcher::match(const QString &pattern, int limit,
+                                    const std::function<bool()> &isCancelled) const
+{
+    QVector<qint64> result;
+    QString needle = pattern.toCaseFolded();
+    if( needle.isEmpty() || limit <= 0 )
+        return result;
+
+    const quint64 needleMask = charMask( needle );
+    const int     typos      = maxTypos( needle.length() );
+    const BitPattern bits( needle );
+
+    QVector<Scored> scored;
+    for( int i = 0; i < _candidates.size(); ++i ){
+        if( isCancelled && (i % CANCEL_CHECK_INTERVAL) == 0 && isCancelled() )
+            return result;
+
+        const Candidate &candidate = _candidates.at(i);
+        int missing = qPopulationCount( needleMask & ~candidate.mask );
+        if( missing > typos )
+            continue;
+
+        int score = -1;
+        int position = candidate.text.indexOf( needle );
+        if( position >= 0 ){
+            bool wordStart = ( position == 0 ) || ! candidate.text.at(position - 1).isLetterOrNumber();
+            score = EXACT_TIER + (wordStart ? 100 : 0) - qMin( position, 99 );
+        }else{
+            int subsequence = ( missing == 0 ) ? subsequenceScore( candidate.text, needle ) : -1;
+            if( subsequence >= 0 ){
+                score = SUBSEQUENCE_TIER + qMin( subsequence, 999 );
+            }else if( typos > 0 ){
+                int distance = bits.distance( candidate.text );
+                if( distance <= typos )
+                    score = TYPO_TIER - 100 * distance;
+            }
+        }
+
+        if( score >= 0 ){
+            Scored item = { score, candidate.createTime, candidate.id };
+            scored.append( item );
+        }
+    }
+
+    int count = qMin( scored.size(), limit );
+    std::partial_sort( scored.begin(), scored.begin() + count, scored.end() );
+
+    result.reserve( count );
+    for( int i = 0; i < count; ++i ){
+        result.append( scored.at(i).id );
+    }
+    return result;
+}
+
+/*!
+ * \brief Метод возвращает количество кандидатов
+ */
+int FuzzyMatcher::count() const
+{
+    return _candidates.size();
+}
+
+/*!
+ * \brief Метод строит маску символов строки (бит = код символа по модулю 64)
+ * Коллизии лишь ослабляют отсечение, но не приводят к пропуску совпадений
+ */
+quint64 FuzzyMatcher::charMask(const QString &text)
+{
+    quint64 mask = 0;
+    const ushort *chars = text.utf16();
+    for( int i = 0, n = text.length(); i < n; ++i ){
+        mask |= quint64(1) << (chars[i] & 63);
+    }
+    return mask;
+}
+
+/*!
+ * \brief Метод возвращает допустимое количество опечаток для длины запроса
+ */
+int FuzzyMatcher::maxTypos(int patternLength)
+{
+    if( patternLength < 4 )
+        return 0;
+    if( patternLength < 8 )
+        return 1;
+    return 2;
+}
+
+/*!
+ * \brief Метод оценивает вхождение шаблона в текст как подпоследовательности
+ * \return оценка, -1 - если шаблон не является подпоследовательностью текста
+ */
+int FuzzyMatcher::subsequenceScore(const QString &text, const QString &pattern)
+{
+    int score     = 0;
+    int matched   = 0;
+    int prevMatch = -1;
+    const int patternLength = pattern.length();
+
+    for( int i = 0, n = text.length(); i < n && matched < patternLength; ++i ){
+        if( text.at(i) != pattern.at(matched) )
+            continue;
+
+        score += 16;
+        if( i == 0 || ! text.at(i - 1).isLetterOrNumber() )
+            score += 8;
+        if( prevMatch >= 0 ){
+            if( prevMatch == i - 1 )
+                score += 4;
+            else
+                score -= qMin( i - prevMatch - 1, 3 );
+        }
+        prevMatch = i;
+        ++matched;
+    }
+
+    return ( matched == patternLength ) ? score : -1;
+}
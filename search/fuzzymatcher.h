@@ -0,0 +1,49 @@
+#ifndef FUZZYMATCHER_H
+#define FUZZYMATCHER_H
+
+#include <QHash>
+#include <QString>
+#include <QVector>
+
+#include <functional>
+
+/*!
+ * \brief Класс FuzzyMatcher - нечёткий поиск по Resource, Url и Login
+ *
+ * Держит в памяти заранее подготовленный список кандидатов (свёрнутый
+ * по регистру текст, маска символов и время создания) и ранжирует их по:
+ * - точному вхождению подстроки;
+ * - вхождению как подпоследовательности (оценка в духе fzf:
+ *   бонусы за начало слова и подряд идущие символы, штраф за разрывы);
+ * - ограниченному расстоянию редактирования, которое считается
+ *   бит-параллельным алгоритмом Майерса (до 64 символов шаблона за один проход).
+ * При равной оценке выше идут более новые записи.
+ */
+class FuzzyMatcher
+{
+public:
+    void clear();
+    void update(qint64 id, const QString &resource, const QString &url,
+                const QString &login, qint64 createTime);
+    void remove(qint64 id);
+    QVector<qint64> match(const QString &pattern, int limit,
+                          const std::function<bool()> &isCancelled = std::function<bool()>()) const;
+    int count() const;
+
+private:
+    struct Candidate {
+        qint64  id;
+        qint64  createTime;
+        quint64 mask;   ///< Множество символов текста (символ по модулю 64)
+        QString text;   ///< Свёрнутые Resource, Url, Login через разделитель
+    };
+
+    QVector<Candidate>  _candidates;
+    QHash<qint64, int>  _positions;
+
+    static quint64 charMask(const QString &text);
+    static int maxTypos(int patternLength);
+    static int subsequenceScore(const QString &text, const QString &pattern);
+};
+
+#endif // FUZZYMATCHER_H
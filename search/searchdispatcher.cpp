@@ -0,0 +1,95 @@
+#include "search/searchdispatcher.h"
+#include "search/searchengine.h"
+
+#include <QMetaType>
+
+SearchWorker::SearchWorker(SearchEngine *engine, const QAtomicInt *generation) :
+    QObject(0),
+    _engine(engine),
+    _generation(generation)
+{
+}
+
+/*!
+ * \brief Метод выполняет поиск, если запрос ещё актуален
+ * \param generation - номер поколения запроса
+ * \param text - строка поиска
+ */
+void SearchWorker::search(int generation, const QString &text)
+{
+    const QAtomicInt *current = _generation;
+    auto isCancelled = [current, generation](){ return current->loadAcquire() != generation; };
+
+    if( isCancelled() )
+        return;
+
+    QVector<qint64> ids = _engine->search( text, SearchEngine::DEFAULT_LIMIT, isCancelled );
+    if( ! isCancelled() )
+        emit finished( generation, ids );
+}
+
+/*!
+ * \brief Конструктор, запускает рабочий поток поиска
+ * \param engine - индекс, по которому выполняется поиск
+ * \param parent - родительский объект
+ */
+SearchDispatcher::SearchDispatcher(SearchEngine *engine, QObject *parent) :
+    QObject(parent),
+    _generation(0),
+    _worker(new SearchWorker(engine, &_generation))
+{
+    qRegisterMetaType< QVector<qint64> >("QVector<qint64>");
+
+    _debounce.setSingleShot( true );
+    _debounce.setInterval( DEBOUNCE_INTERVAL );
+    connect( &_debounce, SIGNAL(timeout()), this, SLOT(dispatch()) );
+
+    _worker->moveToThread( &_thread );
+    connect( &_thread, SIGNAL(finished()), _worker, SLOT(deleteLater()) );
+    connect( this, SIGNAL(requested(int,QString)), _worker, SLOT(search(int,QString)) );
+    connect( _worker, SIGNAL(finished(int,QVector<qint64>)), this, SLOT(workerFinished(int,QVector<qint64>)) );
+
+    _thread.start();
+}
+
+/*!
+ * \brief Деструктор, отменяет поиск и дожидается остановки потока
+ */
+SearchDispatcher::~SearchDispatcher()
+{
+    cancel();
+    _thread.quit();
+    _thread.wait();
+}
+
+/*!
+ * \brief Метод ставит поиск в очередь с задержкой
+ * Выполняющийся запрос отменяется сразу, не дожидаясь окончания задержки
+ * \param text - строка поиска
+ */
+void SearchDispatcher::search(const QString &text)
+{
+    _generation.fetchAndAddOrdered( 1 );
+    _pendingText = text;
+    _debounce.start();
+}
+
+/*!
+ * \brief Метод отменяет отложенный и выполняющийся поиск
+ */
+void SearchDispatcher::cancel()
+{
+    _debounce.stop();
+    _generation.fetchAndAddOrdered( 1 );
+}
+
+void SearchDispatcher::dispatch()
+{
+    emit requested( _generation.loadAcquire(), _pendingText );
+}
+
+void SearchDispatcher::workerFinished(int generation, const QVector<qint64> &ids)
+{
+    if( generation == _generation.loadAcquire() )
+        emit resultsReady( ids );
+}
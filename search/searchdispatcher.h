@@ -0,0 +1,65 @@
+#ifndef SEARCHDISPATCHER_H
+#define SEARCHDISPATCHER_H
+
+#include <QAtomicInt>
+#include <QObject>
+#include <QThread>
+#include <QTimer>
+#include <QVector>
+
+class SearchEngine;
+
+/*!
+ * \brief Класс SearchWorker - исполнитель поиска в рабочем потоке
+ *
+ * Каждому запросу присваивается номер поколения. Запрос, номер которого
+ * к моменту начала уже устарел, не выполняется вовсе, а выполняющийся
+ * прерывается, как только диспетчер выдаёт новое поколение.
+ */
+class SearchWorker : public QObject
+{
+    Q_OBJECT
+private:
+    SearchEngine     *_engine;
+    const QAtomicInt *_generation;
+public:
+    SearchWorker(SearchEngine *engine, const QAtomicInt *generation);
+public slots:
+    void search(int generation, const QString &text);
+signals:
+    void finished(int generation, const QVector<qint64> &ids);
+};
+
+/*!
+ * \brief Класс SearchDispatcher - отложенный отменяемый поиск по SearchEngine
+ *
+ * Ввод в строку поиска откладывается на DEBOUNCE_INTERVAL мс, затем запрос
+ * уходит в рабочий поток. Новый ввод сразу отменяет выполняющийся запрос,
+ * а результат передаётся в интерфейс только если он ещё актуален.
+ */
+class SearchDispatcher : public QObject
+{
+    Q_OBJECT
+private:
+    QThread       _thread;
+    QTimer        _debounce;
+    QAtomicInt    _generation;
+    QString       _pendingText;
+    SearchWorker *_worker;
+public:
+    static const int DEBOUNCE_INTERVAL = 150;
+
+    explicit SearchDispatcher(SearchEngine *engine, QObject *parent = 0);
+    ~SearchDispatcher();
+
+    void search(const QString &text);
+    void cancel();
+private slots:
+    void dispatch();
+    void workerFinished(int generation, const QVector<qint64> &ids);
+signals:
+    void requested(int generation, const QString &text);
+    void resultsReady(const QVector<qint64> &ids);
+};
+
+#endif // SEARCHDISPATCHER_H
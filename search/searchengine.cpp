@@ -0,0 +1,317 @@
+#include "search/searchengine.h"
+#include "Data/data.h"
+#include "Data/recordloader.h"
+#include "Data/recordtable.h"
+#include "metrics/metrics.h"
+#include "trace/trace.h"
+
+#include <QSet>
+#include <QDebug>
+
+#include <algorithm>
+
+namespace {
+    /// Разделитель полей документа, не встречается в пользовательском вводе
+    const QChar FIELD_SEPARATOR(0x1F);
+
+    /// Через сколько проверенных кандидатов опрашивать признак отмены
+    const int CANCEL_CHECK_INTERVAL = 1024;
+
+    struct Hit {
+        int     position;
+        int     length;
+        qint64  id;
+
+        bool operator<(const Hit &other) const
+        {
+            if( position != other.position )
+                return position < other.position;
+            if( length != other.length )
+                return length < other.length;
+            return id < other.id;
+        }
+    };
+}
+
+/*!
+ * \brief Метод загружает индекс из таблицы Data текущего соединения
+ * \return true - в случае успеха
+ */
+bool SearchEngine::load()
+{
+    TRACE_SCOPE( "search.index_load" );
+    QWriteLocker locker( &_lock );
+    clearUnlocked();
+
+    bool success = RecordLoader::forEach( [this](const RecordTable &chunk){
+        for( int row = 0; row < chunk.size(); ++row ){
+            qint64  id       = chunk.id( row );
+            QString resource = chunk.text( row, RecordTable::Resource );
+            QString url      = chunk.text( row, RecordTable::Url );
+            QString login    = chunk.text( row, RecordTable::Login );
+
+            insert( id, documentText( resource, url, login,
+                                      chunk.text( row, RecordTable::Mail ),
+                                      chunk.text( row, RecordTable::Description ) ) );
+            _fuzzy.update( id, resource, url, login, chunk.createTime(row) );
+        }
+        return true;
+    } );
+
+    if( ! success ){
+        qCritical() << "Cannot load search index";
+        clearUnlocked();
+        return false;
+    }
+
+    _loaded = true;
+    return true;
+}
+
+/*!
+ * \brief Метод очищает индекс
+ */
+void SearchEngine::clear()
+{
+    QWriteLocker locker( &_lock );
+    clearUnlocked();
+}
+
+void SearchEngine::clearUnlocked()
+{
+    _loaded = false;
+    _documents.clear();
+    _freeSlots.clear();
+    _slots.clear();
+    _postings.clear();
+    _fuzzy.clear();
+}
+
+/*!
+ * \brief Метод добавляет запись в индекс или заменяет уже проиндексированную
+ * \param data - сохранённая запись, должна иметь id
+ */
+void SearchEngine::update(const Data &data)
+{
+    qint64 id = data.id();
+    if( id <= 0 )
+        return;
+
+    QWriteLocker locker( &_lock );
+    removeUnlocked( id );
+    insert( id, documentText( data.resource(), data.url(), data.login(),
+                              data.mail(), data.description() ) );
+    _fuzzy.update( id, data.resource(), data.url(), data.login(),
+                   data.createTime() );
+}
+
+/*!
+ * \brief Метод удаляет запись из индекса
+ * \param id - идентификатор записи
+ */
+void SearchEngine::remove(qint64 id)
+{
+    QWriteLocker locker( &_lock );
+    removeUnlocked( id );
+}
+
+void SearchEngine::removeUnlocked(qint64 id)
+{
+    _fuzzy.remove( id );
+
+    QHash<qint64, quint32>::iterator slotIt = _slots.find( id );
+    if( slotIt == _slots.end() )
+        return;
+
+    quint32 slot = slotIt.value();
+    _slots.erase( slotIt );
+
+    for( Trigram trigram : trigrams( _documents.at(slot).text ) ){
+        QHash<Trigram, QVector<quint32> >::iterator it = _postings.find( trigram );
+        if( it == _postings.end() )
+            continue;
+
+        QVector<quint32> &posting = it.value();
+        QVector<quint32>::iterator pos = std::lower_bound( posting.begin(), posting.end(), slot );
+        if( pos != posting.end() && *pos == slot )
+            posting.erase( pos );
+        if( posting.isEmpty() )
+            _postings.erase( it );
+    }
+
+    _documents[slot] = Document();
+    _freeSlots.append( slot );
+}
+
+/*!
+ * \brief Метод ищет подстроку во всех индексированных полях без учёта регистра
+ * Для запросов от трёх символов кандидаты находятся пересечением списков
+ * триграмм (от самого короткого), затем проверяются на вхождение подстроки.
+ * Оставшиеся места до limit заполняются результатами FuzzyMatcher.
+ * \param text - искомая строка
+ * \param limit - максимальное количество результатов
+ * \param isCancelled - проверка отмены; отменённый поиск возвращает пустой результат
+ * \return идентификаторы записей: сначала точные совпадения
+ * по позиции вхождения, затем нечёткие по оценке и новизне
+ */
+QVector<qint64> SearchEngine::search(const QString &text, int limit,
+                                     const CancelCheck &isCancelled) const
+{
+    TRACE_SCOPE( "search.query" );
+    ScopedLatency latency( Metrics::Search );
+    Metrics::add( Metrics::Searches );
+    QVector<qint64> result;
+    QString needle = text.toCaseFolded();
+    if( needle.isEmpty() )
+        return result;
+
+    QReadLocker locker( &_lock );
+
+    QVector<quint32> candidates;
+    if( needle.length() < 3 ){
+        candidates.reserve( _slots.count() );
+        for( QHash<qint64, quint32>::const_iterator it = _slots.constBegin(); it != _slots.constEnd(); ++it ){
+            candidates.append( it.value() );
+        }
+    }else{
+        QVector<const QVector<quint32> *> lists;
+        for( Trigram trigram : trigrams(needle) ){
+            QHash<Trigram, QVector<quint32> >::const_iterator it = _postings.constFind( trigram );
+            if( it == _postings.constEnd() ){
+                lists.clear();
+                break;
+            }
+            lists.append( &it.value() );
+        }
+        std::sort( lists.begin(), lists.end(),
+                   [](const QVector<quint32> *a, const QVector<quint32> *b){ return a->size() < b->size(); } );
+
+        if( ! lists.isEmpty() )
+            candidates = *lists.first();
+        QVector<quint32> intersection;
+        for( int i = 1; i < lists.size() && ! candidates.isEmpty(); ++i ){
+            intersection.resize( qMin(candidates.size(), lists.at(i)->size()) );
+            QVector<quint32>::iterator end = std::set_intersection( candidates.constBegin(), candidates.constEnd(),
+                                                                    lists.at(i)->constBegin(), lists.at(i)->constEnd(),
+                                                                    intersection.begin() );
+            intersection.resize( end - intersection.begin() );
+            candidates.swap( intersection );
+        }
+    }
+
+    QVector<Hit> hits;
+    for( int i = 0; i < candidates.size(); ++i ){
+        if( isCancelled && (i % CANCEL_CHECK_INTERVAL) == 0 && isCancelled() )
+            return QVector<qint64>();
+
+        const Document &document = _documents.at( candidates.at(i) );
+        int position = document.text.indexOf( needle );
+        if( position >= 0 ){
+            Hit hit = { position, document.text.length(), document.id };
+            hits.append( hit );
+        }
+    }
+
+    std::sort( hits.begin(), hits.end() );
+    int count = qMin( hits.size(), limit );
+    result.reserve( count );
+    QSet<qint64> found;
+    for( int i = 0; i < count; ++i ){
+        result.append( hits.at(i).id );
+        found.insert( hits.at(i).id );
+    }
+
+    if( result.size() < limit ){
+        for( qint64 id : _fuzzy.match( text, limit, isCancelled ) ){
+            if( result.size() >= limit )
+                break;
+            if( ! found.contains(id) )
+                result.append( id );
+        }
+    }
+    return result;
+}
+
+/*!
+ * \brief Метод позволяет узнать загружен ли индекс
+ * \return true - если индекс загружен из открытого хранилища
+ */
+bool SearchEngine::isLoaded() const
+{
+    QReadLocker locker( &_lock );
+    return _loaded;
+}
+
+/*!
+ * \brief Метод возвращает количество проиндексированных записей
+ */
+int SearchEngine::count() const
+{
+    QReadLocker locker( &_lock );
+    return _slots.count();
+}
+
+void SearchEngine::insert(qint64 id, const QString &text)
+{
+    quint32 slot;
+    if( _freeSlots.isEmpty() ){
+        slot = _documents.size();
+        _documents.append( Document() );
+    }else{
+        slot = _freeSlots.takeLast();
+    }
+
+    _documents[slot].id   = id;
+    _documents[slot].text = text;
+    _slots.insert( id, slot );
+
+    for( Trigram trigram : trigrams(text) ){
+        QVector<quint32> &posting = _postings[trigram];
+        if( posting.isEmpty() || posting.last() < slot )
+            posting.append( slot );
+        else
+            posting.insert( std::lower_bound( posting.begin(), posting.end(), slot ), slot );
+    }
+}
+
+QString SearchEngine::documentText(const QString &resource, const QString &url,
+                                   const QString &login, const QString &mail,
+                                   const QString &description)
+{
+    QString text;
+    text.reserve( resource.length() + url.length() + login.length()
+                  + mail.length() + description.length() + 4 );
+    text += resource;
+    text += FIELD_SEPARATOR;
+    text += url;
+    text += FIELD_SEPARATOR;
+    text += login;
+    text += FIELD_SEPARATOR;
+    text += mail;
+    text += FIELD_SEPARATOR;
+    text += description;
+    return text.toCaseFolded();
+}
+
+/*!
+ * \brief Метод выделяет уникальные триграммы строки
+ * Триграмма - три UTF-16 символа, упакованные в 64-битное число
+ * \param text - свёрнутая по регистру строка
+ * \return отсортированный список уникальных триграмм
+ */
+QVector<SearchEngine::Trigram> SearchEngine::trigrams(const QString &text)
+{
+    QVector<Trigram> result;
+    const ushort *chars = text.utf16();
+    int length = text.length();
+    if( length < 3 )
+        return result;
+
+    result.reserve( length - 2 );
+    for( int i = 0; i + 2 < length; ++i ){
+        result.append( (Trigram(chars[i]) << 32) | (Trigram(chars[i + 1]) << 16) | Trigram(chars[i + 2]) );
+    }
+    std::sort( result.begin(), result.end() );
+    result.erase( std::unique( result.begin(), result.end() ), result.end() );
+    return result;
+}
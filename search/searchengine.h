@@ -0,0 +1,71 @@
+#ifndef SEARCHENGINE_H
+#define SEARCHENGINE_H
+
+#include <QHash>
+#include <QReadWriteLock>
+#include <QString>
+#include <QVector>
+
+#include <functional>
+
+#include "search/fuzzymatcher.h"
+
+class Data;
+
+/*!
+ * \brief Класс SearchEngine - поисковый индекс записей в памяти процесса
+ *
+ * Хранит свёрнутые по регистру поля Resource, Url, Login, Mail и Description
+ * и инвертированный индекс триграмм (триграмма -> отсортированный список слотов).
+ * Загружается при открытии хранилища и обновляется инкрементально
+ * после Data::save() и удаления записи, поэтому поиск не обращается к SQLite.
+ * Если точных совпадений мало, результат дополняется нечётким поиском
+ * FuzzyMatcher по Resource, Url и Login.
+ *
+ * Методы потокобезопасны: поиск может выполняться в рабочем потоке
+ * одновременно с обновлением индекса из потока интерфейса.
+ */
+class SearchEngine
+{
+public:
+    static const int DEFAULT_LIMIT = 1000;
+
+    /// Проверка отмены, вызывается периодически во время поиска
+    typedef std::function<bool()> CancelCheck;
+
+    bool load();
+    void clear();
+    void update(const Data &data);
+    void remove(qint64 id);
+    QVector<qint64> search(const QString &text, int limit = DEFAULT_LIMIT,
+                           const CancelCheck &isCancelled = CancelCheck()) const;
+
+    bool isLoaded() const;
+    int  count() const;
+
+private:
+    typedef quint64 Trigram;
+
+    struct Document {
+        qint64  id = -1;  ///< -1 - слот свободен
+        QString text;     ///< Свёрнутые поля, разделённые FIELD_SEPARATOR
+    };
+
+    mutable QReadWriteLock             _lock;
+    bool                               _loaded = false;
+    QVector<Document>                  _documents;
+    QVector<quint32>                   _freeSlots;
+    QHash<qint64, quint32>             _slots;
+    QHash<Trigram, QVector<quint32> >  _postings;
+    FuzzyMatcher                       _fuzzy;
+
+    void clearUnlocked();
+    void removeUnlocked(qint64 id);
+    void insert(qint64 id, const QString &text);
+    static QString documentText(const QString &resource, const QString &url,
+                                const QString &login, const QString &mail,
+                                const QString &description);
+    static QVector<Trigram> trigrams(const QString &text);
+};
+
+#endif // SEARCHENGINE_H
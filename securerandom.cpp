@@ -0,0 +1,124 @@
+#include "securerandom.h"
+
+#include <openssl/crypto.h>
+#include <openssl/rand.h>
+
+#include <QCryptographicHash>
+#include <QDebug>
+
+#include <string.h>
+
+SecureRandom::SecureRandom()
+{
+}
+
+/*!
+ * \brief Конструктор воспроизводимого генератора
+ * \param seed - зерно; одинаковое зерно даёт одинаковую последовательность
+ */
+SecureRandom::SecureRandom(const QByteArray &seed) :
+    _seeded(true)
+{
+    const QByteArray key = QCryptographicHash::hash( seed, QCryptographicHash::Sha256 );
+    AES_set_encrypt_key( reinterpret_cast<const unsigned char*>(key.constData()), 256, &_key );
+    memset( _counter, 0, sizeof(_counter) );
+    memset( _ecount, 0, sizeof(_ecount) );
+}
+
+SecureRandom::~SecureRandom()
+{
+    OPENSSL_cleanse( _buffer, sizeof(_buffer) );
+    OPENSSL_cleanse( &_key, sizeof(_key) );
+}
+
+void SecureRandom::refill()
+{
+    if( _seeded ){
+        memset( _buffer, 0, sizeof(_buffer) );
+        AES_ctr128_encrypt( _buffer, _buffer, sizeof(_buffer), &_key, _counter, _ecount, &_num );
+    }else if( RAND_bytes(_buffer, sizeof(_buffer)) != 1 ){
+        qCritical() << "RAND_bytes failed, random numbers are not secure";
+        _valid = false;
+    }
+    _position = 0;
+}
+
+/*!
+ * \brief Метод заполняет буфер случайными байтами
+ */
+void SecureRandom::fill(void *data, int size)
+{
+    unsigned char *out = static_cast<unsigned char*>( data );
+    while( size > 0 ){
+        if( _position == BUFFER_SIZE )
+            refill();
+        const int chunk = qMin( size, BUFFER_SIZE - _position );
+        memcpy( out, _buffer + _position, chunk );
+        OPENSSL_cleanse( _buffer + _position, chunk );
+        _position += chunk;
+        out       += chunk;
+        size      -= chunk;
+    }
+}
+
+quint8 SecureRandom::nextByte()
+{
+    if( _position == BUFFER_SIZE )
+        refill();
+    const quint8 value = _buffer[_position];
+    _buffer[_position++] = 0;
+    return value;
+}
+
+quint32 SecureRandom::next32()
+{
+    quint32 value;
+    fill( &value, sizeof(value) );
+    return value;
+}
+
+/*!
+ * \brief Метод возвращает равномерно распределённое число из [0, bound)
+ * Значения из неполного последнего интервала отбрасываются, поэтому
+ * остаток от деления не смещает распределение. Для bound <= 256 тратится
+ * по байту на попытку.
+ */
+quint32 SecureRandom::uniform(quint32 bound)
+{
+    if( bound <= 1 )
+        return 0;
+
+    if( bound <= 256 ){
+        const quint32 limit = 256 - 256 % bound;
+        quint32 value;
+        do {
+            value = nextByte();
+        } while( value >= limit );
+        return value % bound;
+    }
+
+    const quint64 range = quint64(1) << 32;
+    const quint64 limit = range - range % bound;
+    quint64 value;
+    do {
+        value = next32();
+    } while( value >= limit );
+    return quint32( value % bound );
+}
+
+/*!
+ * \brief Метод возвращает false, если системный генератор отказал
+ */
+bool SecureRandom::isValid() const
+{
+    return _valid;
+}
+
+/*!
+ * \brief Метод возвращает генератор текущего потока
+ */
+SecureRandom &SecureRandom::threadInstance()
+{
+    static thread_local SecureRandom random;
+    return random;
+}
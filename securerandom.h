@@ -0,0 +1,49 @@
+#ifndef SECURERANDOM_H
+#define SECURERANDOM_H
+
+#include <QByteArray>
+
+#include <openssl/aes.h>
+
+/*!
+ * \brief Класс SecureRandom - буферизованный криптостойкий генератор случайных чисел
+ *
+ * По умолчанию байты берутся из OpenSSL RAND_bytes блоками по BUFFER_SIZE,
+ * так что вызов на каждое значение не нужен. Конструктор с зерном даёт
+ * воспроизводимый поток AES-256-CTR с ключом SHA-256(зерно) - для тестовых
+ * данных и замеров, не для настоящих паролей.
+ * uniform() использует отбраковку, поэтому все значения равновероятны.
+ * Объект не потокобезопасен: в каждом потоке свой (см. threadInstance()).
+ */
+class SecureRandom
+{
+private:
+    static const int BUFFER_SIZE = 4096;
+
+    unsigned char _buffer[BUFFER_SIZE];
+    int           _position = BUFFER_SIZE;
+    bool          _seeded   = false;
+    bool          _valid    = true;
+
+    AES_KEY       _key;
+    unsigned char _counter[AES_BLOCK_SIZE];
+    unsigned char _ecount[AES_BLOCK_SIZE];
+    unsigned int  _num = 0;
+
+    void refill();
+public:
+    SecureRandom();
+    explicit SecureRandom(const QByteArray &seed);
+    ~SecureRandom();
+
+    void fill(void *data, int size);
+    quint8  nextByte();
+    quint32 next32();
+    quint32 uniform(quint32 bound);
+
+    bool isValid() const;
+
+    static SecureRandom &threadInstance();
+};
+
+#endif // SECURERANDOM_H
@@ -0,0 +1,749 @@
+#include "strength/passwordstrength.h"
+#include "trace/trace.h"
+
+#include <QCoreApplication>
+#include <QDate>
+#include <QHash>
+#include <QtConcurrent/QtConcurrentMap>
+
+#include <cmath>
+#include <limits>
+#include <string.h>
+
+namespace {
+    const double LOG10_2 = 0.30102999566398120;
+
+    /// Слагаемое 10000^(l - 1) в оценке разбиения из l шаблонов (zxcvbn)
+    const double LOG10_SEQUENCE_PENALTY = 4;
+
+    const int    MIN_YEAR_SPACE   = 20;
+    const int    DATE_MIN_YEAR    = 1000;
+    const int    DATE_MAX_YEAR    = 2050;
+    const int    MAX_SEQUENCE_DELTA = 5;
+    const double MIN_GUESSES_SINGLE_CHAR = 10;
+    const double MIN_GUESSES_MULTI_CHAR  = 50;
+
+    const char DATE_SEPARATORS[] = " /\\_.-";
+
+    /// Замены l33t; у '1', '|' и '7' по два прочтения, поэтому таблиц две
+    const char *const L33T_TABLES[][2] = {
+        { "4@8({[<3!9#1|0$5+7%2", "aabcccceighiiossttxz" },
+        { "4@8({[<3!9#1|0$5+7%2", "aabcccceighllosstlxz" }
+    };
+
+    double log10Add(double a, double b)
+    {
+        if( a < b )
+            qSwap( a, b );
+        if( b == -std::numeric_limits<double>::infinity() )
+            return a;
+        return a + std::log10( 1 + std::pow(10.0, b - a) );
+    }
+
+    double log10Factorial(int n)
+    {
+        return std::lgamma( n + 1.0 ) / std::log( 10.0 );
+    }
+
+    double binomial(int n, int k)
+    {
+        if( k < 0 || k > n )
+            return 0;
+        double result = 1;
+        for( int i = 1; i <= k; ++i )
+            result = result * (n - k + i) / i;
+        return result;
+    }
+
+    /// Сумма C(a + b, i) по i = 1..min(a, b): число вариантов расстановки
+    double variations(int a, int b)
+    {
+        double result = 0;
+        for( int i = 1; i <= qMin(a, b); ++i )
+            result += binomial( a + b, i );
+        return result;
+    }
+
+    /*!
+     * \brief Граф соседства клавиш одной раскладки
+     * Ряды сдвинуты на полклавиши: x растёт на 2 от клавиши к клавише,
+     * соседи - x +- 2 в том же ряду и x +- 1 в соседних рядах.
+     */
+    struct KeyboardGraph {
+        struct Key {
+            int  row;
+            int  x;
+            bool shifted;
+        };
+
+        QHash<ushort, Key> keys;
+        double             startingPositions = 0;
+        double             averageDegree = 0;
+
+        KeyboardGraph() {}
+        KeyboardGraph(const char *const rows[4][2])
+        {
+            const int ROW_OFFSETS[4] = { 0, 3, 4, 5 };
+            int unshifted = 0;
+            for( int row = 0; row < 4; ++row ){
+                const QString plain   = QString::fromUtf8( rows[row][0] );
+                const QString shifted = QString::fromUtf8( rows[row][1] );
+                for( int i = 0; i < plain.length(); ++i ){
+                    const int x = ROW_OFFSETS[row] + 2 * i;
+                    keys.insert( plain.at(i).unicode(), Key{row, x, false} );
+                    if( i < shifted.length() )
+                        keys.insert( shifted.at(i).unicode(), Key{row, x, true} );
+                    ++unshifted;
+                }
+            }
+
+            int degree = 0;
+            for( const Key &a : keys ){
+                if( a.shifted )
+                    continue;
+                for( const Key &b : keys ){
+                    if( ! b.shifted && direction(a, b) >= 0 )
+                        ++degree;
+                }
+            }
+            startingPositions = keys.size();
+            averageDegree     = double( degree ) / unshifted;
+        }
+
+        /// Направление перехода a -> b, -1 - клавиши не соседние
+        static int direction(const Key &a, const Key &b)
+        {
+            const int dx   = b.x - a.x;
+            const int drow = b.row - a.row;
+            if( (drow == 0 && qAbs(dx) == 2) || (qAbs(drow) == 1 && qAbs(dx) == 1) )
+                return (drow + 1) * 5 + (dx + 2);
+            return -1;
+        }
+    };
+
+    const char *const QWERTY[4][2] = {
+        { "`1234567890-=",  "~!@#$%^&*()_+" },
+        { "qwertyuiop[]\\", "QWERTYUIOP{}|" },
+        { "asdfghjkl;'",    "ASDFGHJKL:\"" },
+        { "zxcvbnm,./",     "ZXCVBNM<>?" }
+    };
+
+    const char *const JCUKEN[4][2] = {
+        { "ё1234567890-=",  "Ё!\"№;%:?*()_+" },
+        { "йцукенгшщзхъ\\", "ЙЦУКЕНГШЩЗХЪ/" },
+        { "фывапролджэ",    "ФЫВАПРОЛДЖЭ" },
+        { "ячсмитьбю.",     "ЯЧСМИТЬБЮ," }
+    };
+
+    const QVector<KeyboardGraph> &keyboardGraphs()
+    {
+        static const QVector<KeyboardGraph> graphs = QVector<KeyboardGraph>()
+                << KeyboardGraph( QWERTY ) << KeyboardGraph( JCUKEN );
+        return graphs;
+    }
+
+    /// Год по двум или четырём цифрам, -1 - не год
+    int toYear(int value, int digits)
+    {
+        if( digits == 4 )
+            return value >= DATE_MIN_YEAR && value <= DATE_MAX_YEAR ? value : -1;
+        if( digits == 2 )
+            return value > 50 ? 1900 + value : 2000 + value;
+        return -1;
+    }
+
+    /*!
+     * \brief Функция подбирает год из трёх чисел даты
+     * Год - крайнее число из 2 или 4 цифр, остальные - месяц и день
+     * в любом порядке. Из подходящих вариантов берётся ближайший к referenceYear.
+     * \return год или -1, если это не дата
+     */
+    int dateYear(const int values[3], const int digits[3], int referenceYear)
+    {
+        int best = -1;
+        for( int yearIndex = 0; yearIndex < 3; yearIndex += 2 ){
+            const int year = toYear( values[yearIndex], digits[yearIndex] );
+            if( year < 0 || digits[1] > 2 || digits[2 - yearIndex] > 2 )
+                continue;
+            const int a = values[1];
+            const int b = values[2 - yearIndex];
+            const bool valid = ( a >= 1 && a <= 12 && b >= 1 && b <= 31 )
+                            || ( b >= 1 && b <= 12 && a >= 1 && a <= 31 );
+            if( valid && (best < 0 || qAbs(year - referenceYear) < qAbs(best - referenceYear)) )
+                best = year;
+        }
+        return best;
+    }
+
+    double dateGuessesLog10(int year, bool separator, int referenceYear)
+    {
+        const double yearSpace = qMax( qAbs(year - referenceYear), MIN_YEAR_SPACE );
+        return std::log10( yearSpace * 365 * (separator ? 4 : 1) );
+    }
+
+    PasswordStrength::Estimate estimateOne(const QString &password)
+    {
+        return PasswordStrength::estimate( password );
+    }
+}
+
+double PasswordStrength::Estimate::bits() const
+{
+    return guessesLog10 / LOG10_2;
+}
+
+/*!
+ * \brief Метод оценивает стойкость пароля
+ * \param password - пароль
+ * \return число попыток подбора (log10), оценка 0..4 и найденные шаблоны
+ */
+PasswordStrength::Estimate PasswordStrength::estimate(const QString &password)
+{
+    const QString head = password.left( MAX_LENGTH );
+
+    QVector<Match> matches;
+    dictionaryMatches( head, &matches );
+    l33tMatches( head, &matches );
+    spatialMatches( head, &matches );
+    repeatMatches( head, &matches );
+    sequenceMatches( head, &matches );
+    dateMatches( head, &matches );
+
+    Estimate result = mostGuessable( head, matches );
+    result.guessesLog10 += password.length() - head.length();
+
+    if( result.guessesLog10 < 3 )
+        result.score = 0;
+    else if( result.guessesLog10 < 6 )
+        result.score = 1;
+    else if( result.guessesLog10 < 8 )
+        result.score = 2;
+    else if( result.guessesLog10 < 10 )
+        result.score = 3;
+    else
+        result.score = 4;
+
+    return result;
+}
+
+/*!
+ * \brief Метод оценивает набор паролей параллельно
+ * \return оценки в порядке паролей
+ */
+QVector<PasswordStrength::Estimate> PasswordStrength::estimate(const QStringList &passwords)
+{
+    TRACE_SCOPE( "strength.estimate_batch" );
+
+    return QtConcurrent::blockingMapped< QVector<Estimate> >( passwords, estimateOne );
+}
+
+/*!
+ * \brief Метод возвращает подсказку по самому длинному слабому шаблону
+ * \return пустая строка, если пароль стойкий
+ */
+QString PasswordStrength::feedback(const Estimate &estimate)
+{
+    if( estimate.score >= 3 || estimate.sequence.isEmpty() )
+        return QString();
+
+    const Match *longest = &estimate.sequence.first();
+    for( const Match &match : estimate.sequence ){
+        if( match.length() > longest->length() )
+            longest = &match;
+    }
+
+    switch( longest->pattern ){
+    case Dictionary:
+        if( longest->dictionary == StrengthDictionary::Passwords )
+            return longest->rank <= 100 && ! longest->l33t && ! longest->reversed
+                    ? QCoreApplication::translate( "PasswordStrength", "This is a very common password" )
+                    : QCoreApplication::translate( "PasswordStrength", "This is similar to a common password" );
+        if( longest->dictionary == StrengthDictionary::Names )
+            return QCoreApplication::translate( "PasswordStrength", "Names and surnames are easy to guess" );
+        return QCoreApplication::translate( "PasswordStrength", "A word by itself is easy to guess" );
+    case Spatial:
+        return QCoreApplication::translate( "PasswordStrength", "Keyboard patterns are easy to guess" );
+    case Repeat:
+        return QCoreApplication::translate( "PasswordStrength", "Repeats like \"abcabc\" are easy to guess" );
+    case Sequence:
+        return QCoreApplication::translate( "PasswordStrength", "Sequences like \"abc\" or \"6543\" are easy to guess" );
+    case Date:
+        return QCoreApplication::translate( "PasswordStrength", "Dates and years are easy to guess" );
+    case Bruteforce:
+        break;
+    }
+    return QCoreApplication::translate( "PasswordStrength", "Add another word or two" );
+}
+
+/*!
+ * \brief Метод ищет слова словарей, в том числе записанные задом наперёд
+ */
+void PasswordStrength::dictionaryMatches(const QString &password, QVector<Match> *matches)
+{
+    const int n = password.length();
+    const QString lower = password.toLower();
+    QString reversed( n, Qt::Uninitialized );
+    for( int i = 0; i < n; ++i )
+        reversed[i] = lower.at( n - 1 - i );
+
+    char word[StrengthDictionary::MAX_WORD_LENGTH];
+    char letter[StrengthDictionary::MAX_LATIN_LENGTH];
+    for( int pass = 0; pass < 2; ++pass ){
+        const QString &text = pass == 0 ? lower : reversed;
+        for( int i = 0; i < n; ++i ){
+            int length = 0;
+            for( int j = i; j < n; ++j ){
+                // Русские буквы ищутся в транслите, как их записал strengthdict
+                const int letterLength = StrengthDictionary::latin( text.at(j).unicode(), letter );
+                if( letterLength < 0 || length + letterLength > StrengthDictionary::MAX_WORD_LENGTH )
+                    break;
+                memcpy( word + length, letter, letterLength );
+                length += letterLength;
+
+                StrengthDictionary::Dictionary dictionary;
+                const int rank = StrengthDictionary::find( word, length, &dictionary );
+                if( rank == 0 )
+                    continue;
+
+                Match match;
+                match.pattern    = Dictionary;
+                match.begin      = pass == 0 ? i : n - 1 - j;
+                match.end        = pass == 0 ? j : n - 1 - i;
+                match.rank       = rank;
+                match.dictionary = dictionary;
+                match.reversed   = pass == 1;
+                match.guessesLog10 = std::log10( rank * uppercaseVariations(password.mid(match.begin, j - i + 1))
+                                                 * (match.reversed ? 2 : 1) );
+                matches->append( match );
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Метод ищет слова словарей с заменами вида "p@ssw0rd"
+ */
+void PasswordStrength::l33tMatches(const QString &password, QVector<Match> *matches)
+{
+    const int n = password.length();
+    const QString lower = password.toLower();
+
+    for( const auto &table : L33T_TABLES ){
+        const QString from = QString::fromLatin1( table[0] );
+        QString subbed = lower;
+        bool any = false;
+        for( int i = 0; i < n; ++i ){
+            const int index = from.indexOf( lower.at(i) );
+            if( index >= 0 ){
+                subbed[i] = QChar( table[1][index] );
+                any = true;
+            }
+        }
+        if( ! any )
+            continue;
+
+        char word[StrengthDictionary::MAX_WORD_LENGTH];
+        char letter[StrengthDictionary::MAX_LATIN_LENGTH];
+        for( int i = 0; i < n; ++i ){
+            int length = 0;
+            bool substituted = false;
+            for( int j = i; j < n; ++j ){
+                const int letterLength = StrengthDictionary::latin( subbed.at(j).unicode(), letter );
+                if( letterLength < 0 || length + letterLength > StrengthDictionary::MAX_WORD_LENGTH )
+                    break;
+                memcpy( word + length, letter, letterLength );
+                length += letterLength;
+                substituted = substituted || subbed.at( j ) != lower.at( j );
+                if( ! substituted )
+                    continue;
+
+                StrengthDictionary::Dictionary dictionary;
+                const int rank = StrengthDictionary::find( word, length, &dictionary );
+                if( rank == 0 )
+                    continue;
+
+                const QString token = password.mid( i, j - i + 1 );
+                Match match;
+                match.pattern    = Dictionary;
+                match.begin      = i;
+                match.end        = j;
+                match.rank       = rank;
+                match.dictionary = dictionary;
+                match.l33t       = true;
+                match.guessesLog10 = std::log10( rank * uppercaseVariations(token)
+                                                 * l33tVariations(token.toLower(), subbed.mid(i, token.length())) );
+                matches->append( match );
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Метод ищет клавиатурные дорожки длиной от трёх клавиш
+ */
+void PasswordStrength::spatialMatches(const QString &password, QVector<Match> *matches)
+{
+    const int n = password.length();
+
+    for( const KeyboardGraph &graph : keyboardGraphs() ){
+        int i = 0;
+        while( i < n - 1 ){
+            auto previous = graph.keys.constFind( password.at(i).unicode() );
+            int turns = 0;
+            int lastDirection = -1;
+            int shifted = previous != graph.keys.constEnd() && previous->shifted ? 1 : 0;
+            int j = i + 1;
+            for( ; j < n && previous != graph.keys.constEnd(); ++j ){
+                const auto current = graph.keys.constFind( password.at(j).unicode() );
+                if( current == graph.keys.constEnd() )
+                    break;
+                const int direction = KeyboardGraph::direction( *previous, *current );
+                if( direction < 0 )
+                    break;
+                if( direction != lastDirection ){
+                    ++turns;
+                    lastDirection = direction;
+                }
+                if( current->shifted )
+                    ++shifted;
+                previous = current;
+            }
+
+            const int length = j - i;
+            if( length >= 3 ){
+                // Сумма по длинам и числу поворотов: C(l - 1, t - 1) * S * D^t
+                double guesses = 0;
+                for( int l = 2; l <= length; ++l ){
+                    for( int t = 1; t <= qMin(turns, l - 1); ++t )
+                        guesses += binomial( l - 1, t - 1 ) * graph.startingPositions
+                                 * std::pow( graph.averageDegree, t );
+                }
+                if( shifted == length )
+                    guesses *= 2;
+                else if( shifted > 0 )
+                    guesses *= variations( shifted, length - shifted );
+
+                Match match;
+                match.pattern      = Spatial;
+                match.begin        = i;
+                match.end          = j - 1;
+                match.guessesLog10 = std::log10( guesses );
+                matches->append( match );
+            }
+            i = j;
+        }
+    }
+}
+
+/*!
+ * \brief Метод ищет повторы вида "aaa" и "abcabc"
+ * Число попыток - оценка повторяемой части, умноженная на число повторов.
+ */
+void PasswordStrength::repeatMatches(const QString &password, QVector<Match> *matches)
+{
+    const int n = password.length();
+
+    int i = 0;
+    while( i < n - 1 ){
+        int bestBase  = 0;
+        int bestCount = 0;
+        for( int base = 1; base <= (n - i) / 2; ++base ){
+            const QStringRef unit = password.midRef( i, base );
+            int count = 1;
+            while( i + (count + 1) * base <= n && password.midRef(i + count * base, base) == unit )
+                ++count;
+            if( count >= 2 && count * base > bestCount * bestBase ){
+                bestBase  = base;
+                bestCount = count;
+            }
+        }
+        if( bestCount == 0 ){
+            ++i;
+            continue;
+        }
+
+        Match match;
+        match.pattern      = Repeat;
+        match.begin        = i;
+        match.end          = i + bestBase * bestCount - 1;
+        match.guessesLog10 = estimate( password.mid(i, bestBase) ).guessesLog10 + std::log10( bestCount );
+        matches->append( match );
+        i = match.end + 1;
+    }
+}
+
+/*!
+ * \brief Метод ищет последовательности с постоянным шагом до MAX_SEQUENCE_DELTA:
+ * "abc", "6543", "aceg"
+ */
+void PasswordStrength::sequenceMatches(const QString &password, QVector<Match> *matches)
+{
+    const int n = password.length();
+    if( n < 2 )
+        return;
+
+    auto update = [&]( int i, int j, int delta ){
+        if( (j - i <= 1 && qAbs(delta) != 1) || delta == 0 || qAbs(delta) > MAX_SEQUENCE_DELTA )
+            return;
+
+        const QChar first = password.at( i );
+        double base;
+        if( QString("aAzZ019").contains(first) )
+            base = 4;
+        else if( first.isDigit() )
+            base = 10;
+        else
+            base = 26;
+        if( delta < 0 )
+            base *= 2;
+
+        Match match;
+        match.pattern      = Sequence;
+        match.begin        = i;
+        match.end          = j;
+        match.guessesLog10 = std::log10( base * (j - i + 1) );
+        matches->append( match );
+    };
+
+    int i = 0;
+    int lastDelta = password.at( 1 ).unicode() - password.at( 0 ).unicode();
+    for( int k = 2; k < n; ++k ){
+        const int delta = password.at( k ).unicode() - password.at( k - 1 ).unicode();
+        if( delta == lastDelta )
+            continue;
+        update( i, k - 1, lastDelta );
+        i = k - 1;
+        lastDelta = delta;
+    }
+    update( i, n - 1, lastDelta );
+}
+
+/*!
+ * \brief Метод ищет даты из 4-8 цифр, даты с разделителями и недавние годы
+ */
+void PasswordStrength::dateMatches(const QString &password, QVector<Match> *matches)
+{
+    const int n = password.length();
+    const int referenceYear = QDate::currentDate().year();
+
+    auto append = [&]( int begin, int end, double guessesLog10 ){
+        Match match;
+        match.pattern      = Date;
+        match.begin        = begin;
+        match.end          = end;
+        match.guessesLog10 = guessesLog10;
+        matches->append( match );
+    };
+
+    for( int i = 0; i < n; ++i ){
+        // Цифры подряд: год отдельно и все разбиения на три части
+        int digitsEnd = i;
+        while( digitsEnd < n && digitsEnd - i < 8 && password.at(digitsEnd).isDigit() )
+            ++digitsEnd;
+
+        if( digitsEnd - i >= 4 ){
+            const int year = password.mid( i, 4 ).toInt();
+            if( year >= 1900 && year < 2050 )
+                append( i, i + 3, std::log10(double(qMax(qAbs(year - referenceYear), MIN_YEAR_SPACE))) );
+        }
+
+        for( int length = 4; length <= digitsEnd - i; ++length ){
+            const QString token = password.mid( i, length );
+            int best = -1;
+            for( int a = 1; a <= 4 && a < length - 1; ++a ){
+                for( int b = 1; b <= 2 && a + b < length; ++b ){
+                    const int c = length - a - b;
+                    if( c > 4 )
+                        continue;
+                    const int values[3] = { token.mid(0, a).toInt(), token.mid(a, b).toInt(), token.mid(a + b).toInt() };
+                    const int digits[3] = { a, b, c };
+                    const int year = dateYear( values, digits, referenceYear );
+                    if( year >= 0 && (best < 0 || qAbs(year - referenceYear) < qAbs(best - referenceYear)) )
+                        best = year;
+                }
+            }
+            if( best >= 0 )
+                append( i, i + length - 1, dateGuessesLog10(best, false, referenceYear) );
+        }
+
+        // С разделителем: d{1,4} s d{1,2} s d{1,4}
+        for( int length = 6; length <= 10 && i + length <= n; ++length ){
+            const QString token = password.mid( i, length );
+            int first = 0;
+            while( first < length && token.at(first).isDigit() )
+                ++first;
+            if( first < 1 || first > 4 || first >= length
+                    || ! QByteArray(DATE_SEPARATORS).contains(token.at(first).toLatin1()) )
+                continue;
+            const QStringList parts = token.split( token.at(first) );
+            if( parts.size() != 3 )
+                continue;
+            bool valid = true;
+            int values[3];
+            int digits[3];
+            for( int p = 0; p < 3; ++p ){
+                values[p] = parts.at( p ).toInt();
+                digits[p] = parts.at( p ).length();
+                for( QChar c : parts.at(p) )
+                    valid = valid && c.isDigit();
+                valid = valid && digits[p] >= 1 && digits[p] <= 4;
+            }
+            if( ! valid )
+                continue;
+            const int year = dateYear( values, digits, referenceYear );
+            if( year >= 0 )
+                append( i, i + length - 1, dateGuessesLog10(year, true, referenceYear) );
+        }
+    }
+}
+
+/*!
+ * \brief Метод возвращает число вариантов регистра букв слова
+ */
+double PasswordStrength::uppercaseVariations(const QString &token)
+{
+    int upper = 0;
+    int lower = 0;
+    for( QChar c : token ){
+        if( c.isUpper() )
+            ++upper;
+        else if( c.isLower() )
+            ++lower;
+    }
+    if( upper == 0 )
+        return 1;
+
+    const bool startUpper = token.at( 0 ).isUpper() && upper == 1;
+    const bool endUpper   = token.at( token.length() - 1 ).isUpper() && upper == 1;
+    if( startUpper || endUpper || lower == 0 )
+        return 2;
+
+    return variations( upper, lower );
+}
+
+/*!
+ * \brief Метод возвращает число вариантов замен l33t
+ * \param token - слово из пароля в нижнем регистре
+ * \param word - то же слово после замен
+ */
+double PasswordStrength::l33tVariations(const QString &token, const QString &word)
+{
+    double result = 1;
+    QString counted;
+    for( int i = 0; i < token.length(); ++i ){
+        const QChar sub = token.at( i );
+        const QChar letter = word.at( i );
+        if( sub == letter || counted.contains(sub) )
+            continue;
+        counted += sub;
+
+        const int subbed   = token.count( sub );
+        const int unsubbed = token.count( letter );
+        result *= unsubbed == 0 ? 2 : variations( subbed, unsubbed );
+    }
+    return result;
+}
+
+double PasswordStrength::bruteforceGuesses(int length)
+{
+    return qMax( double(length), std::log10(length == 1 ? MIN_GUESSES_SINGLE_CHAR + 1
+                                                        : MIN_GUESSES_MULTI_CHAR + 1) );
+}
+
+/*!
+ * \brief Метод выбирает разбиение пароля на шаблоны с наименьшим числом попыток
+ *
+ * Для каждой позиции k и числа шаблонов l хранится лучшее разбиение
+ * префикса; оценка разбиения - l! * произведение попыток + 10000^(l - 1),
+ * как в zxcvbn. Участки между шаблонами закрываются перебором, два
+ * перебора подряд не допускаются.
+ */
+PasswordStrength::Estimate PasswordStrength::mostGuessable(const QString &password, QVector<Match> &matches)
+{
+    Estimate result;
+    const int n = password.length();
+    if( n == 0 )
+        return result;
+
+    // Шаблон короче пароля стоит не меньше 10 (один символ) или 50 попыток
+    QVector< QVector<int> > byEnd( n );
+    for( int i = 0; i < matches.size(); ++i ){
+        Match &match = matches[i];
+        if( match.length() < n )
+            match.guessesLog10 = qMax( match.guessesLog10,
+                                       std::log10(match.length() == 1 ? MIN_GUESSES_SINGLE_CHAR
+                                                                      : MIN_GUESSES_MULTI_CHAR) );
+        byEnd[match.end] << i;
+    }
+
+    // choice: >= 0 - индекс шаблона, <= -2 - перебор с позиции -(choice + 2), -1 - нет
+    const double INF = std::numeric_limits<double>::infinity();
+    const int width = n + 1;
+    QVector<double> total( n * width, INF );
+    QVector<double> product( n * width, INF );
+    QVector<int>    choice( n * width, -1 );
+
+    auto update = [&]( int begin, int end, double guessesLog10, int code, int l ){
+        double p = guessesLog10;
+        if( l > 1 )
+            p += product[(begin - 1) * width + l - 1];
+        const double g = log10Add( log10Factorial(l) + p, (l - 1) * LOG10_SEQUENCE_PENALTY );
+        // При равном l меньшая оценка означает меньшее произведение попыток
+        if( total[end * width + l] <= g )
+            return;
+        total[end * width + l]   = g;
+        product[end * width + l] = p;
+        choice[end * width + l]  = code;
+    };
+
+    for( int k = 0; k < n; ++k ){
+        for( int index : byEnd.at(k) ){
+            const Match &match = matches.at( index );
+            if( match.begin == 0 ){
+                update( 0, k, match.guessesLog10, index, 1 );
+                continue;
+            }
+            for( int l = 1; l <= match.begin; ++l ){
+                if( choice[(match.begin - 1) * width + l] != -1 )
+                    update( match.begin, k, match.guessesLog10, index, l + 1 );
+            }
+        }
+
+        for( int i = 0; i <= k; ++i ){
+            const double guesses = bruteforceGuesses( k - i + 1 );
+            if( i == 0 ){
+                update( 0, k, guesses, -2, 1 );
+                continue;
+            }
+            for( int l = 1; l <= i; ++l ){
+                const int previous = choice[(i - 1) * width + l];
+                if( previous >= 0 )
+                    update( i, k, guesses, -(i + 2), l + 1 );
+            }
+        }
+    }
+
+    int best = 1;
+    for( int l = 1; l <= n; ++l ){
+        if( total[(n - 1) * width + l] < total[(n - 1) * width + best] )
+            best = l;
+    }
+    result.guessesLog10 = total[(n - 1) * width + best];
+
+    for( int k = n - 1, l = best; k >= 0; --l ){
+        const int code = choice[k * width + l];
+        Match match;
+        if( code >= 0 ){
+            match = matches.at( code );
+        }else{
+            match.pattern      = Bruteforce;
+            match.begin        = -(code + 2);
+            match.end          = k;
+            match.guessesLog10 = bruteforceGuesses( match.length() );
+        }
+        result.sequence.prepend( match );
+        k = match.begin - 1;
+    }
+
+    return result;
+}
@@ -0,0 +1,78 @@
+#ifndef PASSWORDSTRENGTH_H
+#define PASSWORDSTRENGTH_H
+
+#include "strength/strengthdictionary.h"
+
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+/*!
+ * \brief Статический класс PasswordStrength - оценка стойкости пароля в духе zxcvbn
+ *
+ * Пароль разбирается на шаблоны: слова словарей (в том числе перевёрнутые
+ * и с заменами l33t), клавиатурные дорожки QWERTY и ЙЦУКЕН, повторы,
+ * последовательности и даты. Каждому шаблону сопоставляется число попыток
+ * подбора, и динамическим программированием выбирается разбиение, которое
+ * атакующему проще всего перебрать; неразобранные участки считаются
+ * перебором по 10 вариантов на символ.
+ * Числа попыток хранятся десятичными логарифмами, поэтому длинные пароли
+ * не переполняют double. Символы сверх MAX_LENGTH добавляются как перебор.
+ */
+class PasswordStrength
+{
+public:
+    enum Pattern {
+        Bruteforce = 0,
+        Dictionary,
+        Spatial,
+        Repeat,
+        Sequence,
+        Date
+    };
+
+    struct Match {
+        Pattern pattern      = Bruteforce;
+        int     begin        = 0;
+        int     end          = 0;       ///< Последний символ, включительно
+        double  guessesLog10 = 0;
+        int     rank         = 0;       ///< Ранг слова для Dictionary
+        StrengthDictionary::Dictionary dictionary = StrengthDictionary::Passwords;
+        bool    reversed     = false;
+        bool    l33t         = false;
+
+        int length() const { return end - begin + 1; }
+    };
+
+    struct Estimate {
+        double         guessesLog10 = 0;
+        int            score        = 0;  ///< 0 - очень слабый ... 4 - стойкий
+        QVector<Match> sequence;
+
+        double bits() const;
+    };
+
+    static const int MAX_LENGTH = 100;
+
+    static Estimate estimate(const QString &password);
+    static QVector<Estimate> estimate(const QStringList &passwords);
+    static QString feedback(const Estimate &estimate);
+
+private:
+    PasswordStrength();
+    ~PasswordStrength();
+
+    static void dictionaryMatches(const QString &password, QVector<Match> *matches);
+    static void l33tMatches(const QString &password, QVector<Match> *matches);
+    static void spatialMatches(const QString &password, QVector<Match> *matches);
+    static void repeatMatches(const QString &password, QVector<Match> *matches);
+    static void sequenceMatches(const QString &password, QVector<Match> *matches);
+    static void dateMatches(const QString &password, QVector<Match> *matches);
+
+    static double uppercaseVariations(const QString &token);
+    static double l33tVariations(const QString &token, const QString &word);
+    static double bruteforceGuesses(int length);
+    static Estimate mostGuessable(const QString &password, QVector<Match> &matches);
+};
+
+#endif // PASSWORDSTRENGTH_H
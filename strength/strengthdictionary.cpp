@@ -0,0 +1,29 @@
+#include "strengthdictionary.h"
+#include "strengthdictionary_data.h"
+
+#include <string.h>
+
+/*!
+ * \brief Метод ищет слово в словарях
+ * \param word - слово в нижнем регистре, ASCII
+ * \param dictionary - словарь, в котором у слова наименьший ранг
+ * \return ранг слова, 0 - слова нет
+ */
+int StrengthDictionary::find(const char *word, int length, Dictionary *dictionary)
+{
+    if( length < MIN_WORD_LENGTH || length > MAX_WORD_LENGTH )
+        return 0;
+
+    const quint32 mask = StrengthDictionaryData::SLOT_COUNT - 1;
+    for( quint32 index = hash(word, length) & mask; ; index = (index + 1) & mask ){
+        const Slot &slot = StrengthDictionaryData::SLOTS[index];
+        if( slot.length == 0 )
+            return 0;
+        if( slot.length == length
+                && memcmp(StrengthDictionaryData::WORDS + slot.offset, word, length) == 0 ){
+            if( dictionary )
+                *dictionary = static_cast<Dictionary>( slot.dictionary );
+            return slot.rank;
+        }
+    }
+}
@@ -0,0 +1,89 @@
+#ifndef STRENGTHDICTIONARY_H
+#define STRENGTHDICTIONARY_H
+
+#include <QtGlobal>
+
+/*!
+ * \brief Статический класс StrengthDictionary - словари частых паролей и слов
+ *
+ * Словари хранятся в strengthdictionary_data.h, который собирается
+ * из списков tools/strengthdict утилитой strengthdict: все слова лежат
+ * в одном массиве символов, поиск идёт по хэш-таблице с открытой адресацией
+ * (степень двойки, заполнена не более чем наполовину). Ранг слова - его
+ * номер в списке, отсортированном по частоте, начиная с 1.
+ */
+class StrengthDictionary
+{
+public:
+    enum Dictionary {
+        Passwords = 0,  ///< Частые пароли
+        English,        ///< Частые английские слова
+        Names,          ///< Имена и фамилии
+        Russian,        ///< Русские слова латиницей
+        DictionaryCount
+    };
+
+    /// Ячейка хэш-таблицы, length == 0 - пустая
+    struct Slot {
+        quint32 offset;
+        quint16 rank;
+        quint8  length;
+        quint8  dictionary;
+    };
+
+    static const int MIN_WORD_LENGTH = 3;
+    static const int MAX_WORD_LENGTH = 32;
+    static const int MAX_LATIN_LENGTH = 3;  ///< Самый длинный транслит буквы ("sch")
+
+    static int find(const char *word, int length, Dictionary *dictionary = nullptr);
+
+    /*!
+     * \brief FNV-1a, общий для поиска и для утилиты strengthdict
+     */
+    static inline quint32 hash(const char *word, int length)
+    {
+        quint32 value = 2166136261u;
+        for( int i = 0; i < length; ++i ){
+            value ^= static_cast<unsigned char>( word[i] );
+            value *= 16777619u;
+        }
+        return value;
+    }
+
+    /*!
+     * \brief Латинская запись символа, общая для поиска и для утилиты strengthdict
+     * ASCII остаётся как есть, строчные русские буквы - транслит ("ж" - "zh",
+     * "ь" - пусто), так русские слова лежат в словаре Russian.
+     * \param latin - буфер не короче MAX_LATIN_LENGTH
+     * \return число записанных байт, -1 - символ не переводится
+     */
+    static inline int latin(ushort c, char *latin)
+    {
+        static const char *const CYRILLIC[] = {
+            "a", "b", "v", "g", "d", "e", "zh", "z", "i", "y", "k", "l", "m", "n", "o", "p",
+            "r", "s", "t", "u", "f", "h", "c", "ch", "sh", "sch", "", "y", "", "e", "yu", "ya"
+        };
+        if( c < 128 ){
+            latin[0] = char( c );
+            return 1;
+        }
+        const char *text = nullptr;
+        if( c >= 0x0430 && c <= 0x044f )
+            text = CYRILLIC[c - 0x0430];
+        else if( c == 0x0451 )     // ё
+            text = "e";
+        else
+            return -1;
+
+        int length = 0;
+        for( ; text[length] != '\0'; ++length )
+            latin[length] = text[length];
+        return length;
+    }
+
+private:
+    StrengthDictionary();
+    ~StrengthDictionary();
+};
+
+#endif // STRENGTHDICTIONARY_H
@@ -0,0 +1,4996 @@
+// Generated by tools/strengthdict from its word lists, do not edit.
+
+#ifndef STRENGTHDICTIONARY_DATA_H
+#define STRENGTHDICTIONARY_DATA_H
+
+#include "strengthdictionary.h"
+
+namespace StrengthDictionaryData {
+    const int     WORD_COUNT = 7049;
+    const quint32 SLOT_COUNT = 16384;
+
+    const char WORDS[] =
+        "123456" "password" "12345678" "qwerty" "123456789" "12345" "1234" "111111"
+        "1234567" "dragon" "123123" "baseball" "abc123" "football" "monkey" "letmein"
+        "696969" "shadow" "master" "666666" "qwertyuiop" "123321" "mustang" "1234567890"
+        "michael" "654321" "superman" "1qaz2wsx" "7777777" "121212" "000000" "qazwsx"
+        "123qwe" "killer" "trustno1" "jordan" "jennifer" "zxcvbnm" "asdfgh" "hunter"
+        "buster" "soccer" "harley" "batman" "andrew" "tigger" "sunshine" "iloveyou"
+        "2000" "charlie" "robert" "thomas" "hockey" "ranger" "daniel" "starwars"
+        "klaster" "112233" "george" "computer" "michelle" "jessica" "pepper" "1111"
+        "zxcvbn" "555555" "11111111" "131313" "freedom" "777777" "pass" "maggie"
+        "159753" "aaaaaa" "ginger" "princess" "joshua" "cheese" "amanda" "summer"
+        "love" "ashley" "nicole" "chelsea" "biteme" "matthew" "access" "yankees"
+        "987654321" "dallas" "austin" "thunder" "taylor" "matrix" "mobilemail" "minecraft"
+        "william" "corvette" "hello" "martin" "heather" "secret" "merlin" "diamond"
+        "1234qwer" "gfhjkm" "hammer" "silver" "222222" "88888888" "anthony" "justin"
+        "test" "bailey" "q1w2e3r4t5" "patrick" "internet" "scooter" "orange" "11111"
+        "golfer" "cookie" "richard" "samantha" "bigdog" "guitar" "jackson" "whatever"
+        "mickey" "chicken" "sparky" "snoopy" "maverick" "phoenix" "camaro" "peanut"
+        "morgan" "welcome" "falcon" "cowboy" "ferrari" "samsung" "andrea" "smokey"
+        "steelers" "joseph" "mercedes" "dakota" "arsenal" "eagles" "melissa" "boomer"
+        "booboo" "spider" "nascar" "monster" "tigers" "yellow" "xxxxxx" "123123123"
+        "gateway" "marina" "diablo" "bulldog" "qwer1234" "compaq" "purple" "hardcore"
+        "banana" "junior" "hannah" "123654" "porsche" "lakers" "iceman" "money"
+        "cowboys" "987654" "london" "tennis" "999999" "ncc1701" "coffee" "scooby"
+        "0000" "miller" "boston" "q1w2e3r4" "brandon" "yamaha" "chester" "mother"
+        "forever" "johnny" "edward" "333333" "oliver" "redsox" "player" "nikita"
+        "knight" "fender" "barney" "midnight" "please" "brandy" "chicago" "badboy"
+        "slayer" "rangers" "charles" "angel" "flower" "rabbit" "wizard" "bigdick"
+        "jasper" "enter" "rachel" "chris" "steven" "winner" "adidas" "victoria"
+        "natasha" "1q2w3e4r" "jasmine" "winter" "prince" "panties" "marine" "ghbdtn"
+        "fishing" "cocacola" "casper" "james" "232323" "raiders" "888888" "marlboro"
+        "gandalf" "asdfasdf" "crystal" "87654321" "12344321" "golden" "8675309" "apple"
+        "jupiter" "qwerty123" "password1" "admin" "administrator" "root" "toor" "passw0rd"
+        "p@ssw0rd" "changeme" "default" "guest" "login" "qwe123" "zaq12wsx" "1q2w3e"
+        "1qazxsw2" "asdf" "asdfghjkl" "abcdef" "abcd1234" "qweasd" "qweasdzxc" "letmein1"
+        "welcome1" "iloveyou1" "monkey1" "dragon1" "sunshine1" "princess1" "football1" "baseball1"
+        "superman1" "shadow1" "master1" "loveme" "lovely" "secret1" "hello123" "test123"
+        "admin123" "root123" "user" "pass123" "password123" "1q2w3e4r5t" "qwerty1" "123456a"
+        "a123456" "1qaz2wsx3edc" "123abc" "1234abcd" "abc12345" "qwertyu" "1q2w3e4r5t6y" "123qweasd"
+        "qazwsxedc" "147258369" "159357" "147258" "789456123" "741852963" "123456789a" "12341234"
+        "11223344" "1122334455" "102030" "1111111" "0123456789" "9876543210" "5555555" "6666666"
+        "9999999" "00000000" "99999999" "77777777" "66666666" "55555555" "44444444" "33333333"
+        "22222222" "123654789" "456789" "456123" "789456" "12121212" "1212" "2222"
+        "3333" "4444" "5555" "6666" "7777" "8888" "9999" "12345a"
+        "123456q" "1qaz" "2wsx" "zaq1" "zaq1xsw2" "xsw2" "!qaz2wsx" "qwerty12"
+        "qwerty1234" "qwert" "qwerty123456" "ytrewq" "asdf1234" "asd123" "zxc123" "zxcv1234"
+        "qazxsw" "qweqwe" "qwqwqw" "asasas" "zxzxzx" "aaaaaaa" "aaa111" "abcabc"
+        "abcdefg" "abcdefgh" "abc123456" "abcd123" "a1b2c3" "a1b2c3d4" "aa123456" "aaaaaaaa"
+        "1234567a" "password12" "password2" "password3" "password!" "passwort" "passwd" "pass1234"
+        "pass1" "pa55word" "pa55w0rd" "p4ssw0rd" "passpass" "mypass" "mypassword" "nopassword"
+        "secret123" "qwerty12345" "letmein123" "welcome123" "iloveyou2" "iloveu" "iloveyou!" "loveyou"
+        "lovelove" "mylove" "baby" "babygirl" "babyboy" "sweety" "sweetie" "sweetheart"
+        "honey" "honey1" "angel1" "angels" "angelo" "princesa" "princesita" "bonita"
+        "hermosa" "chocolate" "flower1" "flowers" "butterfly" "butterfly1" "rainbow" "unicorn"
+        "kitty" "kitten" "hellokitty" "tinkerbell" "barbie" "cutie" "cute" "pretty"
+        "beautiful" "lovers" "lover" "friends" "friend" "bestfriend" "family" "family1"
+        "mommy" "mom" "daddy" "dad" "mylife" "life" "forever1" "together"
+        "destiny" "jesus" "jesus1" "jesuschrist" "christ" "god" "godisgood" "blessed"
+        "faith" "heaven" "angel123" "trinity" "grace" "lord" "savior" "church"
+        "amen" "michael1" "jordan23" "jordan1" "lebron" "kobe24" "kobe" "lakers1"
+        "celtics" "bulls" "chicago1" "knicks" "yankees1" "redsox1" "mets" "dodgers"
+        "giants" "packers" "cowboys1" "steelers1" "eagles1" "patriots" "broncos" "bears"
+        "vikings" "ravens" "saints" "chargers" "raiders1" "dolphins" "jets" "seahawks"
+        "liverpool" "manchester" "chelsea1" "arsenal1" "barcelona" "realmadrid" "juventus" "milan"
+        "bayern" "united" "football2" "soccer1" "basketball" "baseball2" "hockey1" "tennis1"
+        "golf" "golfer1" "skater" "skateboard" "surfer" "snowboard" "racing" "nascar1"
+        "ferrari1" "porsche1" "mustang1" "corvette1" "camaro1" "bmw" "audi" "honda"
+        "toyota" "nissan" "mazda" "subaru" "harley1" "yamaha1" "suzuki" "kawasaki"
+        "ducati" "ford" "chevy" "dodge" "jeep" "volvo" "jaguar" "mercedes1"
+        "lexus" "batman1" "superman2" "spiderman" "ironman" "hulk" "wolverine" "deadpool"
+        "pokemon" "pikachu" "naruto" "sasuke" "goku" "dragonball" "onepiece" "mario"
+        "zelda" "sonic" "halo" "starwars1" "jedi" "yoda" "vader" "skywalker"
+        "matrix1" "neo" "morpheus" "hogwarts" "harrypotter" "gandalf1" "frodo" "hobbit"
+        "legolas" "mordor" "sauron" "voldemort" "simpsons" "homer" "bart" "spongebob"
+        "scooby1" "garfield" "snoopy1" "mickey1" "minnie" "donald" "goofy" "pluto"
+        "disney" "shrek" "elmo" "cookie1" "cookies" "cupcake" "pizza" "burger"
+        "hotdog" "icecream" "candy" "sugar" "cheese1" "banana1" "apple1" "orange1"
+        "lemon" "cherry" "peaches" "strawberry" "blueberry" "pepper1" "coffee1" "whiskey"
+        "vodka" "beer" "tequila" "bacardi" "jackdaniels" "guinness" "heineken" "budweiser"
+        "marlboro1" "cocacola1" "pepsi" "sprite" "redbull" "monster1" "killer1" "hunter1"
+        "hunter2" "shadow12" "master12" "dragon12" "monkey12" "ninja" "ninja1" "samurai"
+        "warrior" "soldier" "sniper" "gunner" "ranger1" "marine1" "army" "navy"
+        "airforce" "pilot" "captain" "general" "major" "sergeant" "private" "commander"
+        "chief" "boss" "bigboss" "thebest" "best" "winner1" "champion" "champ"
+        "legend" "hero" "king" "kingkong" "queen" "prince1" "princess12" "lady"
+        "gentleman" "sir" "master123" "slave" "god123" "devil" "satan" "demon"
+        "evil" "hell666" "666" "lucifer" "vampire" "zombie" "ghost" "ghost1"
+        "phantom" "spirit" "soul" "angel666" "darkness" "dark" "darkside" "blackout"
+        "black" "white" "red" "blue" "green" "yellow1" "purple1" "pink"
+        "orange2" "silver1" "golden1" "gold" "diamond1" "crystal1" "ruby" "emerald"
+        "pearl" "jade" "amber" "topaz" "sapphire" "star" "stars" "starlight"
+        "moon" "moonlight" "sun" "sunny" "sunshine2" "summer1" "winter1" "spring"
+        "autumn" "fall" "snow" "snowball" "snowman" "rain" "storm" "thunder1"
+        "lightning" "tornado" "hurricane" "fire" "firefly" "flame" "water" "ocean"
+        "sea" "beach" "island" "paradise" "heaven1" "earth" "world" "planet"
+        "galaxy" "universe" "cosmos" "space" "rocket" "nasa" "alien" "matrix2"
+        "computer1" "internet1" "google" "yahoo" "hotmail" "gmail" "facebook" "twitter"
+        "myspace" "youtube" "skype" "apple123" "microsoft" "windows" "linux" "ubuntu"
+        "unix" "hacker" "hack" "hacked" "cracker" "crack" "security" "secure"
+        "private1" "access1" "access14" "letmein2" "enter1" "open" "opensesame" "sesame"
+        "master11" "control" "admin1" "admin12" "administrator1" "system" "sysadmin" "root1"
+        "server" "network" "database" "oracle" "mysql" "sql" "webmaster" "web"
+        "website" "online" "office" "work" "job" "business" "company" "money1"
+        "money123" "cash" "dollar" "dollars" "rich" "million" "billion" "lucky"
+        "lucky7" "lucky13" "luck" "chance" "fortune" "bingo" "poker" "casino"
+        "vegas" "jackpot" "007" "james007" "jamesbond" "bond007" "agent" "spy"
+        "secretagent" "mission" "gizmo" "gizmo1" "buddy" "buddy1" "rocky" "rocky1"
+        "max" "max123" "maxwell" "duke" "bear" "bear1" "teddy" "teddybear"
+        "tiger" "tiger1" "lion" "lion1" "wolf" "wolf1" "fox" "fox1"
+        "eagle" "eagle1" "hawk" "falcon1" "raven" "crow" "dove" "panda"
+        "koala" "monkey123" "gorilla" "elephant" "horse" "horses" "pony" "dolphin"
+        "shark" "whale" "fish" "fishing1" "turtle" "frog" "snake" "cobra"
+        "viper" "python" "dragon123" "dragons" "unicorn1" "phoenix1" "griffin" "pegasus"
+        "puppy" "puppy1" "doggy" "doggie" "dog" "dog123" "cat" "cat123"
+        "kitty1" "kitten1" "pussycat" "mouse" "rabbit1" "bunny" "bunny1" "hamster"
+        "chicken1" "duck" "goose" "turkey" "cow" "pig" "piggy" "sheep"
+        "goat" "donkey" "mickeymouse" "jerry" "tom" "tomcat" "garfield1" "scrappy"
+        "scooter1" "sparky1" "rusty" "rusty1" "lucky1" "lucky123" "shadow123" "smokey1"
+        "midnight1" "blackie" "oreo" "bandit" "bandit1" "coco" "chloe" "sophie"
+        "molly" "molly1" "lucy" "daisy" "maggie1" "sadie" "bella" "bella1"
+        "princess123" "angel12" "baby123" "babygirl1" "lovely1" "qwerty7" "qwerty11" "asdfghjkl1"
+        "zxcvbnm1" "zxcvbn1" "qwertyui" "qwertyuiop1" "1qazxsw" "1234qwerasdf" "qwerasdf" "qwerasdfzxcv"
+        "1q2w3e4" "q1w2e3" "q2w3e4r5" "1z2x3c4v" "zaqwsx" "zaqxsw" "xswzaq" "mnbvcxz"
+        "lkjhgfdsa" "poiuytrewq" "asdfg" "asdfgh1" "zxcvb" "qazwsx1" "qaz123" "wsx123"
+        "edc123" "rfv123" "1qaz2wsx!" "password01" "passw0rd1" "p@ssword" "p@55w0rd" "pa$$word"
+        "pa$$w0rd" "passw0rd!" "p@ssword1" "summer2019" "summer2020" "winter2020" "spring2021" "autumn2021"
+        "summer2018" "winter2019" "winter2021" "spring2020" "january" "february" "march" "april"
+        "may" "june" "july" "august" "september" "october" "november" "december"
+        "monday" "tuesday" "wednesday" "thursday" "friday" "saturday" "sunday" "weekend"
+        "holiday" "christmas" "xmas" "easter" "halloween" "birthday" "happybirthday" "newyear"
+        "valentine" "1234567890q" "abcdef123" "asdasd" "asdasd123" "qweqwe123" "zxczxc" "123asd"
+        "123zxc" "123qaz" "123qwe123" "qwe123qwe" "1qwerty" "qwerty2" "qwerty3" "asdf123"
+        "asdfasdf1" "fuckyou" "fuckyou1" "fuckoff" "fuck" "fuckme" "fucker" "fucking"
+        "shit" "shithead" "asshole" "bitch" "bitch1" "bitches" "bastard" "dick"
+        "dickhead" "cock" "cunt" "pussy" "pussy1" "penis" "vagina" "sex"
+        "sexy" "sexy1" "sexsex" "hotsex" "hot" "hottie" "horny" "porn"
+        "porno" "xxx" "xxxx" "xxxxx" "6969" "696969a" "boobs" "tits"
+        "ass" "booty" "naked" "nude" "playboy" "hustler" "lovesex" "kiss"
+        "kisses" "hugs" "lips" "blowjob" "suck" "sucker" "sucks" "loser"
+        "loser1" "stupid" "idiot" "dumbass" "moron" "crazy" "crazy1" "nobody"
+        "someone" "anybody" "everyone" "whoami" "whatever1" "nothing" "something" "anything"
+        "everything" "maybe" "yes" "okay" "hello1" "hey" "heyhey" "hallo"
+        "hola" "ciao" "bonjour" "salut" "aloha" "welcome2" "goodbye" "bye"
+        "test1" "test12" "test1234" "testing" "tester" "testtest" "demo" "sample"
+        "example" "temp" "temp123" "temppass" "default1" "guest1" "user1" "user123"
+        "username" "login1" "logon" "signin" "member" "public" "anonymous" "nobody1"
+        "none" "null" "void" "blank" "empty" "123456789q" "12345qwert" "12345qwerty"
+        "123456qwerty" "qwerty123456789" "1234509876" "0987654321" "987654321a" "11111a" "111111a" "1111111111"
+        "000000a" "121212a" "123321a" "123abc123" "1a2b3c" "1a2b3c4d" "1a2s3d4f" "a12345"
+        "a1234567" "a123123" "q123456" "q1234567" "qq123456" "qqqqqq" "qqqqqqq" "wwwwww"
+        "eeeeee" "zzzzzz" "zzzzzzz" "ssssss" "dddddd" "ffffff" "gggggg" "hhhhhh"
+        "jjjjjj" "kkkkkk" "llllll" "mmmmmm" "nnnnnn" "bbbbbb" "cccccc" "vvvvvv"
+        "pppppp" "oooooo" "iiiiii" "uuuuuu" "yyyyyy" "tttttt" "rrrrrr" "1qa2ws3ed"
+        "1qw23e" "1q2w" "12qw" "12qwaszx" "12qwas" "123qw" "12345q" "12345z"
+        "zaq123" "vfhbyf" "vfrcbv" "yfnfif" "cjkywt" "ktyjxrf" "kfgjxrf" "rjntyjr"
+        "ckfdbr" "ghbdtn1" "gfhjkm1" "qwertyuiop123" "jktxrf" "fylhtq" "lhfrjy" "pfqrf"
+        "vjcrdf" "ghbdtnbrb" "1qaz@wsx" "!qaz@wsx" "!@#$%^" "!@#$%^&*" "!@#$%^&*()" "1q!2w@3e#"
+        "qwe!@#" "abc!@#" "p@$$w0rd" "trustno1!" "letmein!" "michael123" "daniel1" "david"
+        "david1" "jessica1" "ashley1" "amanda1" "jennifer1" "nicole1" "melissa1" "michelle1"
+        "sarah" "sarah1" "heather1" "elizabeth" "stephanie" "rebecca" "lauren" "emily"
+        "emma" "olivia" "sophia" "isabella" "mia" "abigail" "madison" "chloe1"
+        "natalie" "hannah1" "samantha1" "victoria1" "alexis" "alexandra" "alex" "alex123"
+        "alexander" "alexander1" "andrew1" "anthony1" "christopher" "chris1" "joshua1" "matthew1"
+        "james1" "john" "john1" "robert1" "william1" "richard1" "thomas1" "charles1"
+        "joseph1" "george1" "kevin" "kevin1" "brian" "steven1" "jason" "jason1"
+        "justin1" "ryan" "eric" "adam" "mark" "paul" "peter" "scott"
+        "jeff" "brandon1" "tyler" "austin1" "dylan" "nathan" "zachary" "ethan"
+        "logan" "jacob" "jacob1" "ben" "benjamin" "samuel" "jack" "jack1"
+        "harry" "henry" "oscar" "charlie1" "freddie" "archie" "leo" "max1"
+        "martin1" "victor" "maria" "maria1" "anna" "anna1" "ana" "elena"
+        "natasha1" "nadia" "irina" "olga" "tanya" "svetlana" "marina1" "katya"
+        "masha" "nastya" "dasha" "sveta" "lena" "julia" "julia1" "juliet"
+        "romeo" "romeo1" "jordan2" "taylor1" "morgan1" "dakota1" "jasmine1" "crystal2"
+        "diamond2" "destiny1" "angela" "angelina" "monica" "veronica" "jessie" "carmen"
+        "rosa" "rose" "roses" "daisy1" "lily" "lilly" "tulip" "orchid"
+        "violet" "iris" "poppy" "sakura" "cherry1" "apple2" "blackberry" "raspberry"
+        "pineapple" "mango" "kiwi" "coconut" "peanut1" "peanutbutter" "butter" "popcorn"
+        "chocolate1" "candy1" "cupcake1" "muffin" "pancake" "cookie123" "biscuit" "tweety"
+        "tigger1" "pooh" "winnie" "winniethepooh" "eeyore" "piglet" "bambi" "nemo"
+        "dory" "simba" "nala" "pumba" "timon" "aladdin" "jasmine2" "ariel"
+        "belle" "cinderella" "snowwhite" "sleepingbeauty" "rapunzel" "elsa" "anna2" "olaf"
+        "frozen" "toystory" "buzz" "woody" "nemo1" "cars" "lightning1" "mcqueen"
+        "transformers" "optimus" "bumblebee" "megatron" "power" "powerful" "powers" "energy"
+        "force" "strong" "strength" "superstar" "rockstar" "rock" "rocknroll" "metal"
+        "metallica" "slipknot" "nirvana" "eminem" "tupac" "2pac" "biggie" "drake"
+        "rihanna" "beyonce" "britney" "madonna" "michaeljackson" "elvis" "beatles" "queen1"
+        "acdc" "ledzeppelin" "pinkfloyd" "greenday" "linkinpark" "blink182" "music" "music1"
+        "musica" "guitar1" "piano" "drums" "bass" "singer" "dance" "dancer"
+        "dancing" "ballet" "party" "partyanimal" "cheerleader" "softball" "volleyball" "swimming"
+        "running" "runner" "cycling" "biker" "rider" "cowboy1" "cowgirl" "country"
+        "texas" "california" "florida" "newyork" "brooklyn" "bronx" "boston1" "chicago2"
+        "detroit" "miami" "dallas1" "houston" "atlanta" "seattle" "denver" "phoenix2"
+        "vegas1" "canada" "america" "usa" "usa123" "england" "london1" "paris"
+        "france" "germany" "berlin" "italia" "italy" "roma" "spain" "madrid"
+        "mexico" "brasil" "brazil" "russia" "moscow" "china" "japan" "tokyo"
+        "korea" "india" "australia" "sydney" "africa" "europe" "asia" "you"
+        "the" "and" "that" "have" "for" "not" "with" "this"
+        "but" "his" "from" "they" "she" "her" "one" "all"
+        "would" "there" "their" "what" "out" "about" "who" "get"
+        "which" "when" "make" "can" "like" "time" "just" "him"
+        "know" "take" "people" "into" "year" "your" "good" "some"
+        "could" "them" "see" "other" "than" "then" "now" "look"
+        "only" "come" "its" "over" "think" "also" "back" "after"
+        "use" "two" "how" "our" "first" "well" "way" "even"
+        "new" "want" "because" "any" "these" "give" "day" "most"
+        "find" "here" "thing" "many" "right" "tell" "very" "call"
+        "still" "should" "school" "hand" "feel" "high" "really" "never"
+        "last" "long" "great" "little" "own" "old" "big" "house"
+        "night" "point" "home" "room" "father" "area" "story" "fact"
+        "month" "lot" "study" "book" "eye" "word" "issue" "side"
+        "kind" "head" "service" "hour" "game" "line" "end" "law"
+        "car" "city" "name" "team" "minute" "idea" "kid" "body"
+        "information" "face" "others" "level" "door" "health" "person" "art"
+        "war" "history" "result" "change" "morning" "reason" "research" "girl"
+        "guy" "moment" "air" "teacher" "education" "foot" "boy" "age"
+        "policy" "happy" "sky" "river" "mountain" "forest" "garden" "pirate"
+        "magic" "thanks" "phone" "sister" "brother" "darling" "sweet" "dream"
+        "heart" "always" "ice" "wind" "alpha" "omega" "delta" "bravo"
+        "echo" "victory" "travel" "those" "both" "each" "few" "more"
+        "such" "same" "different" "while" "next" "early" "young" "important"
+        "bad" "able" "group" "number" "problem" "place" "case" "week"
+        "program" "question" "government" "state" "student" "community" "president" "parent"
+        "again" "around" "against" "between" "under" "another" "without" "within"
+        "must" "might" "often" "sometimes" "usually" "already" "almost" "enough"
+        "quite" "rather" "perhaps" "though" "although" "until" "since" "where"
+        "why" "whether" "either" "neither" "yet" "once" "during" "before"
+        "above" "below" "across" "along" "among" "behind" "beside" "beyond"
+        "inside" "outside" "toward" "upon" "through" "throughout" "however" "therefore"
+        "instead" "otherwise" "indeed" "actually" "probably" "certainly" "especially" "simply"
+        "finally" "recently" "suddenly" "quickly" "slowly" "easily" "late" "soon"
+        "later" "today" "tomorrow" "yesterday" "tonight" "century" "future" "past"
+        "present" "begin" "start" "stop" "keep" "let" "put" "set"
+        "seem" "help" "show" "hear" "play" "run" "move" "live"
+        "believe" "hold" "bring" "happen" "write" "provide" "sit" "stand"
+        "lose" "pay" "meet" "include" "continue" "learn" "lead" "understand"
+        "watch" "follow" "create" "speak" "read" "allow" "add" "spend"
+        "grow" "walk" "win" "offer" "remember" "consider" "appear" "buy"
+        "wait" "serve" "die" "send" "expect" "build" "stay" "cut"
+        "reach" "kill" "remain" "suggest" "raise" "sell" "require" "report"
+        "decide" "pull" "return" "explain" "hope" "develop" "carry" "break"
+        "receive" "agree" "support" "hit" "produce" "eat" "cover" "catch"
+        "draw" "choose" "cause" "listen" "realize" "close" "involve" "thank"
+        "apply" "wear" "sing" "drive" "push" "fight" "throw" "pick"
+        "enjoy" "accept" "worry" "visit" "prepare" "fill" "teach" "smile"
+        "laugh" "cry" "sleep" "wake" "talk" "say" "said" "went"
+        "gone" "came" "made" "took" "gave" "found" "told" "thought"
+        "knew" "felt" "became" "left" "kept" "brought" "began" "seemed"
+        "stood" "heard" "meant" "paid" "sent" "built" "fell" "lost"
+        "held" "wrote" "sat" "ran" "spoke" "led" "understood" "grew"
+        "won" "drew" "chose" "broke" "ate" "drove" "sang" "flew"
+        "swam" "rode" "hid" "shot" "fought" "caught" "taught" "sold"
+        "bought" "slept" "woke" "dreamt" "town" "village" "street" "road"
+        "avenue" "bridge" "building" "hospital" "hotel" "restaurant" "store" "shop"
+        "market" "bank" "station" "airport" "park" "field" "farm" "hill"
+        "valley" "lake" "coast" "desert" "nation" "region" "north" "south"
+        "east" "west" "center" "middle" "top" "bottom" "front" "corner"
+        "edge" "circle" "square" "shape" "color" "size" "weight" "height"
+        "length" "price" "cost" "value" "rate" "percent" "amount" "total"
+        "half" "quarter" "double" "single" "couple" "pair" "crowd" "police"
+        "doctor" "nurse" "lawyer" "judge" "officer" "worker" "manager" "director"
+        "leader" "owner" "partner" "staff" "client" "customer" "host" "neighbor"
+        "stranger" "enemy" "man" "woman" "child" "son" "daughter" "husband"
+        "wife" "uncle" "aunt" "cousin" "grandmother" "grandfather" "mind" "brain"
+        "blood" "bone" "skin" "hair" "ear" "nose" "mouth" "lip"
+        "tooth" "tongue" "neck" "shoulder" "arm" "finger" "leg" "knee"
+        "chest" "stomach" "voice" "sound" "noise" "song" "letter" "message"
+        "note" "paper" "page" "novel" "poem" "picture" "photo" "image"
+        "film" "movie" "television" "radio" "news" "newspaper" "magazine" "article"
+        "record" "data" "file" "software" "machine" "engine" "camera" "screen"
+        "window" "wall" "floor" "roof" "kitchen" "bedroom" "bathroom" "table"
+        "chair" "bed" "desk" "lamp" "clock" "mirror" "glass" "cup"
+        "plate" "bowl" "bottle" "box" "bag" "key" "ring" "gift"
+        "card" "ticket" "map" "bill" "coin" "iron" "steel" "stone"
+        "sand" "dust" "mud" "wood" "tree" "leaf" "grass" "plant"
+        "seed" "fruit" "vegetable" "bread" "meat" "egg" "milk" "rice"
+        "corn" "soup" "salad" "salt" "oil" "wine" "tea" "juice"
+        "dinner" "lunch" "breakfast" "meal" "food" "drink" "animal" "bird"
+        "deer" "bee" "insect" "light" "smoke" "heat" "cold" "warm"
+        "cool" "wet" "dry" "clean" "dirty" "fresh" "modern" "ancient"
+        "small" "large" "huge" "tiny" "short" "tall" "wide" "narrow"
+        "thick" "thin" "heavy" "weak" "hard" "soft" "rough" "smooth"
+        "sharp" "quick" "fast" "slow" "loud" "quiet" "sad" "angry"
+        "afraid" "proud" "brave" "calm" "funny" "serious" "strange" "normal"
+        "simple" "easy" "difficult" "possible" "impossible" "true" "false" "real"
+        "fake" "wrong" "better" "worse" "worst" "ugly" "nice" "cruel"
+        "poor" "cheap" "expensive" "free" "busy" "full" "closed" "alive"
+        "dead" "sick" "healthy" "safe" "dangerous" "ready" "sure" "certain"
+        "clear" "bright" "dull" "deep" "low" "near" "far" "whole"
+        "entire" "main" "special" "common" "natural" "human" "social" "political"
+        "economic" "national" "international" "local" "military" "medical" "legal" "financial"
+        "personal" "physical" "mental" "sexual" "religious" "cultural" "federal" "final"
+        "minor" "basic" "central" "recent" "current" "popular" "available" "similar"
+        "various" "particular" "specific" "likely" "necessary" "perfect" "wonderful" "terrible"
+        "horrible" "amazing" "awesome" "excellent" "fantastic" "incredible" "brilliant" "famous"
+        "favorite" "gorgeous" "bitter" "sour" "spicy" "delicious" "hungry" "thirsty"
+        "tired" "lonely" "sorry" "glad" "excited" "nervous" "worried" "scared"
+        "surprised" "confused" "bored" "interested" "grateful" "jealous" "lazy" "smart"
+        "clever" "silly" "wise" "honest" "loyal" "gentle" "polite" "rude"
+        "wild" "shy" "fancy" "plain" "wooden" "broken" "hidden" "mystery"
+        "adventure" "journey" "quest" "battle" "defeat" "glory" "honor" "courage"
+        "peace" "death" "birth" "marriage" "wedding" "funeral" "festival" "vacation"
+        "trip" "tour" "flight" "ship" "boat" "train" "plane" "bus"
+        "truck" "bike" "taxi" "wheel" "traffic" "accident" "danger" "risk"
+        "fate" "memory" "culture" "language" "science" "nature" "sport" "match"
+        "race" "goal" "score" "club" "league" "season" "coach" "fan"
+        "ball" "bat" "net" "court" "track" "pool" "gym" "exercise"
+        "training" "practice" "lesson" "class" "course" "degree" "college" "university"
+        "professor" "scientist" "artist" "writer" "author" "poet" "actor" "painter"
+        "designer" "engineer" "builder" "farmer" "fisher" "driver" "sailor" "chef"
+        "cook" "baker" "waiter" "clerk" "secretary" "thief" "criminal" "prisoner"
+        "guard" "prison" "crime" "murder" "gun" "knife" "sword" "shield"
+        "weapon" "bomb" "attack" "defense" "treaty" "rule" "order" "justice"
+        "truth" "lie" "answer" "solution" "effect" "purpose" "plan" "opinion"
+        "belief" "feeling" "emotion" "hate" "fear" "anger" "joy" "pleasure"
+        "pain" "sorrow" "grief" "shame" "pride" "trust" "respect" "desire"
+        "passion" "interest" "attention" "care" "concern" "effort" "skill" "talent"
+        "ability" "knowledge" "wisdom" "experience" "success" "failure" "mistake" "error"
+        "fault" "choice" "decision" "opportunity" "challenge" "difference" "growth" "progress"
+        "development" "improvement" "increase" "decrease" "loss" "gain" "profit" "benefit"
+        "advantage" "product" "project" "process" "method" "structure" "design" "pattern"
+        "model" "version" "type" "sort" "style" "form" "part" "piece"
+        "section" "element" "feature" "factor" "detail" "aspect" "quality" "quantity"
+        "stage" "step" "phase" "period" "second" "evening" "afternoon" "dawn"
+        "dusk" "noon" "weather" "cloud" "wave" "shore" "continent" "absence"
+        "academy" "accent" "account" "achieve" "acid" "acquire" "act" "action"
+        "active" "activity" "actress" "address" "admire" "admit" "adult" "advance"
+        "advice" "affair" "afford" "agency" "agenda" "agreement" "ahead" "aid"
+        "aim" "alarm" "album" "alcohol" "alley" "alone" "analysis" "angle"
+        "ankle" "announce" "annual" "anxiety" "apart" "apartment" "apology" "apparent"
+        "appeal" "appetite" "approach" "approve" "arena" "argue" "argument" "arise"
+        "armor" "arrange" "arrest" "arrival" "arrive" "arrow" "ash" "aside"
+        "asleep" "assault" "asset" "assist" "assume" "attach" "attempt" "attend"
+        "attitude" "attract" "audience" "auto" "average" "avoid" "award" "aware"
+        "awful" "bacon" "badge" "bake" "balance" "balloon" "band" "banner"
+        "bar" "bare" "bargain" "barrel" "base" "basket" "bath" "battery"
+        "beam" "bean" "beard" "beast" "beat" "beauty" "beef" "beg"
+        "behave" "being" "bell" "belly" "belong" "belt" "bench" "bend"
+        "berry" "bet" "bible" "bicycle" "bid" "bind" "biology" "bishop"
+        "bit" "bite" "blade" "blame" "blanket" "blast" "blend" "bless"
+        "blind" "block" "blond" "bloom" "blow" "board" "boast" "boil"
+        "bold" "bolt" "bond" "bonus" "boot" "border" "borrow" "bother"
+        "bounce" "bound" "bow" "branch" "brand" "brass" "breast" "breath"
+        "breeze" "brick" "bride" "brief" "brush" "bubble" "bucket" "budget"
+        "buffalo" "bug" "bullet" "bunch" "burden" "burn" "burst" "bury"
+        "bush" "button" "cabin" "cabinet" "cable" "cake" "calendar" "camp"
+        "campaign" "canal" "cancel" "cancer" "candle" "cannon" "canvas" "cap"
+        "capable" "capital" "capture" "carbon" "career" "cargo" "carpet" "carrot"
+        "cart" "cartoon" "castle" "casual" "cattle" "ceiling" "cell" "cement"
+        "census" "chain" "chalk" "chamber" "channel" "chapter" "charge" "charity"
+        "charm" "chart" "chase" "cheat" "check" "cheek" "cheer" "chemical"
+        "chin" "chip" "chorus" "cigar" "cinema" "circus" "citizen" "civil"
+        "claim" "clap" "clay" "cliff" "climate" "climb" "clinic" "cloth"
+        "clothes" "clown" "coal" "coat" "code" "collar" "collect" "colony"
+        "column" "combat" "comedy" "comfort" "comic" "command" "comment" "commit"
+        "compare" "compass" "compete" "complain" "complex" "concert" "conduct" "confirm"
+        "connect" "conquer" "consist" "contact" "contain" "content" "contest" "context"
+        "contract" "convert" "convince" "copper" "copy" "coral" "core" "correct"
+        "cotton" "cough" "count" "counter" "craft" "crash" "crawl" "cream"
+        "credit" "crew" "cricket" "crisis" "critic" "crop" "cross" "crown"
+        "cruise" "crush" "cube" "cupboard" "curious" "curtain" "curve" "cushion"
+        "custom" "cycle" "daily" "damage" "damp" "dare" "date" "deal"
+        "dealer" "debate" "debt" "decade" "decline" "decorate" "defend" "define"
+        "delay" "deliver" "demand" "dentist" "deny" "depart" "depend" "deposit"
+        "depth" "deputy" "deserve" "destroy" "detect" "device" "diary" "diet"
+        "digital" "direct" "dirt" "disaster" "discover" "disease" "dish" "display"
+        "distance" "district" "dive" "divide" "document" "domain" "donate" "doubt"
+        "dozen" "draft" "drag" "drama" "drawer" "dress" "drift" "drill"
+        "drum" "dumb" "dump" "duty" "eager" "earn" "ease" "edit"
+        "elbow" "elder" "elect" "electric" "elegant" "elite" "embrace" "emerge"
+        "empire" "employ" "enable" "engage" "enormous" "ensure" "entry" "envelope"
+        "episode" "equal" "equip" "escape" "essay" "estate" "eternal" "ethics"
+        "evidence" "exact" "exam" "exceed" "excess" "exchange" "excuse" "exhibit"
+        "exile" "exist" "exit" "expand" "expert" "explore" "export" "expose"
+        "express" "extend" "extra" "fabric" "factory" "fade" "faint" "fairy"
+        "fame" "fantasy" "fashion" "fat" "fatal" "feast" "feather" "fee"
+        "female" "fence" "fever" "fiber" "fiction" "figure" "filter" "finance"
+        "finish" "fiscal" "fist" "fitness" "flag" "flash" "flat" "flavor"
+        "fleet" "flesh" "float" "flood" "flour" "fluid" "flush" "foam"
+        "focus" "fog" "fold" "folk" "fond" "forbid" "forecast" "forget"
+        "forgive" "fork" "formal" "forum" "fossil" "foster" "fountain" "frame"
+        "fraud" "frequent" "fridge" "frost" "fuel" "fun" "fund" "fur"
+        "furniture" "gallery" "gamble" "gap" "garage" "garbage" "gas" "gate"
+        "gather" "gear" "gene" "genius" "genre" "genuine" "gesture" "giant"
+        "giraffe" "glance" "glimpse" "globe" "glove" "glue" "goddess" "gossip"
+        "govern" "grab" "grade" "grain" "grand" "grant" "grape" "graph"
+        "grasp" "grave" "gravity" "greet" "grid" "grin" "grip" "grocery"
+        "guess" "guide" "guilt" "habit" "handle" "harbor" "harvest" "hat"
+        "hazard" "heal" "heap" "hedge" "heel" "helmet" "herb" "heritage"
+        "hint" "hip" "hire" "hobby" "holy" "hook" "horizon" "horn"
+        "horror" "hostile" "humor" "hunger" "hurry" "hut" "hymn" "icon"
+        "ideal" "identity" "ignore" "illegal" "illness" "imagine" "immune" "impact"
+        "import" "impose" "income" "index" "infant" "inform" "inherit" "injury"
+        "ink" "inner" "input" "insert" "insight" "inspire" "install" "intend"
+        "invest" "invite" "item" "ivory" "jacket" "jail" "jam" "jar"
+        "jazz" "jeans" "jelly" "jewel" "joint" "joke" "journal" "jump"
+        "jungle" "jury" "kettle" "kick" "kidney" "kingdom" "kit" "knock"
+        "label" "labor" "lace" "ladder" "lamb" "land" "lane" "laptop"
+        "laser" "launch" "laundry" "lawn" "layer" "lean" "leather" "lecture"
+        "lens" "liberty" "library" "license" "lid" "lift" "limb" "limit"
+        "linen" "liquid" "list" "liver" "load" "loan" "lobby" "lobster"
+        "lock" "logic" "loop" "lottery" "lounge" "luggage" "lunar" "lung"
+        "luxury" "lyrics" "mad" "magnet" "maid" "mail" "mammal" "mansion"
+        "manual" "maple" "marble" "margin" "mask" "mass" "mat" "math"
+        "matter" "mayor" "meadow" "measure" "medal" "media" "melody" "melt"
+        "menu" "mercy" "merit" "mess" "mild" "mile" "mill" "mineral"
+        "miracle" "mix" "mobile" "moderate" "modest" "monitor" "moral" "motion"
+        "motor" "mount" "muscle" "museum" "mushroom" "mutual" "myth" "nail"
+        "native" "needle" "nerve" "nest" "neutral" "nickel" "noble" "noodle"
+        "nuclear" "nut" "oak" "obey" "object" "obtain" "odd" "offense"
+        "olive" "onion" "opera" "option" "oral" "orbit" "orchard" "organ"
+        "origin" "outfit" "oven" "owl" "oxygen" "pace" "pack" "package"
+        "paddle" "paint" "palace" "palm" "panel" "panic" "pants" "parade"
+        "parcel" "parrot" "passage" "patch" "path" "patient" "patrol" "pause"
+        "pave" "peach" "pen" "penalty" "pencil" "penny" "perfume" "permit"
+        "pet" "phrase" "pie" "pigeon" "pile" "pill" "pine" "pipe"
+        "pistol" "pitch" "plastic" "plot" "plug" "plum" "pocket" "poison"
+        "pole" "polish" "pond" "port" "portrait" "pose" "post" "pot"
+        "potato" "pottery" "pound" "powder" "praise" "pray" "prayer" "predict"
+        "prefer" "pregnant" "priest" "print" "prize" "promise" "proof" "property"
+        "protect" "proverb" "pulse" "pump" "punch" "pupil" "puppet" "purse"
+        "puzzle" "pyramid" "quit" "quiz" "radar" "rage" "rail" "ranch"
+        "range" "rapid" "rare" "rat" "raw" "razor" "recipe" "reform"
+        "refuse" "regret" "relax" "release" "relief" "remote" "rent" "repair"
+        "repeat" "reply" "rescue" "reserve" "resort" "rest" "retire" "reveal"
+        "reward" "rhythm" "rib" "ribbon" "riddle" "ride" "rifle" "ripe"
+        "ritual" "rival" "robot" "rope" "rotate" "round" "route" "royal"
+        "rubber" "rug" "ruin" "rumor" "rural" "rush" "rust" "sack"
+        "saddle" "sail" "salmon" "salon" "sauce" "sausage" "scale" "scare"
+        "scarf" "scene" "scent" "scholar" "scissors" "scout" "scrap" "scream"
+        "script" "sculpture" "seal" "search" "seat" "sector" "seek" "select"
+        "senior" "sense" "series" "sermon" "session" "settle" "shade" "shaft"
+        "shallow" "shed" "shelf" "shell" "shelter" "shift" "shine" "shirt"
+        "shock" "shoe" "shoot" "shout" "shower" "shrimp" "shrug" "siege"
+        "sight" "signal" "silence" "silk" "sin" "siren" "sketch" "ski"
+        "skirt" "skull" "slam" "sleeve" "slice" "slide" "slim" "slip"
+        "slope" "snack" "soap" "sock" "sofa" "soil" "solar" "solid"
+        "solve" "source" "spare" "spark" "speech" "speed" "spell" "sphere"
+        "spice" "spike" "spin" "spine" "splash" "sponge" "spoon" "spot"
+        "spray" "spread" "squad" "squeeze" "stable" "stack" "stadium" "stake"
+        "stamp" "statue" "steak" "steam" "stem" "stick" "stiff" "sting"
+        "stir" "stock" "stove" "straw" "stream" "stress" "stretch" "strict"
+        "strike" "string" "stripe" "stroke" "studio" "stuff" "stunt" "subject"
+        "submit" "subway" "suit" "sum" "summit" "super" "supply" "surf"
+        "surface" "surgeon" "surprise" "survey" "suspect" "swallow" "swamp" "swan"
+        "swear" "sweat" "sweater" "swing" "switch" "symbol" "syrup" "tackle"
+        "tail" "tank" "tape" "target" "task" "taste" "tattoo" "tax"
+        "tear" "tease" "temple" "tenant" "tender" "tent" "term" "terror"
+        "text" "theater" "theme" "theory" "thigh" "thread" "threat" "throat"
+        "throne" "thumb" "tide" "tile" "timber" "tissue" "title" "toast"
+        "tobacco" "toe" "toilet" "token" "tomato" "tone" "tool" "torch"
+        "touch" "tough" "towel" "tower" "toy" "trace" "trade" "trail"
+        "trap" "trash" "tray" "treasure" "treat" "trend" "trial" "tribe"
+        "trick" "trophy" "tropical" "trouble" "trumpet" "trunk" "tube" "tune"
+        "tunnel" "twin" "union" "unique" "unit" "update" "upgrade" "upset"
+        "urban" "urge" "usage" "vacuum" "valve" "van" "vapor" "vast"
+        "vault" "velvet" "vendor" "venture" "venue" "verse" "vessel" "veteran"
+        "victim" "video" "view" "villa" "vinegar" "violin" "virus" "vision"
+        "visual" "vital" "vivid" "vocal" "volcano" "volume" "vote" "voyage"
+        "wage" "wagon" "waist" "wallet" "walnut" "wander" "warn" "wash"
+        "waste" "weave" "wheat" "whip" "whisper" "wicked" "widow" "willow"
+        "wing" "wire" "witch" "witness" "wonder" "wool" "worm" "wound"
+        "wrap" "wreck" "wrist" "yard" "yield" "yoga" "zebra" "zero"
+        "zone" "abbey" "acorn" "adapt" "adobe" "affix" "agile" "agony"
+        "aisle" "alert" "algae" "alibi" "alloy" "almond" "aloe" "alpine"
+        "amend" "ample" "amuse" "anchor" "annex" "ant" "anvil" "apex"
+        "apron" "aroma" "aspen" "atlas" "atom" "attic" "audio" "avid"
+        "awake" "axis" "axle" "bagel" "balcony" "bamboo" "banjo" "barn"
+        "basil" "basin" "baton" "beacon" "bead" "beak" "beaver" "beetle"
+        "bison" "blaze" "blimp" "blink" "bliss" "blouse" "blush" "booth"
+        "boulder" "brake" "brisk" "brook" "broom" "buckle" "bud" "bugle"
+        "bulb" "cactus" "cadet" "cage" "camel" "cane" "canoe" "canyon"
+        "cape" "cave" "cedar" "celery" "cello" "cereal" "chapel" "chess"
+        "chick" "chili" "chime" "choir" "chord" "cider" "citrus" "civic"
+        "clam" "click" "cloak" "clover" "clue" "cocoa" "comet" "cord"
+        "cork" "couch" "cougar" "cove" "coyote" "crab" "crane" "crater"
+        "crayon" "creek" "crest" "crisp" "crumb" "crust" "curb" "curl"
+        "cymbal" "dart" "deck" "den" "denim" "depot" "dial" "dice"
+        "dime" "diner" "dingo" "diver" "dock" "doll" "dome" "dough"
+        "dune" "dwarf" "easel" "eclipse" "eel" "elk" "elm" "ember"
+        "emblem" "envoy" "epic" "era" "errand" "ether" "event" "fair"
+        "fawn" "fern" "ferry" "fig" "finch" "flask" "flint" "flock"
+        "flute" "font" "forge" "fort" "fringe" "fudge" "fury" "fuse"
+        "gadget" "gale" "gallon" "garlic" "gauge" "gazelle" "gecko" "gem"
+        "genie" "geyser" "glacier" "glade" "glow" "gong" "gorge" "gospel"
+        "gown" "granite" "gravel" "gravy" "grill" "grove" "gulf" "gull"
+        "gum" "gust" "hall" "harp" "hay" "hazel" "hen" "heron"
+        "hinge" "hippo" "hive" "hood" "hoof" "hose" "hound" "hub"
+        "hug" "hull" "icicle" "igloo" "inch" "inlet" "ivy" "jaw"
+        "jersey" "jet" "jigsaw" "jockey" "juror" "kale" "kayak" "kebab"
+        "kiosk" "kite" "knob" "knot" "lagoon" "lance" "lantern" "larch"
+        "latch" "lava" "ledge" "leopard" "lever" "lilac" "lime" "lizard"
+        "llama" "loaf" "locket" "lodge" "loft" "lotus" "lute" "lyric"
+        "maize" "mantle" "marsh" "mast" "melon" "memo" "mentor" "mesa"
+        "meteor" "mint" "mist" "mitten" "moat" "mole" "monk" "moose"
+        "moss" "moth" "mound" "mug" "mule" "mural" "muse" "mustard"
+        "napkin" "nectar" "nugget" "nylon" "oar" "oasis" "oat" "octave"
+        "omelet" "opal" "otter" "ounce" "oval" "oyster" "pagoda" "panther"
+        "pasta" "paste" "patio" "peak" "pear" "pebble" "pecan" "pedal"
+        "pelican" "perch" "pickle" "picnic" "pier" "pillow" "pinto" "pixel"
+        "plank" "plaza" "plume" "polar" "poodle" "porch" "portal" "poster"
+        "pouch" "prairie" "prism" "prune" "puddle" "puffin" "puma" "pumpkin"
+        "quail" "quake" "quart" "quartz" "quill" "quilt" "quiver" "raccoon"
+        "raft" "raisin" "rake" "ramp" "reef" "reel" "relay" "relic"
+        "remedy" "reptile" "resin" "rhino" "ridge" "ripple" "robe" "robin"
+        "rodeo" "rover" "rudder" "ruler" "runway" "safari" "saga" "sage"
+        "sandal" "satin" "saucer" "scoop" "scroll" "shawl" "shovel" "shrub"
+        "slate" "sled" "sloth" "snail" "sonnet" "spade" "spinach" "spiral"
+        "sprout" "spruce" "squid" "stencil" "stew" "stool" "sunset" "tablet"
+        "taco" "talon" "tango" "tavern" "thimble" "thistle" "thorn" "tin"
+        "toddler" "toffee" "tortoise" "tractor" "tram" "trout" "tuna" "tundra"
+        "turnip" "tutor" "tuxedo" "twig" "umbrella" "urchin" "urn" "vanilla"
+        "vase" "venom" "vest" "vial" "vine" "vinyl" "visor" "vista"
+        "vulture" "wafer" "walrus" "wand" "warden" "wasp" "wax" "weasel"
+        "weaver" "wedge" "weed" "whisk" "whistle" "wombat" "wreath" "wren"
+        "yacht" "yak" "yarn" "yeast" "yogurt" "yolk" "zinc" "zipper"
+        "zoo" "kenneth" "timothy" "ronald" "jeffrey" "gary" "nicholas" "jonathan"
+        "stephen" "larry" "gregory" "frank" "raymond" "dennis" "aaron" "jose"
+        "douglas" "harold" "kyle" "noah" "liam" "lucas" "mary" "patricia"
+        "linda" "barbara" "susan" "karen" "lisa" "nancy" "betty" "margaret"
+        "sandra" "kimberly" "donna" "carol" "dorothy" "deborah" "sharon" "laura"
+        "cynthia" "kathleen" "amy" "shirley" "brenda" "pamela" "helen" "katherine"
+        "christine" "debra" "charlotte" "amelia" "dmitry" "sergey" "andrey" "alexey"
+        "ivan" "nikolay" "vladimir" "mikhail" "pavel" "maxim" "artem" "denis"
+        "anton" "igor" "oleg" "yuri" "roman" "evgeny" "natalia" "tatiana"
+        "anastasia" "ekaterina" "yulia" "daria" "polina" "ksenia" "smith" "johnson"
+        "williams" "brown" "jones" "garcia" "davis" "rodriguez" "martinez" "wilson"
+        "anderson" "moore" "lee" "thompson" "harris" "clark" "lewis" "robinson"
+        "walker" "allen" "wright" "adams" "nelson" "carter" "mitchell" "roberts"
+        "ivanov" "petrov" "sidorov" "smirnov" "kuznetsov" "popov" "volkov" "sokolov"
+        "cody" "cameron" "jake" "connor" "evan" "luke" "isaac" "gabriel"
+        "caleb" "mason" "elijah" "owen" "wyatt" "sebastian" "jayden" "aiden"
+        "grayson" "levi" "jaxon" "julian" "hudson" "lincoln" "landon" "jeremiah"
+        "easton" "colton" "ryder" "eli" "josiah" "adrian" "nolan" "christian"
+        "ian" "jace" "ezra" "cooper" "miles" "axel" "bentley" "dominic"
+        "silas" "greyson" "brody" "declan" "micah" "ryker" "weston" "kai"
+        "parker" "asher" "sawyer" "xavier" "blake" "tristan" "brayden" "bryson"
+        "ayden" "travis" "chad" "derek" "shawn" "sean" "brett" "troy"
+        "marcus" "jesse" "alan" "randy" "philip" "louis" "billy" "bruce"
+        "willie" "ralph" "roy" "eugene" "russell" "bobby" "howard" "carl"
+        "arthur" "albert" "joe" "juan" "terry" "wayne" "lawrence" "jeremy"
+        "keith" "roger" "gerald" "ernest" "craig" "vincent" "curtis" "stanley"
+        "leonard" "dale" "clarence" "earl" "jimmy" "antonio" "danny" "bryan"
+        "tony" "luis" "mike" "todd" "jim" "clifford" "glenn" "neil"
+        "ricky" "fred" "herbert" "jorge" "jay" "norman" "marvin" "miguel"
+        "carlos" "francisco" "manuel" "ricardo" "pedro" "diego" "fernando" "javier"
+        "alejandro" "rafael" "sergio" "andres" "pablo" "hector" "raul" "enrique"
+        "ruben" "eduardo" "roberto" "mateo" "santiago" "addison" "ella" "avery"
+        "sofia" "aubrey" "zoey" "layla" "lillian" "evelyn" "nora" "riley"
+        "ellie" "leah" "audrey" "savannah" "allison" "claire" "skylar" "paisley"
+        "caroline" "genesis" "aaliyah" "kennedy" "kinsley" "maya" "madelyn" "adeline"
+        "alexa" "ariana" "gabriella" "naomi" "alice" "hailey" "eva" "emilia"
+        "quinn" "nevaeh" "piper" "serenity" "everly" "cora" "kaylee" "lydia"
+        "aubree" "arianna" "eliana" "peyton" "melanie" "gianna" "isabelle" "valentina"
+        "stella" "clara" "vivian" "reagan" "mackenzie" "madeline" "brielle" "delilah"
+        "isla" "rylee" "josephine" "liliana" "hadley" "kylie" "emery" "adalynn"
+        "annabelle" "ximena" "brianna" "raelynn" "athena" "leilani" "lyla" "alyssa"
+        "adalyn" "arya" "norah" "khloe" "kayla" "eden" "eleanor" "megan"
+        "tiffany" "brittany" "danielle" "courtney" "kelly" "erin" "erica" "tara"
+        "vanessa" "alicia" "tracy" "wendy" "holly" "kristen" "kristin" "jenna"
+        "jill" "jenny" "gina" "tina" "dana" "diana" "joan" "joyce"
+        "judy" "julie" "janet" "jean" "ann" "anne" "martha" "marie"
+        "frances" "gloria" "teresa" "doris" "sara" "janice" "kathy" "theresa"
+        "beverly" "denise" "tammy" "irene" "jane" "lori" "marilyn" "kathryn"
+        "louise" "sandy" "shannon" "bonnie" "peggy" "connie" "carrie" "annie"
+        "ruth" "virginia" "jacqueline" "judith" "christina" "lois" "phyllis" "norma"
+        "paula" "kim" "rita" "dolores" "sherry" "sylvia" "sue" "kate"
+        "vicki" "lynn" "alexandr" "dmitriy" "sergei" "andrei" "aleksei" "nikolai"
+        "vladislav" "stanislav" "konstantin" "vyacheslav" "valeriy" "valentin" "viktor" "vitaliy"
+        "vasiliy" "gennadiy" "grigoriy" "leonid" "boris" "fedor" "fyodor" "georgiy"
+        "gleb" "kirill" "ilya" "timur" "ruslan" "rustam" "arseniy" "bogdan"
+        "danila" "daniil" "egor" "eduard" "filipp" "lev" "makar" "matvey"
+        "petr" "semen" "stepan" "taras" "timofey" "vadim" "yaroslav" "yakov"
+        "zakhar" "aleksandr" "sasha" "sanya" "shura" "dima" "dimon" "misha"
+        "mishka" "seryozha" "serezha" "andryusha" "lyosha" "alyosha" "kolya" "vova"
+        "volodya" "vanya" "vanyusha" "petya" "pasha" "pashka" "maks" "tyoma"
+        "artyom" "denchik" "zhenya" "evgeniy" "yevgeny" "igorek" "olezhek" "yura"
+        "yurik" "romka" "slava" "vitya" "valera" "tolya" "anatoliy" "kostya"
+        "lyonya" "borya" "fedya" "grisha" "gosha" "zhora" "styopa" "tima"
+        "vlad" "vladik" "stas" "anya" "anyuta" "nastena" "nastenka" "katyusha"
+        "katerina" "mashenka" "manya" "dashenka" "lenochka" "alena" "alyona" "olya"
+        "olechka" "tanechka" "svetik" "natashka" "nata" "ira" "irochka" "ksyusha"
+        "yulya" "yuliya" "liza" "lizok" "elizaveta" "alina" "alisa" "arina"
+        "vera" "veronika" "valya" "galina" "galya" "lyudmila" "lyuda" "nina"
+        "nadezhda" "nadya" "larisa" "lara" "tamara" "zoya" "raisa" "lidiya"
+        "lida" "inna" "inga" "zhanna" "oksana" "kristina" "karina" "milana"
+        "milena" "sofiya" "sonya" "varvara" "varya" "vasilisa" "ulyana" "yana"
+        "snezhana" "viktoriya" "vika" "taisiya" "margarita" "lilia" "lilya" "nelli"
+        "regina" "albina" "alla" "evgeniya" "tatyana" "natalya" "anastasiya" "mariya"
+        "hernandez" "lopez" "gonzalez" "perez" "sanchez" "ramirez" "torres" "flores"
+        "rivera" "gomez" "diaz" "reyes" "morales" "cruz" "ortiz" "gutierrez"
+        "chavez" "ramos" "ruiz" "alvarez" "mendoza" "castillo" "jimenez" "moreno"
+        "romero" "herrera" "medina" "aguilar" "vargas" "castro" "guzman" "fernandez"
+        "munoz" "rojas" "murphy" "richardson" "cox" "ward" "peterson" "gray"
+        "watson" "brooks" "sanders" "bennett" "barnes" "ross" "henderson" "coleman"
+        "jenkins" "perry" "powell" "patterson" "hughes" "washington" "butler" "simmons"
+        "bryant" "hayes" "myers" "hamilton" "graham" "sullivan" "wallace" "woods"
+        "cole" "owens" "reynolds" "ellis" "harrison" "gibson" "mcdonald" "marshall"
+        "wells" "dixon" "stevens" "tucker" "porter" "hicks" "crawford" "boyd"
+        "warren" "dunn" "burns" "gordon" "shaw" "holmes" "robertson" "daniels"
+        "palmer" "mills" "nichols" "ferguson" "hawkins" "payne" "pierce" "matthews"
+        "arnold" "wagner" "willis" "ray" "watkins" "olson" "carroll" "duncan"
+        "snyder" "hart" "cunningham" "bradley" "andrews" "harper" "armstrong" "carpenter"
+        "greene" "elliott" "sims" "peters" "kelley" "franklin" "lawson" "fields"
+        "schmidt" "carr" "wheeler" "chapman" "montgomery" "richards" "williamson" "johnston"
+        "banks" "meyer" "mccoy" "howell" "morrison" "hansen" "garza" "harvey"
+        "burton" "nguyen" "jacobs" "reid" "fuller" "lynch" "dean" "gilbert"
+        "welch" "larson" "frazier" "burke" "hanson" "bowman" "fowler" "brewer"
+        "hoffman" "carlson" "silva" "pearson" "holland" "fleming" "jensen" "byrd"
+        "davidson" "hopkins" "wade" "soto" "walters" "neal" "caldwell" "lowe"
+        "jennings" "barnett" "graves" "horton" "shelton" "barrett" "obrien" "sutton"
+        "mckinney" "rodriquez" "chambers" "holt" "lambert" "fletcher" "watts" "bates"
+        "hale" "rhodes" "pena" "beck" "newman" "haynes" "mcdaniel" "mendez"
+        "vaughn" "parks" "dawson" "norris" "hardy" "steele" "curry" "schultz"
+        "barker" "keller" "chandler" "weber" "walsh" "lyons" "ramsey" "wolfe"
+        "schneider" "mullins" "benson" "bowen" "barber" "cummings" "hines" "baldwin"
+        "griffith" "valdez" "hubbard" "salazar" "reeves" "warner" "stevenson" "burgess"
+        "santos" "tate" "garner" "mann" "mack" "thornton" "mcgee" "delgado"
+        "vega" "glover" "manning" "cohen" "harmon" "rodgers" "robbins" "newton"
+        "blair" "higgins" "ingram" "reese" "strickland" "townsend" "potter" "goodwin"
+        "walton" "rowe" "hampton" "ortega" "patton" "swanson" "francis" "goodman"
+        "maldonado" "yates" "becker" "erickson" "hodges" "rios" "conner" "adkins"
+        "webster" "malone" "hammond" "cobb" "moody" "pope" "floyd" "osborne"
+        "mccarthy" "guerrero" "lindsey" "estrada" "sandoval" "gibbs" "gross" "fitzgerald"
+        "stokes" "doyle" "sherman" "saunders" "colon" "gill" "alvarado" "greer"
+        "padilla" "simon" "waters" "nunez" "ballard" "schwartz" "mcbride" "christensen"
+        "klein" "pratt" "briggs" "parsons" "mclaughlin" "zimmerman" "french" "buchanan"
+        "moran" "copeland" "pittman" "brady" "mccormick" "holloway" "brock" "poole"
+        "wong" "jefferson" "morton" "abbott" "sparks" "norton" "huff" "clayton"
+        "massey" "lloyd" "figueroa" "carson" "bowers" "roberson" "barton" "tran"
+        "harrington" "casey" "boone" "cortez" "clarke" "mathis" "singleton" "wilkins"
+        "cain" "underwood" "hogan" "mckenzie" "collier" "luna" "phelps" "mcguire"
+        "bridges" "wilkerson" "nash" "summers" "atkins" "lebedev" "kozlov" "novikov"
+        "morozov" "solovyov" "vasiliev" "zaytsev" "pavlov" "semenov" "golubev" "vinogradov"
+        "bogdanov" "vorobyov" "fedorov" "mikhailov" "belyaev" "tarasov" "belov" "komarov"
+        "orlov" "kiselev" "makarov" "andreev" "kovalev" "ilyin" "gusev" "titov"
+        "kuzmin" "kudryavtsev" "baranov" "kulikov" "alekseev" "stepanov" "yakovlev" "sorokin"
+        "sergeev" "romanov" "zakharov" "borisov" "korolev" "gerasimov" "ponomarev" "grigoriev"
+        "lazarev" "medvedev" "ershov" "nikitin" "sobolev" "ryabov" "polyakov" "tsvetkov"
+        "danilov" "zhukov" "frolov" "zhuravlev" "nikolaev" "krylov" "maksimov" "osipov"
+        "belousov" "fedotov" "dorofeev" "egorov" "matveev" "bobrov" "dmitriev" "kalinin"
+        "anisimov" "petukhov" "antonov" "timofeev" "nikiforov" "veselov" "filippov" "markov"
+        "bolshakov" "sukhanov" "mironov" "shiryaev" "aleksandrov" "konovalov" "shestakov" "kazakov"
+        "efimov" "denisov" "gromov" "fomin" "davydov" "melnikov" "shcherbakov" "blinov"
+        "kolesnikov" "karpov" "afanasiev" "vlasov" "maslov" "isakov" "tikhonov" "aksenov"
+        "gavrilov" "rodionov" "kotov" "gorbunov" "kudryashov" "bykov" "zuev" "tretyakov"
+        "savelyev" "panov" "rybakov" "suvorov" "abramov" "voronov" "mukhin" "arkhipov"
+        "trofimov" "martynov" "emelyanov" "gorshkov" "chernov" "ovchinnikov" "seleznev" "panfilov"
+        "kopylov" "mikheev" "galkin" "nazarov" "lobanov" "lukin" "belyakov" "potapov"
+        "nekrasov" "khokhlov" "zhdanov" "naumov" "shilov" "voronin" "ermakov" "drozdov"
+        "ignatyev" "savin" "loginov" "safonov" "kapustin" "kirillov" "moiseev" "eliseev"
+        "koshelev" "kostin" "gorbachev" "orekhov" "efremov" "isaev" "evdokimov" "kalashnikov"
+        "kabanov" "noskov" "yudin" "kulagin" "lapin" "prokhorov" "nesterov" "kharitonov"
+        "agafonov" "muravyov" "laptev" "filatov" "ivanova" "petrova" "smirnova" "kuznetsova"
+        "popova" "volkova" "sokolova" "lebedeva" "kozlova" "novikova" "morozova" "parol"
+        "privet" "lyubov" "k.,jdm" "solnce" "solnyshko" "cjkysirj" "kotik" "rjnbr"
+        "zayka" "malysh" "vfksi" "lapochka" "schaste" "cxfcnmt" "mama" "vfvf"
+        "papa" "gfgf" "semya" "ctvmz" "rodina" "hjlbyf" "rossiya" "hjccbz"
+        "moskva" "piter" "gbnth" "kisa" "rbcf" "vfif" "cfif" "lbvf"
+        "dfyz" "vbif" "ktyf" "rfnz" "yfcnz" "nfyz" "jkz" ".kz"
+        "rc.if" "serega" "cthtuf" "djdf" "rjkz" "zenit" "ptybn" "spartak"
+        "cgfhnfr" "dinamo" "lbyfvj" "leto" "ktnj" "zima" "pbvf" "vesna"
+        "dtcyf" "osen" "jctym" "drug" "lheu" "podruga" "gjlheuf" "devushka"
+        "ltdeirf" "krasavica" "rhfcfdbwf" "angelochek" "fyutkjxtr" "medved" "vtldtlm" "volk"
+        "djkr" "kbcf" "koshka" "rjirf" "sobaka" "cj,frf" "pivo" "gbdj"
+        "djlrf" "dengi" "ltymub" "bog" ",ju" "lyubimaya" "k.,bvfz" "lyubimyy"
+        "k.,bvsq" "nebo" "yt,j" "vjht" "ona" "jyf" "oni" "jyb"
+        "eto" "'nj" "chto" "xnj" "kak" "rfr" "tak" "nfr"
+        "vse" "dct" "ego" "tuj" "dlya" "lkz" "bez" ",tp"
+        "pri" "ghb" "pro" "ghj" "cherez" "xthtp" "nad" "yfl"
+        "pod" "gjl" "mezhdu" "vt;le" "vot" "djn" "byl" ",sk"
+        "byt" ",snm" "bylo" ",skj" "byla" ",skf" "byli" ",skb"
+        "est" "tcnm" "ytn" "mozhno" "vj;yj" "nuzhno" "ye;yj" "nado"
+        "yflj" "ochen" "jxtym" "esche" "tot" "uzhe" "e;t" "tolko"
+        "njkmrj" "tozhe" "nj;t" "dazhe" "lf;t" "potom" "gjnjv" "togda"
+        "njulf" "kogda" "rjulf" "esli" "tckb" "chtoby" "xnj,s" "gde"
+        "ult" "kuda" "relf" "zdes" "pltcm" "tam" "nfv" "tut"
+        "nen" "teper" "ntgthm" "seychas" "ctqxfc" "segodnya" "ctujlyz" "zavtra"
+        "pfdnhf" "vchera" "dxthf" "vsegda" "dctulf" "nikogda" "ybrjulf" "inogda"
+        "byjulf" "opyat" "jgznm" "snova" "cyjdf" "srazu" "chfpe" "vmeste"
+        "dvtcnt" "odin" "jlby" "dva" "ldf" "tri" "nhb" "chetyre"
+        "xtnsht" "pyat" "gznm" "shest" "itcnm" "sem" "ctvm" "vosem"
+        "djctvm" "devyat" "ltdznm" "desyat" "ltcznm" "sto" "cnj" "tysyacha"
+        "nsczxf" "pervyy" "gthdsq" "vtoroy" "dnjhjq" "posledniy" "gjcktlybq" "novyy"
+        "yjdsq" "staryy" "cnfhsq" "bolshoy" ",jkmijq" "malenkiy" "vfktymrbq" "horoshiy"
+        "[jhjibq" "plohoy" "gkj[jq" "glavnyy" "ukfdysq" "russkiy" "heccrbq" "belyy"
+        ",tksq" "chernyy" "xthysq" "krasnyy" "rhfcysq" "siniy" "cbybq" "zelenyy"
+        "ptktysq" "zheltyy" ";tknsq" "zolotoy" "pjkjnjq" "serebryanyy" "ctht,hzysq" "vysokiy"
+        "dscjrbq" "nizkiy" "ybprbq" "dlinnyy" "lkbyysq" "korotkiy" "rjhjnrbq" "molodoy"
+        "vjkjljq" "zhivoy" ";bdjq" "silnyy" "cbkmysq" "slabyy" "ckf,sq" "bystryy"
+        ",scnhsq" "tihiy" "nb[bq" "gromkiy" "uhjvrbq" "dobryy" "lj,hsq" "zloy"
+        "pkjq" "umnyy" "evysq" "glupyy" "ukegsq" "krasivyy" "rhfcbdsq" "milyy"
+        "vbksq" "rodnoy" "hjlyjq" "dorogoy" "ljhjujq" "svobodnyy" "cdj,jlysq" "schastlivyy"
+        "cxfcnkbdsq" "veselyy" "dtctksq" "grustnyy" "uhecnysq" "chelovek" "xtkjdtr" "lyudi"
+        "k.lb" "zhizn" ";bpym" "vremya" "dhtvz" "ltym" "noch" "yjxm"
+        "utro" "enhj" "vecher" "dtxth" "ujl" "mesyac" "vtczw" "nedelya"
+        "ytltkz" "chas" "xfc" "minuta" "vbyenf" "dom" "ljv" "gorod"
+        "ujhjl" "strana" "cnhfyf" "mir" "vbh" "zemlya" "ptvkz" "voda"
+        "djlf" "ogon" "jujym" "vozduh" "djple[" "veter" "dtnth" "dozhd"
+        "lj;lm" "sneg" "cytu" "les" "ktc" "gjkt" "reka" "htrf"
+        "ozero" "jpthj" "gora" "ujhf" "kamen" "rfvtym" "derevo" "lthtdj"
+        "cvetok" "wdtnjr" "roza" "hjpf" "trava" "nhfdf" "ptica" "gnbwf"
+        "ryba" "hs,f" "kon" "rjym" "loshad" "kjiflm" "korova" "rjhjdf"
+        "svinya" "cdbymz" "mysh" "vsim" "zayac" "pfzw" "belka" ",tkrf"
+        "ezhik" "t;br" "tigr" "nbuh" "ktd" "slon" "ckjy" "orel"
+        "jhtk" "sokol" "cjrjk" "voron" "djhjy" "golub" "ujke,m" "lebed"
+        "kt,tlm" "drakon" "ruka" "herf" "noga" "yjuf" "golova" "ujkjdf"
+        "glaz" "ukfp" "lico" "kbwj" "serdce" "cthlwt" "dusha" "leif"
+        "slovo" "ckjdj" "delo" "ltkj" "rabota" "hf,jnf" "shkola" "irjkf"
+        "kniga" "rybuf" "stol" "cnjk" "okno" "jryj" "dver" "ldthm"
+        "ulica" "ekbwf" "doroga" "ljhjuf" "mashina" "vfibyf" "poezd" "gjtpl"
+        "samolet" "cfvjktn" "korabl" "rjhf,km" "voyna" "djqyf" "pobeda" "gj,tlf"
+        "sila" "cbkf" "volya" "djkz" "pravda" "ghfdlf" "istina" "bcnbyf"
+        "dthf" "yflt;lf" "svet" "cdtn" "tma" "nmvf" "ogonek" "jujytr"
+        "zvezda" "pdtplf" "zvezdochka" "pdtpljxrf" "keyf" "planeta" "gkfytnf" "kosmos"
+        "rjcvjc" "oblako" "j,kfrj" "raduga" "hfleuf" "mechta" "vtxnf" "skazka"
+        "crfprf" "pesnya" "gtcyz" "muzyka" "vepsrf" "igra" "buhf" "futbol"
+        "aen,jk" "hokkey" "[jrrtq" "cgjhn" "komanda" "rjvfylf" "druzya" "lhepmz"
+        "brat" ",hfn" "sestra" "ctcnhf" "syn" "csy" "doch" "ljxm"
+        "vfnm" "otec" "jntw" "babushka" ",f,eirf" "dedushka" "ltleirf" "zhena"
+        ";tyf" "muzh" "ve;" "rebenok" "ht,tyjr" "deti" "ltnb" "malchik"
+        "vfkmxbr" "devochka" "ltdjxrf" "paren" "gfhtym" "muzhchina" "ve;xbyf" "zhenschina"
+        ";tyobyf" "korol" "rjhjkm" "koroleva" "rjhjktdf" "princ" "ghbyw" "princessa"
+        "ghbywtccf" "wfhm" "geroy" "uthjq" "voin" "djby" "soldat" "cjklfn"
+        "ohotnik" "j[jnybr" "doktor" "ljrnjh" "uchitel" "exbntkm" "cneltyn" "kompyuter"
+        "rjvgm.nth" "bynthytn" "telefon" "ntktajy" "foto" "ajnj" "kino" "rbyj"
+        "televizor" "ntktdbpjh" "novosti" "yjdjcnb" "pismo" "gbcmvj" "imya" "bvz"
+        "familiya" "afvbkbz" "kjuby" "vhod" "d[jl" "sekret" "ctrhtn" "tayna"
+        "nfqyf" "klyuch" "rk.x" "zamok" "pfvjr" "dverca" "ldthwf" "hleb"
+        "[kt," "moloko" "vjkjrj" "syr" "csh" "myaso" "vzcj" "yabloko"
+        "z,kjrj" "vishnya" "dbiyz" "klubnika" "rke,ybrf" "malina" "vfkbyf" "arbuz"
+        "fh,ep" "apelsin" "fgtkmcby" "limon" "kbvjy" "shokolad" "ijrjkfl" "konfeta"
+        "rjyatnf" "sahar" "cf[fh" "med" "vtl" "chay" "xfq" "kofe"
+        "rjat" "vino" "dbyj" "sup" "ceg" "kasha" "rfif" "picca"
+        "gbwwf" "prazdnik" "ghfplybr" "podarok" "gjlfhjr" "novyygod" "yjdsqujl" "rozhdestvo"
+        "hj;ltcndj" "rozhdeniya" "hj;ltybz" "otpusk" "jngecr" "kanikuly" "rfybreks" "radost"
+        "hfljcnm" "gore" "ujht" "bol" ",jkm" "strah" "cnhf[" "gnev"
+        "uytd" "smeh" "cvt[" "ulybka" "eks,rf" "sleza" "cktpf" "poceluy"
+        "gjwtkeq" "obnimayu" "j,ybvf." "lyublyu" "k.,k." "lyubimka" "k.,bvrf" "zaychik"
+        "pfqxbr" "zaychonok" "pfqxjyjr" "kotenok" "kotenka" "rjntymrf" "pupsik" "gegcbr"
+        "malyshka" "vfksirf" "rybka" "hs,rf" "ptichka" "gnbxrf" "lastochka" "kfcnjxrf"
+        "kiska" "rbcrf" "kisulya" "rbcekz" "murka" "vehrf" "barsik" ",fhcbr"
+        "pushok" "geijr" "sharik" "ifhbr" "bobik" ",j,br" "druzhok" "lhe;jr"
+        "ryzhik" "hs;br" "murzik" "vehpbr" "tuzik" "nepbr" "lapa" "kfgf"
+        "lapulya" "kfgekz" "sladkiy" "ckflrbq" "sladkaya" "ckflrfz" "nezhnost" "yt;yjcnm"
+        "laska" "kfcrf" "mechtatel" "vtxnfntkm" "sudba" "celm,f" "udacha" "elfxf"
+        "fortuna" "ajhneyf" "bogatstvo" ",jufncndj" "ljkkfh" "rubl" "he,km" "zoloto"
+        "pjkjnj" "serebro" "ctht,hj" "almaz" "fkvfp" ",hbkkbfyn" "zhemchug" ";tvxeu"
+        "sokrovische" "cjrhjdbot" "klad" "rkfl" "zagadka" "pfuflrf" "chudo" "xelj"
+        "magiya" "vfubz" "volshebstvo" "djkit,cndj" "koldun" "rjkley" "vedma" "dtlmvf"
+        "fyutk" "ltvjy" "chert" "xthn" "dyavol" "lmzdjk" "bes" ",tc"
+        "smert" "cvthnm" "krov" "rhjdm" "ten" "ntym" "prizrak" "ghbphfr"
+        "vampir" "dfvgbh" "zombi" "pjv,b" "monstr" "vjycnh" "chudovische" "xeljdbot"
+        "zver" "pdthm" "hischnik" "[boybr" "pirat" "gbhfn" "razboynik" "hfp,jqybr"
+        ",fylbn" "vor" "djh" "policiya" "gjkbwbz" "miliciya" "vbkbwbz" "armiya"
+        "fhvbz" "flot" "akjn" "nfyr" "pushka" "geirf" "pistolet" "gbcnjktn"
+        "avtomat" "fdnjvfn" "nozh" "yj;" "mech" "vtx" "schit" "obn"
+        "strela" "cnhtkf" "luk" "ker" "kope" "rjgmt" "krepost" "rhtgjcnm"
+        "bashnya" ",fiyz" "stena" "cntyf" "vjcn" "cerkov" "wthrjdm" "hram"
+        "[hfv" "monastyr" "vjyfcnshm" "derevnya" "lthtdyz" "selo" "ctkj" "poselok"
+        "gjctkjr" "stolica" "cnjkbwf" "kray" "rhfq" "oblast" "j,kfcnm" "rayon"
+        "hfqjy" "ploschad" "gkjoflm" "gfhr" "cfl" "ogorod" "jujhjl" "dacha"
+        "lfxf" "kvartira" "rdfhnbhf" "komnata" "rjvyfnf" "kuhnya" "re[yz" "spalnya"
+        "cgfkmyz" "krovat" "rhjdfnm" "divan" "lbdfy" "stul" "cnek" "shkaf"
+        "irfa" "lampa" "kfvgf" "zerkalo" "pthrfkj" "chasy" "xfcs" "ruchka"
+        "hexrf" "karandash" "rfhfylfi" "tetrad" "ntnhflm" "bumaga" ",evfuf" "kraska"
+        "rhfcrf" "kartina" "rfhnbyf" "hudozhnik" "[elj;ybr" "pisatel" "gbcfntkm" "gj'n"
+        "pevec" "gtdtw" "fhnbcn" "akter" "frnth" "balet" ",fktn" "tanec"
+        "nfytw" "teatr" "ntfnh" "koncert" "rjywthn" "cirk" "wbhr" "kloun"
+        "rkjey" "kukla" "rerkf" "myach" "vzx" "velosiped" "dtkjcbgtl" "motocikl"
+        "vjnjwbrk" "avtobus" "fdnj,ec" "taksi" "nfrcb" "metro" "vtnhj" "vokzal"
+        "djrpfk" "aeroport" "f'hjgjhn" "gostinica" "ujcnbybwf" "restoran" "htcnjhfy" "kafe"
+        "rfat" "magazin" "vfufpby" "rynok" "hsyjr" ",fyr" "bolnica" ",jkmybwf"
+        "apteka" "fgntrf" "vrach" "dhfx" "medsestra" "vtlctcnhf" "lekarstvo" "ktrfhcndj"
+        "zdorove" "pljhjdmt" "bolezn" ",jktpym" "cjy" "otdyh" "jnls[" "plyazh"
+        "gkz;" "ostrov" "jcnhjd" "bereg" ",thtu" "volna" "djkyf" "parus"
+        "gfhec" "kapitan" "rfgbnfy" "moryak" "vjhzr" "rybak" "hs,fr" "rybalka"
+        "hs,fkrf" "ohota" "j[jnf" "lyzhi" "ks;b" "konki" "rjymrb" "snegovik"
+        "cytujdbr" "moroz" "vjhjp" "ktl" "holod" "[jkjl" "teplo" "ntgkj"
+        "zhara" ";fhf" "yanvar" "zydfhm" "fevral" "atdhfkm" "mart" "vfhn"
+        "aprel" "fghtkm" "vfq" "iyun" "b.ym" "iyul" "b.km" "avgust"
+        "fduecn" "sentyabr" "ctynz,hm" "oktyabr" "jrnz,hm" "noyabr" "yjz,hm" "dekabr"
+        "ltrf,hm" "ponedelnik" "gjytltkmybr" "vtornik" "dnjhybr" "sreda" "chtlf" "chetverg"
+        "xtndthu" "pyatnica" "gznybwf" "subbota" "ce,,jnf" "voskresene" "djcrhtctymt" "abrikos"
+        "f,hbrjc" "futyn" "adres" "flhtc" "azbuka" "fp,erf" "aist" "fbcn"
+        "ayva" "fqdf" "akula" "frekf" "alleya" "fkktz" "albom" "fkm,jv"
+        "ambar" "fv,fh" "ananas" "fyfyfc" "antenna" "fyntyyf" "fhtyf" "arka"
+        "fhrf" "arhiv" "fh[bd" "astra" "fcnhf" "fnkfc" "babochka" ",f,jxrf"
+        "bagazh" ",fuf;" "badminton" ",flvbynjy" "baza" ",fpf" "balkon" ",fkrjy"
+        "banan" ",fyfy" "banka" ",fyrf" "banya" ",fyz" "baraban" ",fhf,fy"
+        "baran" ",fhfy" "barsuk" ",fhcer" "begemot" ",tutvjn" "benzin" ",typby"
+        "bereza" ",thtpf" "beton" ",tnjy" "biblioteka" ",b,kbjntrf" "bilet" ",bktn"
+        "binokl" ",byjrkm" "biser" ",bcth" "blin" ",kby" "bloknot" ",kjryjn"
+        "blyudo" ",k.lj" "bobr" ",j,h" "bokal" ",jrfk" "boloto" ",jkjnj"
+        "bochka" ",jxrf" "braslet" ",hfcktn" "brevno" ",htdyj" "brov" ",hjdm"
+        "bryuki" ",h.rb" "bublik" ",e,kbr" "budilnik" ",elbkmybr" "buket" ",ertn"
+        "bulka" ",ekrf" ",ecs" "buterbrod" ",enth,hjl" "butylka" ",enskrf" "bufet"
+        ",eatn" "byk" ",sr" "vagon" "dfujy" "vaza" "dfpf" "valenok"
+        "dfktyjr" "vanna" "dfyyf" "varene" "dfhtymt" "vata" "dfnf" "vedro"
+        "dtlhj" "venik" "dtybr" "venok" "dtyjr" "verblyud" "dth,k.l" "verevka"
+        "dthtdrf" "vertolet" "dthnjktn" "vetka" "dtnrf" "vilka" "dbkrf" "vinograd"
+        "dbyjuhfl" "vodopad" "djljgfl" "vorona" "djhjyf" "vorota" "djhjnf" "vostok"
+        "djcnjr" "vulkan" "dekrfy" "vydra" "dslhf" "vyuga" "dm.uf" "gazeta"
+        "ufptnf" "galka" "ufkrf" "galstuk" "ufkcner" "gamak" "ufvfr" "garazh"
+        "ufhf;" "gvozd" "udjplm" "gepard" "utgfhl" "gitara" "ubnfhf" "globus"
+        "ukj,ec" "gnezdo" "uytplj" "gnom" "uyjv" "goroh" "ujhj[" "gost"
+        "ujcnm" "grad" "uhfl" "granit" "uhfybn" "granica" "uhfybwf" "grach"
+        "uhfx" "grib" "uhb," "groza" "uhjpf" "grusha" "uheif" "gubka"
+        "ue,rf" "gus" "uecm" "dvor" "ldjh" "delfin" "ltkmaby" "dzhem"
+        "l;tv" "dolina" "ljkbyf" "doska" "ljcrf" "drevo" "lhtdj" "drozd"
+        "lhjpl" "dub" "le," "dudka" "lelrf" "duplo" "legkj" "dynya"
+        "lsyz" "eger" "tuthm" "ezhevika" "t;tdbrf" "tkm" "enot" "tyjn"
+        "ersh" "thi" "zhaba" ";f,f" "zhar" ";fh" "zhasmin" ";fcvby"
+        "zhelud" ";tkelm" "zherebenok" ";tht,tyjr" "zhilet" ";bktn" "zhiraf" ";bhfa"
+        "zhuk" ";er" "zhuravl" ";ehfdkm" "zhurnal" ";ehyfk" "zabor" "pf,jh"
+        "zavod" "pfdjl" "zakat" "pfrfn" "zvonok" "pdjyjr" "zdanie" "plfybt"
+        "pt,hf" "zerno" "pthyj" "zmeya" "pvtz" "zont" "pjyn" "zubr"
+        "pe,h" "iva" "bdf" "igla" "bukf" "igrushka" "buheirf" "izba"
+        "bp,f" "izyum" "bp.v" "ikra" "brhf" "indyuk" "byl.r" "iney"
+        "bytq" "iskra" "bcrhf" "istoriya" "bcnjhbz" "kaban" "rf,fy" "kabluk"
+        "rf,ker" "kaktus" "rfrnec" "kalendar" "rfktylfhm" "kanal" "rfyfk" "kapusta"
+        "rfgecnf" "kareta" "rfhtnf" "karman" "rfhvfy" "karta" "rfhnf" "katok"
+        "rfnjr" "kashtan" "rfinfy" "kedr" "rtlh" "keks" "rtrc" "kenguru"
+        "rtyuehe" "kefir" "rtabh" "kirpich" "rbhgbx" "kist" "rbcnm" "rbn"
+        "klever" "rktdth" "klen" "rkty" "kover" "rjdth" "kozha" "rj;f"
+        "koza" "rjpf" "koleso" "rjktcj" "kolokol" "rjkjrjk" "kolco" "rjkmwj"
+        "komar" "rjvfh" "kometa" "rjvtnf" "kompas" "rjvgfc" "konvert" "rjydthn"
+        "korzina" "rjhpbyf" "korona" "rjhjyf" "koster" "rjcnth" "kot" "rjn"
+        "krab" "rhf," "kran" "rhfy" "krapiva" "rhfgbdf" "kreslo" "rhtckj"
+        "krokodil" "rhjrjlbk" "krolik" "rhjkbr" "krot" "rhjn" "kruzhka" "rhe;rf"
+        "kuvshin" "rediby" "kukuruza" "rerehepf" "kulon" "rekjy" "kupol" "regjk"
+        "kurica" "rehbwf" "kust" "recn" "lager" "kfuthm" "ladon" "kfljym"
+        "landysh" "kfylsi" "leyka" "ktqrf" "lenta" "ktynf" "lestnica" "ktcnybwf"
+        "kbcn" "lodka" "kjlrf" "lozhka" "kj;rf" "los" "kjcm" "lug"
+        "keu" "ldina" "kmlbyf" "lyagushka" "kzueirf" "magnit" "vfuybn" "mak"
+        "vfr" "mandarin" "vfylfhby" "maska" "vfcrf" "maslo" "vfckj" "matreshka"
+        "vfnhtirf" "machta" "vfxnf" "mel" "vtk" "melnica" "vtkmybwf" "meshok"
+        "vtijr" "mikrofon" "vbrhjajy" "miska" "vbcrf" "molniya" "vjkybz" "molotok"
+        "vjkjnjr" "morkov" "vjhrjdm" "vjnjh" "muka" "verf" "muravey" "vehfdtq"
+        "mylo" "vskj" "nabor" "yf,jh" "narod" "yfhjl" "nasos" "yfcjc"
+        "nevesta" "ytdtcnf" "nektar" "ytrnfh" "nitka" "ybnrf" "yjhf" "nos"
+        "yjc" "nosorog" "yjcjhju" "obruch" "j,hex" "ovrag" "jdhfu" "ovca"
+        "jdwf" "ogurec" "juehtw" "odeyalo" "jltzkj" "okun" "jreym" "olen"
+        "jktym" "omut" "jven" "oreh" "jht[" "osina" "jcbyf" "otryad"
+        "jnhzl" "ochki" "jxrb" "pavlin" "gfdkby" "paket" "gfrtn" "palatka"
+        "gfkfnrf" "palec" "gfktw" "palma" "gfkmvf" "gfylf" "pauk" "gfer"
+        "pashnya" "gfiyz" "peyzazh" "gtqpf;" "penal" "gtyfk" "gtym" "perec"
+        "gthtw" "pero" "gthj" "pesok" "gtcjr" "petuh" "gtne[" "pechene"
+        "gtxtymt" "pila" "gbkf" "pingvin" "gbyudby" "piramida" "gbhfvblf" "pirog"
+        "gbhju" "plamya" "gkfvz" "podkova" "gjlrjdf" "polka" "gjkrf" "polyana"
+        "gjkzyf" "pomidor" "gjvbljh" "popugay" "gjgeufq" "porog" "gjhju" "portfel"
+        "gjhnatkm" "pochta" "gjxnf" "prud" "ghel" "pugovica" "geujdbwf" "gevf"
+        "pustynya" "gecnsyz" "pchela" "gxtkf" "pshenica" "gitybwf" "pyatno" "gznyj"
+        "raketa" "hfrtnf" "rakushka" "hfreirf" "rama" "hfvf" "ranec" "hfytw"
+        "rassvet" "hfccdtn" "rascheska" "hfcxtcrf" "remen" "htvtym" "repa" "htgf"
+        "ris" "hbc" "rog" "hju" "hjzkm" "ruchey" "hextq" "rys"
+        "hscm" "ryukzak" "h.rpfr" "ryad" "hzl" "salat" "cfkfn" "salyut"
+        "cfk.n" "samovar" "cfvjdfh" "sani" "cfyb" "sapog" "cfgju" "saray"
+        "cfhfq" "svecha" "cdtxf" "sever" "ctdth" "seno" "ctyj" "ctnm"
+        "cbhtym" "skala" "crfkf" "skamya" "crfvmz" "skvorec" "crdjhtw" "skripka"
+        "crhbgrf" "sliva" "ckbdf" "snegir" "cytubhm" "sova" "cjdf" "solovey"
+        "cjkjdtq" "sosna" "cjcyf" "sosulka" "cjcekmrf" "stadion" "cnflbjy" "stakan"
+        "cnfrfy" "stroka" "cnhjrf" "sugrob" "ceuhj," "sudno" "celyj" "sunduk"
+        "ceyler" "taburet" "nf,ehtn" "tarelka" "nfhtkrf" "telezhka" "ntkt;rf" "teplica"
+        "ntgkbwf" "tolpa" "njkgf" "topor" "njgjh" "tort" "njhn" "traktor"
+        "nhfrnjh" "tramvay" "nhfvdfq" "tropa" "nhjgf" "truba" "nhe,f" "tulup"
+        "nekeg" "tuman" "nevfy" "tykva" "nsrdf" "tyulen" "n.ktym" "tyulpan"
+        "n.kmgfy" "ugol" "eujk" "eujkm" "udochka" "eljxrf" "uley" "ektq"
+        "ulitka" "ekbnrf" "utka" "enrf" "uho" "e[j" "uyut" "e.n"
+        "fazan" "afpfy" "fary" "afhs" "fasol" "afcjkm" "feya" "atz"
+        "fialka" "abfkrf" "fikus" "abrec" "akfu" "fonar" "ajyfhm" "fontan"
+        "ajynfy" "halat" "[fkfn" "hvost" "[djcn" "hizhina" "[b;byf" "holm"
+        "[jkv" "homyak" "[jvzr" "hor" "[jh" "hrustal" "[hecnfkm" "caplya"
+        "wfgkz" "cep" "wtgm" "cyplenok" "wsgktyjr" "chayka" "xfqrf" "chaynik"
+        "xfqybr" "chashka" "xfirf" "cherepaha" "xthtgf[f" "chernika" "xthybrf" "chernila"
+        "xthybkf" "chesnok" "xtcyjr" "chulan" "xekfy" "shapka" "ifgrf" "shar"
+        "ifh" "sharf" "ifha" "shahmaty" "if[vfns" "shashki" "ifirb" "sherst"
+        "ithcnm" "shishka" "ibirf" "shmel" "ivtkm" "shuba" "ie,f" "shum"
+        "iev" "schegol" "otujk" "schenok" "otyjr" "schetka" "otnrf" "schuka"
+        "oerf" "ekran" "'rhfy" "eskimo" "'crbvj" "etazh" "'nf;" "eho"
+        "'[j" "yubka" ".,rf" "yug" "yula" ".kf" "yunga" ".yuf"
+        "yagoda" "zujlf" "yakor" "zrjhm" "yama" "zvf" "yastreb" "zcnht,"
+        "yascherica" "zothbwf" "yaschik" "zobr" "lubov" "zaika" "schastie" "ljubimaya"
+        "ljubimiy";
+
+    const StrengthDictionary::Slot SLOTS[SLOT_COUNT] = {
+        {20252, 2109, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {32944, 230, 6, 3}, {1378, 178, 6, 1}, {0, 0, 0, 0},
+        {10500, 71, 5, 1}, {0, 0, 0, 0}, {17635, 1590, 6, 1}, {29332, 1107, 4, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {11707, 447, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {17294, 1528, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {4816, 719, 5, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {9097, 1387, 5, 0},
+        {18509, 1759, 7, 1}, {35492, 457, 7, 3}, {0, 0, 0, 0}, {24044, 96, 7, 2},
+        {0, 0, 0, 0}, {6032, 922, 6, 0}, {24657, 232, 5, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {33337, 268, 7, 3}, {0, 0, 0, 0},
+        {31822, 127, 6, 3}, {34012, 328, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {39132, 789, 6, 3}, {17385, 1546, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {12979, 709, 4, 1}, {0, 0, 0, 0},
+        {25123, 325, 6, 2}, {0, 0, 0, 0}, {28544, 971, 8, 2}, {0, 0, 0, 0},
+        {882, 135, 6, 0}, {15622, 1222, 6, 1}, {37633, 647, 6, 3}, {38449, 726, 7, 3},
+        {37932, 676, 5, 3}, {5047, 289, 6, 1}, {9297, 1417, 7, 0}, {14662, 1052, 5, 1},
+        {0, 0, 0, 0}, {32294, 163, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {3477, 510, 9, 0}, {7965, 1209, 6, 0}, {2814, 413, 6, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {29200, 1085, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {2749, 266, 4, 1}, {8461, 1282, 7, 0}, {22599, 2587, 4, 1},
+        {32008, 141, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {7753, 1177, 7, 0}, {10272, 12, 4, 1}, {24697, 240, 7, 2}, {40135, 880, 5, 3},
+        {1253, 193, 7, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {31033, 42, 7, 3}, {0, 0, 0, 0}, {13733, 891, 6, 1},
+        {0, 0, 0, 0}, {38169, 699, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {9344, 1424, 4, 0}, {31254, 64, 3, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {36124, 512, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {28009, 873, 8, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {592, 92, 7, 0}, {7710, 1172, 10, 0}, {8656, 23, 5, 2},
+        {8673, 1312, 6, 0}, {11367, 388, 3, 1}, {31441, 89, 6, 3}, {37765, 661, 3, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {5338, 800, 5, 0}, {22851, 2652, 4, 1}, {38744, 752, 3, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {13513, 840, 6, 1}, {16602, 1406, 5, 1}, {0, 0, 0, 0},
+        {28212, 909, 6, 2}, {35738, 479, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {40680, 932, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {8638, 1306, 7, 0},
+        {30894, 21, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {5618, 847, 5, 0},
+        {31040, 42, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {794, 122, 6, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {22727, 2623, 4, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {4522, 242, 5, 1}, {8961, 416, 5, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {20696, 2195, 6, 1}, {2883, 422, 10, 0},
+        {6006, 916, 6, 0}, {0, 0, 0, 0}, {32301, 164, 9, 3}, {15112, 1140, 4, 1},
+        {24604, 222, 7, 2}, {26404, 213, 3, 3}, {22293, 2518, 4, 1}, {28572, 975, 6, 2},
+        {37, 6, 5, 0}, {16398, 1366, 5, 1}, {39468, 819, 5, 3}, {0, 0, 0, 0},
+        {4703, 207, 3, 1}, {0, 0, 0, 0}, {8924, 1359, 7, 0}, {0, 0, 0, 0},
+        {9361, 1428, 5, 0}, {24490, 200, 4, 2}, {0, 0, 0, 0}, {1129, 173, 7, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {30886, 19, 4, 3}, {0, 0, 0, 0},
+        {21874, 2426, 5, 1}, {40570, 922, 5, 3}, {11391, 393, 5, 1}, {0, 0, 0, 0},
+        {13890, 925, 5, 1}, {0, 0, 0, 0}, {7491, 1141, 6, 0}, {18997, 1856, 5, 1},
+        {20103, 2076, 6, 1}, {23939, 67, 4, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {38537, 733, 8, 3}, {39247, 800, 5, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {23510, 2786, 6, 1},
+        {39975, 867, 5, 3}, {6877, 1036, 6, 0}, {27114, 712, 8, 2}, {38045, 689, 8, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {27728, 820, 4, 2}, {31996, 140, 5, 3},
+        {18826, 1819, 6, 1}, {5563, 838, 7, 0}, {34610, 379, 8, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {6785, 310, 7, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {14140, 968, 7, 1}, {27827, 842, 6, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {4041, 597, 7, 0}, {1987, 299, 6, 0}, {11396, 394, 6, 1}, {0, 0, 0, 0},
+        {14808, 1085, 5, 1}, {15544, 1208, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {15502, 1202, 7, 1}, {0, 0, 0, 0}, {32622, 196, 4, 3}, {10825, 155, 7, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {9951, 1514, 10, 0},
+        {22223, 2501, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {28980, 1046, 7, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {10729, 134, 4, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {8112, 1233, 6, 0}, {17646, 1593, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {27833, 843, 6, 2}, {25181, 338, 6, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {31288, 70, 3, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {3571, 523, 8, 0},
+        {0, 0, 0, 0}, {22695, 430, 3, 2}, {0, 0, 0, 0}, {8835, 1342, 6, 0},
+        {11749, 455, 3, 1}, {0, 0, 0, 0}, {13917, 930, 4, 1}, {13360, 785, 4, 1},
+        {2791, 218, 5, 1}, {36664, 561, 8, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {258, 39, 6, 0}, {3511, 515, 6, 0}, {36690, 563, 9, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {27031, 698, 4, 2}, {12353, 581, 4, 1},
+        {33774, 306, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {17561, 1578, 8, 1}, {5078, 762, 9, 0},
+        {11999, 507, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {32144, 151, 6, 3}, {18652, 1789, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {35834, 487, 7, 3}, {0, 0, 0, 0}, {1485, 230, 7, 0},
+        {37946, 678, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {4935, 738, 7, 0}, {32378, 168, 7, 3},
+        {32473, 179, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {16208, 1325, 6, 1},
+        {20349, 2126, 6, 1}, {1961, 296, 7, 0}, {0, 0, 0, 0}, {18186, 1695, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {5792, 880, 7, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {1892, 287, 8, 0}, {14365, 1000, 7, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {29240, 1092, 8, 2},
+        {22244, 2506, 5, 1}, {0, 0, 0, 0}, {14703, 1060, 6, 1}, {0, 0, 0, 0},
+        {10938, 251, 6, 1}, {20376, 2131, 6, 1}, {23592, 2801, 4, 1}, {0, 0, 0, 0},
+        {20237, 2105, 4, 1}, {0, 0, 0, 0}, {29663, 1155, 7, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {7575, 1154, 6, 0}, {0, 0, 0, 0}, {6315, 964, 11, 0},
+        {0, 0, 0, 0}, {10819, 154, 6, 1}, {34491, 368, 6, 3}, {23803, 2846, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {13279, 765, 6, 1}, {23296, 2745, 5, 1},
+        {7193, 1090, 5, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {6995, 1052, 7, 0},
+        {0, 0, 0, 0}, {18916, 1839, 6, 1}, {0, 0, 0, 0}, {20161, 2087, 5, 1},
+        {33397, 274, 4, 3}, {37878, 671, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {4117, 212, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {20893, 2231, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {12983, 710, 5, 1}, {0, 0, 0, 0}, {8038, 1221, 6, 0}, {10806, 151, 7, 1},
+        {11050, 58, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {19185, 1893, 6, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {22034, 2460, 5, 1}, {0, 0, 0, 0},
+        {19448, 1948, 3, 1}, {26207, 549, 7, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {31659, 111, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {5804, 835, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {1051, 161, 7, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {32275, 162, 6, 3}, {0, 0, 0, 0}, {25597, 422, 9, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {34457, 365, 5, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {24723, 244, 5, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {36998, 589, 5, 3}, {9988, 1519, 7, 0},
+        {20191, 837, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {9366, 1429, 5, 0}, {9739, 1483, 9, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {19334, 1925, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {1334, 206, 6, 0}, {24001, 83, 8, 2}, {28802, 1016, 7, 2},
+        {33619, 293, 4, 3}, {40253, 893, 5, 3}, {0, 0, 0, 0}, {39925, 863, 7, 3},
+        {0, 0, 0, 0}, {8631, 1305, 7, 0}, {20868, 2226, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {31499, 95, 4, 3}, {217, 33, 6, 0}, {0, 0, 0, 0},
+        {23412, 2768, 6, 1}, {24592, 220, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {27867, 849, 6, 2}, {17034, 1485, 7, 1},
+        {2144, 318, 10, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {14115, 964, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {27747, 824, 6, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {1760, 270, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {30594, 1282, 10, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {27421, 761, 5, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {33308, 265, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {8328, 1262, 7, 0}, {11556, 417, 8, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {2768, 406, 6, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {33569, 288, 8, 3}, {39882, 859, 4, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {15927, 1276, 8, 1}, {29699, 1160, 9, 2},
+        {32600, 193, 4, 3}, {23074, 2701, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {14988, 1116, 4, 1}, {28527, 967, 6, 2}, {0, 0, 0, 0},
+        {16181, 1319, 5, 1}, {22159, 2486, 6, 1}, {0, 0, 0, 0}, {13346, 782, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {39509, 823, 7, 3}, {21324, 2313, 4, 1},
+        {23677, 2820, 5, 1}, {34774, 392, 9, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {29541, 1137, 5, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {20943, 2239, 7, 1}, {0, 0, 0, 0}, {38531, 732, 6, 3}, {31398, 84, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {10633, 103, 4, 1}, {11443, 402, 6, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {11102, 336, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {14761, 1074, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {967, 148, 6, 0},
+        {0, 0, 0, 0}, {24734, 246, 5, 2}, {29656, 1154, 7, 2}, {38200, 702, 4, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {10241, 3, 3, 1}, {7509, 1144, 6, 0},
+        {30118, 1216, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {27873, 850, 4, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {13663, 876, 4, 1},
+        {13427, 802, 4, 1}, {28379, 937, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {16161, 1315, 5, 1}, {14105, 961, 5, 1},
+        {13667, 877, 4, 1}, {12370, 585, 5, 1}, {25005, 301, 7, 2}, {28927, 1038, 7, 2},
+        {36712, 564, 4, 3}, {0, 0, 0, 0}, {15509, 1203, 7, 1}, {33491, 283, 8, 3},
+        {4234, 625, 9, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {12266, 562, 5, 1}, {14688, 1058, 7, 1},
+        {19895, 2037, 8, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {39548, 826, 5, 3}, {20520, 852, 5, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {28179, 904, 7, 2}, {37400, 624, 7, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {27633, 804, 8, 2}, {0, 0, 0, 0}, {429, 66, 6, 0},
+        {7730, 1174, 6, 0}, {0, 0, 0, 0}, {33826, 311, 6, 3}, {3037, 84, 4, 1},
+        {4623, 686, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {1850, 281, 9, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {19435, 1946, 6, 1}, {5491, 826, 7, 0},
+        {37775, 662, 6, 3}, {25738, 452, 5, 2}, {37714, 655, 5, 3}, {16496, 1386, 3, 1},
+        {23781, 2841, 3, 1}, {25882, 487, 4, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {35067, 418, 9, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {15053, 1129, 5, 1}, {6913, 1041, 6, 0}, {12375, 586, 4, 1},
+        {33672, 297, 7, 3}, {31337, 76, 3, 3}, {38296, 712, 4, 3}, {39871, 858, 7, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {38922, 768, 7, 3}, {1091, 167, 6, 0},
+        {1290, 199, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {23215, 822, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {1907, 289, 8, 0}, {0, 0, 0, 0}, {24617, 224, 8, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {36813, 573, 6, 3}, {33561, 288, 8, 3}, {25335, 374, 6, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {13704, 885, 4, 1}, {1451, 136, 7, 2},
+        {18105, 1678, 4, 1}, {4580, 678, 5, 0}, {20479, 2150, 6, 1}, {32523, 184, 3, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {10542, 81, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {4003, 16, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {11248, 360, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {21678, 2384, 5, 1}, {0, 0, 0, 0}, {31933, 135, 7, 3}, {0, 0, 0, 0},
+        {30755, 5, 8, 3}, {20839, 2221, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {5589, 842, 7, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {7426, 1130, 4, 0}, {7911, 1200, 6, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {27394, 757, 6, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {2622, 388, 8, 0}, {18292, 1715, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {22860, 2654, 5, 1},
+        {0, 0, 0, 0}, {20035, 2064, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {5125, 769, 7, 0},
+        {20205, 2098, 4, 1}, {30954, 34, 5, 3}, {34429, 363, 6, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {25035, 306, 5, 2}, {22675, 2608, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {4729, 208, 4, 1}, {6530, 992, 8, 0}, {0, 0, 0, 0},
+        {39241, 799, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {12474, 606, 8, 1}, {0, 0, 0, 0}, {34817, 395, 4, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {23138, 2713, 5, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {29194, 1084, 6, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {10803, 150, 3, 1}, {29115, 1068, 6, 2}, {12865, 681, 8, 1},
+        {34508, 370, 6, 3}, {6237, 954, 7, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {17535, 1573, 5, 1}, {0, 0, 0, 0}, {933, 143, 6, 0}, {0, 0, 0, 0},
+        {10252, 6, 3, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {20781, 2211, 5, 1}, {36520, 546, 5, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {5645, 852, 4, 0}, {18125, 1682, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {17557, 1577, 4, 1}, {0, 0, 0, 0}, {2001, 301, 8, 0}, {28222, 911, 8, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {15761, 1246, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {23340, 2753, 4, 1},
+        {16408, 1368, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {25565, 417, 9, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {13658, 875, 5, 1}, {26433, 586, 5, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {973, 149, 7, 0}, {9644, 1469, 5, 0}, {17158, 1503, 7, 1},
+        {28218, 910, 4, 2}, {20202, 2097, 3, 1}, {25440, 391, 9, 2}, {39313, 807, 4, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {7253, 1101, 4, 0},
+        {3598, 527, 4, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {4629, 687, 5, 0}, {5219, 784, 6, 0}, {7118, 1074, 5, 0}, {24912, 281, 6, 2},
+        {32761, 210, 5, 3}, {35378, 447, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {8022, 1218, 4, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {27551, 787, 10, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {35363, 445, 7, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {739, 114, 6, 0},
+        {3858, 569, 7, 0}, {0, 0, 0, 0}, {18619, 1783, 4, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {17369, 1542, 5, 1}, {0, 0, 0, 0}, {37463, 630, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {11675, 438, 3, 1}, {10248, 5, 4, 1},
+        {17544, 1575, 7, 1}, {31305, 72, 3, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {6087, 930, 7, 0}, {22268, 2512, 4, 1}, {23973, 48, 4, 3}, {19680, 1995, 7, 1},
+        {6624, 1002, 10, 0}, {12182, 543, 4, 1}, {0, 0, 0, 0}, {10524, 77, 5, 1},
+        {14570, 1035, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {17991, 1657, 4, 1},
+        {18174, 1692, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {12367, 584, 3, 1},
+        {15917, 1274, 5, 1}, {22754, 2631, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {15892, 1269, 7, 1}, {29142, 1072, 7, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {18221, 1701, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {27214, 728, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {3002, 265, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {4243, 626, 9, 0}, {6758, 1021, 6, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {8343, 1264, 9, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {12452, 602, 6, 1}, {32930, 229, 4, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {28674, 995, 7, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {16166, 1316, 5, 1}, {0, 0, 0, 0}, {39654, 836, 3, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {18369, 1730, 7, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {16839, 1448, 7, 1},
+        {21423, 2335, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {24959, 291, 6, 2},
+        {0, 0, 0, 0}, {22, 4, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {7326, 1114, 7, 0}, {17053, 1488, 7, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {21222, 2294, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {28664, 993, 4, 2}, {28724, 1003, 6, 2}, {31229, 60, 3, 3}, {30009, 1201, 9, 2},
+        {15922, 1275, 5, 1}, {36490, 543, 11, 3}, {0, 0, 0, 0}, {12431, 598, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {19352, 766, 5, 3}, {0, 0, 0, 0},
+        {13957, 940, 6, 1}, {0, 0, 0, 0}, {3714, 547, 9, 0}, {0, 0, 0, 0},
+        {33517, 285, 9, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {12313, 572, 4, 1}, {25538, 412, 6, 2},
+        {12036, 514, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {22722, 2622, 5, 1},
+        {12606, 632, 6, 1}, {21286, 2307, 5, 1}, {650, 100, 6, 0}, {28256, 918, 8, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {38121, 695, 7, 3}, {15248, 1165, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {14219, 978, 8, 1}, {21328, 2314, 4, 1},
+        {31685, 113, 6, 3}, {37855, 669, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {18820, 1818, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {17551, 1576, 6, 1}, {40301, 898, 5, 3}, {17681, 1600, 5, 1}, {0, 0, 0, 0},
+        {31340, 77, 3, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {9134, 1394, 4, 0}, {1492, 231, 6, 0},
+        {11360, 387, 7, 1}, {10546, 82, 4, 1}, {31371, 81, 3, 3}, {0, 0, 0, 0},
+        {32920, 228, 5, 3}, {0, 0, 0, 0}, {35861, 490, 6, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {8952, 665, 5, 2}, {13638, 871, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {28442, 949, 5, 2},
+        {7238, 1098, 4, 0}, {21395, 2329, 5, 1}, {22956, 2676, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {16962, 1472, 6, 1}, {16914, 1463, 6, 1}, {36104, 510, 5, 3},
+        {0, 0, 0, 0}, {5262, 474, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {38375, 719, 7, 3}, {755, 46, 7, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {16029, 1292, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {32838, 219, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {11662, 435, 5, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {24443, 189, 6, 2}, {0, 0, 0, 0}, {39409, 815, 7, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {28264, 919, 4, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {21338, 2318, 4, 1},
+        {10455, 58, 3, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {35535, 461, 4, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {22621, 2595, 5, 1}, {0, 0, 0, 0}, {19650, 1987, 4, 1},
+        {27374, 754, 7, 2}, {37942, 677, 4, 3}, {39000, 775, 5, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {3990, 588, 7, 0}, {37999, 684, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {37596, 643, 3, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {7893, 1197, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {20645, 2185, 6, 1}, {10330, 27, 4, 1}, {0, 0, 0, 0}, {16973, 1474, 7, 1},
+        {1184, 182, 7, 0}, {2183, 323, 8, 0}, {26559, 607, 7, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {16428, 1372, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {22000, 2451, 5, 1}, {13743, 893, 9, 1}, {1498, 2, 6, 3}, {12686, 647, 5, 1},
+        {38643, 742, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {13561, 854, 5, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {16897, 1460, 6, 1},
+        {0, 0, 0, 0}, {31216, 58, 4, 3}, {13816, 909, 5, 1}, {27877, 851, 10, 2},
+        {39306, 806, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {21408, 2332, 4, 1},
+        {14957, 1110, 7, 1}, {39939, 864, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {40481, 915, 9, 3}, {0, 0, 0, 0}, {26825, 659, 5, 2}, {0, 0, 0, 0},
+        {26488, 595, 5, 2}, {22354, 2533, 3, 1}, {29741, 1165, 6, 2}, {38076, 691, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {18354, 1727, 4, 1}, {0, 0, 0, 0}, {17444, 1557, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {3836, 565, 4, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {10516, 75, 4, 1}, {10618, 100, 5, 1},
+        {0, 0, 0, 0}, {17584, 1581, 4, 1}, {11054, 326, 4, 1}, {34524, 371, 5, 3},
+        {16662, 1417, 5, 1}, {112, 18, 6, 0}, {12387, 589, 4, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {4299, 634, 8, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {19208, 1899, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {21583, 2364, 4, 1}, {0, 0, 0, 0},
+        {17719, 1609, 5, 1}, {25685, 440, 6, 2}, {18572, 1773, 5, 1}, {34113, 338, 7, 3},
+        {0, 0, 0, 0}, {15243, 1164, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {5062, 760, 7, 0}, {5713, 866, 6, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {9779, 1488, 6, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {4085, 219, 5, 1}, {14323, 993, 9, 1}, {14432, 1009, 7, 1},
+        {39454, 818, 8, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {15772, 1248, 3, 1},
+        {7214, 1094, 7, 0}, {17651, 1594, 5, 1}, {28370, 935, 5, 2}, {2743, 402, 6, 0},
+        {22506, 2568, 7, 1}, {39396, 814, 7, 3}, {40212, 888, 4, 3}, {33248, 259, 6, 3},
+        {0, 0, 0, 0}, {10862, 162, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {20758, 2206, 4, 1}, {11921, 492, 4, 1}, {2373, 354, 5, 0}, {4821, 720, 9, 0},
+        {40692, 933, 6, 3}, {40748, 939, 3, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {12004, 508, 7, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {21055, 2261, 6, 1}, {35384, 447, 7, 3}, {0, 0, 0, 0},
+        {504, 78, 6, 0}, {0, 0, 0, 0}, {10356, 34, 4, 1}, {0, 0, 0, 0},
+        {19247, 1907, 5, 1}, {22701, 2618, 6, 1}, {0, 0, 0, 0}, {3790, 558, 10, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {6001, 915, 5, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {13981, 944, 9, 1}, {3595, 526, 3, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {37650, 648, 5, 3}, {0, 0, 0, 0}, {2938, 429, 6, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {24894, 278, 6, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {6072, 928, 7, 0}, {0, 0, 0, 0}, {15538, 1207, 6, 1},
+        {25397, 384, 7, 2}, {0, 0, 0, 0}, {25691, 441, 7, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {6741, 1019, 9, 0},
+        {7720, 1173, 10, 0}, {30763, 6, 5, 3}, {31323, 74, 5, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {7242, 1099, 4, 0},
+        {12086, 523, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {37752, 660, 5, 3},
+        {28533, 969, 5, 2}, {18086, 1675, 7, 1}, {10668, 114, 5, 1}, {31300, 71, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {25236, 348, 5, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {6792, 1026, 9, 0},
+        {9055, 723, 8, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {36515, 545, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {10660, 112, 5, 1}, {26809, 656, 8, 2}, {19424, 1944, 6, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {24716, 243, 7, 2}, {27985, 870, 7, 2},
+        {13342, 780, 4, 1}, {25895, 490, 5, 2}, {0, 0, 0, 0}, {1353, 209, 6, 0},
+        {12468, 605, 6, 1}, {2161, 320, 7, 0}, {25846, 480, 7, 2}, {0, 0, 0, 0},
+        {17351, 1539, 5, 1}, {19490, 1957, 5, 1}, {18052, 1669, 5, 1}, {28495, 962, 5, 2},
+        {18429, 1742, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {9579, 1460, 9, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {8305, 1259, 7, 0}, {15909, 1273, 8, 1},
+        {24430, 187, 7, 2}, {28789, 1014, 6, 2}, {29747, 1166, 7, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {13439, 805, 5, 1}, {34452, 365, 5, 3},
+        {31020, 40, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {29078, 1063, 5, 2}, {17791, 1621, 8, 1},
+        {40429, 911, 8, 3}, {0, 0, 0, 0}, {8828, 1341, 7, 0}, {34255, 350, 6, 3},
+        {0, 0, 0, 0}, {4278, 631, 7, 0}, {37984, 682, 7, 3}, {0, 0, 0, 0},
+        {26131, 534, 3, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {24340, 163, 8, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {20411, 2137, 7, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {38065, 690, 5, 3}, {15862, 1263, 9, 1},
+        {18470, 1751, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {3116, 276, 6, 1}, {18383, 1733, 5, 1},
+        {0, 0, 0, 0}, {16376, 1362, 5, 1}, {14964, 991, 6, 2}, {25975, 506, 7, 2},
+        {32423, 173, 4, 3}, {17641, 1592, 5, 1}, {24693, 239, 4, 2}, {34529, 372, 7, 3},
+        {22919, 2667, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {10184, 1551, 5, 0},
+        {27406, 759, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {9262, 1412, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {9718, 1480, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {26450, 589, 8, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {23875, 43, 7, 2}, {0, 0, 0, 0}, {3015, 441, 5, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {32492, 181, 3, 3},
+        {0, 0, 0, 0}, {7783, 1181, 6, 0}, {21790, 2408, 5, 1}, {24728, 245, 6, 2},
+        {31718, 117, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {3352, 494, 8, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {11761, 458, 3, 1}, {5520, 831, 5, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {19473, 1954, 7, 1}, {28681, 996, 5, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {39878, 859, 4, 3}, {36530, 547, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {4955, 741, 7, 0}, {16156, 1314, 5, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {19745, 2008, 4, 1}, {0, 0, 0, 0},
+        {6564, 996, 10, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {20993, 2248, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {13416, 797, 4, 1}, {0, 0, 0, 0},
+        {37263, 613, 5, 3}, {25349, 376, 7, 2}, {18836, 1821, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {38882, 764, 7, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {5349, 258, 7, 1}, {39731, 844, 7, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {20640, 2184, 5, 1}, {37655, 649, 5, 3}, {0, 0, 0, 0},
+        {18401, 1737, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {28160, 901, 6, 2}, {0, 0, 0, 0},
+        {22855, 2653, 5, 1}, {10353, 33, 3, 1}, {30044, 1206, 5, 2}, {0, 0, 0, 0},
+        {31177, 55, 9, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {38664, 744, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {37439, 628, 6, 3}, {24380, 174, 8, 2}, {4424, 653, 5, 0}, {25135, 330, 6, 2},
+        {0, 0, 0, 0}, {6980, 1050, 7, 0}, {0, 0, 0, 0}, {33800, 308, 7, 3},
+        {35235, 434, 5, 3}, {12739, 657, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {13263, 761, 3, 1}, {0, 0, 0, 0}, {23571, 2797, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {7170, 1085, 4, 0}, {0, 0, 0, 0}, {21857, 2422, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {11633, 430, 7, 1},
+        {0, 0, 0, 0}, {9877, 1503, 10, 0}, {31728, 118, 4, 3}, {14653, 1050, 4, 1},
+        {1719, 264, 6, 0}, {35085, 419, 6, 3}, {28987, 1047, 8, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {11681, 440, 3, 1},
+        {729, 38, 6, 2}, {5898, 185, 5, 1}, {15657, 1228, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {2274, 335, 4, 0}, {39683, 840, 7, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {36426, 539, 5, 3}, {0, 0, 0, 0}, {14414, 1007, 10, 1}, {15163, 1149, 4, 1},
+        {20155, 2086, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {25434, 390, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {17374, 1544, 5, 1}, {25156, 333, 7, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {22526, 2572, 6, 1}, {5179, 777, 4, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {33357, 269, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {15693, 1235, 4, 1},
+        {33792, 308, 8, 3}, {0, 0, 0, 0}, {19960, 2048, 4, 1}, {20582, 2172, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {30919, 27, 4, 3}, {0, 0, 0, 0},
+        {26173, 544, 8, 2}, {27190, 725, 7, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {35703, 476, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {15576, 1214, 4, 1},
+        {23018, 2688, 4, 1}, {11449, 403, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {38609, 739, 6, 3}, {15366, 1184, 5, 1}, {28252, 917, 4, 2}, {28283, 922, 6, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {21167, 2283, 7, 1}, {12255, 560, 4, 1}, {27172, 721, 6, 2}, {0, 0, 0, 0},
+        {15747, 1244, 7, 1}, {14386, 1003, 6, 1}, {13548, 851, 3, 1}, {0, 0, 0, 0},
+        {4886, 489, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {4698, 170, 5, 2}, {0, 0, 0, 0},
+        {25219, 344, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {7849, 1190, 6, 0},
+        {30230, 1232, 7, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {11216, 355, 7, 1},
+        {0, 0, 0, 0}, {37133, 602, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {33587, 290, 9, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {37433, 627, 6, 3}, {34214, 345, 4, 3}, {0, 0, 0, 0},
+        {40190, 885, 4, 3}, {0, 0, 0, 0}, {38483, 728, 8, 3}, {0, 0, 0, 0},
+        {20635, 2183, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {22521, 2571, 5, 1},
+        {0, 0, 0, 0}, {17509, 1568, 7, 1}, {21312, 2311, 7, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {39799, 852, 6, 3}, {0, 0, 0, 0},
+        {36384, 536, 7, 3}, {22442, 2554, 5, 1}, {31691, 114, 4, 3}, {15697, 1236, 7, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {23319, 2749, 5, 1}, {0, 0, 0, 0},
+        {24551, 213, 5, 2}, {33444, 278, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {36982, 588, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {35995, 501, 9, 3},
+        {24750, 249, 3, 2}, {11297, 375, 5, 1}, {18658, 1790, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {3517, 516, 10, 0},
+        {25368, 380, 7, 2}, {9181, 1401, 9, 0}, {20355, 2127, 4, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {40103, 877, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {7144, 1079, 5, 0},
+        {1420, 220, 5, 0}, {0, 0, 0, 0}, {38445, 725, 4, 3}, {19158, 1888, 6, 1},
+        {21739, 2397, 5, 1}, {2802, 411, 6, 0}, {0, 0, 0, 0}, {23407, 2767, 5, 1},
+        {26114, 530, 7, 2}, {30132, 1218, 7, 2}, {39648, 835, 3, 3}, {0, 0, 0, 0},
+        {35038, 415, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {5601, 844, 6, 0}, {12801, 669, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {6099, 932, 6, 0}, {35287, 439, 7, 3}, {7044, 1060, 5, 0},
+        {24463, 192, 9, 2}, {35931, 495, 7, 3}, {0, 0, 0, 0}, {32630, 197, 5, 3},
+        {3876, 572, 8, 0}, {0, 0, 0, 0}, {16533, 1393, 5, 1}, {36031, 503, 7, 3},
+        {11117, 339, 7, 1}, {0, 0, 0, 0}, {10110, 1538, 7, 0}, {7743, 1176, 10, 0},
+        {32590, 191, 4, 3}, {0, 0, 0, 0}, {8694, 54, 4, 2}, {28730, 1004, 5, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {9659, 1080, 5, 2}, {0, 0, 0, 0},
+        {26463, 591, 6, 2}, {0, 0, 0, 0}, {33874, 316, 4, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {21486, 2346, 6, 1}, {39275, 803, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {5028, 292, 8, 1}, {11278, 372, 7, 1},
+        {33543, 286, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {28425, 946, 5, 2}, {25914, 494, 4, 2},
+        {0, 0, 0, 0}, {8417, 113, 6, 2}, {22795, 2640, 7, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {39810, 853, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {38128, 695, 7, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {6661, 1006, 8, 0},
+        {22978, 2680, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {38806, 757, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {23699, 2825, 5, 1}, {32701, 204, 3, 3},
+        {0, 0, 0, 0}, {33191, 254, 9, 3}, {35757, 481, 4, 3}, {15685, 477, 4, 2},
+        {18422, 1741, 7, 1}, {10458, 59, 3, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {13671, 878, 4, 1}, {15456, 1195, 8, 1}, {0, 0, 0, 0},
+        {6292, 961, 8, 0}, {37675, 651, 3, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {32608, 194, 4, 3}, {14525, 1028, 7, 1}, {6614, 1001, 10, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {3208, 473, 7, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {10390, 42, 5, 1}, {25836, 478, 5, 2},
+        {35841, 488, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {32704, 204, 4, 3},
+        {0, 0, 0, 0}, {30686, 1294, 8, 2}, {0, 0, 0, 0}, {4476, 661, 4, 0},
+        {4980, 308, 5, 1}, {21016, 2253, 6, 1}, {0, 0, 0, 0}, {23926, 62, 4, 2},
+        {0, 0, 0, 0}, {18140, 1685, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {3527, 517, 6, 0}, {16305, 1345, 5, 1},
+        {17202, 1510, 6, 1}, {22410, 2547, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {16638, 1413, 4, 1}, {0, 0, 0, 0}, {35572, 465, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {38713, 750, 9, 3}, {23748, 2835, 5, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {23843, 32, 4, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {11508, 411, 8, 1}, {13899, 927, 7, 1}, {20691, 2194, 5, 1}, {19110, 1879, 4, 1},
+        {13314, 773, 3, 1}, {21022, 2254, 4, 1}, {26579, 610, 5, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {8363, 1267, 8, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {22437, 2553, 5, 1}, {5303, 796, 7, 0},
+        {18876, 1830, 5, 1}, {0, 0, 0, 0}, {11453, 404, 7, 1}, {28783, 1013, 6, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {13510, 838, 3, 1},
+        {16065, 1298, 3, 1}, {39497, 822, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {9560, 163, 5, 1}, {29375, 1114, 7, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {16941, 1468, 4, 1}, {26493, 21, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {12722, 654, 4, 1}, {0, 0, 0, 0}, {36884, 579, 5, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {19840, 2028, 6, 1}, {24598, 221, 6, 2},
+        {30890, 20, 4, 3}, {0, 0, 0, 0}, {26020, 514, 7, 2}, {11894, 485, 4, 1},
+        {19134, 1883, 5, 1}, {19541, 1967, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {23143, 2714, 5, 1}, {32877, 223, 6, 3}, {34385, 360, 6, 3},
+        {40263, 894, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {22016, 2454, 3, 1}, {0, 0, 0, 0}, {36800, 572, 7, 3}, {0, 0, 0, 0},
+        {38022, 686, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {27008, 693, 4, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {4595, 681, 4, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {611, 95, 10, 0}, {15567, 1212, 4, 1}, {33469, 281, 4, 3}, {29278, 1099, 10, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {21843, 2419, 4, 1}, {32744, 208, 4, 3}, {0, 0, 0, 0}, {9138, 1395, 5, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {10927, 237, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {12816, 671, 6, 1}, {13067, 727, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {38518, 731, 6, 3},
+        {0, 0, 0, 0}, {19020, 1861, 4, 1}, {0, 0, 0, 0}, {1153, 177, 7, 0},
+        {17825, 1627, 5, 1}, {6412, 976, 7, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {7767, 1179, 7, 0}, {0, 0, 0, 0}, {32111, 148, 8, 3}, {0, 0, 0, 0},
+        {23646, 2813, 3, 1}, {32966, 232, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {6686, 1011, 4, 0},
+        {16349, 1354, 3, 1}, {33897, 318, 3, 3}, {29316, 1105, 9, 2}, {8936, 19, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {38277, 710, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {37838, 667, 3, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {39679, 839, 4, 3}, {894, 137, 6, 0}, {2390, 356, 6, 0}, {8728, 51, 5, 2},
+        {10029, 1525, 7, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {40004, 869, 7, 3}, {37514, 635, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {33175, 253, 6, 3},
+        {0, 0, 0, 0}, {12808, 670, 8, 1}, {24556, 214, 9, 2}, {34272, 351, 5, 3},
+        {26469, 592, 9, 2}, {27284, 739, 4, 2}, {36046, 504, 6, 3}, {10219, 1557, 6, 0},
+        {0, 0, 0, 0}, {10015, 1523, 7, 0}, {17087, 1493, 8, 1}, {28485, 960, 5, 2},
+        {800, 7, 7, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {29495, 1131, 8, 2},
+        {36836, 575, 5, 3}, {406, 62, 7, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {21962, 2444, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {19374, 1933, 8, 1},
+        {0, 0, 0, 0}, {35097, 421, 8, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {25525, 410, 7, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {29862, 1182, 6, 2}, {0, 0, 0, 0}, {9920, 1509, 5, 0},
+        {35213, 432, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {36344, 533, 8, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {1148, 109, 5, 1},
+        {36412, 538, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {13783, 899, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {14784, 1079, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {14559, 1033, 6, 1}, {40552, 920, 6, 3},
+        {0, 0, 0, 0}, {5951, 907, 8, 0}, {0, 0, 0, 0}, {5809, 798, 4, 1},
+        {31099, 46, 6, 3}, {18299, 1717, 9, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {15026, 1125, 8, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {24816, 262, 5, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {36807, 573, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {28393, 940, 6, 2},
+        {12226, 554, 4, 1}, {0, 0, 0, 0}, {29293, 1101, 5, 2}, {0, 0, 0, 0},
+        {85, 14, 8, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {27839, 844, 3, 2},
+        {20880, 2228, 4, 1}, {8118, 1234, 7, 0}, {18408, 1738, 5, 1}, {9450, 1441, 6, 0},
+        {32354, 167, 8, 3}, {1823, 278, 9, 0}, {34201, 344, 6, 3}, {39343, 809, 8, 3},
+        {19143, 1885, 6, 1}, {10173, 315, 6, 1}, {16116, 1307, 6, 1}, {2601, 385, 5, 0},
+        {19890, 2036, 5, 1}, {30485, 1267, 8, 2}, {39945, 864, 6, 3}, {0, 0, 0, 0},
+        {35267, 437, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {14024, 949, 8, 1}, {0, 0, 0, 0},
+        {390, 60, 8, 0}, {1111, 170, 6, 0}, {15106, 1139, 6, 1}, {7484, 1140, 7, 0},
+        {10885, 167, 3, 1}, {17902, 1642, 6, 1}, {23396, 2765, 5, 1}, {37147, 603, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {17228, 1515, 6, 1}, {40145, 881, 5, 3},
+        {23181, 2722, 5, 1}, {9836, 1322, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {30902, 23, 4, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {32310, 164, 9, 3}, {12602, 631, 4, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {11722, 450, 4, 1}, {18599, 1778, 4, 1}, {0, 0, 0, 0}, {5211, 257, 8, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {25268, 356, 7, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {22495, 2566, 6, 1},
+        {39010, 776, 4, 3}, {9049, 99, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {6307, 963, 8, 0},
+        {21207, 2291, 5, 1}, {29029, 1055, 6, 2}, {0, 0, 0, 0}, {22595, 2586, 4, 1},
+        {0, 0, 0, 0}, {11852, 477, 5, 1}, {35697, 475, 6, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {30797, 10, 7, 3}, {5827, 886, 4, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {37048, 593, 5, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {39671, 838, 5, 3}, {10773, 143, 6, 1}, {21952, 2442, 5, 1},
+        {0, 0, 0, 0}, {33972, 325, 7, 3}, {0, 0, 0, 0}, {10422, 50, 4, 1},
+        {0, 0, 0, 0}, {13042, 722, 5, 1}, {0, 0, 0, 0}, {27598, 797, 6, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {8291, 1257, 6, 0}, {6848, 1033, 9, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {21097, 2270, 6, 1}, {11412, 397, 6, 1}, {0, 0, 0, 0}, {1178, 181, 6, 0},
+        {8049, 1223, 6, 0}, {19711, 2001, 4, 1}, {12213, 551, 4, 1}, {24245, 144, 9, 2},
+        {31260, 65, 3, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {23036, 2693, 6, 1}, {28166, 902, 6, 2}, {10859, 161, 3, 1},
+        {30671, 1292, 7, 2}, {39218, 797, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {27813, 840, 8, 2}, {40199, 887, 7, 3},
+        {0, 0, 0, 0}, {9728, 1482, 11, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {27368, 753, 6, 2},
+        {0, 0, 0, 0}, {19052, 1867, 4, 1}, {1746, 268, 6, 0}, {33304, 264, 4, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {11788, 463, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {32863, 222, 4, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {26325, 565, 7, 2},
+        {10673, 115, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {11058, 327, 4, 1},
+        {12091, 524, 5, 1}, {0, 0, 0, 0}, {21519, 2352, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {5093, 764, 5, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {6514, 990, 8, 0},
+        {5753, 874, 9, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {38988, 774, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {28081, 886, 6, 2},
+        {24306, 157, 6, 2}, {0, 0, 0, 0}, {26169, 543, 4, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {39279, 804, 5, 3}, {0, 0, 0, 0}, {10437, 54, 5, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {7673, 1169, 12, 0}, {0, 0, 0, 0},
+        {37719, 656, 8, 3}, {32971, 233, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {8716, 1321, 4, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {10079, 1533, 6, 0}, {34193, 343, 8, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {22076, 2469, 6, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {3975, 586, 8, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {38843, 761, 8, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {1011, 155, 6, 0}, {11657, 434, 5, 1}, {19693, 1997, 3, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {29398, 1117, 4, 2},
+        {0, 0, 0, 0}, {8881, 1351, 3, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {11374, 390, 6, 1}, {11819, 468, 5, 1}, {19873, 2033, 5, 1}, {29825, 1177, 8, 2},
+        {26637, 621, 6, 2}, {0, 0, 0, 0}, {28329, 929, 9, 2}, {35184, 428, 7, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {26287, 559, 8, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {3563, 522, 8, 0}, {0, 0, 0, 0},
+        {37198, 608, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {5324, 256, 6, 1}, {38954, 771, 5, 3}, {5132, 770, 7, 0}, {1944, 294, 10, 0},
+        {3644, 535, 6, 0}, {24928, 284, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {314, 48, 8, 0},
+        {0, 0, 0, 0}, {19623, 1982, 5, 1}, {31617, 107, 6, 3}, {0, 0, 0, 0},
+        {22656, 2603, 4, 1}, {0, 0, 0, 0}, {35539, 462, 5, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {19733, 2006, 5, 1}, {17046, 1487, 7, 1}, {0, 0, 0, 0},
+        {9596, 303, 4, 1}, {986, 90, 7, 2}, {21800, 2410, 6, 1}, {27122, 713, 9, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {32449, 177, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {23231, 2731, 5, 1}, {39174, 793, 7, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {26407, 580, 5, 2},
+        {33146, 250, 4, 3}, {0, 0, 0, 0}, {21714, 2392, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {14982, 1115, 6, 1}, {31282, 69, 3, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {25459, 395, 6, 2}, {31245, 63, 3, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {18501, 1757, 4, 1},
+        {24437, 188, 6, 2}, {29936, 1192, 7, 2}, {0, 0, 0, 0}, {11684, 441, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {23601, 2804, 4, 1},
+        {0, 0, 0, 0}, {9172, 1400, 9, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {39651, 835, 3, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {5923, 902, 6, 0},
+        {12726, 655, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {558, 87, 6, 0},
+        {6054, 326, 3, 2}, {8079, 1228, 6, 0}, {14401, 1005, 8, 1}, {28809, 1017, 7, 2},
+        {30338, 1246, 7, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {23247, 2734, 5, 1}, {23198, 2725, 5, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {8357, 1266, 6, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {15156, 1148, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {31828, 128, 9, 3}, {24179, 127, 5, 2},
+        {16296, 1343, 5, 1}, {20572, 2170, 5, 1}, {10085, 1534, 7, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {27775, 830, 5, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {20279, 2114, 5, 1},
+        {5914, 900, 6, 0}, {4534, 671, 10, 0}, {37085, 597, 7, 3}, {20629, 2182, 6, 1},
+        {31266, 66, 3, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {1166, 179, 6, 0},
+        {0, 0, 0, 0}, {8966, 1367, 6, 0}, {19441, 1947, 7, 1}, {0, 0, 0, 0},
+        {22276, 172, 3, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {20130, 2081, 6, 1}, {30499, 1269, 9, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {31025, 41, 4, 3},
+        {0, 0, 0, 0}, {27142, 716, 9, 2}, {0, 0, 0, 0}, {37383, 623, 5, 3},
+        {20665, 2189, 5, 1}, {32119, 149, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {16856, 252, 5, 2}, {34903, 402, 5, 3}, {0, 0, 0, 0},
+        {176, 27, 8, 0}, {0, 0, 0, 0}, {18296, 1716, 3, 1}, {30862, 16, 6, 3},
+        {31890, 132, 9, 3}, {0, 0, 0, 0}, {21936, 2438, 6, 1}, {11302, 376, 6, 1},
+        {29601, 1147, 6, 2}, {0, 0, 0, 0}, {16876, 1455, 5, 1}, {6805, 1028, 6, 0},
+        {34355, 357, 8, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {27954, 865, 8, 2}, {0, 0, 0, 0},
+        {9077, 1383, 6, 0}, {11849, 476, 3, 1}, {40425, 910, 4, 3}, {4527, 670, 7, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {5735, 870, 4, 0}, {23354, 2756, 5, 1},
+        {20619, 2180, 5, 1}, {0, 0, 0, 0}, {29802, 1174, 9, 2}, {0, 0, 0, 0},
+        {10476, 65, 3, 1}, {22913, 2666, 6, 1}, {0, 0, 0, 0}, {23934, 66, 5, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {21465, 2342, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {6857, 1034, 11, 0},
+        {32887, 224, 4, 3}, {36536, 547, 6, 3}, {0, 0, 0, 0}, {18160, 1689, 5, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {2016, 303, 12, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {2735, 401, 8, 0}, {30357, 1249, 8, 2}, {34897, 401, 6, 3},
+        {35512, 459, 5, 3}, {40078, 875, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {26214, 550, 9, 2}, {0, 0, 0, 0}, {18194, 1697, 6, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {27942, 863, 6, 2}, {34940, 407, 5, 3},
+        {24199, 131, 4, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {7123, 1075, 6, 0}, {16908, 1462, 6, 1}, {31071, 44, 9, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {40150, 882, 5, 3}, {35544, 462, 5, 3},
+        {35277, 438, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {32520, 184, 3, 3},
+        {4693, 205, 5, 1}, {7624, 1162, 4, 0}, {16287, 1341, 3, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {25214, 343, 5, 2}, {4369, 644, 6, 0}, {35819, 486, 8, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {22279, 2515, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {20702, 2196, 5, 1}, {27333, 748, 7, 2}, {0, 0, 0, 0},
+        {20063, 2069, 6, 1}, {14619, 1044, 8, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {959, 147, 8, 0}, {34299, 353, 7, 3}, {0, 0, 0, 0},
+        {14242, 981, 7, 1}, {22812, 2644, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {10697, 123, 4, 1},
+        {10289, 17, 3, 1}, {31882, 132, 8, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {30112, 1215, 6, 2}, {17569, 1579, 8, 1}, {16372, 1361, 4, 1},
+        {32916, 227, 4, 3}, {33882, 317, 6, 3}, {0, 0, 0, 0}, {18536, 1765, 6, 1},
+        {17621, 1587, 8, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {545, 85, 6, 0}, {29527, 1135, 7, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {40653, 929, 3, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {14227, 979, 8, 1}, {0, 0, 0, 0}, {22109, 2476, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {38944, 770, 5, 3},
+        {0, 0, 0, 0}, {815, 125, 6, 0}, {23669, 2818, 4, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {26630, 620, 7, 2}, {40286, 896, 3, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {1807, 276, 7, 0}, {25299, 367, 5, 2}, {510, 79, 6, 0},
+        {14855, 1093, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {37104, 598, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {33157, 252, 6, 3}, {0, 0, 0, 0},
+        {33934, 322, 8, 3}, {0, 0, 0, 0}, {35556, 463, 7, 3}, {0, 0, 0, 0},
+        {24301, 156, 5, 2}, {0, 0, 0, 0}, {3434, 504, 5, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {13206, 751, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {27807, 838, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {24806, 260, 6, 2}, {25918, 495, 3, 2}, {14889, 1098, 9, 1}, {32748, 208, 4, 3},
+        {39593, 830, 5, 3}, {13222, 754, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {300, 46, 6, 0},
+        {18896, 1834, 6, 1}, {22187, 2494, 5, 1}, {26267, 556, 6, 2}, {0, 0, 0, 0},
+        {1479, 229, 6, 0}, {28766, 1010, 6, 2}, {40226, 889, 6, 3}, {0, 0, 0, 0},
+        {3266, 482, 7, 0}, {18969, 1851, 6, 1}, {13642, 872, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {10479, 66, 4, 1}, {20459, 2146, 4, 1}, {32410, 171, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {18435, 1743, 6, 1}, {40315, 900, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {26073, 524, 4, 2}, {3023, 443, 5, 0}, {13074, 728, 4, 1}, {18441, 1744, 4, 1},
+        {17379, 1545, 6, 1}, {36224, 520, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {19583, 1975, 5, 1}, {0, 0, 0, 0}, {22114, 2477, 5, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {33218, 257, 6, 3}, {34738, 389, 6, 3}, {30168, 1223, 10, 2},
+        {38940, 769, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {5649, 824, 4, 1},
+        {15099, 1138, 7, 1}, {22124, 2479, 5, 1}, {3467, 229, 10, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {27780, 831, 7, 2}, {0, 0, 0, 0}, {1968, 297, 7, 0},
+        {21602, 2369, 4, 1}, {37140, 602, 7, 3}, {26674, 629, 6, 2}, {20418, 2138, 4, 1},
+        {32899, 226, 6, 3}, {31193, 56, 8, 3}, {33103, 245, 4, 3}, {32581, 190, 5, 3},
+        {6574, 997, 10, 0}, {30789, 9, 8, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {9291, 1416, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {25800, 467, 5, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {13921, 931, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {25326, 372, 5, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {19314, 1922, 6, 1},
+        {21363, 2323, 7, 1}, {25869, 484, 5, 2}, {31724, 118, 4, 3}, {8371, 71, 9, 2},
+        {18851, 1824, 3, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {40767, 942, 6, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {21692, 2387, 4, 1}, {26895, 673, 6, 2}, {0, 0, 0, 0},
+        {38409, 721, 6, 3}, {0, 0, 0, 0}, {6868, 1035, 9, 0}, {16248, 1333, 7, 1},
+        {0, 0, 0, 0}, {21044, 2259, 5, 1}, {34542, 373, 6, 3}, {38783, 756, 9, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {8796, 48, 4, 2}, {12458, 603, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {11882, 482, 4, 1}, {0, 0, 0, 0}, {32508, 183, 6, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {9378, 1431, 8, 0}, {0, 0, 0, 0}, {29471, 1128, 7, 2}, {40140, 881, 5, 3},
+        {33300, 264, 4, 3}, {25019, 303, 4, 2}, {40271, 895, 5, 3}, {12282, 565, 5, 1},
+        {17948, 1650, 6, 1}, {0, 0, 0, 0}, {2168, 321, 7, 0}, {0, 0, 0, 0},
+        {13266, 762, 4, 1}, {0, 0, 0, 0}, {19458, 1951, 6, 1}, {20964, 2243, 5, 1},
+        {6450, 981, 5, 0}, {0, 0, 0, 0}, {12169, 540, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {8782, 41, 8, 2}, {26589, 612, 6, 2}, {7923, 1202, 6, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {5390, 809, 7, 0}, {6203, 949, 7, 0},
+        {15589, 1217, 7, 1}, {0, 0, 0, 0}, {18005, 1660, 4, 1}, {26962, 685, 8, 2},
+        {0, 0, 0, 0}, {5437, 817, 8, 0}, {6226, 953, 11, 0}, {10550, 83, 5, 1},
+        {12822, 672, 5, 1}, {19986, 2054, 5, 1}, {34370, 359, 7, 3}, {31784, 124, 3, 3},
+        {14277, 392, 9, 3}, {0, 0, 0, 0}, {34277, 352, 7, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {14907, 475, 6, 3}, {29754, 1167, 7, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {33036, 239, 5, 3}, {714, 110, 8, 0}, {5762, 875, 7, 0}, {22895, 2662, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {17503, 1567, 6, 1}, {34243, 348, 4, 3},
+        {31311, 73, 3, 3}, {39092, 784, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {40645, 928, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {37670, 650, 5, 3}, {1123, 172, 6, 0}, {20388, 2133, 7, 1},
+        {23724, 2830, 3, 1}, {17123, 1498, 7, 1}, {6801, 1027, 4, 0}, {28405, 942, 8, 2},
+        {14683, 1057, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {32950, 231, 6, 3},
+        {4962, 742, 5, 0}, {12777, 665, 6, 1}, {24795, 258, 6, 2}, {20845, 2222, 6, 1},
+        {0, 0, 0, 0}, {37152, 603, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {32157, 152, 6, 3},
+        {4437, 655, 7, 0}, {5719, 867, 4, 0}, {0, 0, 0, 0}, {35733, 479, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {28419, 945, 6, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {7953, 1207, 6, 0},
+        {0, 0, 0, 0}, {25383, 382, 7, 2}, {25925, 497, 6, 2}, {0, 0, 0, 0},
+        {10374, 38, 4, 1}, {7789, 1182, 8, 0}, {18413, 1739, 5, 1}, {16642, 1414, 8, 1},
+        {32822, 217, 5, 3}, {11591, 422, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {9108, 359, 4, 2}, {19006, 1858, 7, 1}, {38524, 732, 7, 3},
+        {37237, 611, 8, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {8773, 1331, 6, 0},
+        {30352, 1248, 5, 2}, {0, 0, 0, 0}, {33409, 276, 8, 3}, {31856, 130, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {19628, 1983, 4, 1}, {0, 0, 0, 0},
+        {37565, 640, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {17656, 1595, 4, 1},
+        {28385, 938, 4, 2}, {2231, 329, 8, 0}, {1613, 249, 7, 0}, {0, 0, 0, 0},
+        {8132, 1236, 13, 0}, {16587, 1403, 5, 1}, {7002, 1053, 4, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {29503, 1132, 8, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {15150, 1147, 6, 1}, {13379, 790, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {28375, 936, 4, 2}, {24776, 255, 5, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {1328, 205, 6, 0},
+        {38729, 751, 6, 3}, {0, 0, 0, 0}, {32390, 169, 4, 3}, {5248, 788, 8, 0},
+        {4766, 710, 8, 0}, {31351, 78, 4, 3}, {0, 0, 0, 0}, {6495, 988, 10, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {32265, 161, 5, 3},
+        {23649, 2814, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {9206, 1405, 7, 0},
+        {0, 0, 0, 0}, {16578, 1401, 3, 1}, {0, 0, 0, 0}, {23153, 2716, 5, 1},
+        {36419, 538, 7, 3}, {0, 0, 0, 0}, {15516, 1204, 7, 1}, {31528, 99, 4, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {16473, 1382, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {3445, 506, 6, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {1629, 251, 9, 0},
+        {10283, 15, 3, 1}, {1437, 223, 6, 0}, {26796, 653, 8, 2}, {38437, 724, 4, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {36894, 580, 4, 3}, {6907, 1040, 6, 0}, {1511, 234, 8, 0}, {21375, 2325, 5, 1},
+        {34886, 400, 6, 3}, {10853, 160, 6, 1}, {40863, 952, 8, 3}, {0, 0, 0, 0},
+        {34247, 349, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {22931, 2670, 5, 1}, {29106, 1067, 9, 2},
+        {36052, 504, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {24519, 207, 5, 2}, {0, 0, 0, 0}, {27743, 823, 4, 2}, {33271, 261, 6, 3},
+        {34165, 341, 8, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {31011, 39, 5, 3}, {7018, 1056, 7, 0}, {27686, 813, 7, 2},
+        {0, 0, 0, 0}, {10615, 99, 3, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {24174, 126, 5, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {21819, 2414, 4, 1}, {19402, 1940, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {24118, 117, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {8335, 1263, 8, 0}, {0, 0, 0, 0}, {31862, 130, 6, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {17859, 1633, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {29382, 1115, 7, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {21779, 2405, 6, 1}, {27769, 829, 6, 2},
+        {26566, 22, 5, 3}, {32683, 202, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {33956, 323, 6, 3},
+        {11076, 330, 4, 1}, {23012, 2687, 6, 1}, {6172, 355, 5, 2}, {13606, 863, 4, 1},
+        {23863, 36, 7, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {10402, 45, 5, 1}, {22716, 2621, 6, 1}, {17724, 1610, 5, 1},
+        {37962, 680, 3, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {23855, 35, 8, 2}, {0, 0, 0, 0}, {3439, 505, 6, 0}, {18993, 1855, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {7811, 1185, 8, 0}, {21249, 2300, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {9724, 1481, 4, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {21734, 2396, 5, 1},
+        {0, 0, 0, 0}, {27545, 786, 6, 2}, {0, 0, 0, 0}, {34641, 381, 5, 3},
+        {25468, 397, 6, 2}, {2630, 389, 8, 0}, {16989, 1477, 4, 1}, {31047, 43, 8, 3},
+        {0, 0, 0, 0}, {21537, 2355, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {17130, 1499, 7, 1}, {40528, 918, 7, 3},
+        {0, 0, 0, 0}, {37586, 642, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {21497, 2348, 6, 1}, {25321, 371, 5, 2}, {11572, 419, 7, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {14575, 1036, 7, 1},
+        {0, 0, 0, 0}, {23516, 2787, 6, 1}, {14469, 1017, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {16592, 1404, 6, 1}, {33785, 307, 4, 3}, {0, 0, 0, 0},
+        {20000, 2057, 3, 1}, {11344, 384, 3, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {22071, 2468, 5, 1}, {18455, 1748, 5, 1}, {20851, 2223, 5, 1}, {21081, 2267, 4, 1},
+        {35467, 455, 7, 3}, {24422, 186, 8, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {1656, 254, 4, 0}, {15426, 1192, 8, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {12711, 652, 6, 1}, {0, 0, 0, 0}, {5416, 119, 8, 1},
+        {0, 0, 0, 0}, {2207, 326, 8, 0}, {6177, 428, 6, 2}, {20936, 2238, 7, 1},
+        {35846, 488, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {31235, 61, 3, 3}, {36109, 510, 5, 3},
+        {12209, 550, 4, 1}, {3504, 514, 7, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {30038, 1205, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {21067, 2263, 4, 1}, {26188, 546, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {2753, 404, 8, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {40155, 882, 5, 3}, {46, 8, 6, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {19451, 1949, 3, 1}, {34596, 378, 7, 3},
+        {0, 0, 0, 0}, {32883, 224, 4, 3}, {38141, 696, 6, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {28860, 1025, 6, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {21194, 2288, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {33967, 324, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {12939, 698, 11, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {13179, 747, 8, 1}, {15953, 1280, 9, 1}, {19013, 1859, 7, 1}, {22731, 2624, 5, 1},
+        {31549, 102, 5, 3}, {33909, 320, 7, 3}, {37351, 620, 5, 3}, {7642, 1166, 10, 0},
+        {0, 0, 0, 0}, {30823, 12, 4, 3}, {22005, 2452, 5, 1}, {13556, 853, 5, 1},
+        {0, 0, 0, 0}, {484, 75, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {25375, 381, 8, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {27628, 803, 5, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {38699, 748, 3, 3}, {12538, 450, 4, 3}, {12827, 673, 7, 1}, {26332, 566, 4, 2},
+        {36178, 516, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {32035, 143, 7, 3}, {0, 0, 0, 0}, {15021, 1124, 5, 1},
+        {30097, 1213, 9, 2}, {31567, 103, 6, 3}, {0, 0, 0, 0}, {21198, 2289, 4, 1},
+        {38389, 720, 7, 3}, {0, 0, 0, 0}, {11704, 446, 3, 1}, {0, 0, 0, 0},
+        {10838, 157, 8, 1}, {18280, 1711, 5, 1}, {31816, 127, 6, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {34575, 376, 4, 3}, {0, 0, 0, 0}, {19089, 1875, 5, 1},
+        {16171, 1317, 5, 1}, {22297, 2519, 4, 1}, {30547, 1275, 7, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {34625, 380, 8, 3}, {36909, 581, 7, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {14127, 966, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {33695, 299, 9, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {30365, 1250, 7, 2}, {33169, 253, 6, 3}, {0, 0, 0, 0}, {3813, 561, 5, 0},
+        {33265, 261, 6, 3}, {16217, 1327, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {34603, 378, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {15718, 1240, 9, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {5364, 804, 6, 0},
+        {0, 0, 0, 0}, {10189, 1552, 5, 0}, {1775, 272, 8, 0}, {0, 0, 0, 0},
+        {20908, 2234, 7, 1}, {34026, 329, 5, 3}, {39462, 819, 6, 3}, {0, 0, 0, 0},
+        {23622, 2808, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {40348, 903, 5, 3},
+        {24086, 108, 9, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {93, 15, 6, 0}, {12733, 656, 6, 1}, {1390, 215, 6, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {34579, 376, 4, 3}, {0, 0, 0, 0}, {821, 126, 6, 0},
+        {1680, 258, 8, 0}, {0, 0, 0, 0}, {24014, 87, 5, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {19562, 1971, 6, 1}, {36866, 577, 5, 3}, {23334, 2752, 6, 1},
+        {31080, 45, 10, 3}, {35133, 423, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {13338, 779, 4, 1}, {14612, 1043, 7, 1}, {2552, 379, 9, 0}, {0, 0, 0, 0},
+        {31623, 108, 7, 3}, {33922, 321, 7, 3}, {0, 0, 0, 0}, {12197, 547, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {19155, 1887, 3, 1}, {24356, 169, 8, 2}, {4747, 707, 7, 0},
+        {21514, 2351, 5, 1}, {31002, 38, 4, 3}, {36480, 543, 10, 3}, {0, 0, 0, 0},
+        {34503, 369, 5, 3}, {0, 0, 0, 0}, {10341, 30, 4, 1}, {10899, 191, 3, 1},
+        {16559, 1398, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {14548, 1031, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {21281, 2306, 5, 1},
+        {0, 0, 0, 0}, {28712, 1001, 5, 2}, {38323, 714, 7, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {5813, 884, 8, 0}, {15962, 1281, 7, 1}, {33760, 305, 7, 3}, {0, 0, 0, 0},
+        {2067, 309, 9, 0}, {4657, 692, 8, 0}, {8645, 22, 5, 2}, {16889, 1458, 4, 1},
+        {23065, 2699, 5, 1}, {23429, 2771, 5, 1}, {13030, 720, 5, 1}, {18231, 1703, 5, 1},
+        {24711, 242, 5, 2}, {28759, 1009, 7, 2}, {39917, 862, 8, 3}, {40733, 937, 3, 3},
+        {0, 0, 0, 0}, {13274, 764, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {26550, 33, 5, 3},
+        {39516, 824, 6, 3}, {20802, 2215, 6, 1}, {17430, 1555, 8, 1}, {18606, 1780, 4, 1},
+        {20707, 2197, 7, 1}, {3493, 512, 7, 0}, {10741, 137, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {23306, 2747, 6, 1}, {29089, 1065, 7, 2}, {0, 0, 0, 0},
+        {11807, 466, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {13463, 812, 6, 1}, {0, 0, 0, 0}, {5375, 806, 3, 0},
+        {1219, 188, 8, 0}, {19263, 1910, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {4585, 679, 5, 0}, {13911, 929, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {13302, 770, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {8600, 1301, 8, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {24276, 152, 5, 2}, {1024, 157, 6, 0}, {24704, 241, 7, 2}, {26346, 569, 5, 2},
+        {34686, 384, 5, 3}, {13506, 827, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {5199, 781, 7, 0}, {20922, 2236, 8, 1},
+        {38227, 704, 5, 3}, {0, 0, 0, 0}, {1458, 226, 8, 0}, {25304, 368, 7, 2},
+        {25532, 411, 6, 2}, {31248, 63, 3, 3}, {10529, 78, 4, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {31429, 88, 4, 3}, {35785, 484, 5, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {8897, 1354, 5, 0}, {21650, 2378, 6, 1},
+        {38678, 746, 6, 3}, {39821, 854, 6, 3}, {0, 0, 0, 0}, {18774, 1810, 3, 1},
+        {30565, 1278, 7, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {35600, 467, 6, 3}, {38876, 763, 6, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {19510, 1961, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {19942, 2045, 5, 1}, {8448, 1280, 6, 0}, {35356, 445, 7, 3}, {0, 0, 0, 0},
+        {2254, 332, 6, 0}, {0, 0, 0, 0}, {28186, 905, 5, 2}, {21967, 2445, 6, 1},
+        {0, 0, 0, 0}, {12113, 529, 5, 1}, {13566, 855, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {8157, 220, 6, 3}, {9774, 169, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {15635, 1224, 8, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {4090, 605, 7, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {9858, 1501, 11, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {40282, 896, 4, 3}, {13245, 758, 8, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {5876, 894, 8, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {199, 30, 6, 0}, {22262, 2510, 6, 1},
+        {0, 0, 0, 0}, {18749, 1806, 6, 1}, {2134, 317, 10, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {1296, 200, 6, 0},
+        {10231, 1559, 4, 0}, {23628, 2809, 4, 1}, {26804, 654, 5, 2}, {30734, 3, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {4128, 611, 7, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {25129, 329, 6, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {29591, 1145, 5, 2}, {25621, 425, 7, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {32795, 214, 4, 3}, {0, 0, 0, 0},
+        {22234, 2503, 5, 1}, {19836, 2027, 4, 1}, {25047, 308, 5, 2}, {0, 0, 0, 0},
+        {20874, 2227, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {17300, 1529, 4, 1},
+        {28904, 1035, 7, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {33153, 251, 4, 3}, {0, 0, 0, 0}, {37509, 634, 5, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {15628, 1223, 7, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {35718, 477, 5, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {27135, 715, 7, 2},
+        {12237, 556, 4, 1}, {0, 0, 0, 0}, {15302, 1175, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {26731, 639, 6, 2}, {15401, 1189, 9, 1}, {40535, 918, 6, 3},
+        {0, 0, 0, 0}, {1737, 267, 9, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {22363, 2536, 5, 1}, {32232, 158, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {30906, 24, 4, 3}, {37528, 636, 6, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {8061, 1225, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {17749, 1614, 5, 1}, {0, 0, 0, 0}, {10360, 35, 4, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {24631, 227, 6, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {25279, 361, 5, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {17767, 1617, 6, 1}, {26745, 642, 6, 2}, {31964, 138, 7, 3},
+        {33767, 305, 7, 3}, {38648, 743, 8, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {35349, 444, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {16932, 1466, 5, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {32243, 159, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {11916, 491, 5, 1}, {0, 0, 0, 0}, {39905, 861, 5, 3}, {25331, 373, 4, 2},
+        {17172, 1505, 7, 1}, {25519, 409, 6, 2}, {11966, 501, 4, 1}, {28520, 966, 7, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {17271, 1524, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {3767, 554, 7, 0}, {10585, 92, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {9678, 1475, 7, 0}, {33550, 287, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {32133, 150, 6, 3}, {0, 0, 0, 0}, {17523, 1570, 6, 1}, {16238, 1331, 6, 1},
+        {7069, 1064, 4, 0}, {9554, 1173, 6, 1}, {14769, 1076, 5, 1}, {15116, 1141, 5, 1},
+        {16598, 1405, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {10235, 1, 3, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {22397, 2543, 5, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {23089, 2704, 5, 1},
+        {20915, 2235, 7, 1}, {32812, 216, 5, 3}, {0, 0, 0, 0}, {675, 104, 7, 0},
+        {37388, 623, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {2561, 380, 9, 0}, {0, 0, 0, 0}, {21126, 2275, 6, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {25900, 491, 4, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {38475, 728, 8, 3}, {4263, 629, 7, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {38503, 730, 4, 3},
+        {0, 0, 0, 0}, {7411, 1127, 6, 0}, {13851, 918, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {32077, 146, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {21212, 2292, 5, 1}, {0, 0, 0, 0}, {23922, 61, 4, 2}, {35177, 428, 7, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {21389, 2328, 6, 1}, {0, 0, 0, 0},
+        {8199, 1245, 6, 0}, {18726, 1802, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {23186, 2723, 7, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {32791, 214, 4, 3},
+        {26418, 583, 4, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {19076, 1872, 5, 1},
+        {0, 0, 0, 0}, {855, 131, 6, 0}, {35142, 424, 4, 3}, {0, 0, 0, 0},
+        {28035, 876, 5, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {32891, 225, 4, 3}, {27962, 866, 6, 2}, {2719, 399, 9, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {26126, 532, 5, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {34036, 330, 3, 3}, {3142, 462, 4, 0}, {3927, 579, 6, 0},
+        {17060, 1489, 6, 1}, {0, 0, 0, 0}, {23943, 68, 8, 2}, {38196, 701, 4, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {30025, 1203, 6, 2}, {0, 0, 0, 0}, {38800, 757, 6, 3},
+        {22169, 2489, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {23909, 59, 7, 2}, {0, 0, 0, 0}, {15713, 1239, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {22383, 2540, 3, 1}, {34222, 346, 3, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {17325, 1535, 4, 1}, {2944, 430, 5, 0}, {32270, 161, 5, 3}, {32514, 183, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {22998, 2684, 5, 1}, {10486, 68, 4, 1},
+        {23968, 76, 5, 2}, {27300, 742, 4, 2}, {0, 0, 0, 0}, {22644, 2600, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {35396, 448, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {26741, 641, 4, 2}, {0, 0, 0, 0},
+        {31600, 106, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {23772, 2839, 4, 1},
+        {306, 47, 8, 0}, {1197, 184, 6, 0}, {32554, 188, 6, 3}, {33371, 271, 6, 3},
+        {2009, 302, 7, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {4685, 696, 8, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {2055, 307, 6, 0},
+        {31875, 131, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {35062, 417, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {14805, 82, 3, 3}, {2761, 405, 7, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {30428, 1259, 8, 2}, {5638, 851, 7, 0}, {29811, 1175, 8, 2}, {0, 0, 0, 0},
+        {22432, 2552, 5, 1}, {35091, 420, 3, 3}, {6251, 956, 9, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {9017, 1375, 8, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {24281, 153, 7, 2}, {31232, 61, 3, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {20490, 2152, 5, 1}, {35435, 453, 5, 3}, {0, 0, 0, 0}, {33842, 313, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {5256, 789, 6, 0}, {0, 0, 0, 0}, {22865, 2656, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {2343, 350, 4, 0}, {10049, 1528, 8, 0}, {37624, 646, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {16186, 1320, 4, 1}, {9600, 1463, 9, 0}, {16903, 1461, 5, 1}, {28321, 928, 8, 2},
+        {14941, 1108, 8, 1}, {32467, 178, 6, 3}, {39059, 781, 4, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {35563, 464, 5, 3}, {22944, 2673, 5, 1}, {28598, 979, 6, 2},
+        {11203, 353, 6, 1}, {20506, 2155, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {4060, 600, 6, 0}, {12894, 691, 8, 1}, {13397, 794, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {4480, 662, 7, 0}, {0, 0, 0, 0}, {7422, 1129, 4, 0},
+        {34185, 343, 8, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {9112, 1390, 5, 0}, {17337, 1537, 7, 1}, {0, 0, 0, 0},
+        {29586, 1144, 5, 2}, {0, 0, 0, 0}, {682, 105, 8, 0}, {38060, 690, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {5777, 184, 5, 1}, {0, 0, 0, 0},
+        {36013, 502, 9, 3}, {0, 0, 0, 0}, {3234, 477, 8, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {10944, 254, 5, 1},
+        {0, 0, 0, 0}, {2614, 387, 8, 0}, {0, 0, 0, 0}, {11836, 472, 5, 1},
+        {23494, 2783, 7, 1}, {29134, 1071, 8, 2}, {0, 0, 0, 0}, {23564, 2796, 7, 1},
+        {34444, 364, 8, 3}, {0, 0, 0, 0}, {26919, 677, 5, 2}, {0, 0, 0, 0},
+        {14044, 952, 9, 1}, {0, 0, 0, 0}, {38245, 706, 4, 3}, {36635, 557, 4, 3},
+        {7181, 1087, 5, 0}, {29618, 1149, 7, 2}, {31291, 70, 3, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {13420, 800, 3, 1}, {0, 0, 0, 0},
+        {8352, 75, 5, 2}, {30984, 36, 6, 3}, {5687, 860, 5, 0}, {23536, 2791, 6, 1},
+        {31016, 40, 4, 3}, {4014, 592, 5, 0}, {37026, 592, 8, 3}, {37873, 670, 5, 3},
+        {243, 37, 8, 0}, {20987, 2247, 6, 1}, {36542, 548, 4, 3}, {20219, 2101, 4, 1},
+        {38792, 756, 8, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {34234, 347, 5, 3},
+        {0, 0, 0, 0}, {9540, 1454, 8, 0}, {12391, 590, 3, 1}, {0, 0, 0, 0},
+        {35138, 424, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {8616, 1303, 7, 0}, {13770, 896, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {4647, 690, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {37230, 610, 7, 3},
+        {0, 0, 0, 0}, {40343, 902, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {32983, 234, 4, 3}, {12954, 703, 5, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {15879, 1266, 3, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {17179, 1506, 8, 1},
+        {3158, 465, 4, 0}, {7307, 1111, 6, 0}, {7497, 1142, 8, 0}, {3260, 481, 6, 0},
+        {10955, 268, 7, 1}, {38341, 716, 5, 3}, {0, 0, 0, 0}, {16968, 1473, 5, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {10433, 53, 4, 1},
+        {23522, 2788, 4, 1}, {40778, 943, 5, 3}, {0, 0, 0, 0}, {39766, 848, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {24801, 259, 5, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {27762, 828, 7, 2},
+        {33905, 319, 4, 3}, {11493, 409, 9, 1}, {9961, 1515, 7, 0}, {0, 0, 0, 0},
+        {12056, 518, 5, 1}, {9025, 1376, 8, 0}, {13906, 928, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {6522, 991, 8, 0}, {14156, 970, 7, 1},
+        {17016, 1482, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {39110, 786, 4, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {18866, 1828, 5, 1},
+        {21049, 2260, 6, 1}, {23807, 2847, 6, 1}, {10314, 23, 5, 1}, {2664, 393, 9, 0},
+        {23219, 2729, 7, 1}, {36401, 537, 11, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {12648, 640, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {5692, 825, 4, 1}, {0, 0, 0, 0}, {14486, 1020, 4, 1},
+        {18521, 1761, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {5782, 878, 6, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {11524, 413, 9, 1}, {13431, 803, 4, 1},
+        {0, 0, 0, 0}, {26830, 660, 6, 2}, {35219, 432, 6, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {11925, 493, 6, 1}, {2968, 434, 6, 0}, {0, 0, 0, 0},
+        {5409, 62, 4, 1}, {6696, 1013, 9, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {21441, 2338, 5, 1}, {0, 0, 0, 0},
+        {11833, 471, 3, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {21973, 2446, 5, 1}, {33073, 242, 5, 3}, {33820, 311, 6, 3},
+        {35240, 435, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {10262, 9, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {6372, 970, 6, 0}, {12164, 539, 5, 1},
+        {22447, 2555, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {15072, 1133, 5, 1}, {27561, 788, 6, 2},
+        {0, 0, 0, 0}, {33614, 292, 5, 3}, {35319, 442, 8, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {25676, 437, 9, 2}, {39181, 793, 7, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {10043, 1527, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {16819, 1445, 7, 1}, {0, 0, 0, 0}, {19783, 2017, 4, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {16491, 1385, 5, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {31851, 129, 5, 3}, {40783, 943, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {39738, 845, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {33862, 315, 6, 3}, {27061, 703, 6, 2}, {37727, 656, 7, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {39229, 798, 5, 3}, {35728, 478, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {20856, 2224, 5, 1},
+        {21551, 2358, 5, 1}, {522, 81, 4, 0}, {36378, 536, 6, 3}, {36757, 569, 7, 3},
+        {0, 0, 0, 0}, {1203, 185, 4, 0}, {38702, 749, 5, 3}, {12322, 574, 3, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {9902, 1506, 6, 0},
+        {24812, 261, 4, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {39634, 833, 6, 3}, {0, 0, 0, 0}, {15359, 1183, 7, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {35991, 500, 4, 3},
+        {5696, 862, 5, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {16190, 1321, 7, 1},
+        {15787, 1251, 8, 1}, {0, 0, 0, 0}, {24264, 150, 6, 2}, {17960, 1652, 7, 1},
+        {0, 0, 0, 0}, {20003, 2058, 3, 1}, {5623, 848, 6, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {40630, 927, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {12717, 653, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {19859, 2031, 8, 1}, {0, 0, 0, 0}, {21245, 2299, 4, 1}, {0, 0, 0, 0},
+        {12588, 628, 5, 1}, {22043, 2462, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {17417, 1553, 6, 1}, {19396, 1938, 6, 1}, {29260, 1095, 8, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {36654, 559, 5, 3}, {7319, 366, 7, 1},
+        {25841, 479, 5, 2}, {0, 0, 0, 0}, {40206, 887, 6, 3}, {18912, 1838, 4, 1},
+        {0, 0, 0, 0}, {10949, 267, 6, 1}, {11960, 500, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {23022, 2690, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {33090, 244, 4, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {37522, 636, 6, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {8030, 1220, 8, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {33473, 281, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {23118, 2709, 4, 1}, {0, 0, 0, 0}, {20439, 2142, 5, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {37812, 665, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {5701, 826, 3, 1}, {0, 0, 0, 0},
+        {14778, 1078, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {7874, 1194, 6, 0}, {31524, 98, 4, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {37273, 614, 8, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {37823, 666, 6, 3},
+        {1207, 158, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {29268, 1096, 6, 2},
+        {14798, 957, 4, 2}, {15904, 1272, 5, 1}, {13808, 907, 4, 1}, {18768, 1809, 6, 1},
+        {20670, 2190, 6, 1}, {0, 0, 0, 0}, {39379, 812, 7, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {14898, 1099, 9, 1}, {15815, 1255, 5, 1}, {0, 0, 0, 0},
+        {30709, 1297, 8, 2}, {36004, 501, 9, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {6690, 1012, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {12357, 582, 5, 1},
+        {7598, 334, 6, 1}, {0, 0, 0, 0}, {28241, 915, 4, 2}, {36059, 505, 3, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {21759, 2401, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {13096, 733, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {23505, 2785, 5, 1}, {19645, 1986, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {28652, 990, 5, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {345, 53, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {8238, 1250, 6, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {31220, 59, 3, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {36444, 540, 7, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {31669, 112, 5, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {19936, 2044, 6, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {38008, 685, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {9692, 1477, 14, 0},
+        {29868, 1183, 7, 2}, {30259, 1236, 8, 2}, {7114, 1073, 4, 0}, {31984, 139, 7, 3},
+        {35881, 491, 8, 3}, {35938, 495, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {24472, 193, 5, 2}, {28866, 1026, 7, 2}, {36639, 558, 5, 3},
+        {26110, 529, 4, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {37157, 604, 6, 3}, {0, 0, 0, 0}, {12695, 649, 5, 1}, {21075, 2265, 6, 1},
+        {19480, 1955, 5, 1}, {32347, 166, 7, 3}, {0, 0, 0, 0}, {29248, 1093, 6, 2},
+        {3673, 540, 5, 0}, {0, 0, 0, 0}, {788, 121, 6, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {3297, 486, 8, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {8098, 9, 7, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {12928, 697, 11, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {7203, 1092, 4, 0},
+        {25454, 393, 5, 2}, {34951, 408, 4, 3}, {19547, 1968, 4, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {19659, 801, 3, 3}, {11564, 418, 8, 1}, {32477, 179, 3, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {2774, 407, 7, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {16041, 1294, 6, 1}, {39629, 833, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {11715, 449, 7, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {13293, 768, 5, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {31959, 137, 5, 3}, {24999, 300, 6, 2},
+        {0, 0, 0, 0}, {37183, 606, 5, 3}, {23660, 2816, 5, 1}, {0, 0, 0, 0},
+        {20485, 2151, 5, 1}, {27220, 729, 9, 2}, {0, 0, 0, 0}, {22099, 2474, 5, 1},
+        {23280, 2740, 4, 1}, {16277, 1339, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {2838, 416, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {35262, 436, 5, 3}, {1278, 64, 6, 2}, {37188, 607, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {34514, 370, 5, 3}, {34723, 387, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {8067, 1226, 6, 0}, {0, 0, 0, 0}, {25498, 405, 6, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {11034, 321, 5, 1}, {22360, 2535, 3, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {10307, 21, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {6406, 975, 6, 0},
+        {14235, 980, 7, 1}, {31907, 133, 7, 3}, {33751, 304, 9, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {19127, 1882, 7, 1},
+        {0, 0, 0, 0}, {40675, 931, 5, 3}, {0, 0, 0, 0}, {7232, 1097, 6, 0},
+        {16997, 1479, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {34769, 391, 5, 3}, {6244, 955, 7, 0},
+        {11671, 437, 4, 1}, {37603, 644, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {32503, 182, 5, 3}, {33639, 295, 7, 3}, {35334, 443, 4, 3}, {0, 0, 0, 0},
+        {8223, 1248, 9, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {39069, 782, 6, 3}, {27590, 796, 8, 2}, {40033, 871, 7, 3}, {0, 0, 0, 0},
+        {11339, 383, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {27166, 720, 6, 2}, {0, 0, 0, 0}, {27693, 814, 6, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {163, 4, 7, 2}, {7055, 1062, 7, 0},
+        {17595, 1583, 8, 1}, {23692, 2824, 7, 1}, {25052, 309, 5, 2}, {10751, 139, 3, 1},
+        {7129, 1076, 6, 0}, {14879, 1097, 10, 1}, {22239, 2504, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {36299, 528, 6, 3}, {0, 0, 0, 0},
+        {38902, 765, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {21357, 2322, 6, 1}, {24104, 110, 5, 2}, {14163, 971, 7, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {413, 63, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {17137, 1500, 7, 1}, {0, 0, 0, 0}, {13830, 913, 9, 1}, {0, 0, 0, 0},
+        {34757, 390, 7, 3}, {36459, 541, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {11017, 298, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {28087, 887, 6, 2},
+        {38186, 700, 6, 3}, {39865, 858, 6, 3}, {0, 0, 0, 0}, {19413, 1942, 4, 1},
+        {10199, 1554, 5, 0}, {637, 98, 8, 0}, {0, 0, 0, 0}, {21696, 675, 5, 3},
+        {27795, 836, 7, 2}, {33900, 319, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {37710, 655, 4, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {12159, 538, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {19191, 1894, 5, 1}, {0, 0, 0, 0},
+        {36922, 582, 5, 3}, {28430, 947, 6, 2}, {0, 0, 0, 0}, {6274, 959, 8, 0},
+        {39014, 777, 3, 3}, {31392, 84, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {33150, 251, 3, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {15969, 1282, 8, 1}, {0, 0, 0, 0}, {37245, 611, 8, 3}, {6901, 1039, 6, 0},
+        {27178, 722, 4, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {32431, 174, 4, 3}, {29402, 1118, 7, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {38208, 703, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {24987, 297, 5, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {3780, 556, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {2654, 392, 10, 0},
+        {5006, 286, 5, 1}, {13760, 895, 10, 1}, {16234, 1330, 4, 1}, {37163, 604, 7, 3},
+        {1557, 241, 7, 0}, {15663, 1229, 6, 1}, {30784, 8, 5, 3}, {40320, 900, 6, 3},
+        {40698, 933, 4, 3}, {31940, 136, 7, 3}, {0, 0, 0, 0}, {19616, 1981, 7, 1},
+        {24410, 184, 6, 2}, {34928, 405, 6, 3}, {0, 0, 0, 0}, {35009, 413, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {35867, 490, 6, 3}, {19061, 1869, 5, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {39969, 866, 6, 3}, {0, 0, 0, 0},
+        {9415, 1436, 14, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {38511, 731, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {26840, 662, 7, 2}, {10276, 13, 4, 1},
+        {13825, 912, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {25415, 387, 7, 2},
+        {38031, 687, 4, 3}, {26056, 521, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {18074, 1673, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {33929, 321, 5, 3}, {0, 0, 0, 0}, {22174, 2491, 5, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {21683, 2385, 4, 1}, {36957, 586, 6, 3}, {19968, 2050, 5, 1},
+        {40365, 904, 6, 3}, {5168, 775, 5, 0}, {4175, 52, 5, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {21202, 2290, 5, 1}, {0, 0, 0, 0}, {35959, 498, 7, 3},
+        {0, 0, 0, 0}, {29989, 1199, 11, 2}, {34783, 393, 8, 3}, {0, 0, 0, 0},
+        {24830, 265, 5, 2}, {29017, 1053, 7, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {270, 41, 6, 0}, {21031, 2256, 6, 1}, {5233, 786, 7, 0}, {0, 0, 0, 0},
+        {13950, 938, 7, 1}, {37645, 648, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {33001, 236, 5, 3}, {32169, 153, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {20534, 2161, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {18016, 1662, 7, 1},
+        {27802, 837, 5, 2}, {36841, 576, 10, 3}, {24124, 118, 6, 2}, {27948, 864, 6, 2},
+        {26755, 644, 4, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {8312, 1260, 7, 0}, {24109, 116, 9, 2},
+        {33344, 268, 7, 3}, {24229, 140, 7, 2}, {26357, 571, 6, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {8512, 44, 9, 2}, {13122, 738, 10, 1}, {40243, 891, 3, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {23501, 2784, 4, 1}, {12462, 604, 6, 1},
+        {14860, 1094, 6, 1}, {25874, 485, 4, 2}, {26623, 619, 7, 2}, {0, 0, 0, 0},
+        {4135, 612, 10, 0}, {10297, 19, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {22466, 2560, 5, 1}, {8740, 198, 5, 2}, {32042, 144, 11, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {14913, 1101, 6, 1}, {0, 0, 0, 0},
+        {10129, 1541, 5, 0}, {867, 133, 8, 0}, {36286, 527, 4, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {2282, 337, 4, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {33942, 322, 8, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {16881, 1456, 8, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {4342, 640, 7, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {5053, 758, 4, 0}, {16386, 1364, 7, 1}, {20401, 2135, 5, 1}, {22807, 2642, 5, 1},
+        {0, 0, 0, 0}, {19910, 2039, 7, 1}, {34583, 377, 7, 3}, {40563, 921, 4, 3},
+        {0, 0, 0, 0}, {15089, 1136, 4, 1}, {17715, 1608, 4, 1}, {0, 0, 0, 0},
+        {13047, 723, 5, 1}, {2294, 340, 4, 0}, {33288, 263, 6, 3}, {0, 0, 0, 0},
+        {22590, 2585, 5, 1}, {26737, 640, 4, 2}, {26669, 628, 5, 2}, {36336, 533, 8, 3},
+        {0, 0, 0, 0}, {1260, 194, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {20786, 2212, 5, 1}, {39815, 854, 6, 3},
+        {17873, 1636, 5, 1}, {0, 0, 0, 0}, {29415, 1120, 7, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {38335, 715, 6, 3}, {0, 0, 0, 0}, {23905, 53, 4, 2}, {31105, 46, 7, 3},
+        {0, 0, 0, 0}, {30147, 1220, 8, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {32480, 180, 6, 3}, {24167, 125, 7, 2}, {0, 0, 0, 0},
+        {36776, 570, 5, 3}, {7567, 1153, 8, 0}, {0, 0, 0, 0}, {16697, 1423, 3, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {33997, 327, 8, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {4740, 706, 7, 0},
+        {0, 0, 0, 0}, {16273, 1338, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {21775, 2404, 4, 1}, {21547, 2357, 4, 1}, {29450, 1125, 8, 2}, {18542, 1766, 6, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {538, 84, 7, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {9939, 346, 7, 1}, {16228, 1329, 6, 1}, {6538, 993, 8, 0},
+        {31411, 86, 5, 3}, {0, 0, 0, 0}, {8105, 358, 7, 3}, {0, 0, 0, 0},
+        {8441, 354, 7, 2}, {17256, 1521, 5, 1}, {33084, 243, 6, 3}, {33363, 270, 4, 3},
+        {20029, 2063, 6, 1}, {36252, 524, 5, 3}, {37768, 662, 7, 3}, {27096, 709, 8, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {27002, 692, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {39361, 811, 6, 3}, {0, 0, 0, 0}, {40513, 917, 8, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {10598, 95, 5, 1}, {0, 0, 0, 0},
+        {18670, 1793, 4, 1}, {31426, 87, 3, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {11047, 324, 3, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {22347, 2532, 7, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {4375, 645, 7, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {23995, 81, 6, 2}, {15198, 1155, 4, 1},
+        {5189, 779, 4, 0}, {0, 0, 0, 0}, {18182, 1694, 4, 1}, {30421, 1258, 7, 2},
+        {4458, 658, 4, 0}, {40802, 945, 6, 3}, {31914, 134, 6, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {10483, 67, 3, 1}, {11271, 371, 7, 1}, {29943, 1193, 8, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {15047, 1128, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {22905, 2664, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {7273, 1105, 6, 0}, {0, 0, 0, 0}, {31485, 94, 5, 3},
+        {0, 0, 0, 0}, {11262, 370, 9, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {27293, 741, 7, 2}, {0, 0, 0, 0}, {8191, 1244, 8, 0}, {10716, 129, 4, 1},
+        {18787, 1813, 6, 1}, {20075, 2071, 5, 1}, {19846, 2029, 7, 1}, {0, 0, 0, 0},
+        {32435, 175, 6, 3}, {20959, 2242, 5, 1}, {0, 0, 0, 0}, {32103, 148, 8, 3},
+        {11994, 506, 5, 1}, {0, 0, 0, 0}, {25614, 424, 7, 2}, {25831, 476, 5, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {16301, 765, 4, 2}, {0, 0, 0, 0}, {28772, 1011, 4, 2}, {19229, 1904, 5, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {2355, 352, 8, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {8026, 1219, 4, 0}, {17479, 1563, 6, 1},
+        {27329, 747, 4, 2}, {32415, 172, 4, 3}, {37356, 620, 5, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {478, 74, 6, 0},
+        {28276, 921, 7, 2}, {33135, 249, 7, 3}, {13616, 865, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {3533, 518, 9, 0}, {0, 0, 0, 0},
+        {28854, 1024, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {6934, 1044, 9, 0},
+        {0, 0, 0, 0}, {36320, 531, 4, 3}, {0, 0, 0, 0}, {18841, 1822, 6, 1},
+        {0, 0, 0, 0}, {205, 31, 6, 0}, {11133, 342, 4, 1}, {0, 0, 0, 0},
+        {3312, 488, 5, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {19654, 1988, 5, 1}, {0, 0, 0, 0},
+        {15689, 1233, 4, 1}, {26145, 537, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {13187, 748, 7, 1}, {0, 0, 0, 0},
+        {20463, 2147, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {38959, 771, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {7228, 1096, 4, 0},
+        {11477, 407, 9, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {24222, 137, 7, 2},
+        {35003, 413, 6, 3}, {0, 0, 0, 0}, {23390, 2764, 6, 1}, {40422, 910, 3, 3},
+        {13895, 926, 4, 1}, {17261, 1522, 5, 1}, {0, 0, 0, 0}, {18099, 1677, 6, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {11402, 395, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {1579, 244, 8, 0}, {2860, 419, 7, 0}, {8486, 1285, 6, 0},
+        {1926, 292, 7, 0}, {2974, 435, 5, 0}, {10418, 49, 4, 1}, {0, 0, 0, 0},
+        {11080, 331, 5, 1}, {35255, 436, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {20335, 2123, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {1314, 203, 6, 0}, {18155, 1688, 5, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {8779, 1332, 3, 0}, {0, 0, 0, 0},
+        {35723, 478, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {10334, 28, 4, 1},
+        {34417, 362, 5, 3}, {36975, 587, 7, 3}, {23687, 2823, 5, 1}, {36290, 527, 4, 3},
+        {20544, 2163, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {5663, 856, 9, 0},
+        {0, 0, 0, 0}, {3602, 528, 5, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {22052, 2464, 5, 1}, {0, 0, 0, 0}, {22827, 2647, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {25289, 363, 6, 2}, {11308, 378, 7, 1}, {0, 0, 0, 0},
+        {24547, 212, 4, 2}, {0, 0, 0, 0}, {16091, 1303, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {11891, 484, 3, 1}, {13052, 724, 5, 1}, {13975, 943, 6, 1},
+        {36579, 552, 5, 3}, {40375, 905, 4, 3}, {0, 0, 0, 0}, {23101, 2706, 5, 1},
+        {30056, 1208, 8, 2}, {4951, 281, 4, 1}, {39787, 850, 4, 3}, {0, 0, 0, 0},
+        {5903, 898, 6, 0}, {4315, 636, 8, 0}, {31705, 116, 3, 3}, {23042, 2694, 6, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {13103, 734, 5, 1},
+        {14090, 959, 8, 1}, {21403, 2331, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {23060, 2698, 5, 1}, {0, 0, 0, 0}, {14709, 1061, 4, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {443, 68, 6, 0}, {0, 0, 0, 0}, {31433, 88, 3, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {6486, 987, 9, 0},
+        {19964, 2049, 4, 1}, {21342, 2319, 5, 1}, {0, 0, 0, 0}, {24449, 190, 7, 2},
+        {39328, 808, 7, 3}, {0, 0, 0, 0}, {21151, 2280, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {28075, 884, 6, 2}, {35499, 458, 6, 3}, {0, 0, 0, 0}, {5225, 785, 8, 0},
+        {10712, 128, 4, 1}, {2306, 343, 4, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {22183, 2493, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {13928, 933, 4, 1},
+        {10057, 1529, 6, 0}, {10902, 193, 5, 1}, {36612, 555, 7, 3}, {37120, 600, 5, 3},
+        {39143, 790, 5, 3}, {39991, 868, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {14949, 1109, 8, 1}, {37203, 608, 5, 3}, {1247, 106, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {32495, 181, 3, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {39580, 829, 4, 3}, {5462, 821, 4, 0},
+        {33098, 245, 5, 3}, {0, 0, 0, 0}, {3324, 490, 6, 0}, {5480, 245, 5, 1},
+        {9968, 1516, 7, 0}, {2266, 334, 8, 0}, {29389, 1116, 9, 2}, {13231, 756, 7, 1},
+        {40567, 921, 3, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {38346, 716, 5, 3},
+        {0, 0, 0, 0}, {6728, 1017, 6, 0}, {21037, 2257, 3, 1}, {27355, 751, 7, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {32647, 198, 6, 3},
+        {19824, 2025, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {13175, 746, 4, 1},
+        {24416, 185, 6, 2}, {2781, 408, 10, 0}, {0, 0, 0, 0}, {28879, 1028, 7, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {14267, 984, 10, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {32213, 156, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {17212, 1512, 5, 1}, {34422, 363, 7, 3},
+        {0, 0, 0, 0}, {7161, 1083, 4, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {22660, 2604, 5, 1}, {16054, 1296, 6, 1}, {20241, 2106, 6, 1},
+        {8252, 1252, 9, 0}, {29435, 1123, 7, 2}, {28365, 934, 5, 2}, {30773, 7, 5, 3},
+        {32867, 222, 4, 3}, {0, 0, 0, 0}, {33623, 293, 4, 3}, {8492, 439, 9, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {4336, 639, 6, 0}, {6161, 941, 7, 0},
+        {11285, 373, 6, 1}, {30463, 1264, 8, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {13935, 935, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {18109, 1679, 7, 1},
+        {24159, 124, 8, 2}, {37034, 592, 9, 3}, {40326, 901, 6, 3}, {18814, 1817, 6, 1},
+        {0, 0, 0, 0}, {2103, 313, 8, 0}, {0, 0, 0, 0}, {34397, 361, 8, 3},
+        {28465, 955, 6, 2}, {38441, 725, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {16767, 1436, 6, 1}, {0, 0, 0, 0}, {26438, 587, 7, 2}, {8477, 1284, 9, 0},
+        {24744, 248, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {11726, 451, 5, 1},
+        {27931, 861, 7, 2}, {30380, 1252, 8, 2}, {37893, 672, 5, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {4754, 708, 4, 0},
+        {17805, 1624, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {28919, 1037, 8, 2}, {0, 0, 0, 0}, {10104, 1537, 6, 0}, {15058, 1130, 6, 1},
+        {33477, 282, 7, 3}, {37958, 679, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {31294, 71, 6, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {2127, 316, 7, 0}, {11711, 448, 4, 1},
+        {39075, 783, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {12482, 608, 8, 1},
+        {28447, 951, 6, 2}, {0, 0, 0, 0}, {490, 76, 8, 0}, {7207, 1093, 7, 0},
+        {7685, 1170, 15, 0}, {31314, 73, 3, 3}, {14929, 1105, 5, 1}, {20214, 2100, 5, 1},
+        {40476, 914, 5, 3}, {0, 0, 0, 0}, {7268, 1104, 5, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {18555, 1768, 3, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {7533, 1148, 8, 0}, {0, 0, 0, 0},
+        {15285, 1170, 4, 1}, {38949, 770, 5, 3}, {0, 0, 0, 0}, {20011, 2060, 6, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {18266, 1709, 8, 1},
+        {15709, 1238, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {3330, 491, 6, 0},
+        {0, 0, 0, 0}, {22057, 2465, 6, 1}, {24941, 287, 5, 2}, {4514, 668, 8, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {9492, 1448, 7, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {17629, 1589, 6, 1}, {4890, 283, 4, 1}, {9128, 1393, 6, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {14605, 1042, 7, 1},
+        {8844, 1344, 4, 0}, {39284, 804, 5, 3}, {0, 0, 0, 0}, {7774, 1180, 9, 0},
+        {0, 0, 0, 0}, {18937, 1844, 5, 1}, {32803, 215, 4, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {32849, 220, 6, 3}, {37281, 614, 8, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {9093, 516, 4, 2}, {25040, 307, 7, 2},
+        {0, 0, 0, 0}, {19991, 2055, 5, 1}, {34967, 410, 7, 3}, {0, 0, 0, 0},
+        {13990, 945, 8, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {26715, 636, 6, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {40707, 934, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {30950, 33, 4, 3}, {10590, 93, 4, 1}, {20661, 2188, 4, 1}, {39050, 780, 5, 3},
+        {4257, 628, 6, 0}, {35409, 449, 7, 3}, {0, 0, 0, 0}, {31711, 117, 7, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {35225, 433, 3, 3},
+        {39477, 820, 4, 3}, {39708, 842, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {18755, 1807, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {12127, 532, 5, 1}, {0, 0, 0, 0}, {8578, 1297, 6, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {22402, 2544, 4, 1},
+        {12241, 557, 4, 1}, {30183, 1225, 4, 2}, {33061, 241, 7, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {13194, 749, 6, 1},
+        {12638, 638, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {30837, 14, 6, 3}, {10467, 63, 5, 1}, {0, 0, 0, 0}, {18687, 1796, 6, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {19779, 2015, 4, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {13200, 750, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {30478, 1266, 7, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {551, 13, 7, 2}, {24259, 149, 5, 2}, {18564, 1771, 4, 1},
+        {27842, 845, 7, 2}, {26458, 590, 5, 2}, {9254, 1411, 8, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {21769, 2403, 6, 1}, {11700, 445, 4, 1},
+        {0, 0, 0, 0}, {3678, 541, 4, 0}, {39138, 789, 5, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {37916, 674, 6, 3}, {12205, 549, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {8679, 1313, 7, 0},
+        {170, 26, 6, 0}, {18526, 1762, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {9238, 1409, 10, 0}, {11757, 457, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {14332, 994, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {16779, 1438, 7, 1}, {19072, 744, 4, 3}, {30678, 1293, 8, 2}, {31495, 95, 4, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {36144, 513, 5, 3},
+        {0, 0, 0, 0}, {12745, 658, 6, 1}, {0, 0, 0, 0}, {21870, 2425, 4, 1},
+        {9371, 1430, 7, 0}, {33484, 282, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {15616, 1221, 6, 1}, {0, 0, 0, 0}, {19164, 1889, 4, 1}, {32653, 199, 6, 3},
+        {23930, 65, 4, 2}, {26584, 611, 5, 2}, {0, 0, 0, 0}, {1915, 290, 7, 0},
+        {17304, 984, 5, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {14513, 1026, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {24505, 204, 6, 2}, {8608, 1302, 8, 0},
+        {25748, 454, 5, 2}, {29465, 1127, 6, 2}, {5852, 891, 9, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {9571, 1174, 8, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {3588, 525, 7, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {8269, 1254, 10, 0}, {0, 0, 0, 0},
+        {37115, 600, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {3723, 548, 9, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {22311, 2522, 5, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {5959, 829, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {13165, 744, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {2796, 410, 6, 0},
+        {0, 0, 0, 0}, {39746, 846, 5, 3}, {27318, 745, 6, 2}, {35811, 486, 8, 3},
+        {0, 0, 0, 0}, {12881, 688, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {10726, 133, 3, 1}, {0, 0, 0, 0}, {14713, 1065, 4, 1},
+        {22289, 2517, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {13545, 850, 3, 1},
+        {12016, 510, 7, 1}, {14597, 1041, 8, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {10921, 196, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {30964, 35, 7, 3},
+        {39169, 792, 5, 3}, {21749, 2399, 5, 1}, {13355, 784, 5, 1}, {0, 0, 0, 0},
+        {24317, 160, 9, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {25711, 446, 7, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {22764, 2634, 5, 1}, {11943, 497, 4, 1}, {0, 0, 0, 0}, {18700, 1798, 7, 1},
+        {33389, 273, 4, 3}, {0, 0, 0, 0}, {30612, 1284, 8, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {14565, 1034, 5, 1}, {25860, 482, 5, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {13002, 714, 4, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {22552, 2578, 5, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {12654, 641, 5, 1}, {0, 0, 0, 0},
+        {16176, 1318, 5, 1}, {18036, 1666, 7, 1}, {0, 0, 0, 0}, {38192, 701, 4, 3},
+        {25117, 324, 6, 2}, {38633, 741, 5, 3}, {0, 0, 0, 0}, {15781, 1250, 6, 1},
+        {22769, 2635, 7, 1}, {18957, 1098, 4, 2}, {34053, 332, 4, 3}, {0, 0, 0, 0},
+        {19056, 1868, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {25769, 462, 7, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {38851, 761, 8, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {37741, 658, 4, 3}, {0, 0, 0, 0},
+        {3743, 551, 9, 0}, {0, 0, 0, 0}, {7138, 1078, 6, 0}, {36372, 535, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {22936, 988, 4, 2},
+        {25853, 481, 7, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {13774, 897, 5, 1}, {0, 0, 0, 0}, {30873, 17, 5, 3}, {0, 0, 0, 0},
+        {12664, 643, 4, 1}, {11813, 467, 6, 1}, {16268, 1337, 5, 1}, {13325, 776, 4, 1},
+        {19632, 1984, 7, 1}, {0, 0, 0, 0}, {10292, 18, 5, 1}, {16137, 1310, 8, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {38773, 755, 5, 3}, {10092, 1535, 7, 0}, {7363, 362, 9, 1},
+        {34633, 380, 8, 3}, {3752, 552, 8, 0}, {36119, 511, 5, 3}, {834, 128, 8, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {38568, 735, 5, 3}, {12300, 569, 5, 1},
+        {32441, 175, 5, 3}, {16871, 1454, 5, 1}, {8145, 1237, 6, 0}, {2424, 361, 6, 0},
+        {22301, 2520, 5, 1}, {7797, 1183, 8, 0}, {27916, 858, 9, 2}, {34049, 332, 4, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {29677, 1157, 8, 2}, {10800, 149, 3, 1}, {18344, 1725, 6, 1},
+        {22634, 2598, 5, 1}, {30832, 13, 5, 3}, {33254, 260, 6, 3}, {19219, 1902, 4, 1},
+        {24937, 286, 4, 2}, {4972, 192, 5, 1}, {38553, 734, 5, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {22140, 2482, 5, 1}, {0, 0, 0, 0}, {15001, 1119, 6, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {14098, 960, 7, 1}, {27925, 860, 6, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {29485, 1130, 10, 2}, {34987, 411, 6, 3},
+        {36699, 563, 9, 3}, {38598, 738, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {25818, 473, 7, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {4323, 637, 8, 0},
+        {0, 0, 0, 0}, {25943, 500, 6, 2}, {26252, 554, 7, 2}, {0, 0, 0, 0},
+        {15077, 1134, 6, 1}, {0, 0, 0, 0}, {7279, 1013, 6, 1}, {17754, 1615, 7, 1},
+        {21930, 2437, 6, 1}, {0, 0, 0, 0}, {12317, 573, 5, 1}, {26232, 552, 10, 2},
+        {38263, 708, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {29000, 1050, 4, 2}, {7736, 1175, 7, 0}, {15899, 1271, 5, 1},
+        {35228, 433, 3, 3}, {16714, 1426, 7, 1}, {17438, 1556, 6, 1}, {22831, 2648, 6, 1},
+        {39588, 830, 5, 3}, {0, 0, 0, 0}, {24826, 264, 4, 2}, {32200, 155, 7, 3},
+        {0, 0, 0, 0}, {37829, 666, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {38396, 720, 7, 3}, {25664, 435, 5, 2},
+        {6811, 1029, 9, 0}, {36558, 550, 5, 3}, {39886, 860, 7, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {29012, 1052, 5, 2}, {0, 0, 0, 0}, {8763, 201, 5, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {13713, 888, 7, 1}, {0, 0, 0, 0}, {564, 88, 7, 0},
+        {14976, 1113, 6, 1}, {15136, 1145, 6, 1}, {11857, 478, 8, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {40792, 944, 3, 3}, {0, 0, 0, 0}, {7111, 1072, 3, 0},
+        {0, 0, 0, 0}, {19081, 1873, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {19002, 1857, 4, 1}, {11678, 439, 3, 1}, {10286, 16, 3, 1},
+        {13932, 934, 3, 1}, {36963, 586, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {5139, 771, 5, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {19723, 2004, 4, 1}, {25805, 468, 4, 2}, {12760, 662, 6, 1},
+        {14825, 1089, 8, 1}, {8538, 1292, 8, 0}, {13006, 715, 8, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {31367, 80, 4, 3}, {0, 0, 0, 0}, {14006, 947, 13, 1},
+        {0, 0, 0, 0}, {79, 13, 6, 0}, {0, 0, 0, 0}, {21353, 2321, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {3201, 472, 7, 0}, {0, 0, 0, 0}, {27676, 811, 5, 2}, {15648, 1226, 4, 1},
+        {4967, 104, 5, 1}, {2290, 339, 4, 0}, {30946, 32, 4, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {22419, 2549, 3, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {24326, 161, 8, 2}, {34981, 411, 6, 3}, {1536, 238, 7, 0},
+        {36352, 534, 7, 3}, {22284, 2516, 5, 1}, {31062, 44, 9, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {22750, 2630, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {34536, 372, 6, 3}, {23531, 2790, 5, 1}, {0, 0, 0, 0},
+        {19223, 1903, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {6820, 1030, 8, 0}, {15643, 1225, 5, 1}, {7604, 1159, 9, 0}, {7971, 1210, 6, 0},
+        {32015, 142, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {30856, 15, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {2542, 378, 10, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {18630, 1785, 4, 1}, {15464, 1196, 8, 1}, {13870, 922, 7, 1}, {21942, 2439, 5, 1},
+        {25141, 331, 9, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {34808, 394, 9, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {19522, 1963, 6, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {24891, 277, 3, 2}, {15376, 1186, 6, 1}, {1733, 266, 4, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {27722, 819, 6, 2}, {29206, 1086, 6, 2},
+        {12336, 578, 10, 1}, {33383, 272, 3, 3}, {24565, 215, 6, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {12445, 601, 7, 1},
+        {36748, 568, 5, 3}, {14494, 1022, 3, 1}, {0, 0, 0, 0}, {39848, 856, 7, 3},
+        {37393, 624, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {16553, 1397, 6, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {32784, 212, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {19853, 2030, 6, 1},
+        {11099, 335, 3, 1}, {24642, 229, 3, 2}, {24483, 195, 7, 2}, {0, 0, 0, 0},
+        {19048, 1866, 4, 1}, {38463, 727, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {32604, 194, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {15486, 1200, 7, 1}, {17925, 1646, 4, 1}, {31421, 87, 5, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {21008, 425, 4, 3}, {21297, 2309, 8, 1}, {34291, 353, 8, 3},
+        {1443, 148, 8, 2}, {18640, 1787, 7, 1}, {20257, 2110, 7, 1}, {9033, 1377, 8, 0},
+        {0, 0, 0, 0}, {18497, 1756, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {23549, 2793, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {7198, 1091, 5, 0}, {10878, 165, 4, 1}, {17423, 1554, 7, 1}, {22316, 2523, 4, 1},
+        {40755, 940, 3, 3}, {36787, 571, 6, 3}, {0, 0, 0, 0}, {5891, 896, 7, 0},
+        {17711, 1607, 4, 1}, {30620, 1285, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {11742, 454, 7, 1}, {25705, 444, 6, 2},
+        {7263, 1103, 5, 0}, {34251, 349, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {22580, 2583, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {12751, 659, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {3500, 228, 4, 1}, {15276, 1169, 9, 1}, {35342, 444, 7, 3},
+        {0, 0, 0, 0}, {9248, 1410, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {2316, 345, 7, 0}, {31480, 93, 5, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {696, 107, 6, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {40445, 912, 6, 3}, {33025, 238, 6, 3}, {33499, 283, 7, 3}, {237, 36, 6, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {31328, 75, 3, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {19417, 1943, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {5723, 868, 7, 0},
+        {288, 44, 6, 0}, {37818, 665, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {21132, 2276, 5, 1},
+        {38330, 715, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {31611, 107, 6, 3}, {5473, 823, 7, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {17686, 1601, 4, 1}, {0, 0, 0, 0}, {30633, 1287, 7, 2},
+        {0, 0, 0, 0}, {17221, 1514, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {7833, 1188, 8, 0}, {26659, 626, 5, 2}, {27035, 699, 6, 2}, {10415, 48, 3, 1},
+        {32219, 157, 4, 3}, {36945, 585, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {22842, 2650, 4, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {39584, 829, 4, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {23070, 2700, 4, 1}, {1366, 10, 7, 2},
+        {0, 0, 0, 0}, {7917, 1201, 6, 0}, {8911, 27, 5, 3}, {27110, 711, 4, 2},
+        {38735, 751, 6, 3}, {12426, 597, 5, 1}, {0, 0, 0, 0}, {31554, 102, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {37371, 622, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {21258, 2302, 8, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {16927, 1465, 5, 1}, {0, 0, 0, 0}, {11242, 359, 6, 1}, {12857, 680, 8, 1},
+        {32659, 199, 6, 3}, {0, 0, 0, 0}, {26303, 561, 6, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {4634, 688, 6, 0},
+        {27450, 769, 4, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {20904, 2233, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {22460, 2558, 6, 1}, {0, 0, 0, 0},
+        {38859, 762, 5, 3}, {0, 0, 0, 0}, {29790, 1172, 6, 2}, {0, 0, 0, 0},
+        {28506, 964, 5, 2}, {38974, 773, 7, 3}, {3197, 471, 4, 0}, {3800, 559, 8, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {20086, 2073, 7, 1},
+        {16861, 1452, 5, 1}, {4774, 402, 4, 2}, {32460, 178, 7, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {14925, 473, 4, 3}, {19276, 1913, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {28413, 943, 6, 2}, {30827, 13, 5, 3},
+        {0, 0, 0, 0}, {1564, 242, 8, 0}, {3104, 456, 7, 0}, {27585, 794, 5, 2},
+        {33224, 257, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {37491, 632, 4, 3},
+        {0, 0, 0, 0}, {19311, 1921, 3, 1}, {19573, 1973, 6, 1}, {0, 0, 0, 0},
+        {14286, 986, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {27454, 770, 8, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {22909, 2665, 4, 1}, {11430, 400, 6, 1}, {17882, 1639, 6, 1}, {33452, 279, 3, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {40702, 934, 5, 3}, {7221, 1095, 7, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {36261, 525, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {37883, 671, 5, 3},
+        {27624, 801, 4, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {12555, 621, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {28890, 1031, 5, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {19495, 1958, 6, 1}, {10869, 164, 9, 1}, {21429, 2336, 7, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {20742, 2203, 6, 1}, {22019, 2455, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {2694, 396, 10, 0}, {8125, 1235, 7, 0}, {17010, 1481, 6, 1},
+        {0, 0, 0, 0}, {35775, 483, 5, 3}, {0, 0, 0, 0}, {13150, 742, 8, 1},
+        {27027, 697, 4, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {38604, 739, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {38585, 737, 4, 3}, {0, 0, 0, 0},
+        {34955, 408, 5, 3}, {14459, 1015, 4, 1}, {31273, 67, 3, 3}, {29596, 1146, 5, 2},
+        {2347, 351, 8, 0}, {35713, 477, 5, 3}, {39416, 815, 7, 3}, {12976, 708, 3, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {3619, 531, 5, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {31702, 115, 3, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {22320, 2524, 4, 1}, {30640, 1288, 7, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {16024, 1291, 5, 1}, {21660, 2380, 4, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {11021, 299, 7, 1}, {10612, 98, 3, 1}, {21811, 2412, 3, 1},
+        {12627, 636, 5, 1}, {7526, 1147, 7, 0}, {27894, 854, 7, 2}, {18150, 1687, 5, 1},
+        {13634, 870, 4, 1}, {23128, 2711, 5, 1}, {1688, 259, 7, 0}, {6028, 833, 4, 1},
+        {4270, 630, 8, 0}, {13253, 759, 5, 1}, {26351, 570, 6, 2}, {0, 0, 0, 0},
+        {10345, 31, 4, 1}, {34945, 407, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {16437, 1374, 5, 1}, {1525, 1, 5, 2},
+        {0, 0, 0, 0}, {21606, 2370, 7, 1}, {0, 0, 0, 0}, {12026, 512, 7, 1},
+        {21370, 2324, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {1695, 260, 5, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {6378, 971, 8, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {35522, 460, 4, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {7006, 1054, 6, 0}, {14970, 805, 6, 2}, {12988, 711, 3, 1}, {15844, 1260, 6, 1},
+        {25544, 413, 7, 2}, {30940, 31, 6, 3}, {0, 0, 0, 0}, {5929, 820, 3, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {27242, 732, 5, 2},
+        {0, 0, 0, 0}, {18892, 1833, 4, 1}, {27234, 731, 8, 2}, {0, 0, 0, 0},
+        {22451, 2556, 5, 1}, {28315, 927, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {19819, 2024, 5, 1}, {1466, 227, 7, 0}, {14379, 1002, 7, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {10407, 46, 4, 1}, {16667, 1418, 6, 1},
+        {31171, 54, 3, 3}, {34844, 397, 4, 3}, {12839, 676, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {4758, 709, 8, 0}, {0, 0, 0, 0},
+        {33526, 285, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {5578, 841, 11, 0}, {0, 0, 0, 0},
+        {17729, 1611, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {22949, 2674, 3, 1}, {27641, 806, 5, 2}, {4198, 621, 11, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {31055, 43, 7, 3}, {34669, 383, 5, 3}, {14553, 1032, 6, 1},
+        {12435, 599, 6, 1}, {35485, 457, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {12618, 634, 3, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {12050, 517, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {16866, 1453, 5, 1},
+        {21705, 2390, 4, 1}, {17995, 1658, 5, 1}, {28626, 983, 4, 2}, {3933, 580, 9, 0},
+        {4548, 673, 9, 0}, {0, 0, 0, 0}, {25061, 311, 4, 2}, {0, 0, 0, 0},
+        {6012, 821, 3, 1}, {8820, 1340, 8, 0}, {2949, 431, 4, 0}, {13727, 890, 6, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {4506, 666, 4, 0}, {17393, 1548, 4, 1}, {26873, 669, 3, 2},
+        {40289, 897, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {18358, 1728, 6, 1}, {5206, 782, 5, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {33533, 286, 10, 3}, {708, 109, 6, 0}, {0, 0, 0, 0}, {12700, 650, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {36451, 541, 8, 3}, {0, 0, 0, 0},
+        {35687, 474, 5, 3}, {35202, 430, 3, 3}, {34412, 362, 5, 3}, {8815, 345, 5, 2},
+        {39841, 856, 7, 3}, {10386, 41, 4, 1}, {20264, 2111, 5, 1}, {26181, 545, 7, 2},
+        {40606, 925, 6, 3}, {40712, 935, 6, 3}, {0, 0, 0, 0}, {2928, 428, 10, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {23987, 80, 8, 2}, {21978, 2447, 5, 1},
+        {26382, 575, 6, 2}, {18129, 1683, 6, 1}, {10255, 7, 3, 1}, {26883, 30, 7, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {12245, 558, 6, 1}, {20209, 2099, 5, 1},
+        {17309, 1531, 5, 1}, {0, 0, 0, 0}, {16980, 1475, 5, 1}, {8702, 18, 4, 2},
+        {9456, 1442, 8, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {38768, 754, 5, 3}, {24216, 135, 6, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {8841, 313, 3, 2},
+        {0, 0, 0, 0}, {30124, 1217, 8, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {7662, 1168, 11, 0}, {20513, 2156, 4, 1}, {4487, 300, 8, 1}, {0, 0, 0, 0},
+        {22272, 2513, 4, 1}, {33283, 262, 5, 3}, {2154, 319, 7, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {10651, 110, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {16786, 1439, 4, 1}, {23823, 25, 7, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {34065, 334, 3, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {8454, 358, 7, 2},
+        {16068, 1299, 5, 1}, {10561, 87, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {14497, 1023, 5, 1}, {13117, 737, 5, 1},
+        {14439, 1010, 4, 1}, {21656, 2379, 4, 1}, {31436, 89, 5, 3}, {38016, 686, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {2979, 436, 7, 0}, {20115, 2078, 6, 1},
+        {23656, 2815, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {26336, 567, 6, 2}, {38254, 707, 3, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {1384, 214, 6, 0}, {24576, 217, 7, 2}, {17707, 1606, 4, 1},
+        {35765, 482, 5, 3}, {0, 0, 0, 0}, {36902, 581, 7, 3}, {0, 0, 0, 0},
+        {11650, 433, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {9473, 1445, 5, 0},
+        {1859, 282, 7, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {27261, 735, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {15809, 1254, 6, 1},
+        {9314, 1420, 13, 0}, {8402, 84, 5, 2}, {40808, 946, 10, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {31269, 67, 4, 3},
+        {35625, 469, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {36898, 580, 4, 3}, {0, 0, 0, 0}, {13533, 846, 4, 1},
+        {6734, 1018, 7, 0}, {31461, 91, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {18023, 1663, 3, 1}, {26957, 684, 5, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {9352, 1426, 5, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {17920, 1645, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {28873, 1027, 6, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {5944, 906, 7, 0}, {34435, 364, 9, 3}, {3049, 275, 8, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {498, 20, 6, 2},
+        {23055, 2697, 5, 1}, {35444, 454, 8, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {37639, 647, 6, 3}, {19267, 1911, 4, 1}, {21446, 2339, 6, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {11516, 412, 8, 1}, {926, 142, 7, 0},
+        {4569, 676, 5, 0}, {13625, 867, 5, 1}, {39791, 850, 4, 3}, {4574, 677, 6, 0},
+        {16458, 1379, 5, 1}, {22758, 2633, 6, 1}, {16204, 1324, 4, 1}, {13653, 874, 5, 1},
+        {16450, 1377, 4, 1}, {32665, 200, 4, 3}, {37014, 591, 6, 3}, {40216, 888, 4, 3},
+        {0, 0, 0, 0}, {29896, 1187, 8, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {32549, 187, 5, 3}, {10213, 1556, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {17266, 1523, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {26934, 248, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {22880, 2659, 5, 1}, {0, 0, 0, 0}, {19470, 1953, 3, 1}, {0, 0, 0, 0},
+        {9003, 1373, 7, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {35692, 474, 5, 3},
+        {25792, 466, 8, 2}, {0, 0, 0, 0}, {6194, 379, 4, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {31760, 122, 6, 3}, {37599, 643, 4, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {16773, 1437, 6, 1}, {37327, 618, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {31971, 138, 6, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {3191, 470, 6, 0}, {7333, 367, 8, 1}, {9565, 868, 6, 1}, {25490, 403, 8, 2},
+        {29325, 1106, 7, 2}, {0, 0, 0, 0}, {29767, 1169, 8, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {532, 83, 6, 0}, {18145, 1686, 5, 1}, {35549, 463, 7, 3},
+        {0, 0, 0, 0}, {20525, 2159, 6, 1}, {13258, 760, 5, 1}, {23169, 2720, 6, 1},
+        {0, 0, 0, 0}, {14053, 954, 8, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {38811, 758, 3, 3}, {13688, 882, 6, 1}, {0, 0, 0, 0},
+        {980, 150, 6, 0}, {23916, 60, 6, 2}, {36951, 585, 6, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {9199, 1404, 7, 0}, {22357, 2534, 3, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {472, 73, 6, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {37557, 639, 4, 3},
+        {5356, 803, 8, 0}, {32183, 154, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {8972, 1368, 6, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {7632, 1164, 5, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {24136, 120, 6, 2}, {40258, 893, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {38433, 724, 4, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {3122, 459, 8, 0}, {33816, 310, 4, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {22972, 2679, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {2378, 355, 12, 0}, {8588, 1299, 5, 0},
+        {23133, 2712, 5, 1}, {32486, 180, 6, 3}, {0, 0, 0, 0}, {23106, 2707, 6, 1},
+        {0, 0, 0, 0}, {36771, 570, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {11235, 358, 7, 1},
+        {16721, 1427, 6, 1}, {28295, 924, 7, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {17973, 1654, 5, 1}, {0, 0, 0, 0}, {1832, 279, 9, 0},
+        {7819, 1186, 7, 0}, {0, 0, 0, 0}, {6105, 933, 6, 0}, {0, 0, 0, 0},
+        {24965, 292, 5, 2}, {25669, 436, 7, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {17239, 1517, 5, 1}, {22254, 2508, 4, 1}, {12325, 575, 3, 1}, {31868, 131, 7, 3},
+        {27737, 822, 6, 2}, {20777, 2210, 4, 1}, {0, 0, 0, 0}, {25275, 357, 4, 2},
+        {12909, 693, 4, 1}, {22686, 2610, 4, 1}, {26151, 538, 6, 2}, {30160, 1222, 8, 2},
+        {33712, 301, 7, 3}, {9275, 1414, 9, 0}, {36501, 544, 7, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {35161, 427, 8, 3},
+        {21177, 2285, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {2992, 438, 10, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {2912, 426, 6, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {34218, 345, 4, 3}, {31029, 41, 4, 3},
+        {0, 0, 0, 0}, {15856, 1262, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {10832, 156, 6, 1}, {23900, 52, 5, 2}, {32223, 157, 4, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {38909, 766, 5, 3},
+        {11909, 488, 4, 1}, {26599, 615, 5, 2}, {0, 0, 0, 0}, {17244, 1518, 7, 1},
+        {24531, 209, 5, 2}, {0, 0, 0, 0}, {35043, 416, 8, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {20808, 2216, 7, 1}, {0, 0, 0, 0},
+        {25574, 418, 6, 2}, {39761, 847, 5, 3}, {0, 0, 0, 0}, {13519, 841, 5, 1},
+        {18615, 1782, 4, 1}, {9623, 1466, 8, 0}, {8790, 42, 6, 2}, {36330, 532, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {33314, 265, 6, 3}, {9995, 1520, 8, 0},
+        {0, 0, 0, 0}, {29553, 1139, 5, 2}, {0, 0, 0, 0}, {32871, 223, 6, 3},
+        {17941, 1649, 7, 1}, {0, 0, 0, 0}, {12561, 622, 4, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {37500, 633, 5, 3}, {37968, 681, 4, 3}, {16851, 1450, 5, 1},
+        {20151, 2085, 4, 1}, {27426, 762, 5, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {14790, 1080, 5, 1}, {9089, 1385, 4, 0}, {0, 0, 0, 0},
+        {8205, 1246, 8, 0}, {5105, 766, 5, 0}, {19727, 2005, 6, 1}, {25776, 464, 8, 2},
+        {31285, 69, 3, 3}, {0, 0, 0, 0}, {807, 107, 8, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {10689, 121, 4, 1}, {10349, 32, 4, 1},
+        {31263, 66, 3, 3}, {32139, 150, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {10701, 124, 7, 1}, {36082, 508, 6, 3}, {34705, 386, 9, 3}, {23257, 2736, 6, 1},
+        {33832, 312, 5, 3}, {38094, 693, 8, 3}, {33653, 296, 6, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {630, 5, 7, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {18666, 1792, 4, 1}, {29927, 1191, 9, 2}, {26721, 637, 5, 2},
+        {30276, 1238, 8, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {5466, 822, 7, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {2461, 367, 6, 0},
+        {14075, 957, 6, 1}, {0, 0, 0, 0}, {30000, 1200, 9, 2}, {27362, 752, 6, 2},
+        {0, 0, 0, 0}, {3146, 463, 6, 0}, {35423, 452, 6, 3}, {0, 0, 0, 0},
+        {34519, 371, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {26507, 599, 6, 2}, {34934, 406, 3, 3}, {0, 0, 0, 0}, {23784, 2842, 4, 1},
+        {11106, 337, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {9829, 1497, 7, 0},
+        {17397, 1549, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {39713, 843, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {35169, 427, 8, 3}, {20371, 2130, 5, 1}, {9946, 1513, 5, 0}, {4733, 705, 7, 0},
+        {10747, 138, 4, 1}, {13017, 717, 6, 1}, {27288, 740, 5, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {11533, 414, 10, 1}, {25411, 386, 4, 2}, {0, 0, 0, 0}, {2396, 357, 8, 0},
+        {0, 0, 0, 0}, {5909, 899, 5, 0}, {0, 0, 0, 0}, {24880, 275, 6, 2},
+        {33837, 312, 5, 3}, {38638, 742, 5, 3}, {14203, 976, 7, 1}, {0, 0, 0, 0},
+        {33596, 290, 9, 3}, {0, 0, 0, 0}, {16047, 1295, 7, 1}, {0, 0, 0, 0},
+        {13132, 739, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {12668, 644, 6, 1}, {0, 0, 0, 0}, {7935, 1204, 6, 0},
+        {12570, 625, 6, 1}, {14738, 1070, 7, 1}, {27279, 738, 5, 2}, {0, 0, 0, 0},
+        {2728, 400, 7, 0}, {36525, 546, 5, 3}, {14350, 997, 6, 1}, {0, 0, 0, 0},
+        {770, 118, 7, 0}, {19304, 1919, 7, 1}, {0, 0, 0, 0}, {10225, 318, 6, 1},
+        {32688, 202, 5, 3}, {0, 0, 0, 0}, {23577, 2799, 8, 1}, {3381, 498, 10, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {23376, 2761, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {21071, 2264, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {9631, 1467, 7, 0}, {0, 0, 0, 0},
+        {16423, 1371, 5, 1}, {7408, 1126, 3, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {28620, 982, 6, 2}, {22028, 2459, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {17498, 1566, 5, 1}, {0, 0, 0, 0},
+        {38918, 767, 4, 3}, {14751, 267, 5, 3}, {23434, 2772, 5, 1}, {0, 0, 0, 0},
+        {17671, 1598, 5, 1}, {18857, 1826, 4, 1}, {1922, 261, 4, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {26342, 568, 4, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {3228, 476, 6, 0}, {9706, 1478, 5, 0},
+        {38040, 688, 5, 3}, {3092, 176, 3, 3}, {16790, 1440, 6, 1}, {38282, 710, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {19252, 1908, 5, 1},
+        {34674, 383, 6, 3}, {0, 0, 0, 0}, {31732, 119, 5, 3}, {0, 0, 0, 0},
+        {1005, 154, 6, 0}, {35907, 493, 8, 3}, {0, 0, 0, 0}, {7989, 1213, 6, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {22606, 2589, 4, 1}, {16893, 1459, 4, 1},
+        {24739, 247, 5, 2}, {0, 0, 0, 0}, {21613, 2371, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {6, 2, 8, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {6443, 980, 7, 0},
+        {16685, 1005, 6, 2}, {25718, 448, 4, 2}, {26000, 510, 5, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {11090, 333, 9, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {16352, 1355, 4, 1}, {0, 0, 0, 0},
+        {23847, 33, 8, 2}, {13311, 772, 3, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {31130, 49, 5, 3}, {39855, 857, 5, 3}, {12410, 594, 6, 1}, {0, 0, 0, 0},
+        {35191, 429, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {23439, 2773, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {20227, 2103, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {34261, 350, 6, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {19505, 1960, 5, 1},
+        {1105, 169, 6, 0}, {29336, 1108, 9, 2}, {0, 0, 0, 0}, {10594, 94, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {39703, 842, 5, 3}, {0, 0, 0, 0},
+        {11737, 453, 5, 1}, {6210, 394, 5, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {10623, 101, 5, 1}, {17102, 1495, 7, 1}, {7462, 1136, 3, 0},
+        {20127, 2080, 3, 1}, {31654, 110, 5, 3}, {39910, 862, 7, 3}, {0, 0, 0, 0},
+        {7285, 1107, 5, 0}, {0, 0, 0, 0}, {35851, 489, 5, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {3630, 533, 7, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {22501, 2567, 5, 1}, {20981, 2246, 6, 1}, {22736, 2625, 5, 1}, {33119, 247, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {34340, 356, 6, 3}, {0, 0, 0, 0},
+        {18885, 1832, 7, 1}, {25465, 396, 3, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {29222, 1089, 7, 2}, {3451, 507, 9, 0}, {5183, 778, 6, 0},
+        {15142, 1146, 8, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {19795, 2019, 4, 1}, {0, 0, 0, 0}, {2028, 304, 9, 0}, {0, 0, 0, 0},
+        {22165, 2487, 4, 1}, {35856, 489, 5, 3}, {4034, 596, 7, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {2986, 125, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {34839, 397, 5, 3}, {0, 0, 0, 0}, {3921, 578, 6, 0}, {31363, 80, 4, 3},
+        {0, 0, 0, 0}, {4168, 616, 7, 0}, {13602, 862, 4, 1}, {0, 0, 0, 0},
+        {20969, 2244, 7, 1}, {34832, 396, 7, 3}, {26987, 689, 5, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {37315, 617, 6, 3}, {6353, 968, 12, 0},
+        {0, 0, 0, 0}, {22618, 2594, 3, 1}, {0, 0, 0, 0}, {36722, 565, 6, 3},
+        {28776, 1012, 7, 2}, {26726, 638, 5, 2}, {23720, 2829, 4, 1}, {27023, 696, 4, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {31378, 82, 3, 3}, {34090, 337, 8, 3},
+        {0, 0, 0, 0}, {22965, 2678, 7, 1}, {39351, 810, 5, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {4356, 239, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {36871, 578, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {40194, 886, 5, 3},
+        {0, 0, 0, 0}, {35057, 417, 5, 3}, {18947, 1846, 4, 1}, {16521, 1391, 6, 1},
+        {25311, 369, 6, 2}, {10204, 1555, 9, 0}, {3220, 475, 8, 0}, {35761, 481, 4, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {2959, 433, 9, 0}, {0, 0, 0, 0}, {26680, 630, 5, 2}, {2900, 424, 7, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {2808, 412, 6, 0},
+        {15838, 1259, 6, 1}, {27229, 730, 5, 2}, {33012, 237, 6, 3}, {0, 0, 0, 0},
+        {351, 54, 6, 0}, {4209, 622, 8, 0}, {35770, 482, 5, 3}, {18067, 1672, 7, 1},
+        {0, 0, 0, 0}, {7929, 1203, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {4665, 693, 8, 0}, {0, 0, 0, 0},
+        {22456, 2557, 4, 1}, {32287, 163, 7, 3}, {0, 0, 0, 0}, {1227, 40, 7, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {8244, 1251, 8, 0}, {0, 0, 0, 0}, {27041, 700, 6, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {35391, 448, 5, 3}, {11543, 415, 6, 1},
+        {16454, 1378, 4, 1}, {36294, 528, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {26537, 603, 6, 2},
+        {0, 0, 0, 0}, {31374, 81, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {25031, 305, 4, 2}, {0, 0, 0, 0}, {26901, 674, 4, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {29796, 1173, 6, 2},
+        {0, 0, 0, 0}, {19368, 1932, 6, 1}, {20023, 2062, 6, 1}, {0, 0, 0, 0},
+        {27492, 777, 6, 2}, {21916, 2434, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {16334, 1351, 3, 1}, {0, 0, 0, 0}, {12100, 526, 4, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {15876, 1265, 3, 1}, {34106, 338, 7, 3}, {34892, 401, 5, 3},
+        {12277, 564, 5, 1}, {17865, 1634, 8, 1}, {398, 61, 8, 0}, {28136, 896, 7, 2},
+        {0, 0, 0, 0}, {5788, 879, 4, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {10167, 320, 6, 1}, {0, 0, 0, 0}, {4110, 608, 7, 0}, {12328, 576, 5, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {22668, 2606, 3, 1},
+        {18274, 1710, 6, 1}, {27574, 791, 6, 2}, {24651, 231, 6, 2}, {34733, 388, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {1900, 288, 7, 0},
+        {31226, 60, 3, 3}, {18308, 1718, 7, 1}, {25728, 450, 6, 2}, {10656, 111, 4, 1},
+        {0, 0, 0, 0}, {15083, 1135, 6, 1}, {15850, 1261, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {33665, 297, 7, 3},
+        {0, 0, 0, 0}, {34646, 381, 5, 3}, {39209, 796, 5, 3}, {38249, 706, 5, 3},
+        {0, 0, 0, 0}, {31359, 79, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {6282, 960, 10, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {953, 8, 6, 2}, {38082, 692, 6, 3},
+        {31737, 119, 5, 3}, {0, 0, 0, 0}, {656, 101, 7, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {8286, 6, 5, 2}, {12886, 689, 5, 1}, {13496, 818, 6, 1},
+        {27104, 710, 6, 2}, {27821, 841, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {6682, 1010, 4, 0}, {0, 0, 0, 0}, {3884, 573, 11, 0},
+        {0, 0, 0, 0}, {31403, 85, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {3391, 499, 8, 0}, {0, 0, 0, 0}, {39148, 790, 4, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {3317, 489, 7, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {14069, 956, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {40739, 938, 5, 3},
+        {33987, 326, 5, 3}, {17690, 1602, 4, 1}, {17217, 1513, 4, 1}, {29640, 1152, 8, 2},
+        {13843, 595, 4, 3}, {0, 0, 0, 0}, {4397, 649, 8, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {861, 132, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {16565, 1399, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {1766, 271, 9, 0},
+        {23301, 2746, 5, 1}, {38310, 713, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {1017, 156, 7, 0}, {26013, 513, 7, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {322, 49, 4, 0},
+        {0, 0, 0, 0}, {31147, 51, 4, 3}, {0, 0, 0, 0}, {16086, 1302, 5, 1},
+        {36716, 565, 6, 3}, {0, 0, 0, 0}, {9339, 1423, 5, 0}, {12096, 525, 4, 1},
+        {26654, 624, 5, 2}, {0, 0, 0, 0}, {10907, 194, 8, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {12510, 612, 4, 1}, {33894, 318, 3, 3}, {26765, 647, 7, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {32394, 170, 5, 3}, {2713, 398, 6, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {3840, 566, 4, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {22229, 2502, 5, 1},
+        {0, 0, 0, 0}, {18062, 1671, 5, 1}, {27247, 733, 7, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {28657, 992, 7, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {39005, 775, 5, 3}, {24587, 219, 5, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {30372, 1251, 8, 2}, {14723, 1068, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {25865, 483, 4, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {6772, 1023, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {34764, 391, 5, 3}, {13368, 787, 3, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {17742, 1613, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {6669, 1007, 5, 0}, {0, 0, 0, 0}, {11315, 379, 6, 1}, {20753, 2205, 5, 1},
+        {0, 0, 0, 0}, {2327, 347, 4, 0}, {14490, 1021, 4, 1}, {5378, 807, 9, 0},
+        {11257, 369, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {29163, 1075, 8, 2}, {37541, 637, 7, 3}, {0, 0, 0, 0}, {20406, 2136, 5, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {4894, 732, 8, 0},
+        {28668, 994, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {16011, 1289, 5, 1}, {27907, 857, 9, 2}, {0, 0, 0, 0},
+        {5057, 759, 5, 0}, {1409, 218, 5, 0}, {11460, 405, 10, 1}, {30106, 1214, 6, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {18548, 1767, 7, 1}, {0, 0, 0, 0},
+        {5485, 825, 6, 0}, {34825, 396, 7, 3}, {13035, 721, 7, 1}, {29518, 1134, 9, 2},
+        {24886, 276, 5, 2}, {31546, 101, 3, 3}, {37660, 649, 5, 3}, {22258, 2509, 4, 1},
+        {39020, 778, 7, 3}, {7012, 1055, 6, 0}, {0, 0, 0, 0}, {8091, 1230, 7, 0},
+        {7430, 1131, 7, 0}, {0, 0, 0, 0}, {29708, 1161, 9, 2}, {31543, 101, 3, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {20930, 2237, 6, 1},
+        {2323, 346, 4, 0}, {11043, 323, 4, 1}, {0, 0, 0, 0}, {25449, 392, 5, 2},
+        {0, 0, 0, 0}, {21254, 2301, 4, 1}, {0, 0, 0, 0}, {19878, 2034, 5, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {10512, 74, 4, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {13798, 903, 5, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {22324, 2526, 4, 1}, {32708, 205, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {30401, 1255, 6, 2}, {33633, 294, 6, 3},
+        {6546, 994, 9, 0}, {21040, 2258, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {10647, 108, 4, 1}, {19328, 1924, 6, 1}, {24625, 225, 6, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {11329, 381, 5, 1},
+        {12632, 637, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {20365, 2129, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {9511, 1450, 7, 0}, {0, 0, 0, 0}, {19867, 2032, 6, 1}, {33506, 284, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {40385, 906, 5, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {29904, 1188, 8, 2},
+        {18861, 1827, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {20624, 2181, 5, 1}, {4417, 652, 7, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {7437, 1132, 5, 0}, {15042, 1127, 5, 1},
+        {7062, 1063, 7, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {37412, 625, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {27437, 767, 10, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {30701, 1296, 8, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {1403, 217, 6, 0}, {2215, 327, 8, 0}, {6679, 529, 3, 3}, {12922, 696, 6, 1},
+        {0, 0, 0, 0}, {11291, 374, 6, 1}, {0, 0, 0, 0}, {7826, 1187, 7, 0},
+        {23704, 2826, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {12964, 705, 4, 1},
+        {22585, 2584, 5, 1}, {38070, 691, 6, 3}, {0, 0, 0, 0}, {11321, 380, 8, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {21634, 2375, 4, 1}, {30075, 1210, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {18807, 1816, 7, 1}, {0, 0, 0, 0}, {10446, 56, 4, 1}, {20468, 2148, 5, 1},
+        {39164, 792, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {39527, 825, 8, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {28114, 892, 4, 2}, {38838, 760, 5, 3}, {19388, 1935, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {5964, 909, 7, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {11183, 350, 9, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {7592, 131, 6, 1},
+        {0, 0, 0, 0}, {12565, 624, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {24970, 293, 5, 2}, {40393, 907, 3, 3}, {0, 0, 0, 0}, {14532, 1029, 9, 1},
+        {0, 0, 0, 0}, {36067, 506, 5, 3}, {31308, 72, 3, 3}, {7174, 1086, 7, 0},
+        {18321, 1720, 3, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {16463, 1380, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {25557, 415, 8, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {4677, 695, 8, 0}, {22639, 2599, 5, 1},
+        {2061, 308, 6, 0}, {1664, 256, 8, 0}, {39127, 788, 5, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {23632, 2810, 8, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {35517, 459, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {26164, 542, 5, 2}, {0, 0, 0, 0}, {30655, 1290, 10, 2},
+        {0, 0, 0, 0}, {27732, 821, 5, 2}, {26068, 523, 5, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {7372, 365, 8, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {2488, 371, 9, 0}, {10509, 73, 3, 1}, {13812, 908, 4, 1}, {22681, 2609, 5, 1},
+        {23542, 2792, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {28959, 1043, 10, 2},
+        {13946, 937, 4, 1}, {0, 0, 0, 0}, {9069, 472, 8, 2}, {21754, 2400, 5, 1},
+        {1473, 175, 6, 1}, {27156, 718, 5, 2}, {26617, 618, 6, 2}, {0, 0, 0, 0},
+        {11845, 475, 4, 1}, {22179, 2492, 4, 1}, {5173, 776, 6, 0}, {38164, 698, 5, 3},
+        {11228, 357, 7, 1}, {22119, 2478, 5, 1}, {22746, 2627, 4, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {28109, 891, 5, 2},
+        {0, 0, 0, 0}, {5575, 840, 3, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {23382, 2762, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {39980, 867, 5, 3}, {23760, 2837, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {357, 12, 6, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {20171, 2090, 4, 1}, {26160, 541, 4, 2}, {0, 0, 0, 0},
+        {16369, 1360, 3, 1}, {29511, 1133, 7, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {24875, 274, 5, 2}, {0, 0, 0, 0}, {24494, 202, 7, 2}, {0, 0, 0, 0},
+        {16363, 878, 6, 2}, {23203, 2726, 6, 1}, {24951, 290, 8, 2}, {20181, 2093, 5, 1},
+        {9437, 1438, 4, 0}, {11692, 443, 4, 1}, {0, 0, 0, 0}, {29121, 1069, 8, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {9638, 1468, 6, 0}, {10693, 122, 4, 1},
+        {34239, 348, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {27161, 719, 5, 2},
+        {2606, 386, 8, 0}, {12155, 537, 4, 1}, {12398, 592, 6, 1}, {38116, 694, 5, 3},
+        {39501, 823, 8, 3}, {30139, 1219, 8, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {35923, 494, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {12659, 642, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {5831, 830, 5, 1},
+        {9649, 1470, 4, 0}, {31749, 121, 5, 3}, {6428, 978, 10, 0}, {31520, 98, 4, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {10641, 107, 6, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {12542, 618, 5, 1},
+        {1725, 265, 8, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {22603, 2588, 3, 1}, {31465, 92, 5, 3}, {11174, 349, 9, 1}, {37629, 646, 4, 3},
+        {17615, 1586, 6, 1}, {8468, 1283, 9, 0}, {16691, 1422, 6, 1}, {264, 40, 6, 0},
+        {38969, 772, 5, 3}, {17846, 1631, 6, 1}, {39657, 836, 3, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {8872, 101, 4, 2},
+        {28941, 1040, 8, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {6892, 1038, 9, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {5042, 288, 5, 1}, {0, 0, 0, 0}, {28245, 916, 7, 2},
+        {25734, 451, 4, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {29422, 1121, 6, 2}, {35619, 468, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {23158, 2717, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {38456, 726, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {33726, 302, 4, 3},
+        {0, 0, 0, 0}, {5932, 904, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {22192, 2495, 6, 1}, {20651, 2186, 5, 1}, {32227, 158, 5, 3}, {34333, 356, 7, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {26045, 519, 6, 2}, {13171, 745, 4, 1}, {9766, 1486, 8, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {2893, 278, 7, 1}, {3865, 570, 3, 0}, {30586, 1281, 8, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {14110, 963, 5, 1}, {0, 0, 0, 0},
+        {20284, 2115, 5, 1}, {0, 0, 0, 0}, {20309, 2119, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {32905, 226, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {25653, 433, 6, 2}, {36114, 511, 5, 3}, {37495, 633, 5, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {23788, 2843, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {36149, 514, 5, 3}, {0, 0, 0, 0},
+        {34821, 395, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {32455, 177, 5, 3},
+        {16316, 1347, 4, 1}, {36312, 530, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {35026, 414, 8, 3}, {32545, 187, 4, 3}, {0, 0, 0, 0},
+        {29288, 1100, 5, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {39372, 812, 7, 3},
+        {39542, 826, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {1396, 216, 7, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {39356, 810, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {28346, 931, 4, 2}, {24334, 162, 6, 2}, {0, 0, 0, 0}, {4410, 240, 7, 1},
+        {4985, 309, 6, 1}, {17329, 1536, 8, 1}, {40047, 872, 7, 3}, {0, 0, 0, 0},
+        {28050, 880, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {40825, 947, 7, 3},
+        {37950, 678, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {8557, 1294, 6, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {35034, 415, 4, 3}, {0, 0, 0, 0},
+        {8947, 655, 5, 2}, {42, 7, 4, 0}, {0, 0, 0, 0}, {21291, 2308, 6, 1},
+        {0, 0, 0, 0}, {8978, 1369, 5, 0}, {0, 0, 0, 0}, {27646, 807, 8, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {17194, 1509, 8, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {31452, 90, 4, 3}, {37868, 670, 5, 3},
+        {9143, 1396, 6, 0}, {15832, 1258, 6, 1}, {38382, 719, 7, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {12271, 563, 6, 1}, {3707, 546, 7, 0},
+        {0, 0, 0, 0}, {5629, 613, 3, 2}, {29442, 1124, 8, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {36877, 578, 7, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {21879, 2427, 7, 1},
+        {0, 0, 0, 0}, {35708, 476, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {3372, 497, 9, 0}, {15222, 1160, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {18847, 1823, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {37366, 621, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {2310, 344, 6, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {17401, 1550, 6, 1}, {0, 0, 0, 0}, {9535, 126, 5, 1}, {32193, 155, 7, 3},
+        {37976, 682, 8, 3}, {0, 0, 0, 0}, {18492, 1755, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {36324, 532, 6, 3}, {0, 0, 0, 0}, {40096, 877, 7, 3},
+        {9518, 1451, 9, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {24009, 85, 5, 2},
+        {1160, 178, 6, 0}, {26855, 666, 6, 2}, {20017, 2061, 6, 1}, {27304, 743, 5, 2},
+        {31745, 120, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {19085, 1874, 4, 1},
+        {20833, 2220, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {26398, 578, 6, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {18337, 1723, 3, 1}, {0, 0, 0, 0},
+        {39198, 795, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {17475, 1562, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {29761, 1168, 6, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {28471, 958, 6, 2}, {7905, 1199, 6, 0},
+        {0, 0, 0, 0}, {16833, 1447, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {7100, 1070, 5, 0}, {16581, 1402, 6, 1}, {28706, 1000, 6, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {15371, 1185, 5, 1},
+        {23122, 2710, 6, 1}, {26483, 594, 5, 2}, {32319, 165, 11, 3}, {36931, 583, 4, 3},
+        {0, 0, 0, 0}, {7105, 1071, 6, 0}, {8907, 138, 4, 2}, {29692, 1159, 7, 2},
+        {33125, 247, 6, 3}, {36994, 589, 4, 3}, {16571, 1400, 7, 1}, {0, 0, 0, 0},
+        {26664, 627, 5, 2}, {32404, 171, 6, 3}, {39118, 787, 4, 3}, {30990, 37, 4, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {26938, 681, 8, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {16145, 1312, 4, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {8996, 1372, 7, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {22039, 2461, 4, 1}, {5290, 794, 7, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {23556, 2794, 5, 1}, {28458, 954, 7, 2},
+        {30414, 1257, 7, 2}, {40179, 884, 7, 3}, {20590, 2174, 4, 1}, {40541, 919, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {40601, 924, 5, 3}, {38363, 718, 6, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {19763, 2012, 6, 1}, {0, 0, 0, 0}, {16654, 1416, 8, 1},
+        {17066, 1490, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {27511, 780, 7, 2}, {0, 0, 0, 0}, {40618, 926, 7, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {5370, 805, 5, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {6345, 967, 8, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {6474, 985, 6, 0},
+        {31679, 113, 6, 3}, {11824, 469, 4, 1}, {24788, 257, 7, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {25936, 499, 7, 2},
+        {21847, 2420, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {18516, 1760, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {4510, 178, 4, 2}, {16802, 1442, 5, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {13113, 736, 4, 1},
+        {27151, 717, 5, 2}, {31637, 109, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {28686, 997, 6, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {21828, 2416, 5, 1}, {25225, 346, 4, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {30959, 34, 5, 3}, {17935, 1648, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {3579, 524, 9, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {34913, 404, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {11688, 442, 4, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {20720, 2199, 5, 1},
+        {37888, 672, 5, 3}, {40338, 902, 5, 3}, {22024, 2456, 4, 1}, {0, 0, 0, 0},
+        {5769, 834, 8, 1}, {0, 0, 0, 0}, {17835, 1629, 6, 1}, {0, 0, 0, 0},
+        {30536, 1274, 11, 2}, {30923, 28, 3, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {31343, 77, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {17665, 1597, 6, 1}, {35420, 451, 3, 3}, {38257, 708, 6, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {9711, 1479, 7, 0},
+        {0, 0, 0, 0}, {15167, 1150, 7, 1}, {2454, 366, 7, 0}, {3760, 553, 7, 0},
+        {4653, 691, 4, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {35927, 494, 4, 3}, {0, 0, 0, 0}, {8546, 11, 11, 2}, {0, 0, 0, 0},
+        {19598, 1978, 6, 1}, {0, 0, 0, 0}, {20247, 2107, 5, 1}, {30237, 1233, 6, 2},
+        {34061, 333, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {26051, 520, 5, 2},
+        {38579, 736, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {39834, 855, 7, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {20231, 2104, 6, 1}, {0, 0, 0, 0},
+        {10684, 120, 5, 1}, {326, 50, 7, 0}, {25295, 365, 4, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {40379, 906, 6, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {1030, 158, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {12186, 544, 4, 1},
+        {13227, 755, 4, 1}, {20136, 2082, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {28143, 897, 5, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {16761, 1435, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {35644, 470, 7, 3}, {22479, 2563, 6, 1}, {4080, 220, 5, 1}, {12420, 596, 6, 1},
+        {21638, 2376, 5, 1}, {23241, 2733, 6, 1}, {30204, 1228, 5, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {7977, 1211, 6, 0},
+        {0, 0, 0, 0}, {27580, 793, 5, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {25960, 503, 4, 2}, {38497, 729, 6, 3}, {39214, 797, 4, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {14822, 1088, 3, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {3360, 495, 4, 0}, {40240, 891, 3, 3}, {3687, 543, 6, 0},
+        {0, 0, 0, 0}, {27660, 809, 8, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {8983, 1370, 6, 0}, {38088, 692, 6, 3}, {0, 0, 0, 0}, {17830, 1628, 5, 1},
+        {0, 0, 0, 0}, {30815, 11, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {27612, 799, 7, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {23453, 2776, 6, 1}, {0, 0, 0, 0},
+        {8698, 15, 4, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {21624, 404, 6, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {16633, 1412, 5, 1}, {40130, 880, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {20955, 2241, 4, 1}, {21806, 2411, 5, 1}, {40390, 907, 3, 3}, {39522, 824, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {35592, 466, 8, 3},
+        {6971, 1049, 9, 0}, {14454, 1014, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {22328, 2527, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {29717, 1162, 9, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {25229, 347, 7, 2}, {0, 0, 0, 0}, {913, 140, 6, 0}, {39827, 855, 7, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {2844, 417, 7, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {6119, 935, 9, 0},
+        {0, 0, 0, 0}, {12834, 675, 5, 1}, {8884, 139, 5, 2}, {28237, 914, 4, 2},
+        {17320, 1533, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {20772, 2209, 5, 1}, {0, 0, 0, 0},
+        {30665, 1291, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {35780, 483, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {28309, 926, 6, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {20767, 2208, 5, 1}, {22422, 2550, 5, 1}, {0, 0, 0, 0},
+        {22665, 2605, 3, 1}, {29478, 1129, 7, 2}, {30740, 4, 6, 3}, {13321, 775, 4, 1},
+        {29974, 1197, 7, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {13881, 924, 9, 1},
+        {0, 0, 0, 0}, {25784, 465, 8, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {8711, 39, 5, 2}, {2121, 315, 6, 0}, {3336, 492, 8, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {4606, 683, 3, 0}, {0, 0, 0, 0}, {20449, 2144, 5, 1},
+        {13350, 783, 5, 1}, {27710, 817, 8, 2}, {30223, 1231, 7, 2}, {34548, 373, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {15871, 1264, 5, 1}, {17455, 1559, 7, 1},
+        {0, 0, 0, 0}, {3650, 536, 8, 0}, {12766, 663, 6, 1}, {29176, 1077, 5, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {19687, 1996, 6, 1}, {0, 0, 0, 0},
+        {24501, 203, 4, 2}, {35302, 441, 8, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {24059, 98, 3, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {24907, 280, 5, 2}, {33646, 295, 7, 3}, {3305, 487, 7, 0},
+        {0, 0, 0, 0}, {12033, 513, 3, 1}, {32237, 159, 6, 3}, {16733, 1429, 5, 1},
+        {38153, 697, 6, 3}, {9446, 1440, 4, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {19168, 1890, 4, 1}, {0, 0, 0, 0},
+        {8668, 28, 5, 2}, {0, 0, 0, 0}, {37309, 616, 6, 3}, {8319, 1261, 9, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {20827, 2219, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {339, 9, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {24821, 263, 5, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {8686, 30, 4, 2},
+        {22885, 2660, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {9083, 539, 6, 2},
+        {36062, 506, 5, 3}, {0, 0, 0, 0}, {28949, 1041, 5, 2}, {23274, 2739, 6, 1},
+        {571, 89, 9, 0}, {34937, 406, 3, 3}, {0, 0, 0, 0}, {11198, 352, 5, 1},
+        {27273, 737, 6, 2}, {18395, 1736, 6, 1}, {15007, 1120, 5, 1}, {36197, 518, 6, 3},
+        {36927, 583, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {39997, 869, 7, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {5310, 797, 14, 0}, {26259, 555, 8, 2}, {39963, 866, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {35247, 435, 8, 3}, {38722, 750, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {13087, 731, 5, 1}, {40635, 927, 5, 3}, {12853, 679, 4, 1},
+        {38357, 717, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {33878, 316, 4, 3},
+        {27968, 867, 6, 2}, {30031, 1204, 7, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {32720, 206, 6, 3}, {35750, 480, 7, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {2918, 427, 10, 0}, {5087, 763, 6, 0},
+        {38027, 687, 4, 3}, {32693, 203, 4, 3}, {1643, 253, 13, 0}, {0, 0, 0, 0},
+        {10933, 246, 5, 1}, {25284, 362, 5, 2}, {30910, 25, 4, 3}, {0, 0, 0, 0},
+        {17281, 1526, 7, 1}, {0, 0, 0, 0}, {13388, 792, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {27182, 724, 8, 2}, {0, 0, 0, 0}, {23526, 2789, 5, 1},
+        {0, 0, 0, 0}, {25931, 498, 5, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {6057, 926, 6, 0}, {3702, 545, 5, 0}, {11470, 406, 7, 1},
+        {30291, 1240, 11, 2}, {38222, 704, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {12783, 666, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {26502, 23, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {40547, 919, 5, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {4097, 606, 7, 0},
+        {0, 0, 0, 0}, {12991, 712, 5, 1}, {9748, 1484, 8, 0}, {0, 0, 0, 0},
+        {12968, 706, 4, 1}, {14474, 1018, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {27387, 756, 7, 2}, {17540, 1574, 4, 1},
+        {32911, 227, 5, 3}, {0, 0, 0, 0}, {27431, 766, 6, 2}, {9468, 1444, 5, 0},
+        {21188, 2287, 6, 1}, {23882, 45, 5, 2}, {15529, 1206, 9, 1}, {35827, 487, 7, 3},
+        {10665, 113, 3, 1}, {37954, 679, 4, 3}, {0, 0, 0, 0}, {10520, 76, 4, 1},
+        {0, 0, 0, 0}, {33448, 279, 4, 3}, {39034, 779, 6, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {5330, 799, 8, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {1660, 255, 4, 0}, {0, 0, 0, 0}, {38035, 688, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {6604, 1000, 10, 0}, {3613, 530, 6, 0}, {25163, 334, 5, 2}, {10979, 272, 5, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {20559, 2167, 5, 1}, {0, 0, 0, 0},
+        {16006, 556, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {28357, 933, 8, 2}, {37834, 667, 4, 3},
+        {0, 0, 0, 0}, {6260, 957, 7, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {6023, 832, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {24918, 282, 4, 2},
+        {0, 0, 0, 0}, {19675, 1994, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {26062, 522, 6, 2},
+        {2518, 375, 8, 0}, {20289, 2116, 7, 1}, {36685, 562, 5, 3}, {40267, 894, 4, 3},
+        {39101, 785, 5, 3}, {0, 0, 0, 0}, {16418, 1370, 5, 1}, {4867, 727, 7, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {23148, 2715, 5, 1}, {21947, 2441, 5, 1},
+        {29409, 1119, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {3786, 557, 4, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {14258, 983, 9, 1}, {0, 0, 0, 0},
+        {29966, 1196, 8, 2}, {32163, 152, 6, 3}, {0, 0, 0, 0}, {30395, 1254, 6, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {19803, 2021, 3, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {6712, 1015, 8, 0},
+        {8521, 1290, 10, 0}, {23870, 37, 5, 2}, {29912, 1189, 7, 2}, {0, 0, 0, 0},
+        {4389, 647, 4, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {19346, 1928, 6, 1},
+        {0, 0, 0, 0}, {13455, 810, 3, 1}, {36247, 523, 5, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {20359, 2128, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {21886, 2428, 6, 1}, {19517, 1962, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {13537, 847, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {5546, 836, 8, 0}, {16485, 1384, 6, 1}, {0, 0, 0, 0}, {7085, 1067, 4, 0},
+        {39106, 786, 4, 3}, {12918, 695, 4, 1}, {39114, 787, 4, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {16325, 1349, 4, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {9429, 1437, 8, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {17028, 1484, 6, 1}, {19806, 2022, 6, 1},
+        {0, 0, 0, 0}, {2095, 312, 8, 0}, {13092, 732, 4, 1}, {0, 0, 0, 0},
+        {38111, 694, 5, 3}, {0, 0, 0, 0}, {15551, 1209, 5, 1}, {0, 0, 0, 0},
+        {18871, 1829, 5, 1}, {0, 0, 0, 0}, {21492, 2347, 5, 1}, {0, 0, 0, 0},
+        {38421, 722, 6, 3}, {0, 0, 0, 0}, {39724, 844, 7, 3}, {32673, 201, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {14675, 1055, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {13593, 860, 4, 1},
+        {0, 0, 0, 0}, {34313, 354, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {21108, 2272, 6, 1}, {8232, 1249, 6, 0}, {31560, 103, 7, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {12104, 527, 5, 1},
+        {34318, 355, 8, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {37701, 654, 5, 3}, {466, 72, 6, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {37223, 610, 7, 3}, {16060, 1297, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {13792, 901, 6, 1},
+        {0, 0, 0, 0}, {31790, 125, 8, 3}, {0, 0, 0, 0}, {14541, 1030, 7, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {34908, 403, 5, 3}, {0, 0, 0, 0}, {5525, 832, 6, 0}, {25585, 420, 6, 2},
+        {0, 0, 0, 0}, {23027, 2691, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {2286, 338, 4, 0}, {35480, 456, 5, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {37423, 626, 5, 3}, {10378, 39, 4, 1}, {20059, 2068, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {39985, 868, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {3028, 444, 3, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {9803, 1492, 5, 0}, {2570, 381, 9, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {40025, 871, 8, 3},
+        {0, 0, 0, 0}, {5502, 828, 6, 0}, {17251, 1520, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {25504, 406, 4, 2}, {11137, 343, 7, 1},
+        {33582, 289, 5, 3}, {34306, 354, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {21162, 2282, 5, 1}, {20121, 2079, 6, 1}, {36267, 525, 6, 3}, {0, 0, 0, 0},
+        {29171, 1076, 5, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {14032, 950, 7, 1}, {6654, 1005, 7, 0}, {12490, 609, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {36211, 519, 8, 3}, {39294, 805, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {19501, 1959, 4, 1}, {5161, 774, 7, 0}, {31212, 57, 4, 3},
+        {3130, 460, 7, 0}, {26604, 616, 6, 2}, {32063, 145, 7, 3}, {0, 0, 0, 0},
+        {24184, 128, 5, 2}, {28613, 981, 7, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {12394, 591, 4, 1}, {0, 0, 0, 0}, {38491, 729, 6, 3},
+        {783, 120, 5, 0}, {19749, 2009, 4, 1}, {26699, 633, 6, 2}, {0, 0, 0, 0},
+        {2410, 359, 6, 0}, {0, 0, 0, 0}, {15476, 1198, 4, 1}, {0, 0, 0, 0},
+        {11209, 354, 7, 1}, {229, 35, 8, 0}, {20047, 2066, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {7947, 1206, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {14019, 948, 5, 1}, {0, 0, 0, 0}, {26543, 604, 7, 2}, {0, 0, 0, 0},
+        {4030, 595, 4, 0}, {20444, 2143, 5, 1}, {28975, 1045, 5, 2}, {33260, 260, 5, 3},
+        {39261, 802, 5, 3}, {0, 0, 0, 0}, {17878, 1637, 4, 1}, {37518, 635, 4, 3},
+        {40403, 908, 8, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {3693, 544, 9, 0}, {12612, 633, 6, 1}, {34179, 342, 6, 3}, {8745, 55, 6, 2},
+        {2046, 306, 9, 0}, {5515, 830, 5, 0}, {34005, 327, 7, 3}, {5821, 885, 6, 0},
+        {0, 0, 0, 0}, {25891, 489, 4, 2}, {0, 0, 0, 0}, {5938, 905, 6, 0},
+        {10370, 37, 4, 1}, {15064, 1131, 3, 1}, {32843, 219, 6, 3}, {34031, 329, 5, 3},
+        {7246, 1100, 7, 0}, {19830, 2026, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {26817, 658, 8, 2}, {7805, 1184, 6, 0},
+        {29839, 1179, 8, 2}, {31160, 53, 5, 3}, {23894, 49, 6, 2}, {37112, 599, 3, 3},
+        {516, 80, 6, 0}, {7652, 1167, 10, 0}, {8163, 7, 5, 3}, {34618, 379, 7, 3},
+        {25208, 342, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {23006, 2686, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {11731, 452, 6, 1}, {0, 0, 0, 0}, {12011, 509, 5, 1},
+        {0, 0, 0, 0}, {12441, 600, 4, 1}, {17516, 1569, 7, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {10138, 1543, 5, 0}, {0, 0, 0, 0},
+        {38869, 763, 7, 3}, {0, 0, 0, 0}, {10442, 55, 4, 1}, {38300, 712, 4, 3},
+        {0, 0, 0, 0}, {17810, 1625, 8, 1}, {1711, 263, 8, 0}, {10322, 25, 3, 1},
+        {37561, 639, 4, 3}, {13158, 743, 7, 1}, {37345, 619, 6, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {32771, 211, 5, 3}, {32859, 221, 4, 3},
+        {0, 0, 0, 0}, {39700, 841, 3, 3}, {13589, 859, 4, 1}, {21701, 2389, 4, 1},
+        {35793, 485, 9, 3}, {0, 0, 0, 0}, {25023, 304, 8, 2}, {34128, 339, 8, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {1284, 198, 6, 0}, {12551, 180, 4, 2},
+        {16515, 1390, 6, 1}, {17841, 1630, 5, 1}, {18460, 832, 5, 2}, {33738, 303, 4, 3},
+        {40232, 890, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {35310, 441, 9, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {22741, 2626, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {25317, 370, 4, 2},
+        {0, 0, 0, 0}, {40846, 950, 8, 3}, {0, 0, 0, 0}, {1340, 207, 7, 0},
+        {2260, 333, 6, 0}, {19234, 1905, 6, 1}, {21085, 2268, 7, 1}, {28585, 977, 7, 2},
+        {35127, 423, 6, 3}, {2278, 336, 4, 0}, {35631, 469, 6, 3}, {0, 0, 0, 0},
+        {22548, 2576, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {745, 115, 10, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {23270, 2738, 4, 1}, {0, 0, 0, 0},
+        {24130, 119, 6, 2}, {0, 0, 0, 0}, {26363, 572, 7, 2}, {4785, 713, 5, 0},
+        {4834, 722, 9, 0}, {28436, 948, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {18261, 1708, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {24288, 154, 8, 2},
+        {2076, 310, 9, 0}, {28836, 1021, 8, 2}, {0, 0, 0, 0}, {4331, 236, 5, 1},
+        {5677, 858, 6, 0}, {6155, 419, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {27668, 810, 8, 2},
+        {0, 0, 0, 0}, {13014, 716, 3, 1}, {37208, 609, 8, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {29304, 1103, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {8593, 1300, 7, 0}, {22544, 2575, 4, 1}, {20495, 2153, 5, 1}, {33200, 255, 4, 3},
+        {37469, 630, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {18475, 1752, 5, 1}, {33094, 244, 4, 3}, {0, 0, 0, 0}, {2085, 311, 10, 0},
+        {10962, 269, 7, 1}, {0, 0, 0, 0}, {35578, 465, 5, 3}, {40744, 938, 4, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {14443, 1011, 5, 1}, {24753, 250, 6, 2},
+        {6151, 939, 4, 0}, {7135, 849, 3, 1}, {8183, 1243, 8, 0}, {32022, 142, 6, 3},
+        {37067, 596, 9, 3}, {10430, 52, 3, 1}, {29035, 1056, 5, 2}, {37505, 634, 4, 3},
+        {0, 0, 0, 0}, {10779, 144, 5, 1}, {33511, 284, 6, 3}, {0, 0, 0, 0},
+        {945, 145, 8, 0}, {0, 0, 0, 0}, {30994, 37, 4, 3}, {10395, 43, 4, 1},
+        {30155, 1221, 5, 2}, {23209, 2727, 6, 1}, {0, 0, 0, 0}, {26295, 560, 8, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {15734, 1242, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {14463, 1016, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {18248, 1706, 8, 1}, {31151, 51, 4, 3}, {6674, 475, 5, 2},
+        {15727, 1241, 7, 1}, {35743, 480, 7, 3}, {36659, 560, 5, 3}, {37761, 661, 4, 3},
+        {0, 0, 0, 0}, {15207, 1157, 3, 1}, {36764, 569, 7, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {4225, 624, 9, 0},
+        {4942, 739, 9, 0}, {28154, 900, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {14627, 1045, 8, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {17984, 1656, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {11983, 504, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {34854, 398, 5, 3}, {0, 0, 0, 0}, {4902, 733, 7, 0}, {1117, 171, 6, 0},
+        {22927, 2669, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {8423, 114, 8, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {20069, 2070, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {28490, 961, 5, 2}, {36753, 568, 4, 3}, {11828, 470, 5, 1}, {40818, 946, 7, 3},
+        {20326, 2122, 9, 1}, {23605, 2805, 6, 1}, {0, 0, 0, 0}, {40736, 937, 3, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {17978, 1655, 6, 1}, {33462, 280, 7, 3}, {4066, 601, 6, 0}, {9406, 1435, 9, 0},
+        {24075, 103, 6, 2}, {28830, 1020, 6, 2}, {0, 0, 0, 0}, {11085, 176, 5, 2},
+        {153, 24, 10, 0}, {11144, 344, 8, 1}, {31141, 50, 6, 3}, {36366, 535, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {23094, 2705, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {16826, 1446, 7, 1}, {9975, 364, 8, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {11152, 345, 10, 1}, {30267, 1237, 9, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {21004, 2250, 4, 1},
+        {35205, 431, 5, 3}, {0, 0, 0, 0}, {23418, 2769, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {31606, 106, 5, 3}, {15935, 1277, 6, 1}, {0, 0, 0, 0},
+        {15887, 1268, 5, 1}, {23386, 2763, 4, 1}, {0, 0, 0, 0}, {22149, 2484, 5, 1},
+        {22427, 2551, 5, 1}, {33377, 271, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {14765, 1075, 4, 1}, {18080, 1674, 6, 1},
+        {4122, 211, 6, 1}, {14081, 958, 9, 1}, {35526, 460, 4, 3}, {39772, 848, 5, 3},
+        {0, 0, 0, 0}, {7959, 1208, 6, 0}, {0, 0, 0, 0}, {30527, 1273, 9, 2},
+        {34057, 333, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {7073, 1065, 8, 0}, {16700, 1424, 7, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {5098, 765, 7, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {12362, 583, 5, 1}, {2704, 397, 9, 0},
+        {3095, 455, 9, 0}, {10179, 319, 5, 1}, {23956, 72, 7, 2}, {5011, 86, 5, 1},
+        {25551, 414, 6, 2}, {28753, 1008, 6, 2}, {37922, 675, 5, 3}, {27017, 695, 6, 2},
+        {39598, 831, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {9818, 307, 5, 1}, {8407, 104, 4, 2}, {16796, 1441, 6, 1}, {33142, 250, 4, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {2673, 394, 11, 0}, {0, 0, 0, 0}, {15420, 1191, 6, 1}, {0, 0, 0, 0},
+        {9983, 1518, 5, 0}, {20339, 2124, 6, 1}, {35613, 468, 6, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {16538, 1394, 5, 1},
+        {0, 0, 0, 0}, {31920, 134, 6, 3}, {223, 34, 6, 0}, {13502, 823, 4, 1},
+        {11585, 421, 6, 1}, {5596, 843, 5, 0}, {20682, 2192, 5, 1}, {17095, 1494, 7, 1},
+        {24152, 123, 7, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {8916, 142, 8, 2},
+        {5424, 264, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {39088, 784, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {33417, 276, 7, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {7049, 1061, 6, 0}, {25921, 496, 4, 2},
+        {24039, 95, 5, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {11071, 329, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {25743, 453, 5, 2}, {23982, 79, 5, 2},
+        {33078, 243, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {13998, 946, 8, 1},
+        {2239, 330, 9, 0}, {18116, 899, 4, 3}, {2331, 348, 4, 0}, {28644, 989, 8, 2},
+        {31201, 56, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {1085, 166, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {4715, 702, 7, 0}, {14318, 992, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {38316, 714, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {37575, 641, 6, 3},
+        {14695, 1059, 8, 1}, {39158, 791, 6, 3}, {16290, 1342, 6, 1}, {23423, 2770, 6, 1},
+        {39535, 825, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {21436, 2337, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {12902, 692, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {36242, 523, 5, 3},
+        {33068, 242, 5, 3}, {31347, 78, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {32498, 182, 5, 3}, {26975, 687, 4, 2}, {37063, 595, 4, 3}, {0, 0, 0, 0},
+        {24189, 129, 5, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {663, 102, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {1752, 269, 8, 0}, {13963, 941, 7, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {11987, 505, 7, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {22984, 2681, 6, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {14992, 764, 4, 2}, {0, 0, 0, 0}, {13285, 766, 5, 1},
+        {20269, 2112, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {37617, 645, 7, 3}, {2534, 377, 8, 0}, {34791, 393, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {13023, 718, 3, 1},
+        {19705, 2000, 6, 1}, {12547, 619, 4, 1}, {6038, 923, 11, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {7899, 1198, 6, 0}, {9671, 1474, 7, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {21619, 2372, 5, 1}, {19883, 2035, 7, 1}, {21240, 2298, 5, 1},
+        {24405, 182, 5, 2}, {2404, 358, 6, 0}, {4673, 694, 4, 0}, {32560, 188, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {12041, 515, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {16846, 1449, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {15802, 1253, 7, 1},
+        {37216, 609, 7, 3}, {0, 0, 0, 0}, {31135, 50, 6, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {12174, 541, 3, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {33031, 239, 5, 3}, {0, 0, 0, 0}, {36584, 552, 6, 3},
+        {12346, 579, 4, 1}, {12383, 588, 4, 1}, {36188, 517, 4, 3}, {0, 0, 0, 0},
+        {13371, 763, 4, 2}, {0, 0, 0, 0}, {7094, 1069, 6, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {20146, 2084, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {3668, 539, 5, 0}, {0, 0, 0, 0}, {10411, 47, 4, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {2510, 374, 8, 0}, {15704, 1237, 5, 1}, {6400, 974, 6, 0},
+        {6841, 1032, 7, 0}, {29254, 1094, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {24583, 218, 4, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {22485, 2564, 4, 1}, {34391, 360, 6, 3},
+        {20080, 2072, 6, 1}, {0, 0, 0, 0}, {31276, 68, 3, 3}, {21531, 2354, 6, 1},
+        {22489, 2565, 6, 1}, {36273, 526, 6, 3}, {23459, 2777, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {27309, 744, 9, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {27485, 776, 7, 2},
+        {0, 0, 0, 0}, {11334, 382, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {32083, 146, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {25659, 434, 5, 2}, {35651, 471, 9, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {18744, 1805, 5, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {21911, 2433, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {27047, 701, 8, 2}, {6750, 1020, 8, 0},
+        {621, 96, 9, 0}, {15741, 1243, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {1425, 17, 6, 2}, {17462, 1560, 6, 1},
+        {0, 0, 0, 0}, {24536, 210, 5, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {25076, 316, 8, 2}, {39900, 861, 5, 3}, {0, 0, 0, 0}, {31674, 112, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {20109, 2077, 6, 1}, {20382, 2132, 6, 1}, {23776, 2840, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {6828, 1031, 13, 0}, {18647, 1788, 5, 1}, {20613, 2179, 6, 1}, {22698, 2617, 3, 1},
+        {38692, 747, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {22990, 2682, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {8758, 63, 5, 2},
+        {36219, 520, 5, 3}, {0, 0, 0, 0}, {19094, 1876, 7, 1}, {25628, 426, 4, 2},
+        {28895, 1033, 4, 2}, {9348, 1425, 4, 0}, {26970, 686, 5, 2}, {0, 0, 0, 0},
+        {39437, 817, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {27705, 816, 5, 2}, {0, 0, 0, 0}, {23344, 533, 5, 2},
+        {39027, 778, 7, 3}, {10680, 118, 4, 1}, {29685, 1158, 7, 2}, {0, 0, 0, 0},
+        {29558, 1140, 7, 2}, {40417, 909, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {13857, 919, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {32697, 203, 4, 3}, {4880, 177, 6, 1},
+        {40854, 951, 9, 3}, {32571, 189, 5, 3}, {4252, 627, 5, 0}, {0, 0, 0, 0},
+        {10143, 1544, 6, 0}, {12845, 677, 8, 1}, {15390, 1188, 11, 1}, {30448, 1262, 7, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {8733, 1324, 7, 0}, {17165, 1504, 7, 1},
+        {7380, 364, 10, 1}, {28130, 895, 6, 2}, {1791, 274, 9, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {8563, 1295, 7, 0}, {11609, 426, 8, 1},
+        {18777, 1811, 5, 1}, {7029, 1058, 8, 0}, {36733, 566, 5, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {28745, 1007, 8, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {21183, 2286, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {39299, 806, 7, 3}, {36554, 549, 4, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {6198, 948, 5, 0}, {13078, 729, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {29819, 1176, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {17208, 1511, 4, 1}, {33868, 315, 6, 3}, {0, 0, 0, 0}, {19121, 1881, 6, 1},
+        {4025, 594, 5, 0}, {0, 0, 0, 0}, {4722, 703, 7, 0}, {10069, 316, 7, 1},
+        {32617, 195, 5, 3}, {20517, 2157, 3, 1}, {31503, 96, 6, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {38573, 736, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {23048, 2696, 7, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {3426, 503, 8, 0},
+        {10915, 195, 6, 1}, {25341, 375, 8, 2}, {39055, 781, 4, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {4055, 222, 5, 1}, {20748, 2204, 5, 1}, {21227, 2295, 3, 1},
+        {31334, 76, 3, 3}, {36626, 556, 5, 3}, {38589, 737, 4, 3}, {0, 0, 0, 0},
+        {37296, 615, 7, 3}, {0, 0, 0, 0}, {26685, 631, 8, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {1549, 240, 8, 0}, {36619, 555, 7, 3}, {27718, 818, 4, 2},
+        {0, 0, 0, 0}, {32895, 225, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {8720, 1322, 8, 0}, {13970, 942, 5, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {21719, 2393, 5, 1},
+        {0, 0, 0, 0}, {13925, 932, 3, 1}, {30302, 1241, 8, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {30284, 1239, 7, 2}, {27992, 871, 7, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {2480, 370, 8, 0}, {14774, 1077, 4, 1}, {10319, 24, 3, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {22629, 2597, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {9102, 1388, 6, 0}, {24662, 233, 9, 2}, {0, 0, 0, 0}, {2587, 383, 6, 0},
+        {3170, 467, 8, 0}, {19066, 1870, 6, 1}, {22337, 2530, 5, 1}, {0, 0, 0, 0},
+        {21901, 2431, 5, 1}, {0, 0, 0, 0}, {11062, 328, 9, 1}, {37475, 631, 6, 3},
+        {0, 0, 0, 0}, {27938, 862, 4, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {40246, 892, 4, 3}, {20568, 2169, 4, 1},
+        {26924, 678, 5, 2}, {0, 0, 0, 0}, {12201, 548, 4, 1}, {17603, 1584, 8, 1},
+        {19114, 1880, 7, 1}, {20998, 2249, 6, 1}, {33455, 280, 7, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {23292, 2744, 4, 1}, {19357, 1930, 5, 1}, {24051, 97, 8, 2},
+        {13541, 848, 4, 1}, {0, 0, 0, 0}, {20274, 2113, 5, 1}, {1608, 209, 5, 1},
+        {3290, 485, 7, 0}, {35452, 454, 8, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {3908, 576, 6, 0}, {12333, 521, 3, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {37793, 664, 10, 3}, {0, 0, 0, 0},
+        {35051, 416, 6, 3}, {5658, 855, 5, 0}, {27604, 798, 8, 2}, {17485, 1564, 6, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {14582, 1038, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {4405, 650, 5, 0}, {39489, 821, 8, 3}, {0, 0, 0, 0},
+        {23714, 2828, 6, 1}, {11667, 436, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {40089, 876, 7, 3}, {0, 0, 0, 0}, {9149, 1397, 7, 0},
+        {25196, 340, 6, 2}, {939, 144, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {11486, 408, 7, 1}, {21579, 2363, 4, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {34068, 334, 3, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {39430, 816, 7, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {8297, 1258, 8, 0}, {1320, 204, 8, 0}, {24148, 122, 4, 2}, {22802, 2641, 5, 1},
+        {32370, 168, 8, 3}, {36203, 519, 8, 3}, {40469, 914, 7, 3}, {38696, 748, 3, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {36131, 512, 7, 3},
+        {19604, 1979, 6, 1}, {40575, 922, 4, 3}, {18340, 1724, 4, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {36546, 548, 4, 3}, {0, 0, 0, 0}, {18225, 1702, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {16812, 1444, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {13862, 920, 4, 1},
+        {0, 0, 0, 0}, {6964, 1048, 7, 0}, {12621, 635, 6, 1}, {0, 0, 0, 0},
+        {40125, 879, 5, 3}, {0, 0, 0, 0}, {22082, 2470, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {7025, 1057, 4, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {30325, 1244, 7, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {1873, 284, 6, 0},
+        {3844, 567, 5, 0}, {30868, 17, 5, 3}, {24571, 216, 5, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {7398, 1124, 4, 0}, {8690, 34, 4, 2}, {24845, 268, 5, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {21137, 2277, 4, 1}, {34229, 347, 5, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {21120, 2274, 6, 1},
+        {11898, 486, 6, 1}, {21764, 2402, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {11976, 503, 7, 1}, {7941, 1205, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {17894, 1641, 8, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {31573, 104, 8, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {19922, 2041, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {28692, 998, 7, 2}, {36088, 508, 6, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {2363, 353, 10, 0}, {0, 0, 0, 0}, {16727, 1428, 6, 1},
+        {6644, 1004, 10, 0}, {0, 0, 0, 0}, {39252, 800, 5, 3}, {3607, 529, 6, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {28017, 874, 10, 2}, {0, 0, 0, 0},
+        {28717, 1002, 7, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {31588, 105, 6, 3},
+        {40160, 883, 6, 3}, {32541, 186, 4, 3}, {0, 0, 0, 0}, {22961, 2677, 4, 1},
+        {26847, 664, 8, 2}, {28118, 893, 7, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {28093, 888, 6, 2}, {24095, 109, 9, 2}, {32726, 206, 6, 3},
+        {16679, 1420, 6, 1}, {38763, 754, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {25404, 385, 7, 2}, {3064, 335, 5, 2}, {0, 0, 0, 0}, {18577, 1774, 4, 1},
+        {0, 0, 0, 0}, {30251, 1235, 8, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {40498, 916, 8, 3}, {24611, 223, 6, 2}, {0, 0, 0, 0}, {38755, 753, 8, 3},
+        {0, 0, 0, 0}, {22567, 2581, 7, 1}, {0, 0, 0, 0}, {16920, 1464, 7, 1},
+        {0, 0, 0, 0}, {37927, 676, 5, 3}, {3249, 479, 4, 0}, {21412, 2333, 5, 1},
+        {0, 0, 0, 0}, {39665, 838, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {23799, 2845, 4, 1}, {2467, 368, 6, 0}, {3732, 549, 7, 0}, {0, 0, 0, 0},
+        {8570, 1296, 8, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {14643, 1048, 6, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {28911, 1036, 8, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {38292, 711, 4, 3}, {14, 3, 8, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {15268, 1168, 8, 1},
+        {0, 0, 0, 0}, {13597, 861, 5, 1}, {21814, 2413, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {28064, 882, 6, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {37481, 631, 6, 3}, {29298, 1102, 6, 2}, {15382, 1187, 8, 1},
+        {0, 0, 0, 0}, {8861, 145, 5, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {33888, 317, 6, 3}, {20732, 2201, 5, 1}, {17888, 1640, 6, 1}, {40773, 942, 5, 3},
+        {33848, 313, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {20006, 2059, 5, 1},
+        {40558, 920, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {31238, 62, 4, 3},
+        {24770, 254, 6, 2}, {25646, 431, 7, 2}, {35370, 446, 4, 3}, {38135, 696, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {19555, 1970, 7, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {5144, 772, 8, 0}, {0, 0, 0, 0}, {9308, 1419, 6, 0},
+        {18043, 1667, 3, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {13680, 451, 3, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {14039, 951, 5, 1}, {9614, 1465, 9, 0},
+        {26427, 585, 6, 2}, {31317, 74, 6, 3}, {0, 0, 0, 0}, {10708, 127, 4, 1},
+        {20950, 2240, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {12524, 615, 7, 1},
+        {0, 0, 0, 0}, {8848, 1345, 7, 0}, {18236, 1704, 6, 1}, {30998, 38, 4, 3},
+        {39082, 783, 6, 3}, {5748, 873, 5, 0}, {37696, 653, 5, 3}, {0, 0, 0, 0},
+        {7581, 1155, 5, 0}, {8661, 1310, 7, 0}, {6220, 952, 6, 0}, {22134, 2481, 6, 1},
+        {7841, 1189, 8, 0}, {31165, 53, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {25764, 460, 5, 2},
+        {0, 0, 0, 0}, {36574, 551, 5, 3}, {0, 0, 0, 0}, {15307, 1176, 6, 1},
+        {30471, 1265, 7, 2}, {31355, 79, 4, 3}, {36473, 542, 7, 3}, {0, 0, 0, 0},
+        {3075, 452, 11, 0}, {0, 0, 0, 0}, {6063, 927, 9, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {11424, 399, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {14813, 1086, 5, 1}, {32586, 191, 4, 3}, {690, 1, 6, 3}, {4778, 712, 7, 0},
+        {10399, 44, 3, 1}, {14592, 1040, 5, 1}, {1070, 164, 7, 0}, {11012, 296, 5, 1},
+        {20422, 2139, 5, 1}, {26038, 518, 7, 2}, {26412, 581, 6, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {4599, 682, 7, 0}, {0, 0, 0, 0}, {12755, 660, 5, 1}, {17109, 1496, 7, 1},
+        {37174, 605, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {4292, 633, 7, 0},
+        {0, 0, 0, 0}, {31778, 123, 6, 3}, {1266, 27, 6, 2}, {35683, 473, 4, 3},
+        {39893, 860, 7, 3}, {0, 0, 0, 0}, {37377, 622, 6, 3}, {22104, 2475, 5, 1},
+        {20314, 2120, 6, 1}, {23003, 2685, 3, 1}, {7313, 368, 6, 1}, {23443, 2774, 5, 1},
+        {24353, 168, 3, 2}, {10022, 1060, 7, 2}, {35156, 426, 5, 3}, {39573, 828, 7, 3},
+        {38615, 740, 7, 3}, {7153, 1081, 5, 0}, {12138, 534, 5, 1}, {24388, 175, 6, 2},
+        {36672, 561, 7, 3}, {14657, 1051, 5, 1}, {0, 0, 0, 0}, {17389, 1547, 4, 1},
+        {30882, 18, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {9548, 953, 6, 2},
+        {12251, 559, 4, 1}, {14338, 995, 7, 1}, {31926, 135, 7, 3}, {32635, 197, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {33236, 258, 6, 3}, {4180, 618, 4, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {9932, 1511, 7, 0}, {8411, 112, 6, 2},
+        {13483, 815, 4, 1}, {71, 12, 8, 0}, {13383, 791, 5, 1}, {20196, 2096, 6, 1},
+        {22063, 2466, 4, 1}, {23112, 2708, 6, 1}, {25362, 378, 6, 2}, {29733, 1164, 8, 2},
+        {29919, 1190, 8, 2}, {39612, 832, 9, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {22342, 2531, 5, 1}, {32817, 217, 5, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {10461, 60, 3, 1}, {23640, 2812, 6, 1}, {32799, 215, 4, 3},
+        {10155, 1546, 6, 0}, {10628, 102, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {22822, 2646, 5, 1}, {8957, 24, 4, 3},
+        {0, 0, 0, 0}, {22816, 2645, 6, 1}, {0, 0, 0, 0}, {17151, 1502, 7, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {22690, 2611, 5, 1},
+        {22374, 2538, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {645, 99, 5, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {12531, 616, 7, 1}, {34974, 410, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {33393, 273, 4, 3}, {5036, 755, 6, 0}, {21587, 2365, 5, 1}, {0, 0, 0, 0},
+        {36916, 582, 6, 3}, {0, 0, 0, 0}, {38239, 705, 6, 3}, {0, 0, 0, 0},
+        {4710, 181, 5, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {27567, 789, 7, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {9847, 1500, 11, 0},
+        {11436, 401, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {9869, 1502, 8, 0}, {26910, 676, 9, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {6365, 969, 7, 0}, {0, 0, 0, 0}, {14392, 1004, 9, 1}, {15882, 1267, 5, 1},
+        {23816, 21, 7, 2}, {39795, 851, 4, 3}, {0, 0, 0, 0}, {4860, 726, 7, 0},
+        {5971, 910, 5, 0}, {0, 0, 0, 0}, {10325, 26, 5, 1}, {40456, 913, 7, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {25202, 341, 6, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {16993, 1478, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {18707, 1799, 7, 1},
+        {0, 0, 0, 0}, {7555, 1151, 5, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {20304, 2118, 5, 1}, {11865, 479, 8, 1}, {12959, 704, 5, 1},
+        {22626, 2596, 3, 1}, {28289, 923, 6, 2}, {40172, 884, 7, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {26027, 515, 6, 2}, {6594, 999, 10, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {13218, 753, 4, 1}, {19485, 1956, 5, 1}, {24637, 228, 5, 2},
+        {18623, 1784, 7, 1}, {34019, 328, 7, 3}, {10677, 116, 3, 1}, {34680, 384, 6, 3},
+        {8584, 2, 4, 2}, {10505, 72, 4, 1}, {31470, 92, 5, 3}, {25949, 501, 6, 2},
+        {21785, 2407, 5, 1}, {0, 0, 0, 0}, {5836, 888, 5, 0}, {11938, 495, 5, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {34284, 352, 7, 3}, {33048, 240, 7, 3},
+        {0, 0, 0, 0}, {18120, 1681, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {17785, 1620, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {34076, 335, 4, 3}, {3542, 519, 6, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {32053, 144, 10, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {4072, 602, 8, 0}, {0, 0, 0, 0},
+        {40069, 874, 5, 3}, {0, 0, 0, 0}, {36738, 567, 5, 3}, {37428, 627, 5, 3},
+        {1595, 199, 6, 1}, {0, 0, 0, 0}, {25825, 474, 6, 2}, {0, 0, 0, 0},
+        {7257, 1102, 6, 0}, {8380, 92, 9, 2}, {20976, 2245, 5, 1}, {25098, 320, 4, 2},
+        {36099, 509, 5, 3}, {18531, 1763, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {65, 11, 6, 0}, {39403, 814, 6, 3}, {0, 0, 0, 0},
+        {4154, 614, 7, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {999, 153, 6, 0}, {24688, 238, 5, 2}, {19719, 2003, 4, 1},
+        {40011, 870, 7, 3}, {20796, 2214, 6, 1}, {0, 0, 0, 0}, {19757, 2011, 6, 1},
+        {29726, 1163, 7, 2}, {0, 0, 0, 0}, {15493, 1201, 9, 1}, {0, 0, 0, 0},
+        {18324, 1721, 6, 1}, {1587, 245, 8, 0}, {18558, 1770, 6, 1}, {4790, 432, 4, 2},
+        {25241, 349, 7, 2}, {32678, 201, 5, 3}, {31174, 54, 3, 3}, {211, 32, 6, 0},
+        {25260, 352, 8, 2}, {6919, 1042, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {12593, 629, 5, 1}, {0, 0, 0, 0},
+        {30926, 29, 3, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {5683, 182, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {294, 19, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {19903, 2038, 7, 1}, {0, 0, 0, 0}, {8855, 296, 6, 2}, {10788, 147, 6, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {33006, 237, 6, 3},
+        {31124, 49, 6, 3}, {15218, 1159, 4, 1}, {0, 0, 0, 0}, {5861, 892, 7, 0},
+        {9842, 152, 5, 1}, {9685, 1476, 7, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {37053, 594, 5, 3}, {0, 0, 0, 0}, {25632, 427, 5, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {18587, 1776, 4, 1}, {10997, 293, 5, 1},
+        {12873, 682, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {9396, 1434, 10, 0}, {21983, 2448, 7, 1},
+        {13584, 858, 5, 1}, {30647, 1289, 8, 2}, {1530, 237, 6, 0}, {26992, 690, 6, 2},
+        {28389, 939, 4, 2}, {35675, 472, 8, 3}, {0, 0, 0, 0}, {22414, 2548, 5, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {15261, 1167, 7, 1}, {27204, 727, 10, 2},
+        {31643, 109, 6, 3}, {28399, 941, 6, 2}, {0, 0, 0, 0}, {11913, 490, 3, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {21906, 2432, 5, 1}, {0, 0, 0, 0},
+        {36359, 534, 7, 3}, {29775, 1170, 8, 2}, {26121, 531, 5, 2}, {26319, 564, 6, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {39222, 798, 7, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {24026, 91, 7, 2}, {0, 0, 0, 0}, {9478, 1446, 4, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {31509, 96, 5, 3}, {0, 0, 0, 0},
+        {9482, 1447, 10, 0}, {0, 0, 0, 0}, {26751, 643, 4, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {22471, 2561, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {10533, 79, 5, 1}, {4285, 632, 7, 0}, {21061, 2262, 6, 1},
+        {0, 0, 0, 0}, {39932, 863, 7, 3}, {32257, 160, 8, 3}, {36743, 567, 5, 3},
+        {0, 0, 0, 0}, {378, 58, 6, 0}, {7855, 1191, 7, 0}, {29345, 1109, 5, 2},
+        {34963, 409, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {16548, 1396, 5, 1},
+        {21866, 2424, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {30522, 1272, 5, 2},
+        {12123, 531, 4, 1}, {14667, 1053, 3, 1}, {32150, 151, 7, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {38174, 699, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {3281, 484, 9, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {34136, 340, 10, 3},
+        {18591, 1777, 8, 1}, {26157, 540, 3, 2}, {0, 0, 0, 0}, {15765, 1247, 7, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {6215, 951, 5, 0},
+        {8434, 353, 7, 2}, {5730, 869, 5, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {17022, 1483, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {9887, 1504, 8, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {12913, 694, 5, 1}, {17003, 1480, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {18445, 1746, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {33992, 326, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {33386, 272, 3, 3}, {0, 0, 0, 0},
+        {4830, 189, 4, 1}, {27472, 773, 6, 2}, {15410, 1190, 10, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {40353, 903, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {24934, 285, 3, 2}, {24270, 151, 6, 2}, {32669, 200, 4, 3},
+        {33807, 309, 5, 3}, {0, 0, 0, 0}, {36988, 588, 6, 3}, {17116, 1497, 7, 1},
+        {32855, 221, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {26869, 668, 4, 2},
+        {13877, 923, 4, 1}, {21217, 2293, 5, 1}, {21235, 2297, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {29369, 1113, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {17314, 1532, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {28578, 976, 7, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {12514, 613, 6, 1}, {38351, 717, 6, 3}, {6480, 986, 6, 0},
+        {15255, 1166, 6, 1}, {32526, 185, 6, 3}, {13787, 900, 5, 1}, {37745, 659, 4, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {21319, 2312, 5, 1}, {20040, 2065, 7, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {27536, 785, 9, 2},
+        {32975, 233, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {24312, 159, 5, 2}, {1308, 202, 6, 0}, {7356, 363, 7, 1}, {24859, 271, 6, 2},
+        {27530, 783, 6, 2}, {34207, 344, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {18854, 1825, 3, 1}, {28636, 986, 4, 2},
+        {0, 0, 0, 0}, {25422, 388, 7, 2}, {423, 65, 6, 0}, {12520, 497, 4, 3},
+        {15556, 1210, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {25356, 377, 6, 2}, {11039, 322, 4, 1}, {0, 0, 0, 0},
+        {17676, 1599, 5, 1}, {19981, 2053, 5, 1}, {32576, 190, 5, 3}, {0, 0, 0, 0},
+        {907, 139, 6, 0}, {21384, 2327, 5, 1}, {9823, 1106, 6, 1}, {32738, 207, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {15296, 1172, 6, 1},
+        {21103, 2271, 5, 1}, {23561, 2795, 3, 1}, {23887, 47, 7, 2}, {34363, 358, 7, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {33367, 270, 4, 3}, {39957, 865, 6, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {38864, 762, 5, 3}, {34225, 346, 4, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {1142, 175, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {192, 29, 7, 0}, {13630, 869, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {16950, 1470, 7, 1}, {0, 0, 0, 0}, {24477, 194, 6, 2}, {33204, 256, 7, 3},
+        {0, 0, 0, 0}, {26138, 536, 7, 2}, {30811, 11, 4, 3}, {13839, 914, 4, 1},
+        {9609, 304, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {27340, 749, 7, 2},
+        {9527, 1452, 8, 0}, {17929, 1647, 6, 1}, {17852, 1632, 7, 1}, {29149, 1073, 5, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {21922, 2435, 4, 1}, {30572, 1279, 5, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {7347, 1117, 9, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {13683, 881, 5, 1}, {15775, 1249, 6, 1},
+        {32089, 147, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {25057, 310, 4, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {4349, 238, 7, 1}, {24062, 100, 7, 2}, {3808, 327, 5, 2},
+        {19973, 2051, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {27681, 812, 5, 2},
+        {36851, 576, 10, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {10567, 88, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {19172, 1891, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {21643, 2377, 7, 1}, {27073, 705, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {1700, 261, 5, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {39690, 840, 6, 3}, {4363, 643, 6, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {13270, 763, 4, 1},
+        {37178, 606, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {40220, 889, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {12950, 700, 4, 1}, {30768, 6, 5, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {435, 67, 8, 0}, {3407, 501, 9, 0}, {20821, 2218, 6, 1},
+        {7455, 1135, 7, 0}, {0, 0, 0, 0}, {35298, 440, 4, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {22899, 2663, 6, 1}, {0, 0, 0, 0}, {22368, 2537, 6, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {37170, 605, 4, 3},
+        {0, 0, 0, 0}, {24922, 283, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {2199, 325, 8, 0}, {22710, 2620, 6, 1}, {0, 0, 0, 0},
+        {36173, 516, 5, 3}, {27981, 869, 4, 2}, {37665, 650, 5, 3}, {0, 0, 0, 0},
+        {20093, 2074, 6, 1}, {0, 0, 0, 0}, {31899, 133, 8, 3}, {40451, 912, 5, 3},
+        {0, 0, 0, 0}, {4812, 188, 4, 1}, {10117, 314, 6, 1}, {22648, 2601, 4, 1},
+        {13451, 808, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {25995, 509, 5, 2},
+        {39553, 827, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {18782, 1812, 5, 1},
+        {4307, 635, 8, 0}, {21479, 2345, 7, 1}, {34797, 394, 11, 3}, {12296, 568, 4, 1},
+        {0, 0, 0, 0}, {14849, 1092, 6, 1}, {0, 0, 0, 0}, {35338, 443, 4, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {36631, 557, 4, 3}, {35637, 470, 7, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {7470, 1138, 6, 0}, {0, 0, 0, 0},
+        {10266, 10, 3, 1}, {26861, 667, 8, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {16479, 1383, 6, 1}, {4913, 280, 5, 1}, {14756, 1073, 5, 1},
+        {26650, 623, 4, 2}, {30722, 2, 6, 3}, {669, 103, 6, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {17407, 1551, 6, 1}, {0, 0, 0, 0}, {40074, 875, 4, 3}, {30577, 1280, 9, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {10134, 625, 4, 2}, {0, 0, 0, 0}, {20320, 2121, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {28040, 877, 5, 2}, {27267, 736, 6, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {13335, 778, 3, 1}, {37445, 628, 6, 3}, {0, 0, 0, 0},
+        {31381, 83, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {1954, 295, 7, 0}, {6168, 942, 4, 0}, {0, 0, 0, 0}, {33163, 252, 6, 3},
+        {0, 0, 0, 0}, {2504, 373, 6, 0}, {0, 0, 0, 0}, {10609, 97, 3, 1},
+        {15233, 1162, 5, 1}, {0, 0, 0, 0}, {25606, 423, 8, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {39040, 779, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {37781, 663, 6, 3},
+        {0, 0, 0, 0}, {17344, 1538, 7, 1}, {7190, 1089, 3, 0}, {7620, 1161, 4, 0},
+        {5413, 117, 3, 1}, {32956, 231, 5, 3}, {9798, 306, 5, 1}, {0, 0, 0, 0},
+        {18761, 1808, 7, 1}, {0, 0, 0, 0}, {580, 90, 6, 0}, {3152, 464, 6, 0},
+        {10984, 274, 6, 1}, {31630, 108, 7, 3}, {827, 127, 7, 0}, {37972, 681, 4, 3},
+        {0, 0, 0, 0}, {29185, 1082, 9, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {38369, 718, 6, 3}, {21567, 2361, 6, 1}, {37734, 657, 3, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {37898, 673, 6, 3}, {0, 0, 0, 0},
+        {28795, 1015, 7, 2}, {26521, 601, 7, 2}, {0, 0, 0, 0}, {25591, 421, 6, 2},
+        {0, 0, 0, 0}, {36466, 542, 7, 3}, {0, 0, 0, 0}, {13458, 811, 5, 1},
+        {9333, 1422, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {38628, 741, 5, 3}, {1414, 111, 6, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {37258, 612, 5, 3}, {919, 141, 7, 0}, {31594, 105, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {38012, 685, 4, 3},
+        {21452, 2340, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {34485, 368, 6, 3},
+        {36819, 574, 6, 3}, {0, 0, 0, 0}, {28350, 932, 7, 2}, {5276, 792, 6, 0},
+        {34651, 382, 9, 3}, {0, 0, 0, 0}, {722, 14, 7, 2}, {3344, 493, 8, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {4217, 623, 8, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {1866, 283, 7, 0}, {36237, 522, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {7442, 1133, 5, 0}, {39565, 828, 8, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {3253, 480, 7, 0},
+        {15174, 1151, 6, 1}, {21990, 2449, 5, 1}, {29951, 1194, 6, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {9268, 1413, 7, 0}, {0, 0, 0, 0}, {25390, 383, 7, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {29040, 1057, 7, 2}, {30407, 1256, 7, 2}, {25989, 508, 6, 2},
+        {0, 0, 0, 0}, {10497, 70, 3, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {40587, 923, 7, 3}, {20554, 2166, 5, 1}, {9664, 1473, 7, 0}, {6018, 919, 5, 0},
+        {33439, 278, 5, 3}, {8810, 56, 5, 2}, {36391, 537, 10, 3}, {39860, 857, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {22786, 2638, 4, 1},
+        {0, 0, 0, 0}, {13779, 898, 4, 1}, {18738, 1804, 6, 1}, {40411, 909, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {14639, 1047, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {19430, 1945, 5, 1},
+        {19753, 2010, 4, 1}, {0, 0, 0, 0}, {17363, 1541, 6, 1}, {31090, 45, 9, 3},
+        {33734, 303, 4, 3}, {31754, 121, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {14188, 974, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {40332, 901, 6, 3}, {0, 0, 0, 0}, {18732, 1803, 6, 1}, {33742, 304, 9, 3},
+        {0, 0, 0, 0}, {124, 20, 6, 0}, {0, 0, 0, 0}, {18932, 1843, 5, 1},
+        {0, 0, 0, 0}, {8279, 1255, 7, 0}, {0, 0, 0, 0}, {31947, 136, 7, 3},
+        {0, 0, 0, 0}, {4009, 591, 5, 0}, {31387, 83, 5, 3}, {39321, 808, 7, 3},
+        {21926, 2436, 4, 1}, {12642, 639, 6, 1}, {5397, 810, 6, 0}, {14356, 998, 5, 1},
+        {35076, 418, 9, 3}, {35980, 499, 6, 3}, {37333, 618, 6, 3}, {0, 0, 0, 0},
+        {888, 136, 6, 0}, {40082, 876, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {2851, 213, 9, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {39045, 780, 5, 3}, {23617, 2807, 5, 1},
+        {11111, 338, 6, 1}, {40663, 930, 5, 3}, {0, 0, 0, 0}, {19926, 2042, 5, 1},
+        {14194, 975, 9, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {34553, 374, 6, 3},
+        {34085, 336, 5, 3}, {26780, 650, 8, 2}, {34714, 386, 9, 3}, {0, 0, 0, 0},
+        {4161, 615, 7, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {5672, 181, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {7465, 1137, 5, 0}, {32991, 235, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {38964, 772, 5, 3},
+        {2593, 384, 8, 0}, {11370, 389, 4, 1}, {37125, 601, 4, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {32419, 173, 4, 3}, {0, 0, 0, 0}, {10269, 11, 3, 1},
+        {0, 0, 0, 0}, {38689, 747, 3, 3}, {0, 0, 0, 0}, {16097, 1304, 6, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {5445, 818, 4, 0}, {34922, 405, 6, 3},
+        {0, 0, 0, 0}, {9925, 1510, 7, 0}, {39234, 799, 7, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {28198, 907, 7, 2}, {19787, 2018, 8, 1}, {0, 0, 0, 0},
+        {12148, 536, 7, 1}, {26876, 670, 7, 2}, {0, 0, 0, 0}, {20166, 2088, 5, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {36229, 521, 3, 3}, {34173, 342, 6, 3},
+        {0, 0, 0, 0}, {6300, 962, 7, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {29004, 1051, 8, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {5704, 864, 4, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {26280, 558, 7, 2}, {0, 0, 0, 0},
+        {22707, 2619, 3, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {22776, 2636, 5, 1},
+        {16807, 1443, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {21474, 2344, 5, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {31490, 94, 5, 3}, {13572, 856, 7, 1},
+        {184, 28, 8, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {13524, 844, 5, 1}, {10993, 285, 4, 1},
+        {0, 0, 0, 0}, {27478, 774, 7, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {35195, 429, 3, 3},
+        {21573, 2362, 6, 1}, {19392, 1936, 4, 1}, {0, 0, 0, 0}, {3895, 574, 8, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {28, 5, 9, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {11167, 298, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {19738, 2007, 7, 1},
+        {0, 0, 0, 0}, {36831, 575, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {28816, 1018, 9, 2}, {30081, 1211, 10, 2}, {16109, 1306, 7, 1}, {31810, 126, 6, 3},
+        {0, 0, 0, 0}, {5110, 767, 8, 0}, {8800, 1336, 5, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {24511, 205, 4, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {37303, 616, 6, 3}, {14519, 1027, 6, 1}, {0, 0, 0, 0}, {13448, 807, 3, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {33605, 291, 4, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {11931, 494, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {27466, 772, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {15563, 1211, 4, 1}, {0, 0, 0, 0}, {31991, 140, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {38824, 759, 8, 3}, {0, 0, 0, 0}, {27901, 855, 6, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {5431, 816, 6, 0}, {29083, 1064, 6, 2},
+        {34660, 382, 9, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {29458, 1126, 7, 2}, {24370, 172, 5, 2}, {21744, 2398, 5, 1},
+        {32566, 189, 5, 3}, {18634, 1786, 6, 1}, {34497, 369, 6, 3}, {0, 0, 0, 0},
+        {18208, 1699, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {3818, 562, 5, 0},
+        {0, 0, 0, 0}, {23370, 2760, 6, 1}, {13621, 866, 4, 1}, {26134, 535, 4, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {14649, 1049, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {8007, 1216, 9, 0}, {23766, 2838, 6, 1},
+        {0, 0, 0, 0}, {32281, 162, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {25084, 317, 5, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {18975, 1852, 5, 1}, {0, 0, 0, 0}, {26077, 525, 8, 2}, {38304, 713, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {599, 93, 6, 0}, {28604, 980, 9, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {8505, 1288, 7, 0},
+        {22889, 2661, 6, 1}, {32757, 209, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {10099, 313, 5, 1}, {0, 0, 0, 0}, {19178, 1892, 7, 1}, {33704, 300, 8, 3},
+        {26528, 602, 9, 2}, {35790, 484, 3, 3}, {5570, 545, 5, 3}, {18256, 1707, 5, 1},
+        {24992, 299, 7, 2}, {30898, 22, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {14717, 1067, 6, 1}, {9357, 1427, 4, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {29218, 1088, 4, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {12079, 522, 7, 1}, {39423, 816, 7, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {35889, 492, 9, 3}, {14308, 990, 6, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {40668, 931, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {25073, 315, 3, 2},
+        {0, 0, 0, 0}, {3827, 564, 9, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {3008, 440, 7, 0}, {10010, 1522, 5, 0}, {40836, 948, 5, 3}, {26422, 584, 5, 2},
+        {34042, 331, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {24194, 130, 5, 2},
+        {18465, 1750, 5, 1}, {4393, 648, 4, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {10382, 40, 4, 1}, {17450, 1558, 5, 1}, {11841, 473, 4, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {26101, 528, 9, 2}, {0, 0, 0, 0},
+        {26497, 597, 5, 2}, {735, 113, 4, 0}, {0, 0, 0, 0}, {38415, 722, 6, 3},
+        {39742, 845, 4, 3}, {23284, 2741, 4, 1}, {16510, 1389, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {22563, 2580, 4, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {37339, 619, 6, 3}, {0, 0, 0, 0},
+        {34120, 339, 8, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {10036, 1526, 7, 0},
+        {15652, 1227, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {30934, 31, 6, 3}, {0, 0, 0, 0}, {9327, 1421, 6, 0}, {36649, 559, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {18906, 1837, 6, 1}, {40718, 935, 6, 3},
+        {0, 0, 0, 0}, {39097, 785, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {28230, 912, 7, 2},
+        {29648, 1153, 8, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {3903, 575, 5, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {11354, 386, 6, 1}, {25637, 429, 9, 2}, {28338, 930, 8, 2}, {13675, 879, 5, 1},
+        {15676, 1231, 9, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {10238, 2, 3, 1}, {32612, 195, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {11802, 465, 5, 1}, {8931, 25, 5, 3}, {16149, 1313, 7, 1}, {0, 0, 0, 0},
+        {18330, 1722, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {38707, 749, 6, 3}, {17234, 1516, 5, 1}, {24900, 279, 7, 2}, {0, 0, 0, 0},
+        {1064, 163, 6, 0}, {0, 0, 0, 0}, {12495, 610, 10, 1}, {1272, 196, 6, 0},
+        {16467, 1381, 6, 1}, {14249, 982, 9, 1}, {38430, 723, 3, 3}, {0, 0, 0, 0},
+        {5884, 792, 7, 2}, {12598, 630, 4, 1}, {5508, 829, 7, 0}, {18179, 1693, 3, 1},
+        {34570, 375, 5, 3}, {0, 0, 0, 0}, {14872, 1096, 7, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {16738, 1430, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {14180, 973, 8, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {22518, 2570, 3, 1}, {32925, 228, 5, 3}, {18603, 1779, 3, 1}, {7628, 1163, 4, 0},
+        {14061, 955, 8, 1}, {20725, 2200, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {7549, 1150, 6, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {21417, 2334, 6, 1},
+        {12305, 570, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {31416, 86, 5, 3},
+        {14841, 1091, 8, 1}, {26005, 511, 4, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {34155, 341, 10, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {10637, 105, 4, 1}, {24375, 173, 5, 2},
+        {0, 0, 0, 0}, {1543, 239, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {10794, 148, 6, 1}, {0, 0, 0, 0}, {28500, 963, 6, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {15584, 1216, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {37361, 621, 5, 3},
+        {4977, 623, 3, 1}, {29579, 1143, 7, 2}, {31766, 122, 6, 3}, {16750, 1432, 4, 1},
+        {30493, 1268, 6, 2}, {37548, 638, 5, 3}, {38896, 765, 6, 3}, {13529, 845, 4, 1},
+        {30728, 3, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {18610, 1781, 5, 1},
+        {14147, 969, 9, 1}, {18046, 1668, 6, 1}, {18720, 1801, 6, 1}, {21630, 2374, 4, 1},
+        {22652, 2602, 4, 1}, {12996, 713, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {4184, 619, 7, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {11904, 487, 5, 1},
+        {35460, 455, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {25814, 470, 4, 2},
+        {40059, 873, 5, 3}, {0, 0, 0, 0}, {34744, 389, 6, 3}, {7390, 377, 5, 1},
+        {27091, 708, 5, 2}, {0, 0, 0, 0}, {21687, 2386, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {36968, 587, 7, 3}, {0, 0, 0, 0},
+        {3950, 582, 5, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {30515, 1271, 7, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {7613, 1160, 7, 0}, {10571, 89, 4, 1}, {11604, 425, 5, 1},
+        {17356, 1540, 7, 1}, {2298, 341, 4, 0}, {0, 0, 0, 0}, {19293, 1917, 4, 1},
+        {0, 0, 0, 0}, {27079, 706, 5, 2}, {0, 0, 0, 0}, {24835, 266, 4, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {30878, 18, 4, 3}, {25173, 337, 8, 2}, {0, 0, 0, 0},
+        {3399, 500, 8, 0}, {23477, 2780, 6, 1}, {27699, 815, 6, 2}, {29632, 1151, 8, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {19257, 457, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {6957, 1047, 7, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {22333, 2529, 4, 1},
+        {0, 0, 0, 0}, {19538, 1966, 3, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {35327, 442, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {3041, 447, 8, 0},
+        {4846, 724, 5, 0}, {33181, 254, 10, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {12230, 555, 7, 1}, {26705, 634, 5, 2},
+        {36935, 584, 5, 3}, {0, 0, 0, 0}, {11162, 347, 5, 1}, {29607, 1148, 11, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {35802, 485, 9, 3}, {0, 0, 0, 0},
+        {11124, 340, 5, 1}, {7880, 1195, 7, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {23682, 2822, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {25878, 486, 4, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {18942, 1845, 5, 1}, {21995, 2450, 5, 1}, {3486, 511, 7, 0},
+        {7700, 1171, 10, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {462, 71, 4, 0}, {21305, 2310, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {25109, 322, 5, 2}, {21592, 2366, 5, 1}, {29358, 1111, 7, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {21380, 2326, 4, 1}, {11752, 456, 5, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {11617, 427, 9, 1},
+        {0, 0, 0, 0}, {15335, 1180, 10, 1}, {0, 0, 0, 0}, {25102, 321, 7, 2},
+        {10244, 4, 4, 1}, {3555, 521, 8, 0}, {0, 0, 0, 0}, {456, 70, 6, 0},
+        {12350, 580, 3, 1}, {15352, 1182, 7, 1}, {20454, 2145, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {1504, 233, 7, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {12691, 648, 4, 1}, {10464, 61, 3, 1}, {38668, 745, 5, 3}, {12309, 571, 4, 1},
+        {13847, 917, 4, 1}, {14210, 977, 9, 1}, {15603, 1219, 7, 1}, {18418, 1740, 4, 1},
+        {25248, 350, 7, 2}, {29229, 1090, 6, 2}, {0, 0, 0, 0}, {19408, 1941, 5, 1},
+        {19038, 1864, 7, 1}, {40490, 915, 8, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {37321, 617, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {13940, 936, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {40437, 911, 8, 3}, {24254, 147, 5, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {22923, 2668, 4, 1}, {10490, 69, 7, 1},
+        {0, 0, 0, 0}, {33950, 323, 6, 3}, {276, 42, 6, 0}, {28538, 970, 6, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {4874, 176, 6, 1}, {15012, 1121, 9, 1}, {0, 0, 0, 0}, {27012, 694, 5, 2},
+        {5498, 827, 4, 0}, {22513, 2569, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {23401, 2766, 6, 1}, {0, 0, 0, 0},
+        {5997, 831, 4, 1}, {17277, 1525, 4, 1}, {21709, 2391, 5, 1}, {23753, 2836, 7, 1},
+        {39063, 782, 6, 3}, {15825, 1257, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {27381, 755, 6, 2}, {15187, 1153, 7, 1}, {2497, 372, 7, 0},
+        {36606, 554, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {27974, 868, 7, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {9117, 1391, 5, 0},
+        {27197, 726, 7, 2}, {18285, 1713, 4, 1}, {19947, 2046, 6, 1}, {31208, 57, 4, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {16621, 1410, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {6144, 938, 7, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {22406, 2546, 4, 1}, {27462, 771, 4, 2}, {31664, 111, 5, 3},
+        {18170, 1691, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {19297, 1918, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {15610, 1220, 6, 1}, {28302, 925, 7, 2},
+        {14802, 1083, 3, 1}, {37937, 677, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {25429, 389, 5, 2}, {0, 0, 0, 0}, {30091, 1212, 6, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {8389, 93, 7, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {10758, 141, 11, 1}, {28850, 1023, 4, 2}, {39805, 853, 5, 3},
+        {26223, 551, 9, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {40306, 898, 5, 3}, {0, 0, 0, 0}, {17734, 1612, 8, 1}, {33686, 299, 9, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {4991, 277, 8, 1}, {10003, 1521, 7, 0}, {13487, 816, 4, 1}, {15795, 1252, 7, 1},
+        {3914, 577, 7, 0}, {3658, 537, 6, 0}, {21838, 560, 5, 3}, {29212, 1087, 6, 2},
+        {18200, 1698, 8, 1}, {38778, 755, 5, 3}, {40521, 917, 7, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {5989, 913, 8, 0},
+        {16403, 1367, 5, 1}, {23471, 2779, 6, 1}, {16985, 1476, 4, 1}, {10063, 317, 6, 1},
+        {14314, 991, 4, 1}, {30804, 10, 7, 3}, {39317, 807, 4, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {1240, 191, 7, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {13329, 777, 6, 1}, {18832, 1820, 4, 1}, {33852, 314, 5, 3},
+        {39152, 791, 6, 3}, {40788, 944, 4, 3}, {14635, 1046, 4, 1}, {777, 119, 6, 0},
+        {15434, 1193, 11, 1}, {2526, 376, 8, 0}, {23830, 26, 6, 2}, {8531, 1291, 7, 0},
+        {27447, 768, 3, 2}, {30178, 1224, 5, 2}, {36508, 544, 7, 3}, {5016, 287, 6, 1},
+        {8085, 4, 6, 3}, {5536, 834, 7, 0}, {28453, 952, 5, 2}, {32979, 234, 4, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {34859, 399, 11, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {4926, 737, 9, 0}, {5554, 837, 9, 0}, {8431, 115, 3, 2},
+        {19271, 1912, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {26643, 622, 7, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {7158, 1082, 3, 0},
+        {13290, 767, 3, 1}, {35668, 472, 7, 3}, {0, 0, 0, 0}, {12046, 516, 4, 1},
+        {30187, 1226, 9, 2}, {20656, 2187, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {29881, 1185, 8, 2}, {31699, 115, 3, 3}, {0, 0, 0, 0},
+        {32626, 196, 4, 3}, {40506, 916, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {38936, 769, 4, 3}, {0, 0, 0, 0},
+        {33779, 306, 6, 3}, {0, 0, 0, 0}, {3955, 583, 4, 0}, {15941, 1278, 7, 1},
+        {23288, 2743, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {15669, 1230, 7, 1},
+        {20608, 2178, 5, 1}, {24678, 236, 4, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {106, 17, 6, 0}, {5282, 793, 8, 0}, {16016, 1290, 8, 1}, {14833, 1090, 8, 1},
+        {0, 0, 0, 0}, {16393, 1365, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {24019, 89, 7, 2}, {0, 0, 0, 0},
+        {40612, 925, 6, 3}, {3215, 474, 5, 0}, {3242, 478, 7, 0}, {26273, 557, 7, 2},
+        {1705, 262, 6, 0}, {7341, 1116, 6, 0}, {16103, 1305, 6, 1}, {18881, 1831, 4, 1},
+        {25982, 507, 7, 2}, {27067, 704, 6, 2}, {33018, 238, 7, 3}, {28103, 890, 6, 2},
+        {18450, 1747, 5, 1}, {22087, 2471, 6, 1}, {30717, 1, 5, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {32249, 160, 8, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {34960, 409, 3, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {14507, 1025, 6, 1},
+        {27498, 778, 4, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {15180, 1152, 7, 1},
+        {22208, 2498, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {9391, 1433, 5, 0},
+        {0, 0, 0, 0}, {1359, 210, 7, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {6950, 1046, 7, 0}, {16615, 1409, 6, 1}, {16626, 1411, 7, 1},
+        {38981, 773, 7, 3}, {36595, 553, 5, 3}, {2248, 331, 6, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {6468, 984, 6, 0},
+        {0, 0, 0, 0}, {1036, 159, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {39203, 795, 6, 3}, {27400, 758, 6, 2}, {34848, 398, 6, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {34998, 412, 5, 3}, {37787, 663, 6, 3}, {25150, 332, 6, 2},
+        {0, 0, 0, 0}, {3997, 589, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {13579, 857, 5, 1}, {16337, 1352, 5, 1}, {6925, 1043, 9, 0}, {29534, 1136, 7, 2},
+        {21597, 2368, 5, 1}, {26392, 577, 6, 2}, {18093, 1676, 6, 1}, {34080, 336, 5, 3},
+        {36940, 584, 5, 3}, {39640, 834, 4, 3}, {40729, 936, 4, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {9195, 1403, 4, 0}, {0, 0, 0, 0}, {18679, 1795, 8, 1},
+        {17761, 1616, 6, 1}, {29062, 1061, 11, 2}, {40625, 926, 5, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {32362, 167, 8, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {21669, 2382, 4, 1}, {0, 0, 0, 0}, {8213, 1247, 10, 0},
+        {25065, 312, 4, 2}, {39447, 818, 7, 3}, {26571, 609, 8, 2}, {12379, 587, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {10579, 91, 6, 1}, {0, 0, 0, 0},
+        {29783, 1171, 7, 2}, {25809, 469, 5, 2}, {24211, 134, 5, 2}, {29235, 1091, 5, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {14448, 1012, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {17288, 1527, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {19528, 1964, 6, 1}, {30209, 1229, 7, 2},
+        {35955, 497, 4, 3}, {13694, 883, 5, 1}, {6326, 965, 7, 0}, {11418, 398, 6, 1},
+        {0, 0, 0, 0}, {5982, 912, 7, 0}, {16607, 1407, 4, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {37129, 601, 4, 3}, {8889, 1353, 8, 0}, {0, 0, 0, 0},
+        {28125, 894, 5, 2}, {13375, 789, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {29981, 1198, 8, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {21861, 2423, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {19240, 1906, 7, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {1814, 277, 9, 0},
+        {3968, 585, 7, 0}, {17468, 1561, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {11954, 499, 6, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {26759, 645, 6, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {21470, 2343, 4, 1}, {18214, 1700, 7, 1}, {22574, 2582, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {24069, 102, 6, 2}, {39696, 841, 4, 3}, {0, 0, 0, 0},
+        {11947, 498, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {21157, 2281, 5, 1}, {23349, 2755, 5, 1}, {5069, 761, 9, 0},
+        {10723, 132, 3, 1}, {40236, 890, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {36728, 566, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {27887, 852, 7, 2}, {25168, 336, 5, 2},
+        {9386, 1432, 5, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {12193, 546, 4, 1}, {40463, 913, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {36154, 514, 5, 3}, {251, 38, 7, 0}, {35606, 467, 7, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {6111, 934, 8, 0}, {19610, 1980, 6, 1}, {26890, 29, 5, 3},
+        {28886, 1030, 4, 2}, {38403, 721, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {31407, 85, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {38914, 767, 4, 3},
+        {25698, 442, 7, 2}, {0, 0, 0, 0}, {37076, 596, 9, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {7505, 1143, 4, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {31787, 124, 3, 3}, {6394, 973, 6, 0},
+        {1302, 201, 6, 0}, {14372, 1001, 7, 1}, {23464, 2778, 7, 1}, {842, 129, 6, 0},
+        {28995, 1049, 5, 2}, {35440, 453, 4, 3}, {9908, 1507, 7, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {7149, 1080, 4, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {10850, 159, 3, 1}, {10894, 172, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {40640, 928, 5, 3}, {36708, 564, 4, 3}, {14120, 965, 7, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {4429, 654, 8, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {39605, 831, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {37109, 599, 3, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {20815, 2217, 6, 1}, {1136, 174, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {21503, 2349, 6, 1}, {3273, 483, 8, 0}, {23263, 2737, 7, 1},
+        {28640, 987, 4, 2}, {31846, 129, 5, 3}, {29847, 1180, 7, 2}, {29047, 1058, 8, 2},
+        {0, 0, 0, 0}, {27619, 800, 5, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {39266, 802, 5, 3},
+        {0, 0, 0, 0}, {5193, 780, 6, 0}, {21957, 2443, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {7395, 1123, 3, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {8151, 1238, 6, 0},
+        {24759, 251, 5, 2}, {27654, 808, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {31798, 125, 6, 3}, {0, 0, 0, 0}, {32597, 192, 3, 3},
+        {10974, 271, 5, 1}, {37904, 673, 6, 3}, {27347, 750, 8, 2}, {0, 0, 0, 0},
+        {32532, 185, 5, 3}, {27055, 702, 6, 2}, {0, 0, 0, 0}, {10846, 158, 4, 1},
+        {3548, 520, 7, 0}, {11873, 480, 6, 1}, {22145, 2483, 4, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {10720, 130, 3, 1}, {13752, 894, 8, 1},
+        {37991, 683, 4, 3}, {0, 0, 0, 0}, {21230, 2296, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {4191, 620, 7, 0}, {0, 0, 0, 0}, {29055, 1059, 7, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {32207, 156, 6, 3}, {3111, 438, 5, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {10603, 96, 6, 1}, {0, 0, 0, 0}, {32752, 209, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {33962, 324, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {8261, 1253, 8, 0}, {0, 0, 0, 0},
+        {34267, 351, 5, 3}, {4706, 204, 4, 1}, {14292, 987, 8, 1}, {22995, 2683, 3, 1},
+        {0, 0, 0, 0}, {25485, 401, 5, 2}, {0, 0, 0, 0}, {4909, 284, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {5607, 845, 5, 0},
+        {30929, 30, 5, 3}, {8001, 1215, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {1373, 187, 5, 1}, {0, 0, 0, 0},
+        {22202, 2497, 6, 1}, {4616, 685, 7, 0}, {10364, 36, 6, 1}, {16329, 839, 5, 2},
+        {33405, 275, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {10149, 1545, 6, 0}, {35873, 491, 8, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {13108, 735, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {19216, 274, 3, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {32776, 211, 4, 3}, {7081, 1066, 4, 0}, {20531, 2160, 3, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {5543, 835, 3, 0}, {0, 0, 0, 0},
+        {27131, 714, 4, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {1638, 252, 5, 0}, {12680, 646, 6, 1}, {15580, 1215, 4, 1}, {15754, 1245, 7, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {59, 10, 6, 0}, {13469, 813, 5, 1},
+        {35416, 450, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {10813, 153, 6, 1}, {12404, 593, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {34377, 359, 8, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {25069, 314, 4, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {12118, 530, 5, 1},
+        {18388, 1735, 7, 1}, {37193, 607, 5, 3}, {22532, 2573, 7, 1}, {24515, 206, 4, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {28630, 985, 6, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {22010, 2453, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {32446, 176, 3, 3}, {0, 0, 0, 0},
+        {19696, 1998, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {37737, 658, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {11886, 483, 5, 1}, {16650, 1415, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {18315, 1719, 6, 1}, {35150, 426, 6, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {13821, 911, 4, 1}, {0, 0, 0, 0}, {10311, 22, 3, 1},
+        {6943, 1045, 7, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {18242, 790, 6, 2}, {34918, 404, 4, 3},
+        {0, 0, 0, 0}, {21673, 2383, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {7402, 1125, 6, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {15289, 1171, 7, 1},
+        {0, 0, 0, 0}, {29428, 1122, 7, 2}, {363, 56, 8, 0}, {1620, 250, 9, 0},
+        {4462, 659, 7, 0}, {4851, 725, 9, 0}, {16446, 1376, 4, 1}, {17187, 1508, 7, 1},
+        {18026, 1664, 5, 1}, {20687, 2193, 4, 1}, {16527, 1392, 6, 1}, {31708, 116, 3, 3},
+        {38622, 740, 6, 3}, {5531, 833, 5, 0}, {39473, 820, 4, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {8623, 1304, 8, 0}, {17694, 1603, 4, 1},
+        {25012, 302, 7, 2}, {8706, 57, 5, 2}, {16957, 1471, 5, 1}, {30778, 8, 6, 3},
+        {32385, 169, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {24674, 235, 4, 2}, {39271, 803, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {11640, 431, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {31954, 137, 5, 3}, {0, 0, 0, 0},
+        {18961, 1849, 4, 1}, {40724, 936, 5, 3}, {0, 0, 0, 0}, {34346, 357, 9, 3},
+        {0, 0, 0, 0}, {3031, 445, 6, 0}, {8168, 16, 6, 3}, {15034, 1126, 8, 1},
+        {26376, 574, 6, 2}, {28844, 1022, 6, 2}, {12061, 519, 6, 1}, {33401, 275, 4, 3},
+        {0, 0, 0, 0}, {39481, 821, 8, 3}, {0, 1, 6, 0}, {37020, 591, 6, 3},
+        {40250, 892, 3, 3}, {26314, 563, 5, 2}, {36550, 549, 4, 3}, {13647, 873, 6, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {23665, 2817, 4, 1},
+        {0, 0, 0, 0}, {28268, 920, 8, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {30196, 1227, 8, 2}, {12972, 707, 4, 1}, {0, 0, 0, 0}, {1800, 275, 7, 0},
+        {39289, 805, 5, 3}, {0, 0, 0, 0}, {26370, 573, 6, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {18922, 1840, 7, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {38656, 743, 8, 3}, {0, 0, 0, 0}, {28592, 978, 6, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {7447, 1134, 8, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {35966, 498, 8, 3}, {15067, 1132, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {19281, 1914, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {16381, 1363, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {6883, 1037, 9, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {17529, 1571, 6, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {26194, 547, 6, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {11028, 311, 6, 1}, {39621, 832, 8, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {13435, 804, 4, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {37841, 668, 7, 3}, {28564, 974, 8, 2}, {12292, 567, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {36094, 509, 5, 3}, {8044, 1222, 5, 0},
+        {0, 0, 0, 0}, {28099, 889, 4, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {38204, 702, 4, 3}, {19105, 1878, 5, 1}, {5868, 893, 8, 0}, {40758, 941, 5, 3},
+        {35429, 452, 6, 3}, {11783, 462, 5, 1}, {17588, 1582, 7, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {9063, 471, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {10784, 146, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {24296, 155, 5, 2},
+        {15523, 1205, 6, 1}, {30508, 1270, 7, 2}, {38053, 689, 7, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {27861, 848, 6, 2}, {2473, 369, 7, 0},
+        {0, 0, 0, 0}, {35568, 464, 4, 3}, {0, 0, 0, 0}, {26951, 683, 6, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {30604, 1283, 8, 2}, {0, 0, 0, 0},
+        {16244, 1332, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {8768, 31, 5, 2}, {9162, 1399, 10, 0}, {21012, 2252, 4, 1}, {0, 0, 0, 0},
+        {15228, 1161, 5, 1}, {36861, 577, 5, 3}, {0, 0, 0, 0}, {30914, 26, 5, 3},
+        {9895, 1505, 7, 0}, {35505, 458, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {37581, 641, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {12795, 668, 6, 1},
+        {28735, 1006, 10, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {39391, 813, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {9653, 1471, 6, 0}, {18902, 1836, 4, 1}, {25255, 351, 5, 2}, {5266, 791, 10, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {11879, 481, 3, 1},
+        {26929, 679, 5, 2}, {31772, 123, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {37407, 625, 5, 3}, {30318, 1243, 7, 2}, {0, 0, 0, 0}, {31242, 62, 3, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {12788, 667, 7, 1}, {8073, 1227, 6, 0}, {9808, 1078, 4, 2},
+        {37534, 637, 7, 3}, {24854, 270, 5, 2}, {30455, 1263, 8, 2}, {36436, 540, 8, 3},
+        {0, 0, 0, 0}, {13444, 806, 4, 1}, {27518, 781, 7, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {4469, 660, 7, 0}, {32399, 170, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {33320, 266, 6, 3}, {38741, 752, 3, 3}, {0, 0, 0, 0}, {26095, 527, 6, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {25508, 407, 6, 2}, {7868, 1193, 6, 0},
+        {0, 0, 0, 0}, {7476, 1139, 8, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {36431, 539, 5, 3}, {0, 0, 0, 0}, {10538, 80, 4, 1}, {21795, 2409, 5, 1},
+        {24764, 253, 6, 2}, {25474, 399, 5, 2}, {35898, 492, 9, 3}, {24394, 177, 5, 2},
+        {0, 0, 0, 0}, {14679, 1056, 4, 1}, {0, 0, 0, 0}, {16707, 1425, 7, 1},
+        {38673, 745, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {31475, 93, 5, 3}, {29310, 1104, 6, 2},
+        {3849, 568, 9, 0}, {17491, 1565, 7, 1}, {0, 0, 0, 0}, {26555, 32, 4, 3},
+        {25886, 488, 5, 2}, {34750, 390, 7, 3}, {0, 0, 0, 0}, {40276, 895, 6, 3},
+        {0, 0, 0, 0}, {3460, 508, 7, 0}, {23733, 859, 6, 2}, {11970, 502, 6, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {6555, 995, 9, 0}, {29889, 1186, 7, 2},
+        {30441, 1261, 7, 2}, {0, 0, 0, 0}, {33979, 325, 8, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {13708, 887, 5, 1},
+        {9464, 1443, 4, 0}, {35401, 449, 8, 3}, {2335, 349, 8, 0}, {36022, 502, 9, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {37092, 597, 7, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {17611, 1585, 4, 1},
+        {32996, 236, 5, 3}, {32537, 186, 4, 3}, {35945, 496, 5, 3}, {0, 0, 0, 0},
+        {10769, 142, 4, 1}, {13212, 752, 6, 1}, {23078, 2702, 6, 1}, {38004, 684, 4, 3},
+        {0, 0, 0, 0}, {19593, 1977, 5, 1}, {22940, 2672, 4, 1}, {0, 0, 0, 0},
+        {32096, 147, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {16034, 1293, 7, 1},
+        {19953, 2047, 7, 1}, {3637, 534, 7, 0}, {9010, 1374, 7, 0}, {33789, 307, 3, 3},
+        {35281, 439, 6, 3}, {28825, 1019, 5, 2}, {5240, 787, 8, 0}, {33659, 296, 6, 3},
+        {40018, 870, 7, 3}, {0, 0, 0, 0}, {21092, 2269, 5, 1}, {31456, 91, 5, 3},
+        {23312, 2748, 7, 1}, {30626, 1286, 7, 2}, {33555, 287, 6, 3}, {6049, 50, 5, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {23710, 2827, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {39188, 794, 5, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {39559, 827, 6, 3}, {7560, 1152, 7, 0}, {5841, 889, 5, 0},
+        {130, 21, 10, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {38147, 697, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {6764, 1022, 8, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {419, 64, 4, 0}, {16342, 1353, 7, 1}, {586, 91, 6, 0},
+        {22846, 2651, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {38469, 727, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {4382, 646, 7, 0}, {36192, 518, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {38102, 693, 9, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {2867, 420, 7, 0},
+        {18965, 853, 4, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {26836, 28, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {7186, 1088, 4, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {23673, 2819, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {37253, 612, 5, 3}, {0, 0, 0, 0}, {19101, 1877, 4, 1}, {0, 0, 0, 0},
+        {31649, 110, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {10123, 1540, 6, 0},
+        {2579, 382, 8, 0}, {21266, 2303, 5, 1}, {23448, 2775, 5, 1}, {29957, 1195, 9, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {384, 24, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {6128, 936, 7, 0}, {36793, 572, 7, 3}, {39676, 839, 3, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {18289, 1714, 3, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {1783, 273, 8, 0}, {13474, 814, 9, 1},
+        {16259, 1335, 4, 1}, {18980, 1853, 6, 1}, {28699, 999, 7, 2}, {14361, 999, 4, 1},
+        {37749, 659, 3, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {16122, 1308, 8, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {22129, 2480, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {20395, 2134, 6, 1}, {14730, 1069, 8, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {26710, 635, 5, 2}, {14424, 1008, 8, 1},
+        {10990, 282, 3, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {13866, 921, 4, 1},
+        {0, 0, 0, 0}, {19382, 1934, 6, 1}, {34691, 385, 7, 3}, {0, 0, 0, 0},
+        {21026, 2255, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {27999, 872, 10, 2}, {23793, 2844, 6, 1},
+        {18376, 1731, 7, 1}, {0, 0, 0, 0}, {20714, 2198, 6, 1}, {15983, 1284, 8, 1},
+        {28552, 972, 5, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {16356, 1356, 7, 1}, {33230, 258, 6, 3}, {26693, 632, 6, 2}, {26788, 651, 8, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {1172, 180, 6, 0}, {0, 0, 0, 0},
+        {36889, 579, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {12023, 511, 3, 1}, {11407, 396, 5, 1},
+        {39751, 846, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {11129, 341, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {2638, 390, 6, 0}, {5632, 850, 6, 0},
+        {22671, 2607, 4, 1}, {1975, 298, 12, 0}, {15991, 1285, 8, 1}, {22790, 2639, 5, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {30332, 1245, 6, 2},
+        {22249, 2507, 5, 1}, {24946, 288, 5, 2}, {30971, 35, 7, 3}, {37691, 653, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {37487, 632, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {17779, 1619, 6, 1}, {17773, 1618, 6, 1},
+        {28056, 881, 8, 2}, {19212, 1900, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {13803, 904, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {31742, 120, 3, 3}, {6462, 983, 6, 0}, {8650, 1308, 6, 0}, {4048, 598, 7, 0},
+        {16442, 1375, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {18568, 1772, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {30843, 14, 6, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {19149, 1886, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {38273, 709, 4, 3}, {38747, 753, 8, 3}, {9441, 1439, 5, 0},
+        {605, 94, 6, 0}, {34480, 367, 5, 3}, {0, 0, 0, 0}, {5708, 183, 5, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {14480, 1019, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {26085, 526, 10, 2}, {19977, 2052, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {15093, 1137, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {27525, 782, 5, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {1431, 222, 6, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {26513, 600, 8, 2}, {0, 0, 0, 0},
+        {15202, 1156, 5, 1}, {22475, 2562, 4, 1}, {5799, 836, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {39193, 794, 5, 3}, {371, 57, 7, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {3664, 538, 4, 0}, {18714, 1800, 6, 1}, {23175, 2721, 6, 1}, {38684, 746, 5, 3},
+        {702, 108, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {17144, 1501, 7, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {38994, 774, 6, 3}, {52, 9, 7, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {6267, 958, 7, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {10969, 270, 5, 1},
+        {0, 0, 0, 0}, {31257, 65, 3, 3}, {0, 0, 0, 0}, {19568, 1972, 5, 1},
+        {8174, 1242, 9, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {37289, 615, 7, 3}, {0, 0, 0, 0}, {26979, 249, 8, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {7541, 1149, 8, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {37457, 629, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {29670, 1156, 7, 2},
+        {36078, 507, 4, 3}, {8501, 298, 4, 2}, {16499, 1387, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {17967, 1653, 6, 1}, {35094, 420, 3, 3}, {32961, 232, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {36279, 526, 7, 3}, {0, 0, 0, 0},
+        {33812, 310, 4, 3}, {17698, 1604, 4, 1}, {31537, 100, 3, 3}, {20053, 2067, 6, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {11764, 459, 4, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {7983, 1212, 6, 0},
+        {0, 0, 0, 0}, {4560, 675, 9, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {18190, 1696, 4, 1}, {34993, 412, 5, 3}, {7290, 1108, 7, 0}, {0, 0, 0, 0},
+        {2874, 421, 9, 0}, {10338, 29, 3, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {1042, 160, 9, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {99, 16, 7, 0},
+        {25722, 449, 6, 2}, {0, 0, 0, 0}, {37678, 651, 3, 3}, {28191, 906, 7, 2},
+        {3868, 571, 8, 0}, {10754, 140, 4, 1}, {23836, 29, 7, 2}, {28045, 879, 5, 2},
+        {38558, 734, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {20791, 2213, 5, 1}, {0, 0, 0, 0}, {6720, 1016, 8, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {14818, 1087, 4, 1},
+        {31532, 99, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {35974, 499, 6, 3},
+        {4590, 403, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {26309, 562, 5, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {20142, 2083, 4, 1},
+        {6438, 979, 5, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {5612, 846, 6, 0}, {25114, 323, 3, 2},
+        {0, 0, 0, 0}, {21852, 2421, 5, 1}, {23324, 2750, 5, 1}, {26478, 20, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {40115, 878, 5, 3}, {16543, 1395, 5, 1},
+        {0, 0, 0, 0}, {22557, 2579, 6, 1}, {0, 0, 0, 0}, {35986, 500, 5, 3},
+        {0, 0, 0, 0}, {17954, 1651, 6, 1}, {0, 0, 0, 0}, {36159, 515, 7, 3},
+        {0, 0, 0, 0}, {11599, 424, 5, 1}, {12772, 664, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {36825, 574, 6, 3},
+        {30049, 1207, 7, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {28477, 959, 8, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {38179, 700, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {18364, 1729, 5, 1}, {31517, 97, 3, 3}, {38269, 709, 4, 3}, {0, 0, 0, 0},
+        {29572, 1142, 7, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {29854, 1181, 8, 2}, {24364, 171, 6, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {1519, 235, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {24975, 294, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {21276, 2305, 5, 1},
+        {39386, 813, 5, 3}, {37591, 642, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {6333, 966, 12, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {23611, 2806, 6, 1},
+        {17413, 1552, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {9284, 1358, 7, 1}, {10280, 14, 3, 1}, {40687, 932, 5, 3}, {0, 0, 0, 0},
+        {25970, 505, 5, 2}, {0, 0, 0, 0}, {15329, 1179, 6, 1}, {38832, 760, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {35112, 422, 8, 3}, {0, 0, 0, 0},
+        {36138, 513, 6, 3}, {4999, 749, 7, 0}, {20577, 2171, 5, 1}, {9785, 1489, 6, 0},
+        {24081, 106, 5, 2}, {0, 0, 0, 0}, {22198, 2496, 4, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {10194, 1553, 5, 0}, {37553, 638, 4, 3}, {0, 0, 0, 0},
+        {31977, 139, 7, 3}, {0, 0, 0, 0}, {13610, 864, 6, 1}, {16255, 1334, 4, 1},
+        {0, 0, 0, 0}, {10575, 90, 4, 1}, {22781, 2637, 5, 1}, {25753, 455, 4, 2},
+        {19320, 1923, 8, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {19669, 1993, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {20500, 2154, 6, 1}, {32340, 166, 7, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {3624, 532, 6, 0}, {18505, 1758, 4, 1}, {28899, 1034, 5, 2},
+        {36568, 551, 6, 3}, {34071, 335, 5, 3}, {40795, 945, 7, 3}, {0, 0, 0, 0},
+        {13057, 725, 4, 1}, {0, 0, 0, 0}, {25955, 502, 5, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {13739, 892, 4, 1},
+        {6584, 998, 10, 0}, {0, 0, 0, 0}, {16310, 1346, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {40295, 897, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {33055, 241, 6, 3}, {0, 0, 0, 0}, {28511, 965, 9, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {13026, 719, 4, 1}, {37757, 660, 4, 3},
+        {39756, 847, 5, 3}, {0, 0, 0, 0}, {20898, 2232, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {5403, 145, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {28070, 883, 5, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {21833, 2417, 5, 1}, {23489, 2782, 5, 1}, {9122, 1392, 6, 0}, {31540, 100, 3, 3},
+        {34698, 385, 7, 3}, {35474, 456, 6, 3}, {34729, 388, 4, 3}, {0, 0, 0, 0},
+        {4495, 664, 5, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {31120, 48, 4, 3}, {38929, 768, 7, 3}, {19799, 2020, 4, 1},
+        {40110, 878, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {37803, 664, 9, 3}, {0, 0, 0, 0}, {34146, 340, 9, 3},
+        {37058, 594, 5, 3}, {449, 69, 7, 0}, {21729, 2395, 5, 1}, {0, 0, 0, 0},
+        {40649, 929, 4, 3}, {23032, 2692, 4, 1}, {14919, 1102, 6, 1}, {10161, 1547, 6, 0},
+        {21332, 2315, 6, 1}, {26595, 614, 4, 2}, {12704, 651, 7, 1}, {29181, 1081, 4, 2},
+        {0, 0, 0, 0}, {29024, 1054, 5, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {35015, 414, 11, 3}, {19139, 1884, 4, 1}, {23193, 2724, 5, 1}, {27854, 847, 7, 2},
+        {22876, 2658, 4, 1}, {17577, 1580, 7, 1}, {36781, 571, 6, 3}, {11768, 460, 7, 1},
+        {24981, 295, 6, 2}, {37099, 598, 5, 3}, {40763, 941, 4, 3}, {3137, 360, 5, 2},
+        {40396, 908, 7, 3}, {37995, 683, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {6505, 989, 9, 0}, {0, 0, 0, 0}, {14795, 1081, 3, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {13083, 730, 4, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {12891, 505, 3, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {8876, 1350, 5, 0}, {10888, 168, 6, 1},
+        {25904, 492, 5, 2}, {30216, 1230, 7, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {20737, 2202, 5, 1}, {13298, 769, 4, 1}, {22212, 2499, 5, 1}, {28027, 875, 8, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {8751, 58, 7, 2},
+        {0, 0, 0, 0}, {39442, 817, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {28969, 1044, 6, 2}, {0, 0, 0, 0}, {4453, 657, 5, 0}, {9213, 1406, 12, 0},
+        {0, 0, 0, 0}, {16263, 1336, 5, 1}, {32028, 143, 7, 3}, {0, 0, 0, 0},
+        {1933, 293, 11, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {37451, 629, 6, 3},
+        {0, 0, 0, 0}, {1191, 183, 6, 0}, {6419, 977, 9, 0}, {9756, 1485, 10, 0},
+        {13423, 801, 4, 1}, {21400, 2330, 3, 1}, {35146, 425, 4, 3}, {0, 0, 0, 0},
+        {20884, 2229, 3, 1}, {0, 0, 0, 0}, {5976, 911, 6, 0}, {11792, 464, 10, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {1993, 300, 8, 0}, {23596, 2802, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {38507, 730, 4, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {40064, 874, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {37009, 590, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {11223, 356, 5, 1}, {282, 43, 6, 0}, {22093, 2473, 6, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {20586, 2173, 4, 1}, {30436, 1260, 5, 2}, {32807, 216, 5, 3},
+        {25580, 419, 5, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {34098, 337, 8, 3},
+        {0, 0, 0, 0}, {19996, 2056, 4, 1}, {0, 0, 0, 0}, {2828, 415, 10, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {32732, 207, 6, 3}, {9915, 1508, 5, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {3682, 542, 5, 0}, {11595, 423, 4, 1}, {0, 0, 0, 0},
+        {20603, 2177, 5, 1}, {32126, 149, 7, 3}, {18663, 1791, 3, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {25093, 319, 5, 2}, {31155, 52, 5, 3}, {40040, 872, 7, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {22048, 2463, 4, 1}, {0, 0, 0, 0}, {15210, 1158, 8, 1}, {20594, 2175, 4, 1},
+        {0, 0, 0, 0}, {4444, 656, 9, 0}, {0, 0, 0, 0}, {34475, 367, 5, 3},
+        {12177, 542, 5, 1}, {27502, 779, 9, 2}, {9231, 1408, 7, 0}, {37268, 613, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {21724, 2394, 5, 1}, {5022, 291, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {30694, 1295, 7, 2},
+        {0, 0, 0, 0}, {31514, 97, 3, 3}, {15472, 1197, 4, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {16221, 1328, 7, 1}, {0, 0, 0, 0}, {7089, 1068, 5, 0},
+        {6386, 972, 8, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {12074, 521, 5, 1},
+        {1213, 187, 6, 0}, {12217, 552, 4, 1}, {21347, 2320, 6, 1}, {24348, 165, 5, 2},
+        {35374, 446, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {18135, 1684, 5, 1},
+        {3416, 502, 10, 0}, {0, 0, 0, 0}, {18480, 1753, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {33351, 269, 6, 3}, {18929, 707, 3, 3},
+        {34559, 374, 6, 3}, {33609, 292, 5, 3}, {0, 0, 0, 0}, {38215, 703, 7, 3},
+        {0, 0, 0, 0}, {24524, 208, 7, 2}, {30819, 12, 4, 3}, {2448, 365, 6, 0},
+        {31006, 39, 5, 3}, {0, 0, 0, 0}, {12674, 645, 6, 1}, {16611, 944, 4, 2},
+        {8902, 141, 5, 2}, {19812, 2023, 7, 1}, {0, 0, 0, 0}, {5152, 773, 9, 0},
+        {13402, 795, 9, 1}, {35231, 434, 4, 3}, {36308, 530, 4, 3}, {20473, 2149, 6, 1},
+        {21823, 2415, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {30345, 1247, 7, 2}, {0, 0, 0, 0}, {20432, 2141, 7, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {37862, 669, 6, 3}, {3959, 584, 9, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {35105, 421, 7, 3}, {0, 0, 0, 0},
+        {3983, 587, 7, 0}, {24236, 143, 9, 2}, {15128, 1143, 5, 1}, {26905, 675, 5, 2},
+        {2820, 414, 8, 0}, {33857, 314, 5, 3}, {6778, 429, 7, 1}, {31112, 47, 4, 3},
+        {32714, 205, 6, 3}, {23963, 73, 5, 2}, {33131, 248, 4, 3}, {35583, 466, 9, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {1672, 257, 8, 0}, {11626, 428, 7, 1},
+        {13317, 774, 4, 1}, {2191, 324, 8, 0}, {18793, 1814, 7, 1}, {0, 0, 0, 0},
+        {21271, 2304, 5, 1}, {23329, 2751, 5, 1}, {16744, 1431, 6, 1}, {28934, 1039, 7, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {36072, 507, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {32330, 165, 10, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {39122, 788, 5, 3},
+        {37043, 593, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {6015, 822, 3, 1},
+        {23359, 2758, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {17908, 1643, 7, 1}, {0, 0, 0, 0},
+        {3774, 555, 6, 0}, {22837, 2649, 5, 1}, {0, 0, 0, 0}, {33107, 246, 6, 3},
+        {39017, 777, 3, 3}, {24456, 191, 7, 2}, {26445, 588, 5, 2}, {12221, 553, 5, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {1841, 280, 9, 0}, {13364, 786, 4, 1}, {3364, 496, 8, 0}, {23164, 2719, 5, 1},
+        {11549, 416, 7, 1}, {18951, 1847, 6, 1}, {24850, 269, 4, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {6079, 929, 8, 0},
+        {6634, 1003, 10, 0}, {24682, 237, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {15999, 1286, 7, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {17041, 1486, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {31447, 90, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {37570, 640, 5, 3}, {0, 0, 0, 0}, {12259, 561, 7, 1}, {32427, 174, 4, 3},
+        {19031, 1863, 7, 1}, {9499, 1449, 12, 0}, {17818, 1626, 7, 1}, {19362, 1931, 6, 1},
+        {39257, 801, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {7165, 1084, 5, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {14133, 967, 7, 1}, {40054, 873, 5, 3},
+        {0, 0, 0, 0}, {140, 22, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {4918, 736, 8, 0}, {0, 0, 0, 0}, {19715, 2002, 4, 1}, {33916, 320, 6, 3},
+        {36305, 529, 3, 3}, {15194, 1154, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {2223, 328, 8, 0}, {26033, 517, 5, 2}, {40841, 949, 5, 3},
+        {23727, 2831, 6, 1}, {0, 0, 0, 0}, {24781, 256, 7, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {34590, 377, 6, 3}, {16505, 1388, 5, 1}, {9156, 1398, 6, 0},
+        {15596, 1218, 7, 1}, {32188, 154, 5, 3}, {0, 0, 0, 0}, {23226, 2730, 5, 1},
+        {20564, 2168, 4, 1}, {0, 0, 0, 0}, {22306, 2521, 5, 1}, {24870, 273, 5, 2},
+        {18031, 1665, 5, 1}, {13699, 884, 5, 1}, {20427, 2140, 5, 1}, {24645, 230, 6, 2},
+        {35530, 461, 5, 3}, {11696, 444, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {31186, 55, 7, 3}, {0, 0, 0, 0}, {11386, 392, 5, 1}, {22392, 2542, 5, 1},
+        {31804, 126, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {28172, 903, 7, 2}, {21509, 2350, 5, 1}, {2416, 360, 8, 0}, {34469, 366, 6, 3},
+        {0, 0, 0, 0}, {14409, 1006, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {33730, 302, 4, 3}, {32594, 192, 3, 3},
+        {0, 0, 0, 0}, {39719, 843, 5, 3}, {0, 0, 0, 0}, {19931, 2043, 5, 1},
+        {18581, 1775, 6, 1}, {11007, 295, 5, 1}, {4640, 689, 7, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {29154, 1074, 9, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {10555, 85, 6, 1}, {23813, 2848, 3, 1},
+        {0, 0, 0, 0}, {29096, 1066, 10, 2}, {12505, 611, 5, 1}, {17073, 1491, 7, 1},
+        {24207, 133, 4, 2}, {37848, 668, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {18009, 1661, 7, 1}, {29565, 1141, 7, 2}, {28205, 908, 7, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {37611, 645, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {5297, 795, 6, 0},
+        {0, 0, 0, 0}, {16945, 1469, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {13137, 740, 4, 1}, {8989, 1371, 7, 0},
+        {15480, 1199, 6, 1}, {34565, 375, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {29073, 1062, 5, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {1097, 168, 8, 0},
+        {0, 0, 0, 0}, {13061, 726, 6, 1}, {33577, 289, 5, 3}, {0, 0, 0, 0},
+        {22614, 2593, 4, 1}, {10426, 51, 4, 1}, {36679, 562, 6, 3}, {0, 0, 0, 0},
+        {4500, 665, 6, 0}, {33277, 262, 6, 3}, {0, 0, 0, 0}, {6705, 1014, 7, 0},
+        {10302, 20, 5, 1}, {20345, 2125, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {37417, 626, 6, 3}, {31331, 75, 3, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {39644, 834, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {31251, 64, 3, 3},
+        {29546, 1138, 7, 2}, {36183, 517, 5, 3}, {0, 0, 0, 0}, {19202, 1897, 6, 1},
+        {31581, 104, 7, 3}, {0, 0, 0, 0}, {18000, 1659, 5, 1}, {0, 0, 0, 0},
+        {38545, 733, 8, 3}, {0, 0, 0, 0}, {40656, 930, 7, 3}, {37003, 590, 6, 3},
+        {0, 0, 0, 0}, {18800, 1815, 7, 1}, {19045, 1865, 3, 1}, {36232, 522, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {33424, 277, 8, 3}, {27254, 734, 7, 2},
+        {33326, 266, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {29833, 1178, 6, 2},
+        {6135, 937, 9, 0}, {5387, 808, 3, 0}, {23236, 2732, 5, 1}, {30978, 36, 6, 3},
+        {33211, 256, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {33294, 263, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {37607, 644, 4, 3},
+        {0, 0, 0, 0}, {15948, 1279, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {13393, 793, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {21459, 2341, 6, 1}, {22217, 2500, 6, 1}, {0, 0, 0, 0},
+        {21664, 2381, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {37706, 654, 4, 3},
+        {38563, 735, 5, 3}, {0, 0, 0, 0}, {37681, 652, 5, 3}, {0, 0, 0, 0},
+        {19341, 1927, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {21141, 2278, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {9041, 1378, 8, 0}, {19024, 1862, 7, 1}, {20548, 2165, 6, 1}, {30064, 1209, 11, 2},
+        {7297, 1109, 5, 0}, {33432, 277, 7, 3}, {0, 0, 0, 0}, {29350, 1110, 8, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {1879, 285, 6, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {40358, 904, 7, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {31279, 68, 3, 3},
+        {11252, 361, 5, 1}, {39951, 865, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {875, 134, 7, 0}, {35198, 430, 4, 3}, {30560, 1277, 5, 2}, {36644, 558, 5, 3},
+        {0, 0, 0, 0}, {34039, 330, 3, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {20296, 2117, 8, 1}, {36257, 524, 4, 3},
+        {29274, 1097, 4, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {11192, 351, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {19464, 1952, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {34405, 361, 7, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {5920, 819, 3, 1}, {20175, 2092, 6, 1}, {24203, 132, 4, 2},
+        {10737, 136, 4, 1}, {0, 0, 0, 0}, {8396, 458, 6, 2}, {15820, 1256, 5, 1},
+        {19454, 1950, 4, 1}, {3942, 581, 8, 0}, {23739, 2833, 5, 1}, {40120, 879, 5, 3},
+        {0, 0, 0, 0}, {4544, 672, 4, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {38593, 738, 5, 3}, {5739, 871, 4, 0}, {16214, 1326, 3, 1}, {19639, 1985, 6, 1},
+        {16197, 1323, 7, 1}, {27753, 826, 9, 2}, {0, 0, 0, 0}, {12416, 595, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {36563, 550, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {35210, 431, 3, 3}, {39367, 811, 5, 3},
+        {25479, 400, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {19769, 193, 4, 3},
+        {0, 0, 0, 0}, {25757, 456, 7, 2}, {7302, 886, 5, 1}, {35950, 496, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {12576, 626, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {5449, 387, 6, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {18674, 1794, 5, 1}, {0, 0, 0, 0},
+        {6183, 945, 5, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {20762, 2207, 5, 1},
+        {11502, 410, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {19773, 2014, 6, 1}, {14587, 1039, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {14300, 989, 8, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {7995, 1214, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {1885, 286, 7, 0}, {12287, 566, 5, 1}, {16413, 1369, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {22379, 2539, 4, 1}, {0, 0, 0, 0}, {17080, 1492, 7, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {3739, 550, 4, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {23365, 2759, 5, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {32788, 213, 3, 3}, {0, 0, 0, 0},
+        {32641, 198, 6, 3}, {993, 152, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {19196, 1895, 6, 1}, {0, 0, 0, 0}, {20887, 2230, 6, 1}, {16937, 1467, 4, 1},
+        {40311, 899, 4, 3}, {0, 0, 0, 0}, {40186, 885, 4, 3}, {29365, 255, 4, 3},
+        {3020, 442, 3, 0}, {13141, 741, 9, 1}, {4104, 607, 6, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {15313, 1177, 7, 1}, {29625, 1150, 7, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {2111, 314, 10, 0},
+        {20099, 2075, 4, 1}, {0, 0, 0, 0}, {40832, 947, 4, 3}, {4804, 717, 8, 0},
+        {21897, 2430, 4, 1}, {0, 0, 0, 0}, {40579, 923, 8, 3}, {3823, 563, 4, 0},
+        {34870, 399, 10, 3}, {33332, 267, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {35272, 437, 5, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {17702, 1605, 5, 1},
+        {21561, 2360, 6, 1}, {0, 0, 0, 0}, {33041, 240, 7, 3}, {23951, 70, 5, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {35294, 440, 4, 3}, {20598, 2176, 5, 1}, {7887, 1196, 6, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {21524, 2353, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {23977, 78, 5, 2}, {20676, 2191, 6, 1},
+        {14670, 1054, 5, 1}, {1572, 243, 7, 0}, {10450, 57, 5, 1}, {19289, 1916, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {5343, 259, 6, 1}, {32766, 210, 5, 3},
+        {30018, 1202, 7, 2}, {40166, 883, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {18693, 1797, 7, 1}, {3178, 468, 7, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {1347, 208, 6, 0}, {25909, 493, 5, 2},
+        {19551, 1969, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {2175, 322, 8, 0}, {10733, 135, 4, 1}, {18986, 1854, 7, 1},
+        {20223, 2102, 4, 1}, {34046, 331, 3, 3}, {0, 0, 0, 0}, {35660, 471, 8, 3},
+        {22952, 2675, 4, 1}, {19579, 1974, 4, 1}, {8016, 1217, 6, 0}, {22386, 2541, 6, 1},
+        {0, 0, 0, 0}, {2684, 395, 10, 0}, {0, 0, 0, 0}, {900, 138, 7, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {3185, 469, 6, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {36590, 553, 5, 3}, {38287, 711, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {2907, 186, 5, 1}, {22871, 1079, 5, 2}, {0, 0, 0, 0}, {1601, 247, 7, 0},
+        {21556, 2359, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {10472, 64, 4, 1}, {22539, 2574, 5, 1}, {32780, 212, 4, 3},
+        {16079, 1301, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {32827, 218, 5, 3}, {23483, 2781, 6, 1},
+        {0, 0, 0, 0}, {15133, 1144, 3, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {7760, 1178, 7, 0}, {11646, 432, 4, 1}, {15238, 1163, 5, 1},
+        {17660, 1596, 5, 1}, {30310, 1242, 8, 2}, {1234, 190, 6, 0}, {2644, 391, 10, 0},
+        {31223, 59, 3, 3}, {39782, 849, 5, 3}, {0, 0, 0, 0}, {4609, 684, 7, 0},
+        {146, 23, 7, 0}, {11002, 294, 5, 1}, {12132, 533, 6, 1}, {16432, 1373, 5, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {16073, 1300, 6, 1},
+        {37965, 680, 3, 3}, {0, 0, 0, 0}, {13308, 771, 3, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {4557, 674, 3, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {2430, 362, 6, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {5118, 768, 7, 0}, {11775, 461, 8, 1}, {5653, 854, 5, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {20861, 2225, 7, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {21174, 2284, 3, 1},
+        {0, 0, 0, 0}, {2302, 342, 4, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {22067, 2467, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {1058, 146, 6, 2},
+        {24142, 121, 6, 2}, {0, 0, 0, 0}, {23252, 2735, 5, 1}, {0, 0, 0, 0},
+        {12190, 545, 3, 1}, {28148, 898, 6, 2}, {0, 0, 0, 0}, {26610, 617, 7, 2},
+        {40751, 940, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {10258, 8, 4, 1}, {14866, 1095, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {8805, 289, 5, 2}, {36316, 531, 4, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {24033, 94, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {5743, 796, 5, 3},
+        {24399, 179, 6, 2}, {12582, 627, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {38814, 758, 3, 3}, {0, 0, 0, 0}, {33113, 246, 6, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {4019, 593, 6, 0}, {14745, 1071, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {38817, 759, 7, 3}, {12067, 520, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {9791, 1490, 7, 0}, {7586, 1156, 6, 0},
+        {12143, 535, 5, 1}, {18165, 1690, 5, 1}, {19917, 2040, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {7515, 1145, 7, 0}, {32001, 141, 7, 3}, {39335, 809, 8, 3},
+        {5455, 820, 7, 0}, {25514, 408, 5, 2}, {0, 0, 0, 0}, {526, 82, 6, 0},
+        {10076, 1532, 3, 0}, {3162, 466, 8, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {7862, 1192, 6, 0},
+        {26242, 553, 10, 2}, {35915, 493, 8, 3}, {38427, 723, 3, 3}, {40371, 905, 4, 3},
+        {0, 0, 0, 0}, {19702, 1999, 3, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {16320, 1348, 5, 1}, {38889, 764, 7, 3}, {0, 0, 0, 0},
+        {8866, 1348, 6, 0}, {0, 0, 0, 0}, {31695, 114, 4, 3}, {26998, 691, 4, 2},
+        {4794, 459, 5, 2}, {23744, 2834, 4, 1}, {38159, 698, 5, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {16754, 1433, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {13720, 889, 7, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {26200, 548, 7, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {15571, 1213, 5, 1}, {0, 0, 0, 0},
+        {31837, 128, 9, 3}, {32070, 145, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {9225, 217, 6, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {11347, 385, 7, 1}, {29875, 1184, 6, 2},
+        {0, 0, 0, 0}, {333, 3, 6, 2}, {6455, 982, 7, 0}, {0, 0, 0, 0},
+        {33679, 298, 7, 3}, {0, 0, 0, 0}, {20539, 2162, 5, 1}, {15320, 1178, 9, 1},
+        {21145, 2279, 6, 1}, {2953, 432, 6, 0}, {7637, 916, 5, 1}, {0, 0, 0, 0},
+        {21541, 2356, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {32987, 235, 4, 3}, {25964, 504, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {17915, 1644, 5, 1}, {23585, 2800, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {2436, 363, 6, 0}, {0, 0, 0, 0}, {2037, 305, 9, 0},
+        {24671, 234, 3, 2}, {0, 0, 0, 0}, {8055, 1224, 6, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {30388, 1253, 7, 2},
+        {24839, 267, 6, 2}, {39660, 837, 5, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {15345, 1181, 7, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {23084, 2703, 5, 1}, {0, 0, 0, 0}, {15977, 1283, 6, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {26946, 682, 5, 2}, {0, 0, 0, 0},
+        {848, 130, 7, 0}, {0, 0, 0, 0}, {20186, 2094, 5, 1}, {11579, 420, 6, 1},
+        {24865, 272, 5, 2}, {32938, 230, 6, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {9812, 1104, 6, 1}, {0, 0, 0, 0}, {19534, 1965, 4, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {18350, 1726, 4, 1}, {6188, 946, 6, 0},
+        {14934, 1107, 7, 1}, {8941, 26, 6, 3}, {22610, 2590, 4, 1}, {118, 19, 6, 0},
+        {24541, 211, 6, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}, {36166, 515, 7, 3},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {762, 117, 8, 0}, {0, 0, 0, 0}, {11380, 391, 6, 1}, {13551, 852, 5, 1},
+        {27084, 707, 7, 2}, {0, 0, 0, 0}, {28557, 973, 7, 2}, {0, 0, 0, 0},
+        {26388, 576, 4, 2}, {18485, 1754, 7, 1}, {0, 0, 0, 0}, {28954, 1042, 5, 2},
+        {32934, 229, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {15445, 1194, 11, 1},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {37686, 652, 5, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {16283, 1340, 4, 1},
+        {19285, 1915, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {4843, 190, 3, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {7417, 1128, 5, 0},
+        {14502, 1024, 5, 1}, {0, 0, 0, 0}, {33627, 294, 6, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {1077, 165, 8, 0}, {12878, 687, 3, 1},
+        {0, 0, 0, 0}, {21892, 2429, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {19588, 1976, 5, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {13238, 757, 7, 1},
+        {17799, 1622, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {25187, 339, 9, 2},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {26772, 648, 8, 2}, {30243, 1234, 8, 2}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {38232, 705, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {7037, 1059, 7, 0}, {13491, 817, 5, 1}, {18057, 1670, 5, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {19662, 1992, 7, 1}, {5846, 890, 6, 0},
+        {0, 0, 0, 0}, {25089, 318, 4, 2}, {37910, 674, 6, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {21114, 2273, 6, 1}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {4799, 716, 5, 0},
+        {0, 0, 0, 0}, {26009, 512, 4, 2}, {40594, 924, 7, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {3057, 449, 7, 0}, {27324, 746, 5, 2}, {0, 0, 0, 0},
+        {34880, 400, 6, 3}, {0, 0, 0, 0}, {6094, 931, 5, 0}, {0, 0, 0, 0},
+        {6987, 1051, 8, 0}, {36038, 503, 8, 3}, {16130, 1309, 7, 1}, {0, 0, 0, 0},
+        {34326, 355, 7, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {3069, 451, 6, 0}, {10882, 166, 3, 1}, {16673, 1419, 6, 1}, {7522, 1146, 4, 0},
+        {31116, 47, 4, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {9304, 1418, 4, 0},
+        {0, 0, 0, 0}, {30554, 1276, 6, 2}, {32832, 218, 6, 3}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {9190, 1402, 5, 0}, {14345, 996, 5, 1}, {0, 0, 0, 0},
+        {3086, 453, 6, 0}, {0, 0, 0, 0}, {27849, 846, 5, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {12109, 528, 4, 1}, {27412, 760, 9, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {34462, 366, 7, 3}, {15121, 1142, 7, 1}, {27787, 834, 8, 2},
+        {39777, 849, 5, 3}, {13411, 796, 5, 1}, {29129, 1070, 5, 2}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {30746, 5, 9, 3}, {14170, 972, 10, 1}, {0, 0, 0, 0},
+        {0, 0, 0, 0}, {0, 0, 0, 0}, {33719, 301, 7, 3}, {32176, 153, 7, 3},
+        {0, 0, 0, 0}, {35120, 422, 7, 3}, {0, 0, 0, 0}, {22154, 2485, 5, 1},
+        {33242, 259, 6, 3}, {0, 0, 0, 0}, {14996, 183, 5, 2}, {4145, 613, 9, 0},
+        {0, 0, 0, 0}, {30849, 15, 7, 3}, {36600, 554, 6, 3}, {0, 0, 0, 0},
+        {9588, 1461, 8, 0}, {2442, 364, 6, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}
+    };
+}
+
+#endif // STRENGTHDICTIONARY_DATA_H
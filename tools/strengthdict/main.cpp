@@ -0,0 +1,205 @@
+#include "strength/strengthdictionary.h"
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QFile>
+#include <QHash>
+#include <QRegExp>
+#include <QSet>
+#include <QSaveFile>
+#include <QTextStream>
+#include <QVector>
+
+namespace {
+    struct Word {
+        QByteArray text;
+        int        rank;
+        int        dictionary;
+    };
+
+    const int WORDS_PER_LINE = 8;
+    const int SLOTS_PER_LINE = 4;
+}
+
+/*!
+ * \brief Функция переводит русское слово в латиницу
+ * Возвращает транслит (тот же, что у поиска, см. StrengthDictionary::latin())
+ * и то же слово, набранное в английской раскладке, или пустой список,
+ * если в слове есть другие не-ASCII символы.
+ */
+static QList<QByteArray> latinForms(const QString &word)
+{
+    static const QString CYRILLIC = QString::fromUtf8( "абвгдеёжзийклмнопрстуфхцчшщъыьэюя" );
+    static const char LAYOUT[] = "f,dult`;pbqrkvyjghcnea[wxio]sm'.z";
+
+    QByteArray translit;
+    QByteArray layout;
+    char letter[StrengthDictionary::MAX_LATIN_LENGTH];
+    for( const QChar c : word ){
+        const int length = StrengthDictionary::latin( c.unicode(), letter );
+        if( length < 0 )
+            return QList<QByteArray>();
+        translit += QByteArray( letter, length );
+
+        const int index = CYRILLIC.indexOf( c );
+        layout += index >= 0 ? LAYOUT[index] : char( c.unicode() );
+    }
+    if( translit == layout )
+        return QList<QByteArray>() << translit;
+    return QList<QByteArray>() << translit << layout;
+}
+
+/*!
+ * \brief Функция читает список слов, отсортированный по частоте
+ * Из строки берётся первое поле, так что подходят и списки вида
+ * "слово частота". Русские слова переводятся в латиницу, пустые строки
+ * и строки с '#' пропускаются, повторы не занимают ранг, limit > 0
+ * ограничивает число слов.
+ */
+static bool readList(const QString &fileName, int dictionary, int limit,
+                     QVector<Word> *words, QHash<QByteArray, int> *positions)
+{
+    QFile file( fileName );
+    if( ! file.open(QIODevice::ReadOnly | QIODevice::Text) ){
+        QTextStream( stderr ) << "Cannot open " << fileName << endl;
+        return false;
+    }
+
+    QSet<QByteArray> seen;
+    int rank = 0;
+    while( ! file.atEnd() && (limit <= 0 || rank < limit) ){
+        const QString line = QString::fromUtf8( file.readLine() ).trimmed().toLower();
+        if( line.isEmpty() || line.startsWith('#') )
+            continue;
+        const QList<QByteArray> forms = latinForms( line.section(QRegExp("\\s+"), 0, 0) );
+
+        bool ranked = false;
+        for( const QByteArray &word : forms ){
+            if( seen.contains(word) )
+                continue;
+            if( word.size() < StrengthDictionary::MIN_WORD_LENGTH
+                    || word.size() > StrengthDictionary::MAX_WORD_LENGTH )
+                continue;
+
+            seen.insert( word );
+            // Транслит и раскладка одного слова делят его ранг
+            if( ! ranked ){
+                ++rank;
+                ranked = true;
+            }
+            // Из нескольких словарей остаётся наименьший ранг
+            const int position = positions->value( word, -1 );
+            if( position < 0 ){
+                positions->insert( word, words->size() );
+                words->append( Word{word, rank, dictionary} );
+            }else if( rank < words->at(position).rank ){
+                (*words)[position].rank       = rank;
+                (*words)[position].dictionary = dictionary;
+            }
+        }
+    }
+    return true;
+}
+
+static QByteArray escape(const QByteArray &word)
+{
+    QByteArray result;
+    for( char c : word ){
+        if( c == '"' || c == '\\' )
+            result += '\\';
+        result += c;
+    }
+    return result;
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(
+                "Builds the password strength dictionaries header.\n"
+                "Lists are given in StrengthDictionary::Dictionary order,"
+                " one word per line, most frequent first. Anything after the word"
+                " (e.g. a count in zxcvbn frequency lists) is ignored, Cyrillic"
+                " words are transliterated." );
+    parser.addHelpOption();
+    QCommandLineOption limitOption( QStringList() << "n" << "limit",
+                                    "Take at most <count> words from each list.", "count", "0" );
+    parser.addOption( limitOption );
+    parser.addPositionalArgument( "lists", "Word lists.", "<list>..." );
+    parser.addPositionalArgument( "output", "Header to write." );
+    parser.process( app );
+
+    QStringList args = parser.positionalArguments();
+    if( args.size() != StrengthDictionary::DictionaryCount + 1 ){
+        QTextStream( stderr ) << parser.helpText();
+        return 2;
+    }
+    const QString output = args.takeLast();
+    const int limit = parser.value( limitOption ).toInt();
+
+    QVector<Word> words;
+    QHash<QByteArray, int> positions;
+    for( int i = 0; i < args.size(); ++i ){
+        if( ! readList(args.at(i), i, limit, &words, &positions) )
+            return 1;
+    }
+
+    // Таблица заполнена не более чем наполовину
+    quint32 slotCount = 1;
+    while( slotCount < quint32(words.size()) * 2 )
+        slotCount *= 2;
+
+    QVector<StrengthDictionary::Slot> slots( slotCount, StrengthDictionary::Slot{0, 0, 0, 0} );
+    quint32 offset = 0;
+    for( const Word &word : words ){
+        quint32 index = StrengthDictionary::hash( word.text.constData(), word.text.size() ) & (slotCount - 1);
+        while( slots.at(index).length != 0 )
+            index = (index + 1) & (slotCount - 1);
+        slots[index] = StrengthDictionary::Slot{ offset, quint16(qMin(word.rank, 0xffff)),
+                                                 quint8(word.text.size()), quint8(word.dictionary) };
+        offset += word.text.size();
+    }
+
+    QSaveFile file( output );
+    if( ! file.open(QIODevice::WriteOnly | QIODevice::Text) ){
+        QTextStream( stderr ) << "Cannot write " << output << endl;
+        return 1;
+    }
+    QTextStream out( &file );
+    out << "// Generated by tools/strengthdict from its word lists, do not edit.\n\n"
+        << "#ifndef STRENGTHDICTIONARY_DATA_H\n"
+        << "#define STRENGTHDICTIONARY_DATA_H\n\n"
+        << "#include \"strengthdictionary.h\"\n\n"
+        << "namespace StrengthDictionaryData {\n"
+        << "    const int     WORD_COUNT = " << words.size() << ";\n"
+        << "    const quint32 SLOT_COUNT = " << slotCount << ";\n\n"
+        << "    const char WORDS[] =";
+    for( int i = 0; i < words.size(); ++i ){
+        if( i % WORDS_PER_LINE == 0 )
+            out << "\n        ";
+        else
+            out << " ";
+        out << "\"" << escape( words.at(i).text ) << "\"";
+    }
+    out << ";\n\n"
+        << "    const StrengthDictionary::Slot SLOTS[SLOT_COUNT] = {";
+    for( quint32 i = 0; i < slotCount; ++i ){
+        const StrengthDictionary::Slot &slot = slots.at( i );
+        out << ( i % SLOTS_PER_LINE == 0 ? "\n        " : " " )
+            << "{" << slot.offset << ", " << slot.rank << ", "
+            << int(slot.length) << ", " << int(slot.dictionary) << "}"
+            << ( i + 1 < slotCount ? "," : "" );
+    }
+    out << "\n    };\n"
+        << "}\n\n"
+        << "#endif // STRENGTHDICTIONARY_DATA_H\n";
+    out.flush();
+
+    if( ! file.commit() ){
+        QTextStream( stderr ) << "Cannot write " << output << endl;
+        return 1;
+    }
+    return 0;
+}
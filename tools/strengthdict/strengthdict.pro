@@ -0,0 +1,25 @@
+#-------------------------------------------------
+#
+# Builds strength/strengthdictionary_data.h from the word lists:
+#   strengthdict passwords.txt english.txt names.txt russian.txt \
+#       ../../strength/strengthdictionary_data.h
+#
+# Lists may be frequency lists in "word count" form (as in zxcvbn's
+# data/*.txt); russian.txt may be Cyrillic, it is transliterated and
+# also added as typed in the English layout. Use --limit to cap each
+# list when feeding full frequency lists.
+#
+#-------------------------------------------------
+
+QT       -= gui
+
+TARGET = strengthdict
+TEMPLATE = app
+CONFIG += console c++11
+CONFIG -= app_bundle
+
+INCLUDEPATH += ../..
+
+SOURCES += main.cpp
+
+HEADERS  += ../../strength/strengthdictionary.h
@@ -0,0 +1,190 @@
+#include "vaultgenerator.h"
+#include "vault.h"
+#include "vaultkey.h"
+#include "io/transferstats.h"
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QDateTime>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QTextStream>
+
+const char PASSWORD_VARIABLE[] = "PASSMAN_PASSWORD";
+
+const qint64 MIN_RECORDS = 1;
+const qint64 MAX_RECORDS = 10000000;
+
+/*!
+ * \brief Функция разбирает диапазон вида "min:max"
+ */
+static bool parseRange(const QString &text, int *min, int *max)
+{
+    const QStringList parts = text.split( ':' );
+    if( parts.size() != 2 )
+        return false;
+    bool okMin = false;
+    bool okMax = false;
+    *min = parts.at(0).toInt( &okMin );
+    *max = parts.at(1).toInt( &okMax );
+    return okMin && okMax && *min >= 0 && *min <= *max;
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName( "PasswordManager" );
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(
+                "Generates a synthetic encrypted vault for load testing.\n"
+                "The same options and --seed produce the same records." );
+    parser.addHelpOption();
+    parser.addPositionalArgument( "output", "Vault file to create." );
+
+    QCommandLineOption passwordOption( QStringList() << "p" << "password-file",
+                                       "Read the password from <path> ('-' for stdin)"
+                                       " instead of PASSMAN_PASSWORD.", "path" );
+    QCommandLineOption recordsOption( QStringList() << "n" << "records",
+                                      "Number of records, 1 to 10000000 (default: 1000).", "n" );
+    QCommandLineOption groupsOption( "groups",
+                                     "Number of groups (default: 50).", "n" );
+    QCommandLineOption skewOption( "group-skew",
+                                   "Zipf exponent of group sizes, 0 for uniform (default: 1).", "s" );
+    QCommandLineOption passwordLengthOption( "password-length",
+                                             "Secret length range (default: 8:24).", "min:max" );
+    QCommandLineOption descriptionOption( "description-length",
+                                          "Description length mean and deviation (default: 40:30).",
+                                          "mean:stddev" );
+    QCommandLineOption fillOption( "fill-rate",
+                                   "Share of filled optional fields (default: 0.6).", "r" );
+    QCommandLineOption expiredOption( "expired-rate",
+                                      "Share of expired passwords (default: 0.1).", "r" );
+    QCommandLineOption lifeTimeOption( "lifetime-days",
+                                       "Longest password lifetime in days (default: 365).", "n" );
+    QCommandLineOption baseTimeOption( "base-time",
+                                       "Reference \"now\" for dates, ISO 8601"
+                                       " (default: today 00:00 UTC).", "time" );
+    QCommandLineOption seedOption( "seed",
+                                   "Random seed (default: 42).", "n" );
+    QCommandLineOption forceOption( QStringList() << "f" << "force",
+                                    "Overwrite an existing output file." );
+    parser.addOption( passwordOption );
+    parser.addOption( recordsOption );
+    parser.addOption( groupsOption );
+    parser.addOption( skewOption );
+    parser.addOption( passwordLengthOption );
+    parser.addOption( descriptionOption );
+    parser.addOption( fillOption );
+    parser.addOption( expiredOption );
+    parser.addOption( lifeTimeOption );
+    parser.addOption( baseTimeOption );
+    parser.addOption( seedOption );
+    parser.addOption( forceOption );
+    parser.process( app );
+
+    QTextStream err( stderr );
+    const QStringList args = parser.positionalArguments();
+    if( args.size() != 1 ){
+        err << parser.helpText();
+        return 2;
+    }
+    const QString output = args.first();
+
+    VaultGenerator::Options options;
+    bool ok = true;
+    if( parser.isSet(recordsOption) ){
+        options.records = parser.value( recordsOption ).toLongLong( &ok );
+        ok = ok && options.records >= MIN_RECORDS && options.records <= MAX_RECORDS;
+    }
+    if( ok && parser.isSet(groupsOption) ){
+        options.groups = parser.value( groupsOption ).toInt( &ok );
+        ok = ok && options.groups > 0;
+    }
+    if( ok && parser.isSet(skewOption) ){
+        options.groupSkew = parser.value( skewOption ).toDouble( &ok );
+        ok = ok && options.groupSkew >= 0;
+    }
+    if( ok && parser.isSet(passwordLengthOption) ){
+        ok = parseRange( parser.value(passwordLengthOption), &options.passwordMin, &options.passwordMax )
+                && options.passwordMin > 0;
+    }
+    if( ok && parser.isSet(descriptionOption) ){
+        const QStringList parts = parser.value( descriptionOption ).split( ':' );
+        bool okStdDev = false;
+        ok = parts.size() == 2;
+        if( ok ){
+            options.descriptionMean   = parts.at(0).toDouble( &ok );
+            options.descriptionStdDev = parts.at(1).toDouble( &okStdDev );
+            ok = ok && okStdDev && options.descriptionMean >= 0 && options.descriptionStdDev >= 0;
+        }
+    }
+    if( ok && parser.isSet(fillOption) ){
+        options.fillRate = parser.value( fillOption ).toDouble( &ok );
+        ok = ok && options.fillRate >= 0 && options.fillRate <= 1;
+    }
+    if( ok && parser.isSet(expiredOption) ){
+        options.expiredRate = parser.value( expiredOption ).toDouble( &ok );
+        ok = ok && options.expiredRate >= 0 && options.expiredRate <= 1;
+    }
+    if( ok && parser.isSet(lifeTimeOption) ){
+        options.lifeTimeDays = parser.value( lifeTimeOption ).toInt( &ok );
+        ok = ok && options.lifeTimeDays > 0;
+    }
+    if( ok && parser.isSet(seedOption) ){
+        options.seed = parser.value( seedOption ).toUInt( &ok );
+    }
+
+    QDateTime baseTime( QDate::currentDate(), QTime(0, 0), Qt::UTC );
+    if( ok && parser.isSet(baseTimeOption) ){
+        baseTime = QDateTime::fromString( parser.value(baseTimeOption), Qt::ISODate );
+        ok = baseTime.isValid();
+    }
+    options.baseTime = baseTime.toMSecsSinceEpoch();
+
+    if( ! ok ){
+        err << "Invalid option value\n\n" << parser.helpText();
+        return 2;
+    }
+
+    QString password;
+    if( ! VaultKey::readPassword(parser.value(passwordOption), PASSWORD_VARIABLE, &password) ){
+        err << "Password is not set: use --password-file or " << PASSWORD_VARIABLE << endl;
+        return 2;
+    }
+
+    if( QFileInfo::exists(output) ){
+        if( ! parser.isSet(forceOption) || ! QFile::remove(output) ){
+            err << output << " already exists, use --force to overwrite" << endl;
+            return 1;
+        }
+    }
+
+    Vault vault;
+    if( ! vault.create(output, VaultKey::passwordHash(password), VaultKey::salt(password)) ){
+        err << "Cannot create " << output << endl;
+        return 1;
+    }
+
+    TransferStats stats;
+    VaultGenerator generator( options );
+    if( ! generator.generate(&stats) ){
+        vault.close();
+        return 1;
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+    if( ! vault.save() ){
+        err << "Cannot save " << output << endl;
+        return 1;
+    }
+    const qint64 saveTime = timer.elapsed();
+    vault.close();
+
+    err << "Generated: " << stats.summary() << "\n"
+        << "Encrypted: " << QFileInfo(output).size() << " bytes in " << saveTime << " ms\n"
+        << "Base time: " << baseTime.toString(Qt::ISODate) << ", seed: " << options.seed << endl;
+    return 0;
+}
@@ -0,0 +1,19 @@
+#-------------------------------------------------
+#
+# Synthetic vault generator for load testing
+#
+#-------------------------------------------------
+
+QT       -= gui
+
+TARGET = vaultgen
+TEMPLATE = app
+CONFIG += console
+CONFIG -= app_bundle
+
+include(../../core.pri)
+
+SOURCES += main.cpp \
+    vaultgenerator.cpp
+
+HEADERS  += vaultgenerator.h
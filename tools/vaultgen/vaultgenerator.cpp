@@ -0,0 +1,143 @@
+#include "vaultgenerator.h"
+#include "passwordgenerator.h"
+#include "Data/recordtable.h"
+#include "db/querysmanager.h"
+#include "io/transferstats.h"
+
+#include <QSqlDatabase>
+#include <QVector>
+#include <QDebug>
+
+#include <cmath>
+
+namespace {
+    const char *SYLLABLES[] = {
+        "ka", "lo", "mi", "ne", "ro", "su", "ta", "vi", "do", "be",
+        "ra", "zo", "pe", "li", "mu", "sa", "te", "no", "gi", "fa"
+    };
+    const int SYLLABLE_COUNT = sizeof(SYLLABLES) / sizeof(SYLLABLES[0]);
+
+    const char *DOMAINS[] = { "com", "org", "net", "ru", "io", "dev" };
+    const int DOMAIN_COUNT = sizeof(DOMAINS) / sizeof(DOMAINS[0]);
+
+    const qint64 DAY = 24LL * 60 * 60 * 1000;
+    const int    CREATED_WITHIN_DAYS = 3 * 365;
+}
+
+VaultGenerator::VaultGenerator(const Options &options) :
+    _options(options),
+    _random(options.seed),
+    _passwordRandom(QByteArray::number(options.seed))
+{
+    // Вес группы i пропорционален 1 / (i + 1)^skew
+    QVector<double> weights;
+    for( int i = 0; i < _options.groups; ++i ){
+        weights << 1.0 / std::pow( i + 1.0, _options.groupSkew );
+        _groupNames << word( 2 + i % 3 ) + " " + QString::number( i + 1 );
+    }
+    _groupDistribution = std::discrete_distribution<int>( weights.begin(), weights.end() );
+
+    if( _options.passwordTypes == 0 )
+        _options.passwordTypes = PasswordGenerator::Upper | PasswordGenerator::Lower
+                               | PasswordGenerator::Numbers | PasswordGenerator::Special
+                               | PasswordGenerator::Minus | PasswordGenerator::Underline;
+}
+
+/*!
+ * \brief Метод генерирует записи в текущую базу
+ * \param stats - число записей и время
+ * \return false - если вставка порции не удалась
+ */
+bool VaultGenerator::generate(TransferStats *stats)
+{
+    stats->start();
+
+    RecordTable batch;
+    batch.reserve( BATCH_SIZE );
+    QSqlDatabase db = QSqlDatabase::database();
+    for( qint64 index = 0; index < _options.records; ++index ){
+        append( &batch, index );
+        if( batch.size() < BATCH_SIZE && index + 1 < _options.records )
+            continue;
+
+        db.transaction();
+        if( ! QuerysManager::insert(batch) || ! db.commit() ){
+            db.rollback();
+            qCritical() << "Cannot insert generated records";
+            stats->finish();
+            return false;
+        }
+        stats->addRecords( batch.size() );
+        batch.clearRows();
+    }
+
+    stats->finish();
+    return true;
+}
+
+void VaultGenerator::append(RecordTable *batch, qint64 index)
+{
+    QString texts[RecordTable::TextFieldCount];
+
+    const QString name  = word( uniform(2, 4) );
+    const QString login = word( uniform(2, 3) ) + QString::number( index );
+    texts[RecordTable::Resource] = name;
+    texts[RecordTable::Url]      = chance( _options.fillRate )
+            ? "https://" + name + "." + DOMAINS[uniform(0, DOMAIN_COUNT - 1)] + "/login"
+            : QString();
+    texts[RecordTable::Login]    = login;
+    texts[RecordTable::Password] = PasswordGenerator::getPassword( _options.passwordTypes,
+                                                                  uniform(_options.passwordMin, _options.passwordMax),
+                                                                  _passwordRandom );
+    texts[RecordTable::Mail]     = chance( _options.fillRate )
+            ? login + "@" + word(2) + "." + DOMAINS[uniform(0, DOMAIN_COUNT - 1)]
+            : QString();
+    texts[RecordTable::Phone]    = chance( _options.fillRate / 2 )
+            ? "+7" + QString::number( uniform(900000000, 999999999) )
+            : QString();
+    texts[RecordTable::Answer]   = chance( _options.fillRate / 2 ) ? word( uniform(2, 4) ) : QString();
+
+    std::normal_distribution<double> descriptionLength( _options.descriptionMean, _options.descriptionStdDev );
+    texts[RecordTable::Description] = text( qMax(0, int(descriptionLength(_random))) );
+
+    const qint64 createTime = _options.baseTime - uniform( 0, CREATED_WITHIN_DAYS ) * DAY
+            - uniform( 0, int(DAY / 1000) ) * 1000LL;
+    const qint64 lifeTime = uniform( 1, _options.lifeTimeDays ) * DAY;
+    const qint64 passLifeTime = chance( _options.expiredRate )
+            ? _options.baseTime - lifeTime / 2
+            : _options.baseTime + lifeTime;
+
+    batch->append( 0, _groupNames.at(_groupDistribution(_random)), texts, createTime, passLifeTime );
+}
+
+QString VaultGenerator::word(int syllables)
+{
+    QString result;
+    for( int i = 0; i < syllables; ++i )
+        result += SYLLABLES[uniform(0, SYLLABLE_COUNT - 1)];
+    return result;
+}
+
+/*!
+ * \brief Метод составляет текст из слов длиной около length символов
+ */
+QString VaultGenerator::text(int length)
+{
+    QString result;
+    while( result.length() < length ){
+        if( ! result.isEmpty() )
+            result += ' ';
+        result += word( uniform(1, 4) );
+    }
+    return result.left( length );
+}
+
+bool VaultGenerator::chance(double probability)
+{
+    return std::generate_canonical<double, 32>( _random ) < probability;
+}
+
+int VaultGenerator::uniform(int min, int max)
+{
+    return std::uniform_int_distribution<int>( min, max )( _random );
+}
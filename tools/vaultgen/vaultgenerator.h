@@ -0,0 +1,61 @@
+#ifndef VAULTGENERATOR_H
+#define VAULTGENERATOR_H
+
+#include <QString>
+#include <QStringList>
+
+#include <random>
+
+#include "securerandom.h"
+
+class RecordTable;
+class TransferStats;
+
+/*!
+ * \brief Класс VaultGenerator - генератор записей синтетического хранилища
+ *
+ * Все значения выводятся из одного зерна: генератор std::mt19937 для полей
+ * и воспроизводимый SecureRandom для PasswordGenerator, поэтому при тех же параметрах
+ * получаются те же записи. Записи вставляются в открытую базу порциями
+ * по BATCH_SIZE в отдельных транзакциях.
+ */
+class VaultGenerator
+{
+public:
+    struct Options {
+        qint64  records        = 1000;
+        int     groups         = 50;
+        double  groupSkew      = 1.0;    ///< Показатель Ципфа, 0 - группы равновероятны
+        int     passwordMin    = 8;
+        int     passwordMax    = 24;
+        int     passwordTypes  = 0;      ///< PasswordGenerator::CharType, 0 - все типы
+        double  descriptionMean   = 40;  ///< Длина описания, нормальное распределение
+        double  descriptionStdDev = 30;
+        double  fillRate       = 0.6;    ///< Доля заполненных необязательных полей
+        double  expiredRate    = 0.1;    ///< Доля просроченных паролей
+        int     lifeTimeDays   = 365;    ///< Наибольший срок жизни пароля
+        qint64  baseTime       = 0;      ///< "Сейчас" для дат, мс от начала эпохи
+        quint32 seed           = 42;
+    };
+
+    static const int BATCH_SIZE = 10000;
+
+    explicit VaultGenerator(const Options &options);
+
+    bool generate(TransferStats *stats);
+
+private:
+    Options                             _options;
+    std::mt19937                        _random;
+    SecureRandom                        _passwordRandom;
+    std::discrete_distribution<int>     _groupDistribution;
+    QStringList                         _groupNames;
+
+    void append(RecordTable *batch, qint64 index);
+    QString word(int syllables);
+    QString text(int length);
+    bool chance(double probability);
+    int uniform(int min, int max);
+};
+
+#endif // VAULTGENERATOR_H
@@ -0,0 +1,24 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+/*!
+ * \file trace.h
+ * \brief Макрос TRACE_SCOPE - замер времени до конца текущей области видимости
+ *
+ * Имя замера - строковый литерал вида "категория.операция".
+ * Без PASSMAN_TRACING (qmake CONFIG+=tracing) макрос раскрывается в пустую
+ * инструкцию и ничего не стоит. С ним замеры копятся в Tracer и при выходе
+ * из программы записываются в DefinesPath::log() в формате Chrome trace
+ * (chrome://tracing, Perfetto).
+ */
+
+#ifdef PASSMAN_TRACING
+#  include "trace/tracer.h"
+#  define TRACE_CONCAT_(a, b) a##b
+#  define TRACE_CONCAT(a, b) TRACE_CONCAT_(a, b)
+#  define TRACE_SCOPE(name) ScopedTrace TRACE_CONCAT(_scopedTrace, __LINE__)(name)
+#else
+#  define TRACE_SCOPE(name) ((void)0)
+#endif
+
+#endif // TRACE_H
@@ -0,0 +1,126 @@
+#include "trace/tracer.h"
+#include "definespath.h"
+
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QHash>
+#include <QThread>
+#include <QDebug>
+
+#include <string.h>
+
+Tracer::Tracer()
+{
+    _clock.start();
+    qAddPostRoutine( writeOnExit );
+}
+
+Tracer *Tracer::instance()
+{
+    static Tracer tracer;
+    return &tracer;
+}
+
+/*!
+ * \brief Метод возвращает время от запуска в наносекундах
+ */
+qint64 Tracer::now() const
+{
+    return _clock.nsecsElapsed();
+}
+
+void Tracer::record(const char *name, qint64 start, qint64 duration)
+{
+    Event event;
+    event.name     = name;
+    event.start    = start;
+    event.duration = duration;
+    event.thread   = reinterpret_cast<quintptr>( QThread::currentThreadId() );
+
+    QMutexLocker locker( &_mutex );
+    if( _events.size() >= MAX_EVENTS ){
+        ++_dropped;
+        return;
+    }
+    _events.append( event );
+}
+
+/*!
+ * \brief Метод записывает замеры в формате Chrome trace event
+ * Каждый замер - событие "X" (complete) с временем в микросекундах;
+ * категория - часть имени до первой точки
+ */
+bool Tracer::write(const QString &fileName) const
+{
+    QMutexLocker locker( &_mutex );
+    if( _events.isEmpty() )
+        return true;
+
+    QFile file( fileName );
+    if( ! file.open(QIODevice::WriteOnly | QIODevice::Truncate) ){
+        qWarning() << "Cannot write trace" << fileName;
+        return false;
+    }
+
+    const QByteArray pid = QByteArray::number( QCoreApplication::applicationPid() );
+    QHash<quintptr, int> threads;
+    QByteArray out;
+    out.reserve( 1 << 20 );
+    out += "{\"traceEvents\":[\n";
+    for( int i = 0; i < _events.size(); ++i ){
+        const Event &event = _events.at(i);
+        const int thread = threads.value( event.thread, threads.size() + 1 );
+        threads.insert( event.thread, thread );
+
+        const char *dot = strchr( event.name, '.' );
+        const QByteArray category = dot ? QByteArray(event.name, int(dot - event.name))
+                                        : QByteArray(event.name);
+        out += "{\"name\":\"";
+        out += event.name;
+        out += "\",\"cat\":\"";
+        out += category;
+        out += "\",\"ph\":\"X\",\"ts\":";
+        out += QByteArray::number( event.start / 1000.0, 'f', 3 );
+        out += ",\"dur\":";
+        out += QByteArray::number( event.duration / 1000.0, 'f', 3 );
+        out += ",\"pid\":";
+        out += pid;
+        out += ",\"tid\":";
+        out += QByteArray::number( thread );
+        out += ( i + 1 < _events.size() ) ? "},\n" : "}\n";
+
+        if( out.size() > (1 << 20) ){
+            file.write( out );
+            out.clear();
+        }
+    }
+    out += "],\"displayTimeUnit\":\"ms\",\"otherData\":{\"dropped\":";
+    out += QByteArray::number( _dropped );
+    out += "}}\n";
+    file.write( out );
+    return file.error() == QFile::NoError;
+}
+
+/*!
+ * \brief Метод возвращает имя файла для записи замеров
+ */
+QString Tracer::defaultFileName()
+{
+    const QString fileName = QString::fromLocal8Bit( qgetenv("PASSMAN_TRACE_FILE") );
+    if( ! fileName.isEmpty() )
+        return fileName;
+
+    return DefinesPath::log() + "trace-"
+            + QDateTime::currentDateTime().toString( "yyyyMMdd-hhmmss" ) + "-"
+            + QString::number( QCoreApplication::applicationPid() ) + ".json";
+}
+
+void Tracer::writeOnExit()
+{
+    const QString fileName = defaultFileName();
+    QDir().mkpath( QFileInfo(fileName).absolutePath() );
+    instance()->write( fileName );
+}
@@ -0,0 +1,68 @@
+#ifndef TRACER_H
+#define TRACER_H
+
+#include <QElapsedTimer>
+#include <QMutex>
+#include <QString>
+#include <QVector>
+
+/*!
+ * \brief Класс Tracer - накопитель замеров TRACE_SCOPE
+ *
+ * Замер - имя, начало и длительность в наносекундах от запуска и поток.
+ * Хранится не более MAX_EVENTS замеров, остальные отбрасываются.
+ * При завершении QCoreApplication замеры записываются в файл
+ * DefinesPath::log()/trace-<время>-<pid>.json или в файл из переменной
+ * окружения PASSMAN_TRACE_FILE.
+ */
+class Tracer
+{
+private:
+    struct Event {
+        const char *name;
+        qint64      start;
+        qint64      duration;
+        quintptr    thread;
+    };
+
+    QElapsedTimer   _clock;
+    mutable QMutex  _mutex;
+    QVector<Event>  _events;
+    qint64          _dropped = 0;
+
+    Tracer();
+    static void writeOnExit();
+public:
+    static const int MAX_EVENTS = 1 << 20;
+
+    static Tracer *instance();
+
+    qint64 now() const;
+    void record(const char *name, qint64 start, qint64 duration);
+    bool write(const QString &fileName) const;
+    static QString defaultFileName();
+};
+
+/*!
+ * \brief Класс ScopedTrace - замер от создания до уничтожения объекта
+ * Используется через макрос TRACE_SCOPE
+ */
+class ScopedTrace
+{
+private:
+    const char *_name;
+    qint64      _start;
+public:
+    explicit ScopedTrace(const char *name) :
+        _name(name),
+        _start(Tracer::instance()->now())
+    {
+    }
+    ~ScopedTrace()
+    {
+        Tracer *tracer = Tracer::instance();
+        tracer->record( _name, _start, tracer->now() - _start );
+    }
+};
+
+#endif // TRACER_H
@@ -0,0 +1,164 @@
+#include "vault.h"
+#include "dbfileprocessing.h"
+#include "db/querysmanager.h"
+#include "metrics/metrics.h"
+#include "trace/trace.h"
+
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QStandardPaths>
+#include <QDebug>
+
+Vault::Vault(int bufferSize) :
+    _bufferSize(bufferSize)
+{
+}
+
+Vault::~Vault()
+{
+    close();
+}
+
+/*!
+ * \brief Метод открывает зашифрованный файл
+ * \param path - путь к зашифрованному файлу
+ * \param passwordHash - хэш пароля (VaultKey::passwordHash)
+ * \param salt - соль (VaultKey::salt)
+ * \return true - если файл расшифрован и база готова к работе
+ */
+bool Vault::open(const QString &path, const QByteArray &passwordHash, const QByteArray &salt)
+{
+    TRACE_SCOPE( "vault.open" );
+    ScopedLatency latency( Metrics::Unlock );
+    close();
+
+    _path         = path;
+    _tmpPath      = temporaryPath();
+    _passwordHash = passwordHash;
+    _salt         = salt;
+    _file = new DbFileProcessing( _tmpPath, _path, _passwordHash, _salt, _bufferSize );
+
+    if( ! _file->openEncryptFile() ){
+        qCritical() << "Cannot open encrypted file" << path;
+        close();
+        return false;
+    }
+    return connect();
+}
+
+/*!
+ * \brief Метод создаёт новый пустой зашифрованный файл и открывает его
+ * \return true - в случае успеха
+ */
+bool Vault::create(const QString &path, const QByteArray &passwordHash, const QByteArray &salt)
+{
+    close();
+
+    QFile file( path );
+    if( ! file.open(QIODevice::WriteOnly) ){
+        qCritical() << "Cannot create file" << path;
+        return false;
+    }
+    file.close();
+
+    _path         = path;
+    _tmpPath      = temporaryPath();
+    _passwordHash = passwordHash;
+    _salt         = salt;
+    _file = new DbFileProcessing( _tmpPath, _path, _passwordHash, _salt, _bufferSize );
+
+    return connect() && save();
+}
+
+bool Vault::connect()
+{
+    if( ! _db.open(_tmpPath) || ! QuerysManager::createTables() ){
+        qCritical() << "Cannot open database of" << _path;
+        close();
+        return false;
+    }
+    return true;
+}
+
+/*!
+ * \brief Метод шифрует базу обратно в файл
+ * Соединение на время записи закрывается, чтобы файл базы был целостным
+ */
+bool Vault::save()
+{
+    TRACE_SCOPE( "vault.save" );
+    if( _file == nullptr )
+        return false;
+
+    _db.close();
+    bool success = _file->saveEncryptFile();
+    if( ! _db.open(_tmpPath) )
+        return false;
+    return success;
+}
+
+/*!
+ * \brief Метод сохраняет изменения и перешифровывает файл новым ключом
+ * \sa VaultRekey
+ * \return true - в случае успеха
+ */
+bool Vault::rekey(const VaultRekey::Key &key)
+{
+    if( _file == nullptr || ! save() )
+        return false;
+
+    if( ! VaultRekey::rekey(_path, _passwordHash, _salt, key) )
+        return false;
+
+    delete _file;
+    _passwordHash = key.password;
+    _salt         = key.salt;
+    _file = new DbFileProcessing( _tmpPath, _path, _passwordHash, _salt, _bufferSize );
+    _file->setKeyLength( key.keyLength );
+    _file->setNumRounds( key.numRounds );
+    return true;
+}
+
+/*!
+ * \brief Метод закрывает файл без сохранения и удаляет расшифрованную копию
+ */
+void Vault::close()
+{
+    _db.close();
+    _db.remove();
+
+    delete _file;
+    _file = nullptr;
+    _tmpPath.clear();
+}
+
+bool Vault::isOpen()
+{
+    return _file != nullptr && _db.isOpen();
+}
+
+QString Vault::path() const
+{
+    return _path;
+}
+
+QByteArray Vault::passwordHash() const
+{
+    return _passwordHash;
+}
+
+QByteArray Vault::salt() const
+{
+    return _salt;
+}
+
+/*!
+ * \brief Метод возвращает путь для временной расшифрованной базы
+ */
+QString Vault::temporaryPath()
+{
+    return QStandardPaths::writableLocation( QStandardPaths::TempLocation )
+            + QDir::separator()
+            + QString::number( QDateTime::currentMSecsSinceEpoch() );
+}
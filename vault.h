@@ -0,0 +1,52 @@
+#ifndef VAULT_H
+#define VAULT_H
+
+#include "db/connectionmanager.h"
+#include "vaultrekey.h"
+
+#include <QByteArray>
+#include <QString>
+
+class DbFileProcessing;
+
+/*!
+ * \brief Класс Vault - открытый зашифрованный файл паролей без интерфейса
+ *
+ * Расшифровывает файл во временную базу SQLite через DbFileProcessing,
+ * подключается к ней через ConnectionManager и создаёт таблицы.
+ * save() шифрует базу обратно, close() удаляет расшифрованную копию.
+ * Используется командной строкой; окно приложения ведёт те же шаги само.
+ */
+class Vault
+{
+private:
+    ConnectionManager _db;
+    DbFileProcessing *_file = nullptr;
+    QString           _path;
+    QString           _tmpPath;
+    QByteArray        _passwordHash;
+    QByteArray        _salt;
+    int               _bufferSize;
+
+    bool connect();
+public:
+    static const int DEFAULT_BUFFER_SIZE = 51200;
+
+    explicit Vault(int bufferSize = DEFAULT_BUFFER_SIZE);
+    ~Vault();
+
+    bool open(const QString &path, const QByteArray &passwordHash, const QByteArray &salt);
+    bool create(const QString &path, const QByteArray &passwordHash, const QByteArray &salt);
+    bool save();
+    bool rekey(const VaultRekey::Key &key);
+    void close();
+
+    bool isOpen();
+    QString path() const;
+    QByteArray passwordHash() const;
+    QByteArray salt() const;
+
+    static QString temporaryPath();
+};
+
+#endif // VAULT_H
@@ -0,0 +1,83 @@
+#include "vaultkey.h"
+#include "trace/trace.h"
+
+#include <QCryptographicHash>
+#include <QFile>
+#include <QSettings>
+
+const QString VaultKey::HASH_CYCLES_OPTION("PasswordHashCycles");
+
+/*!
+ * \brief Метод возвращает число циклов хэширования из настроек
+ * \return значение из QSettings, DEFAULT_HASH_CYCLES - если оно не задано или неверно
+ */
+int VaultKey::hashCycles()
+{
+    QSettings cfg;
+    bool ok = false;
+    int cycles = cfg.value( HASH_CYCLES_OPTION, DEFAULT_HASH_CYCLES ).toInt( &ok );
+    if( (! ok) || (cycles < 1) )
+        cycles = DEFAULT_HASH_CYCLES;
+    return cycles;
+}
+
+/*!
+ * \brief Метод вычисляет хэш пароля, которым шифруется файл
+ * \param password - пароль пользователя
+ * \param hashCycles - число циклов хэширования
+ */
+QByteArray VaultKey::passwordHash(const QString &password, int hashCycles)
+{
+    TRACE_SCOPE( "key.hash" );
+    QByteArray passwordHash = password.toUtf8();
+    for( int i = 0; i < hashCycles; ++i ){
+        passwordHash = QCryptographicHash::hash( passwordHash, QCryptographicHash::Md5 );
+    }
+    return passwordHash;
+}
+
+/*!
+ * \brief Метод вычисляет хэш пароля с числом циклов из настроек
+ */
+QByteArray VaultKey::passwordHash(const QString &password)
+{
+    return passwordHash( password, hashCycles() );
+}
+
+/*!
+ * \brief Метод вычисляет соль шифрования для пароля
+ */
+QByteArray VaultKey::salt(const QString &password)
+{
+    return password.toUtf8().toHex();
+}
+
+/*!
+ * \brief Метод читает пароль из файла, stdin ("-") или переменной окружения
+ * Для консольных программ: пароль в аргументах командной строки не принимается,
+ * его видно в списке процессов
+ * \param fileName - файл с паролем в первой строке, пусто - переменная окружения
+ * \param variable - имя переменной окружения
+ * \return false - если пароль не задан или файл не читается
+ */
+bool VaultKey::readPassword(const QString &fileName, const char *variable, QString *password)
+{
+    if( fileName.isEmpty() ){
+        if( ! qEnvironmentVariableIsSet(variable) )
+            return false;
+        *password = QString::fromLocal8Bit( qgetenv(variable) );
+        return true;
+    }
+
+    QFile file( fileName );
+    bool opened = (fileName == "-")
+            ? file.open( stdin, QIODevice::ReadOnly )
+            : file.open( QIODevice::ReadOnly );
+    if( ! opened )
+        return false;
+
+    *password = QString::fromUtf8( file.readLine() );
+    while( password->endsWith('\n') || password->endsWith('\r') )
+        password->chop( 1 );
+    return true;
+}
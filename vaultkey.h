@@ -0,0 +1,26 @@
+#ifndef VAULTKEY_H
+#define VAULTKEY_H
+
+#include <QByteArray>
+#include <QString>
+
+/*!
+ * \brief Статический класс VaultKey получает ключ шифрования файла из пароля
+ *
+ * Общий для графического интерфейса и командной строки, чтобы файл,
+ * созданный в одном, открывался в другом.
+ */
+class VaultKey
+{
+public:
+    static const int DEFAULT_HASH_CYCLES = 3;
+    static const QString HASH_CYCLES_OPTION;
+
+    static int hashCycles();
+    static QByteArray passwordHash(const QString &password, int hashCycles);
+    static QByteArray passwordHash(const QString &password);
+    static QByteArray salt(const QString &password);
+    static bool readPassword(const QString &fileName, const char *variable, QString *password);
+};
+
+#endif // VAULTKEY_H
@@ -0,0 +1,154 @@
+#include "vaultrekey.h"
+
+#include <QFile>
+#include <QSaveFile>
+#include <QThread>
+#include <QVector>
+#include <QtConcurrent>
+#include <QtEndian>
+#include <QDebug>
+
+#include <openssl/evp.h>
+
+#include <string.h>
+
+namespace {
+
+/// Ключ CTR, для которого гамма вычисляется по смещению в файле
+struct CtrCipher
+{
+    AES_KEY       key;
+    unsigned char iv[EVP_MAX_IV_LENGTH];
+
+    bool init(const QByteArray &password, const QByteArray &salt,
+              CryptFileDevice::AesKeyLength keyLength, int numRounds)
+    {
+        return CryptFileDevice::deriveKey( password, salt, keyLength, numRounds, &key, iv );
+    }
+
+    /// Счётчик устроен так же, как в CryptFileDevice::initCtr()
+    void apply(qint64 offset, char *data, qint64 length) const
+    {
+        const int prefix = AES_BLOCK_SIZE - sizeof(qint64);
+        CtrState state;
+        qint64 block = offset / AES_BLOCK_SIZE;
+        state.num = offset % AES_BLOCK_SIZE;
+        memset( state.ecount, 0, sizeof(state.ecount) );
+        memcpy( state.ivec, iv, prefix );
+
+        qint64 counter = qToBigEndian( block );
+        memcpy( state.ivec + prefix, &counter, sizeof(counter) );
+        if( state.num > 0 ){
+            AES_encrypt( state.ivec, state.ecount, &key );
+            counter = qToBigEndian( block + 1 );
+            memcpy( state.ivec + prefix, &counter, sizeof(counter) );
+        }
+
+        unsigned char *bytes = reinterpret_cast<unsigned char*>( data );
+        AES_ctr128_encrypt( bytes, bytes, size_t(length), &key,
+                            state.ivec, state.ecount, &state.num );
+    }
+};
+
+struct Chunk
+{
+    qint64     offset;   ///< Смещение от конца заголовка
+    QByteArray data;
+};
+
+}
+
+/*!
+ * \brief Метод перешифровывает файл
+ * \param fileName - зашифрованный файл
+ * \param password, salt - текущий ключ; параметры шифра читаются из заголовка
+ * \param newKey - новый ключ и параметры шифра
+ * \return true - если файл заменён перешифрованным
+ */
+bool VaultRekey::rekey(const QString &fileName,
+                       const QByteArray &password,
+                       const QByteArray &salt,
+                       const Key &newKey)
+{
+    CryptFileDevice::Header header;
+    if( ! CryptFileDevice::readHeader(fileName, &header) ){
+        qCritical() << "[VaultRekey::rekey()] not an encrypted file:" << fileName;
+        return false;
+    }
+
+    QFile source( fileName );
+    if( ! source.open(QIODevice::ReadOnly) ){
+        qCritical() << "[VaultRekey::rekey()] cannot open" << fileName;
+        return false;
+    }
+
+    // Заголовок хранит хэши пароля и соли: сверяем всё, кроме версии
+    const QByteArray sourceHeader = source.read( CryptFileDevice::headerLength() );
+    const QByteArray expected = CryptFileDevice::makeHeader( password, salt, header.keyLength, header.numRounds );
+    if( sourceHeader.mid(2) != expected.mid(2) ){
+        qCritical() << "[VaultRekey::rekey()] wrong password for" << fileName;
+        return false;
+    }
+
+    CtrCipher oldCipher;
+    CtrCipher newCipher;
+    if( ! oldCipher.init(password, salt, header.keyLength, header.numRounds)
+            || ! newCipher.init(newKey.password, newKey.salt, newKey.keyLength, newKey.numRounds) ){
+        qCritical() << "[VaultRekey::rekey()] cannot derive keys";
+        return false;
+    }
+
+    QSaveFile target( fileName );
+    if( ! target.open(QIODevice::WriteOnly) ){
+        qCritical() << "[VaultRekey::rekey()] cannot write" << fileName << target.errorString();
+        return false;
+    }
+    target.write( CryptFileDevice::makeHeader(newKey.password, newKey.salt,
+                                              newKey.keyLength, newKey.numRounds) );
+
+    auto recrypt = [&oldCipher, &newCipher](Chunk &chunk){
+        oldCipher.apply( chunk.offset, chunk.data.data(), chunk.data.size() );
+        newCipher.apply( chunk.offset, chunk.data.data(), chunk.data.size() );
+    };
+    const int batchSize = qMax( 2, QThread::idealThreadCount() * 2 );
+    qint64 offset = 0;
+    auto readBatch = [&source, &offset, batchSize](QVector<Chunk> *batch){
+        batch->clear();
+        while( batch->size() < batchSize ){
+            Chunk chunk;
+            chunk.offset = offset;
+            chunk.data   = source.read( CHUNK_SIZE );
+            if( chunk.data.isEmpty() )
+                break;
+            offset += chunk.data.size();
+            batch->append( chunk );
+        }
+    };
+
+    // Пока шифруется текущая порция, читается следующая
+    QVector<Chunk> current;
+    QVector<Chunk> next;
+    readBatch( &current );
+    bool success = true;
+    while( ! current.isEmpty() && success ){
+        QFuture<void> future = QtConcurrent::map( current, recrypt );
+        readBatch( &next );
+        future.waitForFinished();
+
+        for( const Chunk &chunk : current ){
+            if( target.write(chunk.data) != chunk.data.size() ){
+                success = false;
+                break;
+            }
+        }
+        current.swap( next );
+    }
+
+    if( ! success || source.error() != QFile::NoError ){
+        qCritical() << "[VaultRekey::rekey()] i/o error:" << source.errorString() << target.errorString();
+        target.cancelWriting();
+        return false;
+    }
+    source.close();
+    return target.commit();
+}
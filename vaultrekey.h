@@ -0,0 +1,40 @@
+#ifndef VAULTREKEY_H
+#define VAULTREKEY_H
+
+#include "cryptfiledevice.h"
+
+#include <QByteArray>
+#include <QString>
+
+/*!
+ * \brief Статический класс VaultRekey перешифровывает файл новым ключом
+ *
+ * Файл читается блоками, каждый блок расшифровывается старым ключом
+ * и сразу шифруется новым на месте, поэтому открытый текст не попадает
+ * на диск и не остаётся в памяти. Режим CTR позволяет обрабатывать блоки
+ * независимо, так что они шифруются параллельно, пока читается следующая
+ * порция. Результат записывается через QSaveFile и заменяет исходный
+ * файл только целиком. Новый заголовок получает текущую версию формата.
+ */
+class VaultRekey
+{
+public:
+    struct Key {
+        QByteArray password;
+        QByteArray salt;
+        CryptFileDevice::AesKeyLength keyLength = CryptFileDevice::kAesKeyLength256;
+        int numRounds = 5;
+    };
+
+    static const int CHUNK_SIZE = 1024 * 1024;   ///< Кратен AES_BLOCK_SIZE
+
+    static bool rekey(const QString &fileName,
+                      const QByteArray &password,
+                      const QByteArray &salt,
+                      const Key &newKey);
+private:
+    VaultRekey();
+    ~VaultRekey();
+};
+
+#endif // VAULTREKEY_H
@@ -0,0 +1,134 @@
+#include "wordlist.h"
+#include "definespath.h"
+
+#include <QFileInfo>
+#include <QHash>
+#include <QMutex>
+#include <QDebug>
+
+#include <cmath>
+#include <cstring>
+
+const char Wordlist::RESOURCE_PREFIX[] = ":/wordlists/";
+
+Wordlist::Wordlist()
+{
+}
+
+Wordlist::~Wordlist()
+{
+}
+
+/*!
+ * \brief Метод открывает список и строит индекс слов
+ * Пустые строки и строки с '#' пропускаются
+ * \return false - если файл не открылся или в нём нет слов
+ */
+bool Wordlist::open(const QString &fileName)
+{
+    _file.setFileName( fileName );
+    if( ! _file.open(QIODevice::ReadOnly) ){
+        qWarning() << "Cannot open wordlist" << fileName << _file.errorString();
+        return false;
+    }
+
+    qint64 size = _file.size();
+    _text = reinterpret_cast<const char*>( _file.map(0, size) );
+    if( _text == nullptr ){
+        // Сжатый ресурс не отображается - читается один раз
+        _copy = _file.readAll();
+        _text = _copy.constData();
+        size  = _copy.size();
+    }
+
+    const char *const end = _text + size;
+    for( const char *line = _text; line < end; ){
+        const char *lineEnd = static_cast<const char*>( memchr(line, '\n', end - line) );
+        if( lineEnd == nullptr )
+            lineEnd = end;
+
+        const char *wordEnd = lineEnd;
+        while( wordEnd > line && (wordEnd[-1] == '\r' || wordEnd[-1] == ' ') )
+            --wordEnd;
+        const char *word = wordEnd;
+        while( word > line && word[-1] != '\t' )
+            --word;
+
+        const qint64 length = wordEnd - word;
+        if( length > 0 && length <= 255 && *line != '#' ){
+            _starts.append( quint32(word - _text) );
+            _lengths.append( quint8(length) );
+        }
+        line = lineEnd + 1;
+    }
+
+    if( _starts.isEmpty() ){
+        qWarning() << "Wordlist is empty:" << fileName;
+        return false;
+    }
+    return true;
+}
+
+bool Wordlist::isOpen() const
+{
+    return ! _starts.isEmpty();
+}
+
+int Wordlist::count() const
+{
+    return _starts.size();
+}
+
+QString Wordlist::word(int index) const
+{
+    return QString::fromUtf8( _text + _starts.at(index), _lengths.at(index) );
+}
+
+/*!
+ * \brief Метод возвращает энтропию одного слова при равновероятном выборе
+ */
+double Wordlist::bitsPerWord() const
+{
+    return count() > 0 ? std::log2( double(count()) ) : 0;
+}
+
+/*!
+ * \brief Метод возвращает путь к списку языка
+ * \param name - код языка ("en", "ru") или путь к файлу
+ */
+QString Wordlist::languageFile(const QString &name)
+{
+    if( QFileInfo(name).isFile() )
+        return name;
+
+    for( const QString &dir : DefinesPath::share() ){
+        const QString fileName = dir + "wordlists/" + name + ".txt";
+        if( QFileInfo(fileName).isFile() )
+            return fileName;
+    }
+    return RESOURCE_PREFIX + name + ".txt";
+}
+
+/*!
+ * \brief Метод возвращает список слов языка, открывая его при первом обращении
+ * Открытые списки живут до конца работы программы.
+ * \return nullptr - если списка нет
+ */
+const Wordlist *Wordlist::language(const QString &name)
+{
+    static QMutex mutex;
+    static QHash<QString, Wordlist*> lists;
+
+    QMutexLocker locker( &mutex );
+    auto it = lists.constFind( name );
+    if( it != lists.constEnd() )
+        return it.value();
+
+    Wordlist *list = new Wordlist;
+    if( ! list->open(languageFile(name)) ){
+        delete list;
+        list = nullptr;
+    }
+    lists.insert( name, list );
+    return list;
+}
@@ -0,0 +1,47 @@
+#ifndef WORDLIST_H
+#define WORDLIST_H
+
+#include <QByteArray>
+#include <QFile>
+#include <QString>
+#include <QVector>
+
+/*!
+ * \brief Класс Wordlist - список слов для генерации парольных фраз
+ *
+ * Файл - слово на строку; строки вида "11111<Tab>слово" (списки EFF
+ * для игральных костей) тоже понимаются. Файл отображается в память,
+ * в индексе хранятся только начало и длина каждого слова, сами слова
+ * не копируются. Встроенные списки лежат в ресурсах ":/wordlists/"
+ * (en - EFF Large Wordlist, ru - того же размера, по 7776 слов);
+ * файл <имя>.txt в каталоге wordlists/ данных приложения их заменяет.
+ * Списки открываются при первом обращении к language().
+ */
+class Wordlist
+{
+public:
+    static const char RESOURCE_PREFIX[];
+
+    Wordlist();
+    ~Wordlist();
+
+    bool open(const QString &fileName);
+    bool isOpen() const;
+    int count() const;
+    QString word(int index) const;
+    double bitsPerWord() const;
+
+    static const Wordlist *language(const QString &name);
+    static QString languageFile(const QString &name);
+
+private:
+    QFile             _file;
+    QByteArray        _copy;    ///< Содержимое, если файл не отображается
+    const char       *_text = nullptr;
+    QVector<quint32>  _starts;
+    QVector<quint8>   _lengths;
+
+    Q_DISABLE_COPY(Wordlist)
+};
+
+#endif // WORDLIST_H